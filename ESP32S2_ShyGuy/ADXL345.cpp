@@ -29,6 +29,16 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include <Wire.h>
 #include "ADXL345.h"
 
+//===============================================================
+// Interrupt flag, set by the INT pin ISR
+//===============================================================
+static volatile bool InterruptPending = false;
+
+static void IRAM_ATTR onInterruptPin()
+{
+  InterruptPending = true;
+}
+
 //===============================================================
 // Starts communication
 //===============================================================
@@ -38,8 +48,9 @@ bool ADXL345::begin(int sda, int scl)
   f.YAxis = 0;
   f.ZAxis = 0;
 
-  Wire.setPins(sda, scl);
-  Wire.begin();
+  _sdaPin = sda;
+  _sclPin = scl;
+  startBus();
 
   // Check ADXL345 REG DEVID
   if (fastRegister8(ADXL345_REG_DEVID) != 0xE5)
@@ -47,13 +58,20 @@ bool ADXL345::begin(int sda, int scl)
       return false;
   }
 
+  // Load the configuration registers into the shadow copy
+  if (!readRegisters(ADXL345_REG_SHADOW_FIRST, _shadow, ADXL345_SHADOW_SIZE))
+  {
+    return false;
+  }
+  _dirty = 0;
+
   // Enable measurement mode (0b00001000)
-  writeRegister8(ADXL345_REG_POWER_CTL, 0x08);
+  setShadow(ADXL345_REG_POWER_CTL, 0x08);
 
   // Clear settings
   clearSettings();
 
-  return true;
+  return commit();
 }
 
 //===============================================================
@@ -62,7 +80,7 @@ bool ADXL345::begin(int sda, int scl)
 void ADXL345::setRange(adxl345_range_t range)
 {
   // Get actual value register
-  uint8_t value = readRegister8(ADXL345_REG_DATA_FORMAT);
+  uint8_t value = getShadow(ADXL345_REG_DATA_FORMAT);
 
   // Update the data rate
   // (&) 0b11110000 (0xF0 - Leave HSB)
@@ -72,7 +90,7 @@ void ADXL345::setRange(adxl345_range_t range)
   value |= range;
   value |= 0x08;
 
-  writeRegister8(ADXL345_REG_DATA_FORMAT, value);
+  setShadow(ADXL345_REG_DATA_FORMAT, value);
 }
 
 //===============================================================
@@ -80,7 +98,7 @@ void ADXL345::setRange(adxl345_range_t range)
 //===============================================================
 adxl345_range_t ADXL345::getRange(void)
 {
-  return (adxl345_range_t)(readRegister8(ADXL345_REG_DATA_FORMAT) & 0x03);
+  return (adxl345_range_t)(getShadow(ADXL345_REG_DATA_FORMAT) & 0x03);
 }
 
 //===============================================================
@@ -88,7 +106,7 @@ adxl345_range_t ADXL345::getRange(void)
 //===============================================================
 void ADXL345::setDataRate(adxl345_dataRate_t dataRate)
 {
-  writeRegister8(ADXL345_REG_BW_RATE, dataRate);
+  setShadow(ADXL345_REG_BW_RATE, dataRate);
 }
 
 //===============================================================
@@ -96,7 +114,7 @@ void ADXL345::setDataRate(adxl345_dataRate_t dataRate)
 //===============================================================
 adxl345_dataRate_t ADXL345::getDataRate(void)
 {
-  return (adxl345_dataRate_t)(readRegister8(ADXL345_REG_BW_RATE) & 0x0F);
+  return (adxl345_dataRate_t)(getShadow(ADXL345_REG_BW_RATE) & 0x0F);
 }
 
 //===============================================================
@@ -115,9 +133,15 @@ Vector ADXL345::lowPassFilter(Vector vector, float alpha)
 //===============================================================
 Vector ADXL345::readRaw(void)
 {
-  r.XAxis = readRegister16(ADXL345_REG_DATAX0);
-  r.YAxis = readRegister16(ADXL345_REG_DATAY0);
-  r.ZAxis = readRegister16(ADXL345_REG_DATAZ0);
+  // All three axes in one burst (DATAX0 ... DATAZ1), the sensor
+  // guarantees the six bytes belong to the same sample
+  uint8_t data[6];
+  if (readRegisters(ADXL345_REG_DATAX0, data, 6))
+  {
+    r.XAxis = (int16_t)(data[1] << 8 | data[0]);
+    r.YAxis = (int16_t)(data[3] << 8 | data[2]);
+    r.ZAxis = (int16_t)(data[5] << 8 | data[4]);
+  }
   return r;
 }
 
@@ -152,32 +176,88 @@ Vector ADXL345::readScaled(void)
 }
 
 //===============================================================
-// Clear settings
+// Set FIFO mode, the watermark interrupt is raised at the given
+// number of entries (1 ... 31)
+//===============================================================
+void ADXL345::setFifoMode(adxl345_fifo_t mode, uint8_t watermark)
+{
+  // (|) 0bxx000000 (mode)
+  // (|) 0b00000000 (trigger on INT1)
+  // (|) 0b000xxxxx (samples)
+  uint8_t value = (mode << 6) | (constrain(watermark, 1, ADXL345_FIFO_SIZE - 1) & 0x1F);
+  setShadow(ADXL345_REG_FIFO_CTL, value);
+}
+
+//===============================================================
+// Get FIFO mode
+//===============================================================
+adxl345_fifo_t ADXL345::getFifoMode(void)
+{
+  return (adxl345_fifo_t)(getShadow(ADXL345_REG_FIFO_CTL) >> 6);
+}
+
+//===============================================================
+// Get number of samples in the FIFO
+//===============================================================
+uint8_t ADXL345::getFifoEntries(void)
+{
+  return readRegister8(ADXL345_REG_FIFO_STATUS) & 0x3F;
+}
+
+//===============================================================
+// Drains up to maxSamples raw samples from the FIFO, returns the
+// number of samples read
+//===============================================================
+uint8_t ADXL345::readFifo(RawSample *samples, uint8_t maxSamples)
+{
+  // The entry count is read once for the whole drain
+  uint8_t entries = min(getFifoEntries(), maxSamples);
+
+  // The FIFO pops one entry per 6 byte read of DATAX0 ... DATAZ1, so every
+  // entry is its own burst. The next entry is ready 5 us after the stop
+  // condition, less than the address phase of the next burst at 400 kHz
+  uint8_t data[6];
+  for (uint8_t index = 0; index < entries; index++)
+  {
+    if (!readRegisters(ADXL345_REG_DATAX0, data, 6))
+    {
+      return index;
+    }
+    samples[index].XAxis = (int16_t)(data[1] << 8 | data[0]);
+    samples[index].YAxis = (int16_t)(data[3] << 8 | data[2]);
+    samples[index].ZAxis = (int16_t)(data[5] << 8 | data[4]);
+  }
+  return entries;
+}
+
+//===============================================================
+// Clear settings (shadow copy, written by commit)
 //===============================================================
 void ADXL345::clearSettings(void)
 {
   setRange(ADXL345_RANGE_2G);
   setDataRate(ADXL345_DATARATE_100HZ);
 
-  writeRegister8(ADXL345_REG_THRESH_TAP, 0x00);
-  writeRegister8(ADXL345_REG_DUR, 0x00);
-  writeRegister8(ADXL345_REG_LATENT, 0x00);
-  writeRegister8(ADXL345_REG_WINDOW, 0x00);
-  writeRegister8(ADXL345_REG_THRESH_ACT, 0x00);
-  writeRegister8(ADXL345_REG_THRESH_INACT, 0x00);
-  writeRegister8(ADXL345_REG_TIME_INACT, 0x00);
-  writeRegister8(ADXL345_REG_THRESH_FF, 0x00);
-  writeRegister8(ADXL345_REG_TIME_FF, 0x00);
+  setShadow(ADXL345_REG_THRESH_TAP, 0x00);
+  setShadow(ADXL345_REG_DUR, 0x00);
+  setShadow(ADXL345_REG_LATENT, 0x00);
+  setShadow(ADXL345_REG_WINDOW, 0x00);
+  setShadow(ADXL345_REG_THRESH_ACT, 0x00);
+  setShadow(ADXL345_REG_THRESH_INACT, 0x00);
+  setShadow(ADXL345_REG_TIME_INACT, 0x00);
+  setShadow(ADXL345_REG_THRESH_FF, 0x00);
+  setShadow(ADXL345_REG_TIME_FF, 0x00);
+  setShadow(ADXL345_REG_FIFO_CTL, 0x00);
 
   uint8_t value;
 
-  value = readRegister8(ADXL345_REG_ACT_INACT_CTL);
+  value = getShadow(ADXL345_REG_ACT_INACT_CTL);
   value &= 0b10001000;
-  writeRegister8(ADXL345_REG_ACT_INACT_CTL, value);
+  setShadow(ADXL345_REG_ACT_INACT_CTL, value);
 
-  value = readRegister8(ADXL345_REG_TAP_AXES);
+  value = getShadow(ADXL345_REG_TAP_AXES);
   value &= 0b11111000;
-  writeRegister8(ADXL345_REG_TAP_AXES, value);
+  setShadow(ADXL345_REG_TAP_AXES, value);
 }
 
 //===============================================================
@@ -186,7 +266,7 @@ void ADXL345::clearSettings(void)
 void ADXL345::setTapThreshold(float threshold)
 {
   uint8_t scaled = constrain(threshold / 0.0625f, 0, 255);
-  writeRegister8(ADXL345_REG_THRESH_TAP, scaled);
+  setShadow(ADXL345_REG_THRESH_TAP, scaled);
 }
 
 //===============================================================
@@ -194,7 +274,7 @@ void ADXL345::setTapThreshold(float threshold)
 //===============================================================
 float ADXL345::getTapThreshold(void)
 {
-  return readRegister8(ADXL345_REG_THRESH_TAP) * 0.0625f;
+  return getShadow(ADXL345_REG_THRESH_TAP) * 0.0625f;
 }
 
 //===============================================================
@@ -203,7 +283,7 @@ float ADXL345::getTapThreshold(void)
 void ADXL345::setTapDuration(float duration)
 {
   uint8_t scaled = constrain(duration / 0.000625f, 0, 255);
-  writeRegister8(ADXL345_REG_DUR, scaled);
+  setShadow(ADXL345_REG_DUR, scaled);
 }
 
 //===============================================================
@@ -211,7 +291,7 @@ void ADXL345::setTapDuration(float duration)
 //===============================================================
 float ADXL345::getTapDuration(void)
 {
-  return readRegister8(ADXL345_REG_DUR) * 0.000625f;
+  return getShadow(ADXL345_REG_DUR) * 0.000625f;
 }
 
 //===============================================================
@@ -220,7 +300,7 @@ float ADXL345::getTapDuration(void)
 void ADXL345::setDoubleTapLatency(float latency)
 {
   uint8_t scaled = constrain(latency / 0.00125f, 0, 255);
-  writeRegister8(ADXL345_REG_LATENT, scaled);
+  setShadow(ADXL345_REG_LATENT, scaled);
 }
 
 //===============================================================
@@ -228,7 +308,7 @@ void ADXL345::setDoubleTapLatency(float latency)
 //===============================================================
 float ADXL345::getDoubleTapLatency()
 {
-  return readRegister8(ADXL345_REG_LATENT) * 0.00125f;
+  return getShadow(ADXL345_REG_LATENT) * 0.00125f;
 }
 
 //===============================================================
@@ -237,7 +317,7 @@ float ADXL345::getDoubleTapLatency()
 void ADXL345::setDoubleTapWindow(float window)
 {
   uint8_t scaled = constrain(window / 0.00125f, 0, 255);
-  writeRegister8(ADXL345_REG_WINDOW, scaled);
+  setShadow(ADXL345_REG_WINDOW, scaled);
 }
 
 //===============================================================
@@ -245,7 +325,7 @@ void ADXL345::setDoubleTapWindow(float window)
 //===============================================================
 float ADXL345::getDoubleTapWindow(void)
 {
-  return readRegister8(ADXL345_REG_WINDOW) * 0.00125f;
+  return getShadow(ADXL345_REG_WINDOW) * 0.00125f;
 }
 
 //===============================================================
@@ -254,7 +334,7 @@ float ADXL345::getDoubleTapWindow(void)
 void ADXL345::setActivityThreshold(float threshold)
 {
   uint8_t scaled = constrain(threshold / 0.0625f, 0, 255);
-  writeRegister8(ADXL345_REG_THRESH_ACT, scaled);
+  setShadow(ADXL345_REG_THRESH_ACT, scaled);
 }
 
 //===============================================================
@@ -262,7 +342,7 @@ void ADXL345::setActivityThreshold(float threshold)
 //===============================================================
 float ADXL345::getActivityThreshold(void)
 {
-  return readRegister8(ADXL345_REG_THRESH_ACT) * 0.0625f;
+  return getShadow(ADXL345_REG_THRESH_ACT) * 0.0625f;
 }
 
 //===============================================================
@@ -271,7 +351,7 @@ float ADXL345::getActivityThreshold(void)
 void ADXL345::setInactivityThreshold(float threshold)
 {
   uint8_t scaled = constrain(threshold / 0.0625f, 0, 255);
-  writeRegister8(ADXL345_REG_THRESH_INACT, scaled);
+  setShadow(ADXL345_REG_THRESH_INACT, scaled);
 }
 
 //===============================================================
@@ -279,7 +359,7 @@ void ADXL345::setInactivityThreshold(float threshold)
 //===============================================================
 float ADXL345::getInactivityThreshold(void)
 {
-  return readRegister8(ADXL345_REG_THRESH_INACT) * 0.0625f;
+  return getShadow(ADXL345_REG_THRESH_INACT) * 0.0625f;
 }
 
 //===============================================================
@@ -287,7 +367,7 @@ float ADXL345::getInactivityThreshold(void)
 //===============================================================
 void ADXL345::setTimeInactivity(uint8_t time)
 {
-  writeRegister8(ADXL345_REG_TIME_INACT, time);
+  setShadow(ADXL345_REG_TIME_INACT, time);
 }
 
 //===============================================================
@@ -295,7 +375,7 @@ void ADXL345::setTimeInactivity(uint8_t time)
 //===============================================================
 uint8_t ADXL345::getTimeInactivity(void)
 {
-  return readRegister8(ADXL345_REG_TIME_INACT);
+  return getShadow(ADXL345_REG_TIME_INACT);
 }
 
 //===============================================================
@@ -304,7 +384,7 @@ uint8_t ADXL345::getTimeInactivity(void)
 void ADXL345::setFreeFallThreshold(float threshold)
 {
   uint8_t scaled = constrain(threshold / 0.0625f, 0, 255);
-  writeRegister8(ADXL345_REG_THRESH_FF, scaled);
+  setShadow(ADXL345_REG_THRESH_FF, scaled);
 }
 
 //===============================================================
@@ -312,7 +392,7 @@ void ADXL345::setFreeFallThreshold(float threshold)
 //===============================================================
 float ADXL345::getFreeFallThreshold(void)
 {
-  return readRegister8(ADXL345_REG_THRESH_FF) * 0.0625f;
+  return getShadow(ADXL345_REG_THRESH_FF) * 0.0625f;
 }
 
 //===============================================================
@@ -321,7 +401,7 @@ float ADXL345::getFreeFallThreshold(void)
 void ADXL345::setFreeFallDuration(float duration)
 {
   uint8_t scaled = constrain(duration / 0.005f, 0, 255);
-  writeRegister8(ADXL345_REG_TIME_FF, scaled);
+  setShadow(ADXL345_REG_TIME_FF, scaled);
 }
 
 //===============================================================
@@ -329,7 +409,7 @@ void ADXL345::setFreeFallDuration(float duration)
 //===============================================================
 float ADXL345::getFreeFallDuration()
 {
-  return readRegister8(ADXL345_REG_TIME_FF) * 0.005f;
+  return getShadow(ADXL345_REG_TIME_FF) * 0.005f;
 }
 
 //===============================================================
@@ -385,18 +465,37 @@ bool ADXL345::getActivityZ(void)
 //===============================================================
 void ADXL345::setActivityXYZ(bool state)
 {
-  uint8_t value = readRegister8(ADXL345_REG_ACT_INACT_CTL);
+  uint8_t value = getShadow(ADXL345_REG_ACT_INACT_CTL);
 
+  // ACT_X, ACT_Y, ACT_Z enable are bits 6 ... 4, bit 3 is the coupling of inactivity
   if (state)
   {
-	  value |= 0b00111000;
+	  value |= 0b01110000;
   }
   else
   {
-	  value &= 0b11000111;
+	  value &= 0b10001111;
   }
 
-  writeRegister8(ADXL345_REG_ACT_INACT_CTL, value);
+  setShadow(ADXL345_REG_ACT_INACT_CTL, value);
+}
+
+//===============================================================
+// Sets AC coupled activity detection, compares the change against
+// the threshold instead of the absolute value (which includes 1g
+// of gravity)
+//===============================================================
+void ADXL345::setActivityAcCoupled(bool state)
+{
+  writeRegisterBit(ADXL345_REG_ACT_INACT_CTL, 7, state);
+}
+
+//===============================================================
+// Gets AC coupled activity detection
+//===============================================================
+bool ADXL345::getActivityAcCoupled(void)
+{
+  return readRegisterBit(ADXL345_REG_ACT_INACT_CTL, 7);
 }
 
 //===============================================================
@@ -449,7 +548,7 @@ bool ADXL345::getInactivityZ(void)
 //===============================================================
 void ADXL345::setInactivityXYZ(bool state)
 {
-  uint8_t value = readRegister8(ADXL345_REG_ACT_INACT_CTL);
+  uint8_t value = getShadow(ADXL345_REG_ACT_INACT_CTL);
 
   if (state)
   {
@@ -460,7 +559,7 @@ void ADXL345::setInactivityXYZ(bool state)
 	  value &= 0b11111000;
   }
 
-  writeRegister8(ADXL345_REG_ACT_INACT_CTL, value);
+  setShadow(ADXL345_REG_ACT_INACT_CTL, value);
 }
 
 //===============================================================
@@ -516,7 +615,7 @@ bool ADXL345::getTapDetectionZ(void)
 //===============================================================
 void ADXL345::setTapDetectionXYZ(bool state)
 {
-  uint8_t value = readRegister8(ADXL345_REG_TAP_AXES);
+  uint8_t value = getShadow(ADXL345_REG_TAP_AXES);
 
   if (state)
   {
@@ -527,24 +626,68 @@ void ADXL345::setTapDetectionXYZ(bool state)
 	  value &= 0b11111000;
   }
 
-  writeRegister8(ADXL345_REG_TAP_AXES, value);
+  setShadow(ADXL345_REG_TAP_AXES, value);
 }
 
 //===============================================================
-// Sets interrupt
+// Sets interrupt, sources is the INT_ENABLE mask (bits of
+// adxl345_activity_t)
 //===============================================================
-void ADXL345::useInterrupt(adxl345_int_t interrupt)
+void ADXL345::useInterrupt(adxl345_int_t interrupt, uint8_t sources)
 {
   if (interrupt == 0)
   {
-	  writeRegister8(ADXL345_REG_INT_MAP, 0x00);
+	  setShadow(ADXL345_REG_INT_MAP, 0x00);
   }
   else
   {
-	  writeRegister8(ADXL345_REG_INT_MAP, 0xFF);
+	  setShadow(ADXL345_REG_INT_MAP, 0xFF);
+  }
+
+  setShadow(ADXL345_REG_INT_ENABLE, sources);
+}
+
+//===============================================================
+// Enables the sources of both lines, int2Sources are routed to
+// INT2. INT_SOURCE only latches enabled sources, so events that
+// are only read (e.g. taps while INT1 signals the watermark) go
+// to the unconnected INT2 line
+//===============================================================
+void ADXL345::useInterrupts(uint8_t int1Sources, uint8_t int2Sources)
+{
+  setShadow(ADXL345_REG_INT_MAP, int2Sources & ~int1Sources);
+  setShadow(ADXL345_REG_INT_ENABLE, int1Sources | int2Sources);
+}
+
+//===============================================================
+// Attaches the GPIO the INT line is connected to, events are then
+// only read if the sensor raised the line
+//===============================================================
+void ADXL345::attachInterruptPin(int pin)
+{
+  _intPin = pin;
+  InterruptPending = false;
+
+  // The INT lines are active high and stay high until INT_SOURCE is read
+  pinMode(pin, INPUT_PULLDOWN);
+  attachInterrupt(digitalPinToInterrupt(pin), onInterruptPin, RISING);
+}
+
+//===============================================================
+// Returns true if an event is pending and clears the flag. Without
+// an attached pin it is always true (polling)
+//===============================================================
+bool ADXL345::isInterruptPending(void)
+{
+  if (_intPin < 0)
+  {
+    return true;
   }
 
-  writeRegister8(ADXL345_REG_INT_ENABLE, 0xFF);
+  // The line stays high if an event came in before the last read cleared it
+  bool pending = InterruptPending || digitalRead(_intPin) == HIGH;
+  InterruptPending = false;
+  return pending;
 }
 
 //===============================================================
@@ -552,7 +695,26 @@ void ADXL345::useInterrupt(adxl345_int_t interrupt)
 //===============================================================
 Activites ADXL345::readActivites(void)
 {
-  uint8_t data = readRegister8(ADXL345_REG_INT_SOURCE);
+  // One burst from ACT_TAP_STATUS to INT_SOURCE, the registers in between
+  // have no read side effects. ACT_TAP_STATUS is read before INT_SOURCE
+  // clears the interrupts, as the datasheet requires
+  uint8_t status[ADXL345_REG_INT_SOURCE - ADXL345_REG_ACT_TAP_STATUS + 1];
+  if (!readRegisters(ADXL345_REG_ACT_TAP_STATUS, status, sizeof(status)))
+  {
+    memset(&a, 0, sizeof(a));
+    return a;
+  }
+
+  return decodeActivites(status);
+}
+
+//===============================================================
+// Decodes the activities from the registers ACT_TAP_STATUS ...
+// INT_SOURCE
+//===============================================================
+Activites ADXL345::decodeActivites(const uint8_t *status)
+{
+  uint8_t data = status[ADXL345_REG_INT_SOURCE - ADXL345_REG_ACT_TAP_STATUS];
 
   a.isOverrun = ((data >> ADXL345_OVERRUN) & 1);
   a.isWatermark = ((data >> ADXL345_WATERMARK) & 1);
@@ -563,7 +725,7 @@ Activites ADXL345::readActivites(void)
   a.isTap = ((data >> ADXL345_SINGLE_TAP) & 1);
   a.isDataReady = ((data >> ADXL345_DATA_READY) & 1);
 
-  data = readRegister8(ADXL345_REG_ACT_TAP_STATUS);
+  data = status[0];
 
   a.isActivityOnX = ((data >> 6) & 1);
   a.isActivityOnY = ((data >> 5) & 1);
@@ -576,19 +738,81 @@ Activites ADXL345::readActivites(void)
 }
 
 //===============================================================
-// Write byte to register
+// Write consecutive registers in one transaction
 //===============================================================
-void ADXL345::writeRegister8(uint8_t reg, uint8_t value)
+bool ADXL345::writeRegisters(uint8_t reg, const uint8_t *buffer, uint8_t count)
 {
   Wire.beginTransmission(ADXL345_ADDRESS);
-#if ARDUINO >= 100
   Wire.write(reg);
-  Wire.write(value);
-#else
-  Wire.send(reg);
-  Wire.send(value);
-#endif
-  Wire.endTransmission();
+  Wire.write(buffer, count);
+  if (Wire.endTransmission() != 0)
+  {
+    _errorCount++;
+    recoverBus();
+    return false;
+  }
+  return true;
+}
+
+//===============================================================
+// Returns a configuration register from the shadow copy
+//===============================================================
+uint8_t ADXL345::getShadow(uint8_t reg)
+{
+  return _shadow[reg - ADXL345_REG_SHADOW_FIRST];
+}
+
+//===============================================================
+// Sets a configuration register in the shadow copy, written by
+// the next commit if it changed
+//===============================================================
+void ADXL345::setShadow(uint8_t reg, uint8_t value)
+{
+  uint8_t index = reg - ADXL345_REG_SHADOW_FIRST;
+  if (_shadow[index] != value)
+  {
+    _shadow[index] = value;
+    _dirty |= 1UL << index;
+  }
+}
+
+//===============================================================
+// Writes all changed configuration registers, consecutive ones in
+// one burst. Returns false if a write failed, it is retried with
+// the next commit
+//===============================================================
+bool ADXL345::commit(void)
+{
+  bool success = true;
+  uint8_t index = 0;
+  while (index < ADXL345_SHADOW_SIZE)
+  {
+    if ((_dirty & (1UL << index)) == 0)
+    {
+      index++;
+      continue;
+    }
+
+    // Only configuration registers are ever dirty, so a run never
+    // covers a status or data register
+    uint8_t count = 1;
+    while (index + count < ADXL345_SHADOW_SIZE &&
+      (_dirty & (1UL << (index + count))) != 0)
+    {
+      count++;
+    }
+
+    if (writeRegisters(ADXL345_REG_SHADOW_FIRST + index, _shadow + index, count))
+    {
+      _dirty &= ~(((1UL << count) - 1) << index);
+    }
+    else
+    {
+      success = false;
+    }
+    index += count;
+  }
+  return success;
 }
 
 //===============================================================
@@ -619,54 +843,278 @@ uint8_t ADXL345::fastRegister8(uint8_t reg)
 // Read byte from register
 //===============================================================
 uint8_t ADXL345::readRegister8(uint8_t reg)
+{
+  uint8_t value = 0;
+  readRegisters(reg, &value, 1);
+  return value;
+}
+
+//===============================================================
+// Reads consecutive registers in one transaction (repeated start),
+// returns false if the sensor did not deliver all bytes. Every
+// transaction is bounded by the Wire timeout, a failed one counts
+// as error and recovers the bus
+//===============================================================
+bool ADXL345::readRegisters(uint8_t reg, uint8_t *buffer, uint8_t count)
 {
   Wire.beginTransmission(ADXL345_ADDRESS);
-#if ARDUINO >= 100
   Wire.write(reg);
-#else
-  Wire.send(reg);
-#endif
-  Wire.endTransmission();
+  if (Wire.endTransmission(false) != 0 ||
+    Wire.requestFrom((uint8_t)ADXL345_ADDRESS, count) != count)
+  {
+    _errorCount++;
+    recoverBus();
+    return false;
+  }
 
-  Wire.beginTransmission(ADXL345_ADDRESS);
-  Wire.requestFrom(ADXL345_ADDRESS, 1);
-  while(!Wire.available()) { };
-#if ARDUINO >= 100
-  uint8_t value = Wire.read();
-#else
-  uint8_t value = Wire.receive();
-#endif
-  Wire.endTransmission();
+  for (uint8_t index = 0; index < count; index++)
+  {
+    buffer[index] = Wire.read();
+  }
+  return true;
+}
 
-  return value;
+//===============================================================
+// Frees the bus from a sensor that holds SDA low (e.g. after a
+// glitch in the middle of a read) and restarts the controller
+//===============================================================
+void ADXL345::recoverBus(void)
+{
+  Wire.end();
+
+  // Clock out the rest of the byte the sensor is sending
+  pinMode(_sdaPin, INPUT_PULLUP);
+  pinMode(_sclPin, OUTPUT_OPEN_DRAIN);
+  for (uint8_t index = 0; index < 9 && digitalRead(_sdaPin) == LOW; index++)
+  {
+    digitalWrite(_sclPin, LOW);
+    delayMicroseconds(5);
+    digitalWrite(_sclPin, HIGH);
+    delayMicroseconds(5);
+  }
+
+  // Stop condition, SDA rises while SCL is high
+  pinMode(_sdaPin, OUTPUT_OPEN_DRAIN);
+  digitalWrite(_sdaPin, LOW);
+  delayMicroseconds(5);
+  digitalWrite(_sdaPin, HIGH);
+  delayMicroseconds(5);
+
+  startBus();
 }
 
 //===============================================================
-// Read word from register
+// Starts the I2C controller in fast mode with a bounded timeout
 //===============================================================
-int16_t ADXL345::readRegister16(uint8_t reg)
+void ADXL345::startBus(void)
 {
-  Wire.beginTransmission(ADXL345_ADDRESS);
-#if ARDUINO >= 100
-  Wire.write(reg);
-#else
-  Wire.send(reg);
-#endif
-  Wire.endTransmission();
+  Wire.setPins(_sdaPin, _sclPin);
+  Wire.begin();
 
-  Wire.beginTransmission(ADXL345_ADDRESS);
-  Wire.requestFrom(ADXL345_ADDRESS, 2);
-  while(!Wire.available()) { };
-#if ARDUINO >= 100
-  uint8_t vla = Wire.read();
-  uint8_t vha = Wire.read();
-#else
-  uint8_t vla = Wire.receive();
-  uint8_t vha = Wire.receive();
-#endif
-  Wire.endTransmission();
+  // Fast mode, the sensor supports 400 kHz and FIFO drains at high data rates need it
+  Wire.setClock(400000);
+  Wire.setTimeOut(ADXL345_I2C_TIMEOUT_MS);
+}
+
+//===============================================================
+// Starts the transfer task, register reads can then be queued
+// without blocking the caller. Direct register access should then
+// be limited to the setup, it is not synchronized with the task
+//===============================================================
+bool ADXL345::beginAsync(void)
+{
+  if (_transferQueue != NULL)
+  {
+    return true;
+  }
+
+  _transferQueue = xQueueCreate(ADXL345_TRANSFER_QUEUE, sizeof(ADXL345Transfer*));
+  if (_transferQueue == NULL)
+  {
+    return false;
+  }
+
+  // Above the loop task, it only runs while a transfer is queued
+  return xTaskCreate(transferTask, "ADXL345", 2048, this, 2, NULL) == pdPASS;
+}
+
+//===============================================================
+// Queues a register read (or FIFO drain), returns false if the
+// queue is full
+//===============================================================
+bool ADXL345::submit(ADXL345Transfer &transfer)
+{
+  if (_transferQueue == NULL ||
+    transfer.length > ADXL345_TRANSFER_MAX)
+  {
+    return false;
+  }
+
+  ADXL345Transfer* item = &transfer;
+  transfer.status = ADXL345_TRANSFER_PENDING;
+  if (xQueueSend(_transferQueue, &item, 0) != pdTRUE)
+  {
+    transfer.status = ADXL345_TRANSFER_ERROR;
+    return false;
+  }
+  return true;
+}
 
-  return vha << 8 | vla;
+//===============================================================
+// Transfer task, runs the queued register reads
+//===============================================================
+void ADXL345::transferTask(void *parameter)
+{
+  ADXL345* sensor = (ADXL345*)parameter;
+  ADXL345Transfer* transfer;
+  while (true)
+  {
+    if (xQueueReceive(sensor->_transferQueue, &transfer, portMAX_DELAY) == pdTRUE)
+    {
+      bool success = sensor->runTransfer(*transfer);
+      transfer->status = success ? ADXL345_TRANSFER_DONE : ADXL345_TRANSFER_ERROR;
+    }
+  }
+}
+
+//===============================================================
+// Runs a transfer: the FIFO drain, if any, then the register read
+//===============================================================
+bool ADXL345::runTransfer(ADXL345Transfer &transfer)
+{
+  // A failed burst ends the drain, the samples read before it are still valid
+  if (transfer.samples != NULL)
+  {
+    transfer.timeMs = millis();
+    transfer.sampleCount = readFifo(transfer.samples, transfer.sampleCount);
+  }
+  if (transfer.length == 0)
+  {
+    return true;
+  }
+  return readRegisters(transfer.reg, transfer.data, transfer.length);
+}
+
+//===============================================================
+// Starts reading the activities in the background, returns false
+// if a read is still running or could not be queued
+//===============================================================
+bool ADXL345::requestActivites(void)
+{
+  if (_activitesTransfer.status == ADXL345_TRANSFER_PENDING)
+  {
+    return false;
+  }
+
+  _activitesTransfer.reg = ADXL345_REG_ACT_TAP_STATUS;
+  _activitesTransfer.length = ADXL345_REG_INT_SOURCE - ADXL345_REG_ACT_TAP_STATUS + 1;
+
+  // Without the transfer task the read happens right here
+  if (_transferQueue == NULL)
+  {
+    bool success = runTransfer(_activitesTransfer);
+    _activitesTransfer.status = success ? ADXL345_TRANSFER_DONE : ADXL345_TRANSFER_ERROR;
+    return success;
+  }
+  return submit(_activitesTransfer);
+}
+
+//===============================================================
+// Starts draining up to maxSamples from the FIFO in the
+// background, optionally followed by the activities. The samples
+// must not be touched until pollFifo returns them. Returns false
+// if a drain is still running or could not be queued
+//===============================================================
+bool ADXL345::requestFifo(RawSample *samples, uint8_t maxSamples, bool withActivites)
+{
+  if (_fifoTransfer.status == ADXL345_TRANSFER_PENDING)
+  {
+    return false;
+  }
+
+  _fifoTransfer.samples = samples;
+  _fifoTransfer.sampleCount = maxSamples;
+  _fifoTransfer.reg = ADXL345_REG_ACT_TAP_STATUS;
+  _fifoTransfer.length = withActivites ? ADXL345_REG_INT_SOURCE - ADXL345_REG_ACT_TAP_STATUS + 1 : 0;
+
+  // Without the transfer task the drain happens right here
+  if (_transferQueue == NULL)
+  {
+    bool success = runTransfer(_fifoTransfer);
+    _fifoTransfer.status = success ? ADXL345_TRANSFER_DONE : ADXL345_TRANSFER_ERROR;
+    return success;
+  }
+
+  // A drain that could not be queued has no samples to return
+  if (!submit(_fifoTransfer))
+  {
+    _fifoTransfer.status = ADXL345_TRANSFER_IDLE;
+    return false;
+  }
+  return true;
+}
+
+//===============================================================
+// Returns true once the requested FIFO drain is done, with the
+// number of samples and the start of the drain. The activities
+// are only set if they were requested and read
+//===============================================================
+bool ADXL345::pollFifo(uint8_t &count, uint32_t &timeMs, Activites &activities)
+{
+  adxl345_transfer_t status = _fifoTransfer.status;
+  if (status != ADXL345_TRANSFER_DONE &&
+    status != ADXL345_TRANSFER_ERROR)
+  {
+    return false;
+  }
+
+  // A failed activities read still returns the drained samples
+  _fifoTransfer.status = ADXL345_TRANSFER_IDLE;
+  count = _fifoTransfer.sampleCount;
+  timeMs = _fifoTransfer.timeMs;
+  if (status == ADXL345_TRANSFER_DONE &&
+    _fifoTransfer.length > 0)
+  {
+    activities = decodeActivites(_fifoTransfer.data);
+  }
+  return true;
+}
+
+//===============================================================
+// Returns true while requested activities or a FIFO drain are
+// still being read
+//===============================================================
+bool ADXL345::isBusy(void)
+{
+  return _activitesTransfer.status == ADXL345_TRANSFER_PENDING ||
+    _fifoTransfer.status == ADXL345_TRANSFER_PENDING;
+}
+
+//===============================================================
+// Returns true once the requested activities are read, a failed
+// read returns no activities
+//===============================================================
+bool ADXL345::pollActivites(Activites &activities)
+{
+  if (_activitesTransfer.status == ADXL345_TRANSFER_DONE)
+  {
+    _activitesTransfer.status = ADXL345_TRANSFER_IDLE;
+    activities = decodeActivites(_activitesTransfer.data);
+    return true;
+  }
+  if (_activitesTransfer.status == ADXL345_TRANSFER_ERROR)
+  {
+    _activitesTransfer.status = ADXL345_TRANSFER_IDLE;
+  }
+  return false;
+}
+
+//===============================================================
+// Returns the number of failed transactions
+//===============================================================
+uint32_t ADXL345::getErrorCount(void)
+{
+  return _errorCount;
 }
 
 //===============================================================
@@ -674,7 +1122,7 @@ int16_t ADXL345::readRegister16(uint8_t reg)
 //===============================================================
 void ADXL345::writeRegisterBit(uint8_t reg, uint8_t pos, bool state)
 {
-  uint8_t value = readRegister8(reg);
+  uint8_t value = getShadow(reg);
 
   if (state)
   {
@@ -685,7 +1133,7 @@ void ADXL345::writeRegisterBit(uint8_t reg, uint8_t pos, bool state)
 	  value &= ~(1 << pos);
   }
 
-  writeRegister8(reg, value);
+  setShadow(reg, value);
 }
 
 //===============================================================
@@ -693,6 +1141,6 @@ void ADXL345::writeRegisterBit(uint8_t reg, uint8_t pos, bool state)
 //===============================================================
 bool ADXL345::readRegisterBit(uint8_t reg, uint8_t pos)
 {
-  uint8_t value = readRegister8(reg);
+  uint8_t value = getShadow(reg);
   return ((value >> pos) & 1);
 }
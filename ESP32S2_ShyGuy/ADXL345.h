@@ -59,6 +59,14 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #define ADXL345_REG_FIFO_CTL         (0x38)
 #define ADXL345_REG_FIFO_STATUS      (0x39)
 
+#define ADXL345_REG_SHADOW_FIRST     ADXL345_REG_THRESH_TAP
+#define ADXL345_SHADOW_SIZE          (ADXL345_REG_FIFO_CTL - ADXL345_REG_THRESH_TAP + 1)
+
+#define ADXL345_FIFO_SIZE            32
+#define ADXL345_I2C_TIMEOUT_MS       10   // Upper bound of one transaction
+#define ADXL345_TRANSFER_MAX         8    // Bytes of one queued register read
+#define ADXL345_TRANSFER_QUEUE       4    // Queued register reads
+
 #define ADXL345_GRAVITY_SUN          273.95f
 #define ADXL345_GRAVITY_EARTH        9.80665f
 #define ADXL345_GRAVITY_MOON         1.622f
@@ -103,6 +111,14 @@ typedef enum
     ADXL345_OVERRUN            = 0x00
 } adxl345_activity_t;
 
+typedef enum
+{
+    ADXL345_FIFO_BYPASS        = 0b00,
+    ADXL345_FIFO_FIFO          = 0b01,
+    ADXL345_FIFO_STREAM        = 0b10,
+    ADXL345_FIFO_TRIGGER       = 0b11
+} adxl345_fifo_t;
+
 typedef enum
 {
     ADXL345_RANGE_16G          = 0b11,
@@ -121,6 +137,32 @@ struct Vector
 };
 #endif
 
+struct RawSample
+{
+    int16_t XAxis;
+    int16_t YAxis;
+    int16_t ZAxis;
+};
+
+typedef enum : uint8_t
+{
+    ADXL345_TRANSFER_IDLE,
+    ADXL345_TRANSFER_PENDING,
+    ADXL345_TRANSFER_DONE,
+    ADXL345_TRANSFER_ERROR
+} adxl345_transfer_t;
+
+struct ADXL345Transfer
+{
+    uint8_t reg;
+    uint8_t length;
+    uint8_t data[ADXL345_TRANSFER_MAX];
+    RawSample *samples;     // If set, the FIFO is drained into it before the register read
+    uint8_t sampleCount;    // Samples to drain at most, the drained samples once done
+    uint32_t timeMs;        // Start of the FIFO drain (millis)
+    volatile adxl345_transfer_t status;
+};
+
 struct Activites
 {
     bool isOverrun;
@@ -144,6 +186,7 @@ class ADXL345
   public:
     bool begin(int sda, int scl);
     void clearSettings(void);
+    bool commit(void);
 
     Vector readRaw(void);
     Vector readNormalize(float gravityFactor = ADXL345_GRAVITY_EARTH);
@@ -151,6 +194,20 @@ class ADXL345
 
     Activites readActivites(void);
 
+    bool beginAsync(void);
+    bool submit(ADXL345Transfer &transfer);
+    bool requestActivites(void);
+    bool pollActivites(Activites &activities);
+    bool requestFifo(RawSample *samples, uint8_t maxSamples, bool withActivites = false);
+    bool pollFifo(uint8_t &count, uint32_t &timeMs, Activites &activities);
+    bool isBusy(void);
+    uint32_t getErrorCount(void);
+
+    void setFifoMode(adxl345_fifo_t mode, uint8_t watermark = 16);
+    adxl345_fifo_t getFifoMode(void);
+    uint8_t getFifoEntries(void);
+    uint8_t readFifo(RawSample *samples, uint8_t maxSamples);
+
     Vector lowPassFilter(Vector vector, float alpha = 0.5);
 
     void  setRange(adxl345_range_t range);
@@ -193,6 +250,8 @@ class ADXL345
     void setActivityZ(bool state);
     bool getActivityZ(void);
     void setActivityXYZ(bool state);
+    void setActivityAcCoupled(bool state);
+    bool getActivityAcCoupled(void);
 
     void setInactivityX(bool state);
     bool getInactivityX(void);
@@ -210,7 +269,11 @@ class ADXL345
     bool getTapDetectionZ(void);
     void setTapDetectionXYZ(bool state);
 
-    void useInterrupt(adxl345_int_t interrupt);
+    void useInterrupt(adxl345_int_t interrupt, uint8_t sources = 0xFF);
+    void useInterrupts(uint8_t int1Sources, uint8_t int2Sources);
+
+    void attachInterruptPin(int pin);
+    bool isInterruptPending(void);
 
   private:
     Vector r;
@@ -218,11 +281,28 @@ class ADXL345
     Vector f;
     Activites a;
     adxl345_range_t _range;
-
-    void writeRegister8(uint8_t reg, uint8_t value);
+    int _intPin = -1;
+    int _sdaPin = -1;
+    int _sclPin = -1;
+    volatile uint32_t _errorCount = 0;
+    QueueHandle_t _transferQueue = NULL;
+    ADXL345Transfer _activitesTransfer = { };
+    ADXL345Transfer _fifoTransfer = { };
+    uint8_t _shadow[ADXL345_SHADOW_SIZE];
+    uint32_t _dirty = 0;
+
+    void startBus(void);
+    void recoverBus(void);
+    static void transferTask(void *parameter);
+    bool runTransfer(ADXL345Transfer &transfer);
+    Activites decodeActivites(const uint8_t *status);
+
+    bool writeRegisters(uint8_t reg, const uint8_t *buffer, uint8_t count);
+    uint8_t getShadow(uint8_t reg);
+    void setShadow(uint8_t reg, uint8_t value);
     uint8_t readRegister8(uint8_t reg);
     uint8_t fastRegister8(uint8_t reg);
-    int16_t readRegister16(uint8_t reg);
+    bool readRegisters(uint8_t reg, uint8_t *buffer, uint8_t count);
     void writeRegisterBit(uint8_t reg, uint8_t pos, bool state);
     bool readRegisterBit(uint8_t reg, uint8_t pos);
 };
@@ -9,7 +9,8 @@
  * 
  * Configuration Wemos S2 Mini:
  * - Board: "ESP32S2 Dev Module"
- * - CPU Frequency: "240MHz (WiFi)"
+ * - CPU Frequency: "240MHz (WiFi)" (boot frequency, lowered to
+ *   CPU_MHZ_IDLE while the door is closed)
  * - USB CDC On Boot: "Enabled"   <------------ Important!
  * - USB DFU On Boot: "Disabled"
  * - USB Firmware MSC On Boot: "Disabled"
@@ -43,12 +44,16 @@
 #include <Adafruit_ST7789.h>
 #include <Wire.h>
 #include "ADXL345.h"
+#include "KnockDetector.h"
+#include "KnockRhythm.h"
+#include "TraceCapture.h"
+#include "PowerManager.h"
 #include "SystemHelper.h"
 #include "Servo.h"
 #include "Face.h"
 #include "XT_DAC_Audio.h"
-#include "sounddata_Hey.h"
-#include "sounddata_GoAway.h"
+#include "SoundBank.h"
+#include "SynthScripts.h"
 
 
 //===============================================================
@@ -60,6 +65,7 @@
 // Accelerometer pin defines
 #define PIN_ACC_SDA             4     // GPIO 4  -> Accelerometer serial data input/output
 #define PIN_ACC_SCL             5     // GPIO 5  -> Accelerometer serial clock
+#define PIN_ACC_INT1            -1    // GPIO of the accelerometer INT1 line, e.g. 3 (-1 = not connected, polling)
 
 // Display pin defines
 #define PIN_TFT_DC              37    // GPIO 37 -> TFT data/command
@@ -67,6 +73,7 @@
 #define PIN_TFT_CS              34    // GPIO 34 -> TFT chip select (Not connected! ST7789 is always selected)
 #define PIN_TFT_SDA             35    // GPIO 35 -> TFT serial data input/output
 #define PIN_TFT_SCL             36    // PGIO 36 -> TFT serial clock
+#define PIN_TFT_BL              -1    // GPIO of the TFT backlight (-1 = not switchable, always on)
 
 // Sound output pin defines
 #define PIN_DAC                 17    // GPIO 17 -> Sound output
@@ -79,9 +86,37 @@
 #define ANGLE_OPEN              32
 #define ANGLE_CLOSED            130
 
-// Tap recognition
-#define TAPS_MAX                10
-#define TAPS_WINDOW_MS          2000
+// Door movement, the servo follows a velocity profile instead of jumping (limits the current peak and the noise)
+#define SERVO_OPEN_MS           400   // Duration of the opening move
+#define SERVO_CLOSE_MS          600   // Duration of the closing move
+#define SERVO_PROFILE           ServoProfile_SCurve
+
+// Servo pulses after a move, releasing stops the holding current, the chatter and its noise on the supply and the DAC
+#define SERVO_HOLD              ServoHold_Release // ServoHold_Always, ServoHold_Release or ServoHold_KeepAlive
+#define SERVO_SETTLE_MS         300   // Pulses after the end of a move until the servo reached the angle
+#define SERVO_KEEPALIVE_MS      500   // Pulse interval of ServoHold_KeepAlive
+
+// Light sleep between sensor checks while the door is closed
+#define IDLE_SLEEP              1     // 1 = light sleep in eClosed, 0 = loop runs flat out
+#define IDLE_POLL_MS            20    // Sleep without INT1 line, half of the FIFO (32 samples = 40 ms at 800 Hz)
+#define IDLE_SLEEP_MAX_MS       100   // Longest sleep if the INT1 line wakes up
+
+// Deep sleep standby after a time without knocks, the accelerometer activity on INT1 wakes up (needs PIN_ACC_INT1)
+#define STANDBY_AFTER_MS        600000 // 10 minutes closed without a knock
+#define STANDBY_ACTIVITY_G      0.5   // Change of acceleration that wakes from standby
+
+// CPU frequency per state, face rendering and audio need the full speed
+#define CPU_MHZ_IDLE            80    // eClosed and standby
+#define CPU_MHZ_ACTIVE          240   // Opening, open and closing
+
+// Voice lines streamed from SPIFFS ("/Voice0.wav", "/Voice1.wav", ...)
+#define VOICE_LINES_MAX         100
+
+// Knock detection, 1 = software detector on 800 Hz FIFO samples, 0 = single tap logic of the ADXL345
+#define KNOCK_DETECTOR_DSP      1
+#define KNOCK_SENSITIVITY       80    // 0 (firm knocks only) ... 100 (softest knocks)
+#define KNOCK_SAMPLE_RATE       800
+#define KNOCK_FIFO_WATERMARK    16    // Samples per drain, 20 ms at 800 Hz
 
 
 //===============================================================
@@ -95,27 +130,40 @@ typedef enum : int
   eClosing
 } State;
 
+typedef enum : uint8_t
+{
+  eReactionShy,         // 3x knock: peek out, maybe say "Hey" and "Go away"
+  eReactionGiggle,      // Shave and a haircut: happy face and a giggle
+  eReactionAngry        // 2+2 knock: angry face, "Go away" right away
+} Reaction;
+
 
 //===============================================================
 // Global variables
 //===============================================================
 Adafruit_ST7789* tft = NULL;
 ADXL345* accelerometer = NULL;
+KnockDetector* knockDetector = NULL;
+RawSample knockSamples[ADXL345_FIFO_SIZE];
+TraceCapture* traceCapture = NULL;
+PowerManager* powerManager = NULL;
 Face* face = NULL;
 Servo* servo = NULL;
 
 // Sound output variables, use GPIO 17, one of the 2 DAC pins (DAC1)
 XT_Wav_Class* wavFileHey = NULL;
 XT_Wav_Class* wavFileGoAway = NULL;
+XT_SpiffsWav_Class* wavFileVoice = NULL;
+XT_Synth_Class* synthCreak = NULL;
+XT_Synth_Class* synthGiggle = NULL;
 XT_DAC_Audio_Class* dacAudio = NULL;
-int16_t activeSound = -1;
+uint16_t voiceLineCount = 0;
 
 // State machine state
 State shyGuyState = eClosed;
 
-// Accelerometer tap variables
-uint32_t taps[TAPS_MAX];
-int16_t tapPointer = 0;
+// Knock rhythm recognition
+KnockRhythm* knockRhythm = NULL;
 
 // Timer variables for alive counter
 uint32_t aliveTimestamp = 0;
@@ -127,6 +175,9 @@ uint32_t openTime_ms = 5000;
 bool withSound = false;
 bool withGoAway = false;
 
+// Time of the last knock or door movement, for the standby
+uint32_t activityTimestamp = 0;
+
 
 //===============================================================
 // Setup function
@@ -137,10 +188,16 @@ void setup(void)
   USBSerial.begin();
   USB.begin();
 
+  // A wake from standby restores straight into eClosed, without the boot delays
+  bool fromStandby = PowerManager::WokeFromStandby();
+
   // Initialize serial communication
   Serial.begin(115200);
-  delay(2000);
-  Serial.println("[SETUP] Shy Guy V1.0");
+  if (!fromStandby)
+  {
+    delay(2000);
+  }
+  Serial.println(fromStandby ? "[SETUP] Shy Guy V1.0, wake from standby" : "[SETUP] Shy Guy V1.0");
   Serial.println(GetSystemInfoString());
   Serial.println();
 
@@ -151,15 +208,27 @@ void setup(void)
 
   // Initialize GPIOs
   Serial.println("[SETUP] Initialize GPIOs");
+  gpio_hold_dis((gpio_num_t)PIN_SERVO);
   pinMode(PIN_SERVO, OUTPUT);
   digitalWrite(PIN_SERVO, LOW);
+#if PIN_TFT_BL >= 0
+  gpio_hold_dis((gpio_num_t)PIN_TFT_BL);
+  pinMode(PIN_TFT_BL, OUTPUT);
+  digitalWrite(PIN_TFT_BL, HIGH);
+#endif
 
 	// Initialize servo pin
   Serial.println("[SETUP] Initialize servo pin");
   servo = new Servo(PIN_SERVO);
+  servo->SetHoldPolicy(SERVO_HOLD, SERVO_SETTLE_MS, SERVO_KEEPALIVE_MS);
   
-  // Set the servo position to opened
-  servo->SetAngle(ANGLE_OPEN);
+  // The door rests closed while powered off, the trajectory starts there. A boot opens the door
+  // smoothly while the setup runs, the door stays closed on a wake from standby
+  servo->SetAngle(ANGLE_CLOSED);
+  if (!fromStandby)
+  {
+    servo->MoveTo(ANGLE_OPEN, SERVO_OPEN_MS, SERVO_PROFILE);
+  }
   
   // Initialize SPI
   Serial.println("[SETUP] Initialize SPI");
@@ -184,6 +253,7 @@ void setup(void)
   Serial.println("[SETUP] Initialize Face");
   tft->println("Init Face");
   face = new Face(tft, SCREEN_WIDTH, SCREEN_HEIGHT, 40);
+  face->OnBand = OnFaceBand;
   face->Expression.GoTo_Normal();
 
   // Create new face behavior
@@ -195,7 +265,7 @@ void setup(void)
   face->Blink.Timer.SetIntervalMillis(2000);
 
   // Allow face to settle
-  for (int index = 0; index < 10; index++)
+  for (int index = 0; index < (fromStandby ? 1 : 10); index++)
   {
     face->Update(ST77XX_WHITE, ST77XX_BLACK, false);
   }
@@ -214,19 +284,85 @@ void setup(void)
     }
   }
 
+#if KNOCK_DETECTOR_DSP
+  // Stream samples through the FIFO, the software knock detector replaces the tap logic
+  accelerometer->setDataRate(ADXL345_DATARATE_800HZ);
+  accelerometer->setFifoMode(ADXL345_FIFO_STREAM, KNOCK_FIFO_WATERMARK);
+  knockDetector = new KnockDetector(KNOCK_SAMPLE_RATE);
+  knockDetector->SetSensitivity(KNOCK_SENSITIVITY);
+  traceCapture = new TraceCapture(&Serial);
+
+  // The tap logic keeps running as reference for recorded traces, 5g, 0.5s on Z-Axis
+  accelerometer->setTapDetectionZ(1);
+  accelerometer->setTapThreshold(5);
+  accelerometer->setTapDuration(0.5);
+#if PIN_ACC_INT1 >= 0
+  // Only the watermark raises the line, the FIFO is drained when it is raised.
+  // Taps are enabled on INT2, otherwise INT_SOURCE never latches the tap flag for the traces
+  accelerometer->useInterrupts(1 << ADXL345_WATERMARK, 1 << ADXL345_SINGLE_TAP);
+  accelerometer->attachInterruptPin(PIN_ACC_INT1);
+#else
+  accelerometer->useInterrupt(ADXL345_INT1);
+#endif
+#else
   // Set tap detection on Z-Axis, 5g, 0.5s
   accelerometer->setTapDetectionZ(1);
   accelerometer->setTapThreshold(5);
   accelerometer->setTapDuration(0.5);
 
-  // Select INT 1 for get activities (Even if no INT1 is connected!)
+  // Select INT 1 for get activities
+#if PIN_ACC_INT1 >= 0
+  // Only taps raise the line, activities are read when it is raised
+  accelerometer->useInterrupt(ADXL345_INT1, 1 << ADXL345_SINGLE_TAP);
+  accelerometer->attachInterruptPin(PIN_ACC_INT1);
+#else
+  // No INT1 connected, activities are polled every loop
   accelerometer->useInterrupt(ADXL345_INT1);
+#endif
+#endif
+
+  // Write the changed configuration registers in one go
+  if (!accelerometer->commit())
+  {
+    Serial.println("[SETUP] Error: Could not configure ADXL345!");
+  }
+
+  // Move accelerometer reads of the loop (FIFO drains or activities) to a background task
+  if (!accelerometer->beginAsync())
+  {
+    Serial.println("[SETUP] Error: Could not start accelerometer task, reading synchronously");
+  }
+
+  // Register the knock rhythms and their reactions
+  knockRhythm = new KnockRhythm();
+  knockRhythm->AddTemplate(Rhythm3x, eReactionShy);
+  knockRhythm->AddTemplate(RhythmShaveAndHaircut, eReactionGiggle);
+  knockRhythm->AddTemplate(Rhythm2Plus2, eReactionAngry);
+
+  // Light sleep wakes on the accelerometer INT1 line, if it is connected
+  powerManager = new PowerManager();
+  powerManager->SetWakePin(PIN_ACC_INT1);
 
   // Initialize audio files
   Serial.println("[SETUP] Initialize Audio Files");
   tft->println("Init Files");
-  wavFileHey = new XT_Wav_Class(sounddata_data_Hey, sounddata_length_Hey);
-  wavFileGoAway = new XT_Wav_Class(sounddata_data_Go_away, sounddata_length_Go_away);
+  wavFileHey = new XT_Wav_Class(SoundBankData, SoundBankClips[SoundClip_Hey]);
+  wavFileGoAway = new XT_Wav_Class(SoundBankData, SoundBankClips[SoundClip_GoAway]);
+  synthCreak = new XT_Synth_Class(SynthCreak);
+  synthGiggle = new XT_Synth_Class(SynthGiggle);
+
+  // Count voice lines on SPIFFS, they are streamed instead of "Go away"
+  if (SPIFFS.begin(false))
+  {
+    while (voiceLineCount < VOICE_LINES_MAX &&
+      SPIFFS.exists(GetVoiceLinePath(voiceLineCount)))
+    {
+      voiceLineCount++;
+    }
+  }
+  wavFileVoice = new XT_SpiffsWav_Class(GetVoiceLinePath(0).c_str());
+  Serial.print("[SETUP] Voice lines on SPIFFS: ");
+  Serial.println(voiceLineCount);
 
   // Allow interrupts
   sei();
@@ -235,17 +371,32 @@ void setup(void)
   Serial.println("[SETUP] Initialize Audio (DAC)");
   tft->println("Init Audio");
   dacAudio = new XT_DAC_Audio_Class(PIN_DAC);
+  dacAudio->OnCueCompleted = OnSoundCompleted;
   dacAudio->Begin();
 
   // Final output
   Serial.println("[SETUP] Finished");
   tft->println("Setup Finished");
 
-  // Set the servo position to closed and reset screen
-  delay(500);
-  servo->SetAngle(ANGLE_CLOSED);
+  // Close the door smoothly and reset screen
+  if (!fromStandby)
+  {
+    WaitForServo();
+    delay(500);
+    servo->MoveTo(ANGLE_CLOSED, SERVO_CLOSE_MS, SERVO_PROFILE);
+    WaitForServo();
+  }
   tft->fillScreen(ST77XX_BLACK);
   dacAudio->Enable(false);
+
+  // The knock that woke from standby is not added to the rhythm. Its time is unknown, it came before the
+  // wake-up and the boot, and the FIFO only runs from the setup on. The rhythm starts with the next knock
+  activityTimestamp = millis();
+  powerManager->SetCpuFrequency(CPU_MHZ_IDLE);
+  powerManager->MarkReady();
+  Serial.print("[SETUP] Ready after ");
+  Serial.print(millis());
+  Serial.println(" ms");
 }
 
 //===============================================================
@@ -262,21 +413,116 @@ void loop()
     Serial.print("[LOOP] ");
     Serial.println(GetMemoryInfoString());
 
-    //dacAudio->PrintPlayitem();
-    //Serial.print("[LOOP] DAC Bufferusage: ");
-    //Serial.println(dacAudio->AverageBufferUsage());
+    // Print audio engine telemetry
+    Serial.print("[LOOP] Audio: ");
+    Serial.println(dacAudio->GetTelemetryString());
+
+    // Print time asleep and awake
+    Serial.print("[LOOP] Power: ");
+    Serial.println(powerManager->GetTelemetryString());
+
+    // Print accelerometer bus errors
+    Serial.print("[LOOP] Accelerometer I2C errors: ");
+    Serial.println(accelerometer->getErrorCount());
+
+#if KNOCK_DETECTOR_DSP
+    // Print knock detector statistics
+    Serial.printf("[LOOP] Knocks: %u, rejected: %u, latency: %u ms avg, %u ms max, %u cycles/sample\n",
+      knockDetector->Knocks, knockDetector->Rejected, knockDetector->LatencyAvgMs,
+      knockDetector->LatencyMaxMs, knockDetector->CyclesPerSample);
+#endif
   }
 
-  // Read accelerometer values
-  Activites activities = accelerometer->readActivites();
+  // Keep audio engine running, releases the DAC after a fade out
+  dacAudio->FillBuffer();
+
+#if KNOCK_DETECTOR_DSP
+  // Process the samples of the last FIFO drain, once the transfer task has read them
+  bool isTap = false;
+  uint8_t count = 0;
+  uint32_t drainTime = millis();
+  uint32_t tapTime = drainTime;
+  Activites activities = { };
+  if (accelerometer->pollFifo(count, drainTime, activities))
+  {
+    // A full FIFO may have overrun, the samples are not continuous anymore
+    if (count == ADXL345_FIFO_SIZE)
+    {
+      knockDetector->Reset();
+    }
+    if (knockDetector->Process(knockSamples, count, drainTime) > 0)
+    {
+      isTap = true;
+      tapTime = knockDetector->LastKnock.TimeMs;
+    }
+
+    // Stream the samples with the flags of the tap logic to Tools/TraceRecorder.py
+    if (traceCapture->IsRunning() &&
+      count > 0)
+    {
+      uint8_t flags = TraceCapture::PackActivites(activities);
+      traceCapture->WriteSamples(knockSamples, count, drainTime, flags);
+    }
+  }
 
-  // Check for tap and if last tap is more than 50ms ago (debounce)
-  if (activities.isTap &&
-    millis() - taps[(tapPointer - 1) % TAPS_MAX] > 50)
+  // Drain the FIFO in the background, only if the watermark was reached (or no INT1 line is connected).
+  // The samples arrive in one of the next loops, the loop never waits for the bus. The trace capture
+  // reads the flags of the tap logic in the same transfer
+  if (!accelerometer->isBusy() &&
+    accelerometer->isInterruptPending())
+  {
+    accelerometer->requestFifo(knockSamples, ADXL345_FIFO_SIZE, traceCapture->IsRunning());
+  }
+#else
+  // Read accelerometer values in the background, only if the sensor raised an event.
+  // The result arrives in one of the next loops, the loop never waits for the bus
+  if (accelerometer->isInterruptPending())
+  {
+    accelerometer->requestActivites();
+  }
+  Activites activities = { };
+  accelerometer->pollActivites(activities);
+  bool isTap = activities.isTap;
+  uint32_t tapTime = millis();
+#endif
+
+  // Match the knocks against the rhythms, a waiting match is decided once no further knock came in time
+  uint8_t reaction = knockRhythm->Update(millis());
+  if (isTap)
   {
-    taps[tapPointer] = millis();
-    tapPointer = (tapPointer + 1) % TAPS_MAX;
     Serial.println("[LOOP] Tap Detected");
+    activityTimestamp = millis();
+    uint8_t tapReaction = knockRhythm->AddTap(tapTime);
+    if (tapReaction != RHYTHM_NONE)
+    {
+      reaction = tapReaction;
+    }
+  }
+
+  // Serial debug trigger, "1" ... "3" selects the reaction, "t" starts and stops the trace capture
+  if (Serial.available())
+  {
+    char command = Serial.readString().charAt(0);
+    if (command >= '1' && command <= '3')
+    {
+      reaction = command - '1';
+      knockRhythm->LastRhythm = NULL;
+    }
+#if KNOCK_DETECTOR_DSP
+    else if (command == 't')
+    {
+      if (traceCapture->IsRunning())
+      {
+        traceCapture->Stop();
+        Serial.printf("[LOOP] Trace capture stopped, %u frames, %u dropped\n", traceCapture->Frames, traceCapture->Dropped);
+      }
+      else
+      {
+        Serial.println("[LOOP] Trace capture started");
+        traceCapture->Start(KNOCK_SAMPLE_RATE);
+      }
+    }
+#endif
   }
 
   // State machine
@@ -285,41 +531,39 @@ void loop()
     case eClosed:
       {
         // Check to start shy guy
-        if (Is3xKnock() ||
-          (Serial.available() &&
-          Serial.readString().startsWith("1")))
+        if (reaction != RHYTHM_NONE)
         {
           // Debug output
-          Serial.println("[LOOP] 3x Knock detected");
+          Serial.print("[LOOP] Knock rhythm detected: ");
+          Serial.println(knockRhythm->LastRhythm != NULL ? knockRhythm->LastRhythm->Name : "Serial");
+
+          // Full speed for the face and the audio
+          powerManager->SetCpuFrequency(CPU_MHZ_ACTIVE);
 
           // Init face for first time opening
           face->Update(ST77XX_WHITE, ST77XX_BLACK, false);
 
-          // Set random open time (2s, 3s, 4s or 5s)
-          openTime_ms = random(1, 5) * 1000;
-          withSound = random(0, 100) > 30;
-          withGoAway = openTime_ms > 2000;
-        
-          // Set the servo position to open
-          servo->SetAngle(ANGLE_OPEN);
-        
-          // Start face with a blink
-          face->DoBlink();
-          face->Update(ST77XX_WHITE, ST77XX_BLACK, true);
-
-          if (withSound)
-          {
-            // Start sound
-            Serial.println("[LOOP] Start playing 'Hey'");
-            dacAudio->Enable(true);
-            dacAudio->Play(wavFileHey);
-            activeSound = 1;
-          }
-
-          // Save open time and change state
+          // Open the door and start the reaction
+          StartReaction((Reaction)reaction);
+          shyGuyState = eOpening;
+
+          // Debug output
+          Serial.println("[LOOP] Opening started");
+        }
+      }
+      break;
+    case eOpening:
+      {
+        // Face and sound start with the movement
+        face->Update(ST77XX_WHITE, ST77XX_BLACK, true);
+        dacAudio->FillBuffer();
+
+        // The open time starts when the door is open
+        if (!servo->IsMoving())
+        {
           openTimestamp = millis();
           shyGuyState = eOpen;
-          
+
           // Debug output
           Serial.println("[LOOP] Opened");
         }
@@ -330,33 +574,15 @@ void loop()
         // Update face
         face->Update(ST77XX_WHITE, ST77XX_BLACK, true);
         
-        // Fill audio buffer
+        // Fill audio buffer, the engine chains the queued sounds
         dacAudio->FillBuffer();
 
-        // If sound play finished
-        if (activeSound == 1 &&
-          wavFileHey->Completed)
-        {
-          Serial.println("[LOOP] Playing 'Hey' finished");
-
-          if (withGoAway)
-          {
-            Serial.println("[LOOP] Start playing 'Go away'");
-            dacAudio->Play(wavFileGoAway);
-            activeSound = 2;
-          }
-          else
-          {
-            activeSound = -1;
-            dacAudio->Stop();
-            dacAudio->Enable(false);
-          }
-        }
-        if (activeSound == 2 &&
-          wavFileGoAway->Completed)
+        // Fade out after the last queued sound and the creak
+        if (withSound &&
+          dacAudio->IsQueueIdle() &&
+          synthCreak->Completed)
         {
-          Serial.println("[LOOP] Playing 'Go away' finished");
-          activeSound = -1;
+          withSound = false;
           dacAudio->Stop();
           dacAudio->Enable(false);
         }
@@ -367,25 +593,42 @@ void loop()
           // Debug output
           Serial.println("[LOOP] Open time finished -> close");
 
+          // Start closing the door
+          servo->MoveTo(ANGLE_CLOSED, SERVO_CLOSE_MS, SERVO_PROFILE);
+
+          // Reset screen
+          tft->fillScreen(ST77XX_BLACK);
+
+          // Stop sound
+          dacAudio->Stop();
+          dacAudio->Enable(false);
+          Serial.println("[LOOP] Stop playing sound");
+
           shyGuyState = eClosing;
         }
       }
       break;
     case eClosing:
       {
-        // Debug output
-        Serial.println("[LOOP] Closing started");
+        // Let the audio output fade out while the door moves
+        dacAudio->FillBuffer();
+        if (servo->IsMoving())
+        {
+          break;
+        }
 
-        // Set the servo position to closed
-        servo->SetAngle(ANGLE_CLOSED);
-        
-        // Reset screen
-        tft->fillScreen(ST77XX_BLACK);
+#if KNOCK_DETECTOR_DSP
+        // The door movement is no knock, let the filters settle again
+        knockDetector->Reset();
+#endif
+        knockRhythm->Clear();
+        activityTimestamp = millis();
 
-        // Stop sound
-        dacAudio->Stop();
-        dacAudio->Enable(false);
-        Serial.println("[LOOP] Stop playing sound");
+        // The reaction is over, the next one starts from the normal face
+        face->Expression.GoTo_Normal();
+
+        // Back to the idle frequency, the fade out of the audio output needs no loop
+        powerManager->SetCpuFrequency(CPU_MHZ_IDLE);
         
         // Reset shy guy state
         shyGuyState = eClosed;
@@ -397,17 +640,177 @@ void loop()
     default:
       break;
   }
+
+#if IDLE_SLEEP
+  // Light sleep while closed and idle, the FIFO (or the latched tap) keeps the knocks meanwhile.
+  // Not while a host has the serial port open, the S2 cannot wake on USB and its CDC connection stops during sleep.
+  // Not while the servo gets pulses, the LEDC stops during light sleep
+  if (shyGuyState == eClosed &&
+    dacAudio->IsIdle() &&
+    servo->IsIdle() &&
+    !accelerometer->isBusy() &&
+    !Serial)
+  {
+    powerManager->LightSleep(PIN_ACC_INT1 >= 0 ? IDLE_SLEEP_MAX_MS : IDLE_POLL_MS);
+  }
+#endif
+
+#if PIN_ACC_INT1 >= 0
+  // Deep sleep standby after a long time closed without a knock, same conditions as the light sleep
+  if (shyGuyState == eClosed &&
+    millis() - activityTimestamp > STANDBY_AFTER_MS &&
+    dacAudio->IsIdle() &&
+    !accelerometer->isBusy() &&
+    !Serial)
+  {
+    EnterStandby();
+  }
+#endif
+}
+
+//===============================================================
+// Waits for the end of a servo move, only used in the setup
+//===============================================================
+void WaitForServo()
+{
+  while (servo->IsMoving())
+  {
+    delay(SERVO_UPDATE_US / 1000);
+  }
+}
+
+//===============================================================
+// Powers down display and servo and deep sleeps until the
+// accelerometer detects activity
+//===============================================================
+void EnterStandby()
+{
+  Serial.println("[LOOP] Standby");
+
+  // Display off, the panel sleeps and the backlight is switched off
+  tft->enableDisplay(false);
+  tft->enableSleep(true);
+#if PIN_TFT_BL >= 0
+  digitalWrite(PIN_TFT_BL, LOW);
+  gpio_hold_en((gpio_num_t)PIN_TFT_BL);
+#endif
+
+  // Servo off, the signal is held low through deep sleep so the servo does not twitch
+  servo->Detach();
+  gpio_hold_en((gpio_num_t)PIN_SERVO);
+  gpio_deep_sleep_hold_en();
+
+  // Accelerometer only raises INT1 on activity, AC coupled so gravity does not count
+  accelerometer->setFifoMode(ADXL345_FIFO_BYPASS);
+  accelerometer->setDataRate(ADXL345_DATARATE_100HZ);
+  accelerometer->setActivityThreshold(STANDBY_ACTIVITY_G);
+  accelerometer->setActivityAcCoupled(true);
+  accelerometer->setActivityXYZ(true);
+  accelerometer->useInterrupt(ADXL345_INT1, 1 << ADXL345_ACTIVITY);
+  accelerometer->commit();
+
+  // Clear pending events, INT1 has to be low when the sleep starts
+  accelerometer->readActivites();
+  powerManager->EnterStandby();
+}
+
+//===============================================================
+// Opens the door and starts the face and sounds of a reaction
+//===============================================================
+void StartReaction(Reaction reaction)
+{
+  switch (reaction)
+  {
+    case eReactionGiggle:
+      {
+        openTime_ms = 4000;
+        withSound = true;
+        withGoAway = false;
+        face->Expression.GoTo_Happy();
+      }
+      break;
+    case eReactionAngry:
+      {
+        openTime_ms = 2000;
+        withSound = true;
+        withGoAway = true;
+        face->Expression.GoTo_Angry();
+      }
+      break;
+    default:
+      {
+        // Set random open time (2s, 3s, 4s or 5s)
+        openTime_ms = random(1, 5) * 1000;
+        withSound = random(0, 100) > 30;
+        withGoAway = openTime_ms > 2000;
+      }
+      break;
+  }
+
+  // Start opening the door, the state machine waits in eOpening for the end of the move
+  servo->MoveTo(ANGLE_OPEN, SERVO_OPEN_MS, SERVO_PROFILE);
+
+  // Start face with a blink
+  face->DoBlink();
+  face->Update(ST77XX_WHITE, ST77XX_BLACK, true);
+
+  if (!withSound)
+  {
+    return;
+  }
+
+  // Fade in audio output with the door creak, the queued sounds start when the fade is done
+  dacAudio->Enable(true);
+  dacAudio->Play(synthCreak, 1, MIXER_GAIN_UNITY / 2);
+  if (reaction == eReactionGiggle)
+  {
+    dacAudio->Enqueue(synthGiggle);
+    Serial.println("[LOOP] Queued giggle");
+  }
+  else if (reaction != eReactionAngry)
+  {
+    dacAudio->Enqueue(wavFileHey);
+    Serial.println("[LOOP] Queued 'Hey'");
+  }
+
+  if (withGoAway)
+  {
+    // Prefer a random voice line from SPIFFS, if there are any
+    XT_Wav_Class* wavFileNext = wavFileGoAway;
+    if (voiceLineCount > 0 &&
+      wavFileVoice->Open(GetVoiceLinePath(random(0, voiceLineCount)).c_str()))
+    {
+      wavFileNext = wavFileVoice;
+    }
+    dacAudio->Enqueue(wavFileNext);
+    Serial.println("[LOOP] Queued 'Go away'");
+  }
 }
 
 //===============================================================
-// Returns true if the last three knocks are within the tap window 
+// Called between the bands of a frame push, keeps the audio buffer filled
 //===============================================================
-bool Is3xKnock()
+void OnFaceBand()
 {
-  uint32_t knockTimeLast = taps[(tapPointer - 1) % TAPS_MAX];
-  uint32_t knockTimeFirst = taps[(tapPointer - 3) % TAPS_MAX];
+  if (dacAudio != NULL)
+  {
+    dacAudio->FillBuffer();
+  }
+}
 
-  // The last knock was less than 500ms ago and the three knocks are less than the set window apart
-  return millis() - knockTimeLast < 500 &&
-    knockTimeLast - knockTimeFirst < TAPS_WINDOW_MS;
+//===============================================================
+// Called by the audio engine when a queued sound has finished
+//===============================================================
+void OnSoundCompleted(XT_Wav_Class* wav)
+{
+  Serial.println(wav == wavFileHey ? "[LOOP] Playing 'Hey' finished" :
+    wav == synthGiggle ? "[LOOP] Playing giggle finished" : "[LOOP] Playing 'Go away' finished");
+}
+
+//===============================================================
+// Returns the SPIFFS path of a voice line
+//===============================================================
+String GetVoiceLinePath(uint16_t index)
+{
+  return "/Voice" + String(index) + ".wav";
 }
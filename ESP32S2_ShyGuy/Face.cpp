@@ -122,7 +122,18 @@ void Face::Draw(uint32_t color, uint32_t backGroundColor)
 	RightEye.CenterY = CenterY;
 	RightEye.Draw(_canvas, color, backGroundColor);
 
-  _tft->drawRGBBitmap(0, 0, _canvas->getBuffer(), _canvas->width(), _canvas->height());
+  // Push the frame in bands, a full frame takes longer than the audio buffer lasts
+  uint16_t* buffer = _canvas->getBuffer();
+  int16_t width = _canvas->width();
+  int16_t height = _canvas->height();
+  for (int16_t y = 0; y < height; y += FACE_BAND_HEIGHT)
+  {
+    if (y > 0 && OnBand != NULL)
+    {
+      OnBand();
+    }
+    _tft->drawRGBBitmap(0, y, buffer + (uint32_t)y * width, width, min(FACE_BAND_HEIGHT, height - y));
+  }
 
   FaceDebug("[FACE] Face: End Draw");
 }
@@ -23,6 +23,11 @@ You should have received a copy of the GNU Affero General Public License along w
 #include "LookAssistant.h"
 #include "BlinkAssistant.h"
 
+// Rows of the canvas pushed to the display at once
+#define FACE_BAND_HEIGHT 24
+
+typedef void(*FaceBandCallback)();
+
 class Face
 {
   public:
@@ -51,6 +56,9 @@ class Face
     bool RandomLook = true;
     bool RandomBlink = true;
 
+    // Called between two bands of a frame push, e.g. to keep audio fed
+    FaceBandCallback OnBand = NULL;
+
     void LookLeft();
     void LookRight();
     void LookFront();
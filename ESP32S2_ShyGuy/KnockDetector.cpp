@@ -0,0 +1,152 @@
+/**
+ * Knock detector on accelerometer FIFO samples
+ *
+ * @author    Florian Staeblein
+ * @date      2026/10/18
+ * @copyright © 2026 Florian Staeblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include "KnockDetector.h"
+
+
+//===============================================================
+// Constructor
+//===============================================================
+KnockDetector::KnockDetector(uint16_t sampleRate)
+{
+  _sampleRate = sampleRate;
+
+  // alpha = RC / (RC + dt) = 1 / (1 + 2 * pi * fc / fs)
+  _alpha = (int32_t)(32768.0f / (1.0f + 2.0f * PI * KNOCK_HIGHPASS_HZ / sampleRate));
+
+  SetSensitivity(50);
+  Reset();
+}
+
+//===============================================================
+// Sets the sensitivity, 0 (~0.8 g) ... 100 (~0.025 g)
+//===============================================================
+void KnockDetector::SetSensitivity(uint8_t sensitivity)
+{
+  // 40000 is the energy of a 200 LSB (0.8 g) peak on one axis
+  sensitivity = min(sensitivity, (uint8_t)100);
+  int32_t energy = 40000 >> (sensitivity / 10);
+
+  // Interpolate between the halving steps
+  _minEnergy = energy - (energy / 2) * (sensitivity % 10) / 10;
+}
+
+//===============================================================
+// Clears the filters, e.g. after a gap in the samples
+//===============================================================
+void KnockDetector::Reset()
+{
+  _primed = false;
+  _highPass[0] = 0;
+  _highPass[1] = 0;
+  _highPass[2] = 0;
+  _envelope = 0;
+  _active = false;
+  _deadUntil = _sample + MsToSamples(KNOCK_SETTLE_MS);
+  _settleUntil = _deadUntil;
+}
+
+//===============================================================
+// Converts milliseconds to samples
+//===============================================================
+uint32_t KnockDetector::MsToSamples(uint32_t ms)
+{
+  return ms * _sampleRate / 1000;
+}
+
+//===============================================================
+// Processes raw samples, the last one taken at nowMs. Returns the
+// number of knocks found, the last one is in LastKnock
+//===============================================================
+uint8_t KnockDetector::Process(const RawSample *samples, uint8_t count, uint32_t nowMs)
+{
+  uint32_t startCycles = ESP.getCycleCount();
+  uint32_t maxKnock = MsToSamples(KNOCK_MAX_MS);
+  uint32_t lastSample = _sample + count - 1;
+  uint8_t knocks = 0;
+
+  for (uint8_t index = 0; index < count; index++, _sample++)
+  {
+    const RawSample &input = samples[index];
+    if (!_primed)
+    {
+      _lastInput = input;
+      _primed = true;
+    }
+
+    // High-pass per axis: y[n] = alpha * (y[n-1] + x[n] - x[n-1])
+    _highPass[0] = (_alpha * (_highPass[0] + input.XAxis - _lastInput.XAxis)) >> 15;
+    _highPass[1] = (_alpha * (_highPass[1] + input.YAxis - _lastInput.YAxis)) >> 15;
+    _highPass[2] = (_alpha * (_highPass[2] + input.ZAxis - _lastInput.ZAxis)) >> 15;
+    _lastInput = input;
+
+    // Energy envelope, fast attack and slower decay (~8 samples) that bridges the zero crossings
+    int32_t energy = _highPass[0] * _highPass[0] + _highPass[1] * _highPass[1] + _highPass[2] * _highPass[2];
+    int32_t delta = energy - _envelope;
+    _envelope += delta > 0 ? delta >> 1 : delta >> 3;
+
+    int32_t threshold = _floor * KNOCK_FLOOR_FACTOR + _minEnergy;
+    if (!_active)
+    {
+      // Noise floor follows the envelope slowly (~256 samples) outside of events. It falls faster (~32 samples),
+      // the ringing of a rejected slam must not hold the threshold above the next knocks
+      if (_sample >= _settleUntil)
+      {
+        int32_t floorDelta = _envelope - _floor;
+        _floor += floorDelta > 0 ? floorDelta >> 8 : floorDelta >> 5;
+      }
+
+      // Event onset
+      if (_sample >= _deadUntil &&
+        _envelope > threshold)
+      {
+        _active = true;
+        _onset = _sample;
+        _peak = _envelope;
+      }
+      continue;
+    }
+
+    // Peak picking until the envelope falls below half of the threshold or 1/16 of the peak
+    _peak = max(_peak, _envelope);
+    if (_sample - _onset > maxKnock ||
+      _peak >= KNOCK_SLAM_ENERGY)
+    {
+      // Too long or too strong, a slam or drop
+      _active = false;
+      _deadUntil = _sample + MsToSamples(KNOCK_REJECT_MS);
+      Rejected++;
+    }
+    else if (_envelope < threshold / 2 ||
+      _envelope < (_peak >> 4))
+    {
+      // Short event, a knock
+      uint16_t latencyMs = (_sample - _onset) * 1000 / _sampleRate;
+      LastKnock.TimeMs = nowMs - (lastSample - _onset) * 1000 / _sampleRate;
+      LastKnock.Peak = _peak;
+      LastKnock.LatencyMs = latencyMs;
+      LatencyAvgMs = Knocks == 0 ? latencyMs : (LatencyAvgMs * 7 + latencyMs) / 8;
+      LatencyMaxMs = max(LatencyMaxMs, latencyMs);
+      Knocks++;
+      knocks++;
+
+      _active = false;
+      _deadUntil = _sample + MsToSamples(KNOCK_REFRACTORY_MS);
+    }
+  }
+
+  if (count > 0)
+  {
+    uint32_t cycles = (uint32_t)(ESP.getCycleCount() - startCycles) / count;
+    CyclesPerSample = CyclesPerSample == 0 ? cycles : (CyclesPerSample * 7 + cycles) / 8;
+  }
+  return knocks;
+}
@@ -0,0 +1,103 @@
+/**
+ * Knock detector on accelerometer FIFO samples
+ *
+ * @author    Florian Staeblein
+ * @date      2026/10/18
+ * @copyright © 2026 Florian Staeblein
+ *
+ * ==============================================================
+ *
+ * Fixed-point pipeline per sample (800 Hz or more):
+ *   1. First order high-pass per axis, removes gravity and the
+ *      slow motion of the door
+ *   2. Energy (sum of squares of all axes) with a fast attack,
+ *      slow decay envelope
+ *   3. Adaptive threshold: noise floor * factor + minimum energy
+ *      (set by the sensitivity). The floor rises slowly and falls
+ *      fast, so it recovers quickly after a slam
+ *   4. Peak picking: an event starts when the envelope crosses the
+ *      threshold and ends when it falls below half of it (or far
+ *      below its peak). Short events are knocks, long or very
+ *      strong ones (door slams, drops) are rejected
+ *
+ * ==============================================================
+ */
+
+#ifndef KNOCKDETECTOR_H
+#define KNOCKDETECTOR_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <Arduino.h>
+#include "ADXL345.h"
+
+
+//===============================================================
+// Defines
+//===============================================================
+#define KNOCK_HIGHPASS_HZ       30    // Cutoff of the high-pass filter
+#define KNOCK_MAX_MS            40    // Longest event still counted as knock
+#define KNOCK_REFRACTORY_MS     80    // Dead time after a knock
+#define KNOCK_REJECT_MS         300   // Dead time after a rejected event
+#define KNOCK_SETTLE_MS         50    // Dead time after a reset, the filters settle
+#define KNOCK_SLAM_ENERGY       250000 // Peak energy of a slam (~500 LSB, 2 g)
+#define KNOCK_FLOOR_FACTOR      8     // Threshold above the noise floor
+
+
+//===============================================================
+// Detected knock
+//===============================================================
+typedef struct
+{
+  uint32_t TimeMs;      // Time of the onset (millis)
+  uint32_t Peak;        // Peak energy
+  uint16_t LatencyMs;   // Time from onset to classification
+} KnockEvent;
+
+//===============================================================
+// Knock detector class
+//===============================================================
+class KnockDetector
+{
+  public:
+    // Constructor
+    KnockDetector(uint16_t sampleRate);
+
+    // Sets the sensitivity, 0 (~0.8 g) ... 100 (~0.025 g), each 10 steps halve the energy threshold
+    void SetSensitivity(uint8_t sensitivity);
+
+    // Clears the filters, e.g. after a gap in the samples
+    void Reset();
+
+    // Processes raw samples, the last one taken at nowMs. Returns the number of knocks found
+    uint8_t Process(const RawSample *samples, uint8_t count, uint32_t nowMs);
+
+    KnockEvent LastKnock = { };         // Last detected knock
+    uint32_t Knocks = 0;                // Detected knocks
+    uint32_t Rejected = 0;              // Rejected events (slams)
+    uint16_t LatencyAvgMs = 0;          // Smoothed classification latency
+    uint16_t LatencyMaxMs = 0;          // Highest classification latency
+    uint32_t CyclesPerSample = 0;       // Smoothed CPU cycles per processed sample
+
+  private:
+    uint16_t _sampleRate;
+    int32_t _alpha;                     // High-pass coefficient (Q15)
+    int32_t _minEnergy;                 // Threshold above the noise floor
+    RawSample _lastInput = { };         // Previous input sample
+    int32_t _highPass[3] = { };         // High-pass output per axis
+    int32_t _envelope = 0;              // Energy envelope
+    int32_t _floor = 0;                 // Noise floor of the envelope
+    uint32_t _sample = 0;               // Processed samples
+    uint32_t _deadUntil = 0;            // No events before this sample
+    uint32_t _settleUntil = 0;          // No noise floor update before this sample
+    bool _primed = false;               // Previous input sample is valid
+    bool _active = false;               // Envelope above the threshold
+    uint32_t _onset = 0;                // Sample of the event onset
+    int32_t _peak = 0;                  // Peak energy of the event
+
+    // Converts milliseconds to samples
+    uint32_t MsToSamples(uint32_t ms);
+};
+
+#endif
@@ -0,0 +1,210 @@
+/**
+ * Knock rhythm recognizer
+ *
+ * @author    Florian Staeblein
+ * @date      2026/10/18
+ * @copyright © 2026 Florian Staeblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include "KnockRhythm.h"
+
+
+//===============================================================
+// Registers a template with its reaction
+//===============================================================
+bool KnockRhythm::AddTemplate(const RhythmTemplate& rhythm, uint8_t reaction)
+{
+  if (_templateCount >= RHYTHM_TEMPLATES_MAX ||
+    rhythm.IntervalCount == 0 ||
+    rhythm.IntervalCount > RHYTHM_INTERVALS_MAX)
+  {
+    return false;
+  }
+
+  // Longer intervals would be cut by the pause that starts a new sequence
+  for (uint8_t index = 0; index < rhythm.IntervalCount; index++)
+  {
+    if (rhythm.Intervals[index] == 0 ||
+      rhythm.Intervals[index] > RHYTHM_INTERVAL_MAX)
+    {
+      return false;
+    }
+  }
+
+  _templates[_templateCount].Rhythm = &rhythm;
+  _templates[_templateCount].Reaction = reaction;
+  _templateCount++;
+  return true;
+}
+
+//===============================================================
+// Forgets all knocks
+//===============================================================
+void KnockRhythm::Clear()
+{
+  _count = 0;
+  _pending = -1;
+}
+
+//===============================================================
+// Returns the tap of the current sequence, 0 = first
+//===============================================================
+uint32_t KnockRhythm::Tap(uint8_t index)
+{
+  return _taps[(_head - _count + index) & (RHYTHM_TAPS_MAX - 1)];
+}
+
+//===============================================================
+// Checks the first count intervals of a template against the
+// newest count + 1 knocks, earlier knocks of the sequence are
+// ignored. Returns the beat length in ms or 0. The deviation is
+// the largest one of an interval in percent of its tolerance
+//===============================================================
+uint32_t KnockRhythm::Match(const RhythmTemplate& rhythm, uint8_t count, uint8_t* deviation)
+{
+  if (_count < count + 1)
+  {
+    return 0;
+  }
+  uint8_t first = _count - 1 - count;
+
+  // Beat length from all matched knocks, averages the jitter of single knocks
+  uint32_t beats = 0;
+  for (uint8_t index = 0; index < count; index++)
+  {
+    beats += rhythm.Intervals[index];
+  }
+  uint32_t beatMs = (Tap(first + count) - Tap(first)) / beats;
+  if (beatMs < RHYTHM_BEAT_MIN_MS ||
+    beatMs > RHYTHM_BEAT_MAX_MS)
+  {
+    return 0;
+  }
+
+  // Every interval within the tolerance
+  int32_t worst = 0;
+  for (uint8_t index = 0; index < count; index++)
+  {
+    int32_t expected = rhythm.Intervals[index] * beatMs;
+    int32_t actual = Tap(first + index + 1) - Tap(first + index);
+    int32_t tolerance = expected * RHYTHM_TOLERANCE / 100 + RHYTHM_SLACK_MS;
+    if (abs(actual - expected) > tolerance)
+    {
+      return 0;
+    }
+    worst = max(worst, abs(actual - expected) * 100 / tolerance);
+  }
+  if (deviation != NULL)
+  {
+    *deviation = worst;
+  }
+  return beatMs;
+}
+
+//===============================================================
+// Reports a template and starts a new sequence
+//===============================================================
+uint8_t KnockRhythm::Decide(int8_t index)
+{
+  LastRhythm = _templates[index].Rhythm;
+  Clear();
+  return _templates[index].Reaction;
+}
+
+//===============================================================
+// Adds a knock, returns the reaction of a recognized rhythm or
+// RHYTHM_NONE
+//===============================================================
+uint8_t KnockRhythm::AddTap(uint32_t timeMs)
+{
+  if (_count > 0)
+  {
+    uint32_t last = Tap(_count - 1);
+    if (timeMs - last < RHYTHM_DEBOUNCE_MS)
+    {
+      return RHYTHM_NONE;
+    }
+
+    // A long pause starts a new sequence
+    if (timeMs - last > RHYTHM_PAUSE_MS)
+    {
+      _count = 0;
+    }
+  }
+
+  // Ring of timestamps, the oldest knock is overwritten
+  _taps[_head] = timeMs;
+  _head = (_head + 1) & (RHYTHM_TAPS_MAX - 1);
+  _count = min((uint8_t)(_count + 1), (uint8_t)RHYTHM_TAPS_MAX);
+  _pending = -1;
+
+  // Complete match on the newest knocks, the one that covers the most knocks, then the one with the smallest
+  // deviation. Stray knocks before a rhythm do not prevent it
+  int8_t matched = -1;
+  uint8_t matchedIntervals = 0;
+  uint8_t matchedDeviation = 0;
+  for (uint8_t index = 0; index < _templateCount; index++)
+  {
+    uint8_t intervals = _templates[index].Rhythm->IntervalCount;
+    uint8_t deviation;
+    if (intervals >= matchedIntervals &&
+      Match(*_templates[index].Rhythm, intervals, &deviation) > 0 &&
+      (intervals > matchedIntervals || deviation < matchedDeviation))
+    {
+      matched = index;
+      matchedIntervals = intervals;
+      matchedDeviation = deviation;
+    }
+  }
+
+  // Longer templates that started on the same or an earlier knock and still fit. On the same knocks only if
+  // they fit better than the complete match, sequences between two rhythms go to the closer one instead of
+  // waiting for the next knock. A longer template that started earlier explains more knocks, it is awaited
+  uint32_t waitMs = 0;
+  for (uint8_t index = 0; index < _templateCount && matched >= 0; index++)
+  {
+    const RhythmTemplate& rhythm = *_templates[index].Rhythm;
+    for (uint8_t intervals = matchedIntervals; intervals < rhythm.IntervalCount && intervals < _count; intervals++)
+    {
+      // Wait for the next interval of the longer template, plus its tolerance
+      uint8_t deviation;
+      uint32_t beatMs = Match(rhythm, intervals, &deviation);
+      if (beatMs > 0 &&
+        (intervals > matchedIntervals || deviation < matchedDeviation))
+      {
+        uint32_t expected = rhythm.Intervals[intervals] * beatMs;
+        waitMs = max(waitMs, expected + expected * RHYTHM_TOLERANCE / 100 + RHYTHM_SLACK_MS);
+      }
+    }
+  }
+
+  if (matched < 0)
+  {
+    return RHYTHM_NONE;
+  }
+  if (waitMs == 0)
+  {
+    return Decide(matched);
+  }
+
+  _pending = matched;
+  _pendingUntil = timeMs + waitMs;
+  return RHYTHM_NONE;
+}
+
+//===============================================================
+// Decides a waiting match once no further knock came in time,
+// returns its reaction or RHYTHM_NONE
+//===============================================================
+uint8_t KnockRhythm::Update(uint32_t nowMs)
+{
+  if (_pending < 0 ||
+    (int32_t)(nowMs - _pendingUntil) < 0)
+  {
+    return RHYTHM_NONE;
+  }
+  return Decide(_pending);
+}
@@ -0,0 +1,120 @@
+/**
+ * Knock rhythm recognizer
+ *
+ * @author    Florian Staeblein
+ * @date      2026/10/18
+ * @copyright © 2026 Florian Staeblein
+ *
+ * ==============================================================
+ *
+ * Keeps the timestamps of the last knocks in a ring and matches
+ * the newest knocks of the current sequence (since the last long
+ * pause) against registered rhythm templates, so stray knocks
+ * before a rhythm are ignored. A template lists the intervals
+ * between its knocks in beats, the length of a beat is taken
+ * from the knocks themselves, so a rhythm matches at any tempo
+ * within RHYTHM_BEAT_MIN_MS ... RHYTHM_BEAT_MAX_MS.
+ *
+ * A match is reported right at its last knock. Only if a longer
+ * template still starts the same way and fits the knocks better,
+ * or started on an earlier knock, the decision waits for the
+ * next knock, at most one expected interval. Of several complete
+ * matches the longest, then the closest one wins.
+ *
+ * ==============================================================
+ */
+
+#ifndef KNOCKRHYTHM_H
+#define KNOCKRHYTHM_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <Arduino.h>
+
+
+//===============================================================
+// Defines
+//===============================================================
+#define RHYTHM_TAPS_MAX         16    // Ring size, power of two
+#define RHYTHM_INTERVALS_MAX    (RHYTHM_TAPS_MAX - 1)
+#define RHYTHM_TEMPLATES_MAX    8
+#define RHYTHM_DEBOUNCE_MS      50    // Taps closer than this are one knock
+#define RHYTHM_BEAT_MIN_MS      60    // Fastest accepted beat
+#define RHYTHM_BEAT_MAX_MS      400   // Slowest accepted beat
+#define RHYTHM_INTERVAL_MAX     4     // Longest interval of a template in beats
+#define RHYTHM_TOLERANCE        25    // Accepted deviation of an interval in percent
+#define RHYTHM_SLACK_MS         10    // Accepted deviation on top, the timing of short intervals jitters most
+
+// A longer pause starts a new sequence, longer than the longest interval at the slowest beat
+#define RHYTHM_PAUSE_MS         (RHYTHM_BEAT_MAX_MS * RHYTHM_INTERVAL_MAX * (100 + RHYTHM_TOLERANCE) / 100 + RHYTHM_SLACK_MS)
+#define RHYTHM_NONE             0xFF  // No reaction
+
+
+//===============================================================
+// Rhythm template, intervals between the knocks in beats
+//===============================================================
+typedef struct
+{
+  const char* Name;
+  uint8_t IntervalCount;
+  uint8_t Intervals[RHYTHM_INTERVALS_MAX]; // 1 ... RHYTHM_INTERVAL_MAX beats
+} RhythmTemplate;
+
+// Three even knocks
+const RhythmTemplate Rhythm3x = { "3x", 2, { 1, 1 } };
+
+// "Shave and a haircut - two bits": knock, knock-knock, knock, knock, (pause), knock, knock
+const RhythmTemplate RhythmShaveAndHaircut = { "Shave and a haircut", 6, { 2, 1, 1, 2, 4, 2 } };
+
+// Two pairs of knocks
+const RhythmTemplate Rhythm2Plus2 = { "2+2", 3, { 1, 3, 1 } };
+
+
+//===============================================================
+// Knock rhythm class
+//===============================================================
+class KnockRhythm
+{
+  public:
+    // Registers a template with its reaction, returns false if the list is full or an interval is out of range
+    bool AddTemplate(const RhythmTemplate& rhythm, uint8_t reaction);
+
+    // Adds a knock, returns the reaction of a recognized rhythm or RHYTHM_NONE
+    uint8_t AddTap(uint32_t timeMs);
+
+    // Decides a waiting match once no further knock came in time, returns its reaction or RHYTHM_NONE
+    uint8_t Update(uint32_t nowMs);
+
+    // Forgets all knocks
+    void Clear();
+
+    const RhythmTemplate* LastRhythm = NULL;  // Last recognized template
+
+  private:
+    struct Entry
+    {
+      const RhythmTemplate* Rhythm;
+      uint8_t Reaction;
+    };
+
+    uint32_t _taps[RHYTHM_TAPS_MAX];
+    uint8_t _head = 0;                  // Next write position
+    uint8_t _count = 0;                 // Knocks of the current sequence
+    Entry _templates[RHYTHM_TEMPLATES_MAX];
+    uint8_t _templateCount = 0;
+    int8_t _pending = -1;               // Matched template waiting for a longer one
+    uint32_t _pendingUntil = 0;         // Decision time of the waiting match
+
+    // Returns the tap of the current sequence, 0 = first
+    uint32_t Tap(uint8_t index);
+
+    // Checks the first count intervals of a template against the newest count + 1 knocks, returns the beat length
+    // in ms or 0. The deviation is the largest one of an interval in percent of its tolerance
+    uint32_t Match(const RhythmTemplate& rhythm, uint8_t count, uint8_t* deviation = NULL);
+
+    // Reports a template and starts a new sequence
+    uint8_t Decide(int8_t index);
+};
+
+#endif
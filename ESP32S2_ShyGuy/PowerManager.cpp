@@ -0,0 +1,226 @@
+/**
+ * Power management of the ESP32-S2
+ *
+ * @author    Florian Staeblein
+ * @date      2026/10/18
+ * @copyright © 2026 Florian Staeblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include "PowerManager.h"
+
+
+//===============================================================
+// Kept in RTC memory through deep sleep
+//===============================================================
+RTC_DATA_ATTR uint32_t StandbyCount = 0;
+
+// Supported CPU frequencies, all with 80 MHz APB clock
+const uint32_t CpuFrequencies[CPU_FREQUENCY_COUNT] = { 80, 160, 240 };
+
+
+//===============================================================
+// Constructor
+//===============================================================
+PowerManager::PowerManager()
+{
+  for (uint8_t index = 0; index < CPU_FREQUENCY_COUNT; index++)
+  {
+    if (CpuFrequencies[index] == getCpuFrequencyMhz())
+    {
+      _cpuIndex = index;
+    }
+  }
+  ResetTelemetry();
+}
+
+//===============================================================
+// Sets the GPIO that ends a light sleep on high level
+//===============================================================
+void PowerManager::SetWakePin(int pin)
+{
+  _wakePin = pin;
+}
+
+//===============================================================
+// Light sleeps for up to maxMs, returns true if it slept
+//===============================================================
+bool PowerManager::LightSleep(uint32_t maxMs)
+{
+  if (maxMs < SLEEP_MIN_MS)
+  {
+    return false;
+  }
+
+  // The GPIO wake-up needs a level interrupt, the edge interrupt of the pin is restored afterwards
+  esp_sleep_enable_timer_wakeup((uint64_t)maxMs * 1000);
+  if (_wakePin >= 0)
+  {
+    gpio_wakeup_enable((gpio_num_t)_wakePin, GPIO_INTR_HIGH_LEVEL);
+    esp_sleep_enable_gpio_wakeup();
+  }
+
+  uint64_t startUs = esp_timer_get_time();
+  esp_err_t result = esp_light_sleep_start();
+  uint64_t sleptUs = esp_timer_get_time() - startUs;
+
+  if (_wakePin >= 0)
+  {
+    gpio_wakeup_disable((gpio_num_t)_wakePin);
+    gpio_set_intr_type((gpio_num_t)_wakePin, GPIO_INTR_POSEDGE);
+  }
+
+  if (result != ESP_OK)
+  {
+    _telemetry.Rejected++;
+    return false;
+  }
+
+  _telemetry.Sleeps++;
+  _telemetry.AsleepUs += sleptUs;
+  switch (esp_sleep_get_wakeup_cause())
+  {
+    case ESP_SLEEP_WAKEUP_GPIO:
+      _telemetry.PinWakes++;
+      break;
+    case ESP_SLEEP_WAKEUP_TIMER:
+      _telemetry.TimerWakes++;
+      break;
+    default:
+      break;
+  }
+  return true;
+}
+
+//===============================================================
+// Deep sleeps until the wake pin is high, never returns
+//===============================================================
+void PowerManager::EnterStandby()
+{
+  StandbyCount++;
+
+  // The light sleeps leave their timer and GPIO wake-ups enabled, they would end the standby at once
+  esp_sleep_disable_wakeup_source(ESP_SLEEP_WAKEUP_ALL);
+  if (_wakePin >= 0)
+  {
+    esp_sleep_enable_ext0_wakeup((gpio_num_t)_wakePin, 1);
+  }
+  esp_deep_sleep_start();
+}
+
+//===============================================================
+// Returns true if the chip started from a standby
+//===============================================================
+bool PowerManager::WokeFromStandby()
+{
+  return esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_EXT0;
+}
+
+//===============================================================
+// Records the end of the setup, the time since the start of the
+// sketch (the ROM and second stage bootloader come on top)
+//===============================================================
+void PowerManager::MarkReady()
+{
+  _telemetry.BootToReadyMs = millis();
+}
+
+//===============================================================
+// Sets the CPU frequency (80, 160 or 240 MHz), returns false for
+// other values
+//===============================================================
+bool PowerManager::SetCpuFrequency(uint32_t mhz)
+{
+  uint8_t index = 0;
+  while (index < CPU_FREQUENCY_COUNT &&
+    CpuFrequencies[index] != mhz)
+  {
+    index++;
+  }
+  if (index == CPU_FREQUENCY_COUNT)
+  {
+    return false;
+  }
+  if (index == _cpuIndex)
+  {
+    return true;
+  }
+
+  CountCpuTime(_telemetry);
+  if (!setCpuFrequencyMhz(mhz))
+  {
+    return false;
+  }
+  _cpuIndex = index;
+  _telemetry.CpuSwitches++;
+  return true;
+}
+
+//===============================================================
+// Adds the time awake since the last frequency change to the
+// current frequency
+//===============================================================
+void PowerManager::CountCpuTime(PowerTelemetry& telemetry)
+{
+  uint64_t nowUs = esp_timer_get_time();
+  telemetry.CpuUs[_cpuIndex] += (nowUs - _cpuSinceUs) - (telemetry.AsleepUs - _cpuSinceAsleepUs);
+  if (&telemetry == &_telemetry)
+  {
+    _cpuSinceUs = nowUs;
+    _cpuSinceAsleepUs = telemetry.AsleepUs;
+  }
+}
+
+//===============================================================
+// Returns a snapshot of the telemetry counters
+//===============================================================
+PowerTelemetry PowerManager::GetTelemetry()
+{
+  PowerTelemetry telemetry = _telemetry;
+  telemetry.Standbys = StandbyCount;
+  CountCpuTime(telemetry);
+  telemetry.AwakeUs = esp_timer_get_time() - _startUs - telemetry.AsleepUs;
+  return telemetry;
+}
+
+//===============================================================
+// Resets the telemetry counters
+//===============================================================
+void PowerManager::ResetTelemetry()
+{
+  uint32_t bootToReadyMs = _telemetry.BootToReadyMs;
+  _telemetry = { };
+  _telemetry.BootToReadyMs = bootToReadyMs;
+  _startUs = esp_timer_get_time();
+  _cpuSinceUs = _startUs;
+  _cpuSinceAsleepUs = 0;
+}
+
+//===============================================================
+// Returns the telemetry as one line string
+//===============================================================
+String PowerManager::GetTelemetryString()
+{
+  PowerTelemetry telemetry = GetTelemetry();
+  uint64_t totalUs = telemetry.AsleepUs + telemetry.AwakeUs;
+
+  String returnString;
+  returnString += "Asleep: " + String(totalUs > 0 ? 100.0f * telemetry.AsleepUs / totalUs : 0.0f, 1) + " %";
+  returnString += ", Sleeps: " + String(telemetry.Sleeps);
+  returnString += " (avg " + String(telemetry.Sleeps > 0 ? (uint32_t)(telemetry.AsleepUs / telemetry.Sleeps / 1000) : 0) + " ms";
+  returnString += ", pin/timer wakes: " + String(telemetry.PinWakes) + "/" + String(telemetry.TimerWakes);
+  returnString += ", rejected: " + String(telemetry.Rejected) + ")";
+  returnString += ", Awake: " + String((uint32_t)(telemetry.AwakeUs / 1000)) + " ms";
+  returnString += ", CPU";
+  for (uint8_t index = 0; index < CPU_FREQUENCY_COUNT; index++)
+  {
+    returnString += " " + String(CpuFrequencies[index]) + " MHz: " + String((uint32_t)(telemetry.CpuUs[index] / 1000)) + " ms";
+  }
+  returnString += " (" + String(telemetry.CpuSwitches) + " switches)";
+  returnString += ", Standbys: " + String(telemetry.Standbys);
+  returnString += ", Boot to ready: " + String(telemetry.BootToReadyMs) + " ms";
+
+  return returnString;
+}
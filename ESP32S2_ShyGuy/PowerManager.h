@@ -0,0 +1,117 @@
+/**
+ * Power management of the ESP32-S2
+ *
+ * @author    Florian Staeblein
+ * @date      2026/10/18
+ * @copyright © 2026 Florian Staeblein
+ *
+ * ==============================================================
+ *
+ * Light sleep between sensor checks while the door is closed.
+ * The CPU, its clocks and the USB peripheral stop, RAM and the
+ * GPIO states are kept and the code continues after the sleep
+ * call. Wakes on a high level of the wake pin (accelerometer
+ * INT1) or a timer, in well below 1 ms.
+ *
+ * Deep sleep standby for long idle periods. Only the RTC domain
+ * stays powered, a high level of the wake pin resets the chip and
+ * the sketch starts again from setup, which restores the state
+ * from WokeFromStandby() instead of running the full boot.
+ *
+ * CPU frequency per state. 80, 160 and 240 MHz all run the APB
+ * bus at 80 MHz, so the LEDC servo PWM, I2C, the USB and the audio
+ * timer keep their timing across a switch. Lower frequencies would
+ * lower the APB clock as well and are not offered.
+ *
+ * The time asleep and awake and the time at each CPU frequency are
+ * counted as proxy of the average current, measured with the
+ * esp_timer, which keeps counting through light sleep.
+ *
+ * ==============================================================
+ */
+
+#ifndef POWERMANAGER_H
+#define POWERMANAGER_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <Arduino.h>
+#include "esp_sleep.h"
+#include "esp_timer.h"
+#include "driver/gpio.h"
+
+
+//===============================================================
+// Defines
+//===============================================================
+#define SLEEP_MIN_MS            2     // Shorter sleeps cost more than they save
+#define CPU_FREQUENCY_COUNT     3     // 80, 160, 240 MHz
+
+
+//===============================================================
+// Power telemetry, counted since the start or the last reset
+//===============================================================
+typedef struct
+{
+  uint64_t AsleepUs;            // Time spent in light sleep
+  uint64_t AwakeUs;             // Time spent awake
+  uint32_t Sleeps;              // Light sleeps
+  uint32_t PinWakes;            // Light sleeps ended by the wake pin
+  uint32_t TimerWakes;          // Light sleeps ended by the timer
+  uint32_t Rejected;            // Light sleeps the system refused
+  uint32_t Standbys;            // Deep sleep standbys since power on
+  uint32_t BootToReadyMs;       // Start of the sketch to the end of the setup
+  uint64_t CpuUs[CPU_FREQUENCY_COUNT]; // Time awake at 80, 160, 240 MHz
+  uint32_t CpuSwitches;         // CPU frequency changes
+} PowerTelemetry;
+
+//===============================================================
+// Power manager class
+//===============================================================
+class PowerManager
+{
+  public:
+    // Constructor
+    PowerManager();
+
+    // Sets the GPIO that ends a light sleep on high level (-1 = timer only)
+    void SetWakePin(int pin);
+
+    // Light sleeps for up to maxMs, returns true if it slept
+    bool LightSleep(uint32_t maxMs);
+
+    // Deep sleeps until the wake pin is high, never returns. Pins that must keep their level are held before
+    void EnterStandby();
+
+    // Returns true if the chip started from a standby
+    static bool WokeFromStandby();
+
+    // Records the end of the setup for the boot-to-ready time
+    void MarkReady();
+
+    // Sets the CPU frequency (80, 160 or 240 MHz), returns false for other values
+    bool SetCpuFrequency(uint32_t mhz);
+
+    // Returns a snapshot of the telemetry counters
+    PowerTelemetry GetTelemetry();
+
+    // Resets the telemetry counters
+    void ResetTelemetry();
+
+    // Returns the telemetry as one line string
+    String GetTelemetryString();
+
+  private:
+    int _wakePin = -1;
+    uint64_t _startUs = 0;              // Start of the telemetry period
+    uint64_t _cpuSinceUs = 0;           // Start of the current CPU frequency
+    uint64_t _cpuSinceAsleepUs = 0;     // Time asleep at that start
+    uint8_t _cpuIndex = CPU_FREQUENCY_COUNT - 1;
+
+    // Adds the time awake since the last frequency change to the current frequency
+    void CountCpuTime(PowerTelemetry& telemetry);
+    PowerTelemetry _telemetry = { };
+};
+
+#endif
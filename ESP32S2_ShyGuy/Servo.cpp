@@ -5,35 +5,332 @@
  * @date      2024/04/12
  * @copyright © 2024 Florian Staeblein
  */
- 
+
 //===============================================================
 // Includes
 //===============================================================
 #include "Servo.h"
 
+
+//===============================================================
+// Calibration of the servo
+//===============================================================
+const ServoCalibrationPoint ServoCalibration[] = SERVO_CALIBRATION;
+
 //===============================================================
 // Servo constructor
 //===============================================================
 Servo::Servo(uint8_t pin)
 {
   _pin = pin;
+  BuildDutyTable(ServoCalibration, sizeof(ServoCalibration) / sizeof(ServoCalibration[0]));
 
   // PWM frequency 50Hz
-  // 12 bits resolution
+  // 14 bits resolution
   ledcAttach(_pin, _frequency, _resolution);
+  _attached = true;
+
+  // The esp_timer runs the callback from its own task, the loop never waits for a move
+  esp_timer_create_args_t timerArgs = { };
+  timerArgs.callback = OnTimer;
+  timerArgs.arg = this;
+  timerArgs.name = "Servo";
+  timerArgs.skip_unhandled_events = true;
+  esp_timer_create(&timerArgs, &_timer);
 }
 
 //===============================================================
-// Sets the angle of the servo
+// Sets the angle of the servo, stops a running move
 //===============================================================
 void Servo::SetAngle(int16_t value)
 {
-  value = min(value, (int16_t)180);
+  StopTimer();
+
+  value = min(value, (int16_t)SERVO_ANGLE_MAX);
+  value = max(value, (int16_t)0);
+  WriteAngle(value);
+  StartSettling();
+}
+
+//===============================================================
+// Moves to the angle in the given time along the profile
+//===============================================================
+void Servo::MoveTo(int16_t value, uint16_t durationMs, eServoProfile profile)
+{
+  value = min(value, (int16_t)SERVO_ANGLE_MAX);
   value = max(value, (int16_t)0);
+  if (durationMs == 0 ||
+    _timer == NULL)
+  {
+    SetAngle(value);
+    return;
+  }
+
+  // A new move starts from where the running one is
+  StopTimer();
+  portENTER_CRITICAL(&_mux);
+  _startAngle = _angle;
+  _targetAngle = value;
+  _profile = profile;
+  _durationUs = (uint32_t)durationMs * 1000;
+  _startUs = esp_timer_get_time();
+  _phase = ServoPhase_Moving;
+  portEXIT_CRITICAL(&_mux);
+
+  esp_timer_start_periodic(_timer, SERVO_UPDATE_US);
+}
+
+//===============================================================
+// Returns true while a move is running
+//===============================================================
+bool Servo::IsMoving()
+{
+  return _phase == ServoPhase_Moving;
+}
+
+//===============================================================
+// Returns true if no pulses are output
+//===============================================================
+bool Servo::IsIdle()
+{
+  return _phase == ServoPhase_Idle && !_attached;
+}
+
+//===============================================================
+// Returns the current angle of the trajectory
+//===============================================================
+float Servo::GetAngle()
+{
+  return _angle;
+}
+
+//===============================================================
+// Sets what happens after a move once the settle time is over,
+// takes effect with the next settle phase
+//===============================================================
+void Servo::SetHoldPolicy(eServoHold hold, uint16_t settleMs, uint16_t keepAliveMs)
+{
+  _hold = hold;
+  _settleUs = (uint32_t)settleMs * 1000;
+  _keepAliveUs = (uint32_t)max(keepAliveMs, (uint16_t)(2 * SERVO_UPDATE_US / 1000)) * 1000;
+
+  // Only stored, a running settle phase or the next move applies it. Writing here would drive the servo to an unknown angle
+}
+
+//===============================================================
+// Stops the timer and the phase
+//===============================================================
+void Servo::StopTimer()
+{
+  if (_phase != ServoPhase_Idle)
+  {
+    esp_timer_stop(_timer);
+    _phase = ServoPhase_Idle;
+  }
+}
+
+//===============================================================
+// Starts the settle phase after the last write
+//===============================================================
+void Servo::StartSettling()
+{
+  if (_hold == ServoHold_Always ||
+    _timer == NULL)
+  {
+    return;
+  }
+
+  _startUs = esp_timer_get_time();
+  _phase = ServoPhase_Settling;
+  esp_timer_start_periodic(_timer, SERVO_UPDATE_US);
+}
+
+//===============================================================
+// Applies the hold policy at the end of the settle phase
+//===============================================================
+void Servo::Hold()
+{
+  switch (_hold)
+  {
+    case ServoHold_Release:
+      Detach();
+      break;
+    case ServoHold_KeepAlive:
+      // Duty 0 keeps the signal low from the next period on, the LEDC stays attached
+      ledcWrite(_pin, 0);
+      _pulseOn = false;
+      _startUs = esp_timer_get_time();
+      _phase = ServoPhase_KeepAlive;
+      break;
+    default:
+      StopTimer();
+      break;
+  }
+}
+
+//===============================================================
+// Timer callback, advances the trajectory and the hold policy
+//===============================================================
+void Servo::OnTimer(void* parameter)
+{
+  Servo* servo = (Servo*)parameter;
+  int64_t nowUs = esp_timer_get_time();
+
+  switch (servo->_phase)
+  {
+    case ServoPhase_Settling:
+      if (nowUs - servo->_startUs >= servo->_settleUs)
+      {
+        servo->Hold();
+      }
+      return;
+    case ServoPhase_KeepAlive:
+      // One period with the pulse, the LEDC takes a new duty at the start of the next period
+      if (servo->_pulseOn)
+      {
+        ledcWrite(servo->_pin, 0);
+        servo->_pulseOn = false;
+      }
+      else if (nowUs - servo->_startUs >= servo->_keepAliveUs)
+      {
+        servo->WriteAngle(servo->_angle);
+        servo->_pulseOn = true;
+        servo->_startUs = nowUs;
+      }
+      return;
+    case ServoPhase_Moving:
+      break;
+    default:
+      return;
+  }
+
+  portENTER_CRITICAL(&servo->_mux);
+  float time = (float)(nowUs - servo->_startUs) / servo->_durationUs;
+  float start = servo->_startAngle;
+  float target = servo->_targetAngle;
+  eServoProfile profile = servo->_profile;
+  portEXIT_CRITICAL(&servo->_mux);
+
+  if (time >= 1.0f)
+  {
+    // Last step exactly on the target, then the settle phase of the hold policy
+    servo->WriteAngle(target);
+    if (servo->_hold == ServoHold_Always)
+    {
+      servo->StopTimer();
+      return;
+    }
+    servo->_startUs = nowUs;
+    servo->_phase = ServoPhase_Settling;
+    return;
+  }
+  servo->WriteAngle(start + (target - start) * Profile(profile, time));
+}
+
+//===============================================================
+// Returns the position (0 ... 1) of a profile at the time (0 ... 1)
+//===============================================================
+float Servo::Profile(eServoProfile profile, float time)
+{
+  switch (profile)
+  {
+    case ServoProfile_Trapezoid:
+      {
+        // Velocity ramps linearly up in the first and down in the last part, the peak velocity is 1 / (1 - ramp)
+        const float ramp = SERVO_TRAPEZOID_RAMP;
+        const float scale = 1.0f / (2.0f * ramp * (1.0f - ramp));
+        if (time < ramp)
+        {
+          return time * time * scale;
+        }
+        if (time > 1.0f - ramp)
+        {
+          float rest = 1.0f - time;
+          return 1.0f - rest * rest * scale;
+        }
+        return (time - ramp / 2.0f) / (1.0f - ramp);
+      }
+    case ServoProfile_SCurve:
+      {
+        // Minimum jerk: 10t^3 - 15t^4 + 6t^5, velocity and acceleration are zero at both ends
+        return time * time * time * (10.0f + time * (-15.0f + time * 6.0f));
+      }
+    default:
+      return time;
+  }
+}
+
+//===============================================================
+// Fills the duty table from the calibration points, linear
+// between the points
+//===============================================================
+void Servo::BuildDutyTable(const ServoCalibrationPoint* points, uint8_t count)
+{
+  uint32_t periodUs = 1000000 / _frequency;
+  uint8_t point = 0;
+  for (uint16_t angle = 0; angle <= SERVO_ANGLE_MAX; angle++)
+  {
+    // Segment of the angle, the ends are extended beyond the first and last point
+    while (point + 2 < count &&
+      angle > points[point + 1].Angle)
+    {
+      point++;
+    }
+
+    int32_t pulseUs = points[0].PulseUs;
+    if (count > 1)
+    {
+      const ServoCalibrationPoint& from = points[point];
+      const ServoCalibrationPoint& to = points[point + 1];
+      pulseUs = from.PulseUs + ((int32_t)to.PulseUs - from.PulseUs) * ((int32_t)angle - from.Angle) / (to.Angle - from.Angle);
+    }
+    pulseUs = constrain(pulseUs, 0, (int32_t)periodUs);
+
+    // Rounded to the next duty step
+    _dutyTable[angle] = (uint16_t)((((uint32_t)pulseUs << _resolution) + periodUs / 2) / periodUs);
+  }
+}
+
+//===============================================================
+// Writes the duty of an angle, interpolated between the full
+// degrees of the table
+//===============================================================
+void Servo::WriteAngle(float angle)
+{
+  _angle = angle;
+
+  uint16_t index = (uint16_t)angle;
+  uint16_t duty = _dutyTable[min(index, (uint16_t)SERVO_ANGLE_MAX)];
+  if (index < SERVO_ANGLE_MAX)
+  {
+    float fraction = angle - index;
+    duty = (uint16_t)(duty + ((int32_t)_dutyTable[index + 1] - duty) * fraction + 0.5f);
+  }
+
+  // Attach again after Detach
+  if (!_attached)
+  {
+    ledcAttach(_pin, _frequency, _resolution);
+    _attached = true;
+  }
 
-  int16_t pwmValueUs = map(value, 0, 180, _servoMinUs, _servoMaxUs);
-  int16_t duty = pwmValueUs * 4096 / 20000;
-  
   // Write value
   ledcWrite(_pin, duty);
 }
+
+//===============================================================
+// Stops the PWM, the signal stays low
+//===============================================================
+void Servo::Detach()
+{
+  StopTimer();
+  if (!_attached)
+  {
+    return;
+  }
+
+  ledcDetach(_pin);
+  pinMode(_pin, OUTPUT);
+  digitalWrite(_pin, LOW);
+  _attached = false;
+}
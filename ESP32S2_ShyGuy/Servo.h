@@ -5,7 +5,7 @@
  * @date      2024/04/12
  * @copyright © 2024 Florian Staeblein
  */
- 
+
 #ifndef SERVO_H
 #define SERVO_H
 
@@ -14,11 +14,69 @@
 //===============================================================
 #include <Arduino.h>
 #include "Driver/ledc.h"
+#include "esp_timer.h"
 
 
 // Values for SG90 servos; adjust if needed
-#define MIN_MICROS      800
-#define MAX_MICROS      2450
+#define MIN_MICROS      544   // Pulse at 0°
+#define MAX_MICROS      2400  // Pulse at 180°
+
+// Per unit calibration, measured pulse (μs) at an angle (°), sorted by angle, from 0° to 180°.
+// Points in between correct the non-linearity of the servo; adjust for your servo
+#define SERVO_CALIBRATION       { { 0, MIN_MICROS }, { 90, (MIN_MICROS + MAX_MICROS) / 2 }, { 180, MAX_MICROS } }
+
+// PWM, 14 bits is the highest LEDC resolution of the ESP32-S2 (1.2 μs steps at 50 Hz)
+#define SERVO_FREQUENCY         50
+#define SERVO_RESOLUTION        14
+#define SERVO_ANGLE_MAX         180
+
+// Trajectory updates, once per PWM period
+#define SERVO_UPDATE_US         20000
+#define SERVO_TRAPEZOID_RAMP    0.25f // Share of the move time spent accelerating (and decelerating)
+
+// Hold policy defaults
+#define SERVO_DEFAULT_SETTLE_MS     300   // Pulses after a move until the servo reached the angle
+#define SERVO_DEFAULT_KEEPALIVE_MS  500   // Pulse interval of ServoHold_KeepAlive
+
+//===============================================================
+// Calibration point, pulse width at an angle
+//===============================================================
+typedef struct
+{
+  uint8_t Angle;    // Angle (°)
+  uint16_t PulseUs; // Measured pulse width (μs)
+} ServoCalibrationPoint;
+
+//===============================================================
+// Velocity profiles of a move
+//===============================================================
+typedef enum
+{
+  ServoProfile_Linear,      // Constant speed, jumps to full speed
+  ServoProfile_Trapezoid,   // Constant acceleration, cruise, constant deceleration
+  ServoProfile_SCurve       // Minimum jerk, acceleration ramps smoothly in and out
+} eServoProfile;
+
+//===============================================================
+// Hold policy after a move has settled
+//===============================================================
+typedef enum
+{
+  ServoHold_Always,         // Pulses all the time, the servo actively holds the angle
+  ServoHold_Release,        // No pulses, the gear friction holds the angle (no holding current, no chatter)
+  ServoHold_KeepAlive       // One pulse per keep-alive interval, corrects a drift with little current
+} eServoHold;
+
+//===============================================================
+// Phase of the timer callback
+//===============================================================
+typedef enum
+{
+  ServoPhase_Idle,          // Timer stopped
+  ServoPhase_Moving,        // Trajectory running
+  ServoPhase_Settling,      // Pulses until the settle time is over
+  ServoPhase_KeepAlive      // Single pulses per keep-alive interval
+} eServoPhase;
 
 //===============================================================
 // Servo class
@@ -29,15 +87,75 @@ class Servo
     // Constructor
     Servo(uint8_t pin);
 
-    // Sets the angle of the servo
+    // Sets the angle of the servo, attaches the PWM again after Detach. Stops a running move
     void SetAngle(int16_t value);
 
+    // Moves to the angle in the given time along the profile, returns at once.
+    // The duty is updated from a timer every PWM period
+    void MoveTo(int16_t value, uint16_t durationMs, eServoProfile profile = ServoProfile_SCurve);
+
+    // Returns true while a move is running
+    bool IsMoving();
+
+    // Returns true if no pulses are output: no move, settle or keep-alive running and the PWM is detached.
+    // The LEDC stops during light sleep, the servo has to be idle before
+    bool IsIdle();
+
+    // Returns the current angle of the trajectory (degrees)
+    float GetAngle();
+
+    // Sets what happens after a move (or SetAngle) once the settle time is over, from the next move on. The next move attaches again
+    void SetHoldPolicy(eServoHold hold, uint16_t settleMs = SERVO_DEFAULT_SETTLE_MS, uint16_t keepAliveMs = SERVO_DEFAULT_KEEPALIVE_MS);
+
+    // Stops the PWM, the signal stays low and the servo holds no position
+    void Detach();
+
   private:
     uint8_t _pin;
-    uint32_t _frequency = 50;    // PWM frequency (Hz)
-    uint8_t _resolution = 12;    // Bits, determines the number of steps in PWM period
-    uint16_t _servoMinUs = 544;  // Minimum servo pulse in μs (544)
-    uint16_t _servoMaxUs = 2400; // Maximum servo pulse in μs (2400)
+    bool _attached = false;
+    uint32_t _frequency = SERVO_FREQUENCY;    // PWM frequency (Hz)
+    uint8_t _resolution = SERVO_RESOLUTION;   // Bits, determines the number of steps in PWM period
+
+    // Duty of each full degree, from the calibration
+    uint16_t _dutyTable[SERVO_ANGLE_MAX + 1];
+
+    // Trajectory, written by MoveTo and the timer callback
+    esp_timer_handle_t _timer = NULL;
+    portMUX_TYPE _mux = portMUX_INITIALIZER_UNLOCKED;
+    volatile eServoPhase _phase = ServoPhase_Idle;
+    float _startAngle = 0;
+    float _targetAngle = 0;
+    volatile float _angle = 0;
+    int64_t _startUs = 0;
+    uint32_t _durationUs = 0;
+    eServoProfile _profile = ServoProfile_SCurve;
+
+    // Hold policy, the settle and keep-alive phases reuse _startUs
+    eServoHold _hold = ServoHold_Always;
+    uint32_t _settleUs = (uint32_t)SERVO_DEFAULT_SETTLE_MS * 1000;
+    uint32_t _keepAliveUs = (uint32_t)SERVO_DEFAULT_KEEPALIVE_MS * 1000;
+    bool _pulseOn = false;
+
+    // Stops the timer and the phase
+    void StopTimer();
+
+    // Starts the settle phase after the last write
+    void StartSettling();
+
+    // Applies the hold policy at the end of the settle phase (timer callback)
+    void Hold();
+
+    // Fills the duty table from the calibration points
+    void BuildDutyTable(const ServoCalibrationPoint* points, uint8_t count);
+
+    // Writes the duty of an angle, interpolated between the full degrees
+    void WriteAngle(float angle);
+
+    // Timer callback, advances the trajectory and the hold policy
+    static void OnTimer(void* parameter);
+
+    // Returns the position (0 ... 1) of a profile at the time (0 ... 1)
+    static float Profile(eServoProfile profile, float time);
 };
 
 #endif
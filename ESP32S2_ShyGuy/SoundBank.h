@@ -0,0 +1,1802 @@
+/**
+ * Flash resident sound bank
+ *
+ * Generated by Tools/SoundBankGenerator.py from Sounds/SoundBank.json, do not edit!
+ */
+
+#ifndef SOUNDBANK_H
+#define SOUNDBANK_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <Arduino.h>
+#include "XT_DAC_Audio.h"
+
+
+//===============================================================
+// Clip indices
+//===============================================================
+enum eSoundClips
+{
+  SoundClip_Hey = 0,
+  SoundClip_GoAway,
+  SOUNDCLIPS_COUNT
+};
+
+//===============================================================
+// Clip names
+//===============================================================
+const char* const SoundClipNames[SOUNDCLIPS_COUNT] =
+{
+  "Hey",
+  "GoAway",
+};
+
+//===============================================================
+// Clip table (offset, length, sample rate, format)
+//===============================================================
+constexpr SoundClip SoundBankClips[SOUNDCLIPS_COUNT] =
+{
+  { 0, 9589, 25000, SoundFormat_PCM8 }, // Hey
+  { 9589, 25270, 25000, SoundFormat_PCM8 }, // GoAway
+};
+
+//===============================================================
+// Sample data of all clips (34859 bytes)
+//===============================================================
+const uint8_t SoundBankData[34859] PROGMEM =
+{
+  128, 128, 128, 128, 126, 126, 127, 128, 128, 126, 126, 126, 128, 128, 127, 126, 126, 126, 128, 128,
+  126, 126, 126, 126, 126, 126, 126, 126, 128, 128, 128, 128, 128, 128, 128, 128, 126, 125, 125, 126,
+  128, 128, 128, 128, 128, 129, 128, 127, 124, 124, 126, 127, 128, 128, 127, 126, 124, 126, 127, 129,
+  129, 128, 128, 128, 128, 126, 126, 125, 124, 124, 126, 127, 128, 128, 126, 126, 126, 127, 128, 128,
+  127, 126, 126, 128, 131, 129, 126, 123, 122, 124, 128, 129, 129, 127, 124, 124, 126, 126, 124, 124,
+  126, 129, 132, 133, 132, 129, 125, 122, 124, 126, 127, 128, 127, 126, 126, 126, 126, 128, 126, 126,
+  126, 127, 129, 129, 128, 127, 126, 126, 126, 126, 127, 128, 127, 124, 122, 122, 123, 127, 129, 129,
+  128, 126, 126, 127, 131, 133, 132, 128, 125, 122, 122, 124, 126, 128, 126, 126, 126, 127, 130, 131,
+  131, 129, 127, 126, 124, 124, 124, 124, 126, 127, 129, 132, 133, 128, 121, 115, 117, 126, 135, 141,
+  141, 133, 127, 124, 122, 121, 120, 122, 123, 125, 126, 125, 122, 122, 122, 125, 129, 132, 136, 135,
+  133, 127, 121, 118, 121, 123, 126, 128, 129, 129, 131, 128, 123, 118, 117, 121, 128, 134, 135, 133,
+  128, 123, 120, 120, 124, 128, 133, 135, 134, 129, 125, 121, 118, 118, 120, 123, 128, 132, 133, 131,
+  127, 124, 126, 128, 129, 129, 130, 130, 129, 125, 122, 120, 122, 126, 129, 129, 128, 128, 129, 133,
+  135, 132, 125, 116, 114, 118, 127, 131, 130, 127, 126, 127, 129, 129, 125, 120, 122, 130, 139, 136,
+  123, 110, 111, 130, 151, 155, 139, 114, 97, 103, 120, 134, 133, 124, 118, 123, 133, 140, 135, 123,
+  116, 120, 132, 139, 139, 130, 119, 113, 113, 117, 124, 130, 134, 135, 135, 136, 134, 128, 119, 114,
+  116, 121, 130, 134, 135, 128, 121, 120, 125, 130, 135, 133, 127, 121, 120, 125, 129, 131, 133, 130,
+  126, 119, 115, 116, 120, 125, 130, 133, 135, 136, 135, 129, 121, 115, 115, 124, 134, 136, 128, 115,
+  109, 111, 122, 131, 135, 134, 132, 129, 128, 131, 135, 133, 127, 122, 125, 130, 131, 126, 121, 120,
+  122, 126, 128, 126, 124, 124, 126, 126, 129, 134, 139, 141, 141, 139, 134, 127, 116, 107, 106, 112,
+  121, 125, 126, 124, 127, 134, 137, 135, 129, 126, 129, 133, 137, 134, 129, 123, 116, 113, 116, 120,
+  122, 122, 124, 129, 136, 140, 136, 129, 124, 130, 137, 136, 127, 117, 118, 125, 131, 129, 123, 116,
+  114, 120, 128, 134, 136, 137, 136, 130, 122, 120, 121, 123, 125, 125, 128, 131, 130, 123, 115, 115,
+  120, 130, 137, 138, 133, 127, 123, 122, 126, 129, 128, 122, 120, 118, 121, 124, 126, 127, 132, 136,
+  137, 133, 129, 128, 126, 125, 124, 125, 128, 127, 123, 118, 114, 114, 120, 128, 136, 140, 133, 120,
+  113, 121, 136, 148, 148, 138, 129, 120, 118, 120, 118, 112, 108, 108, 119, 133, 143, 144, 135, 126,
+  124, 127, 133, 137, 135, 128, 121, 118, 121, 126, 129, 127, 121, 116, 119, 125, 132, 131, 131, 129,
+  133, 138, 139, 135, 128, 118, 113, 113, 116, 124, 133, 140, 138, 130, 121, 121, 125, 130, 134, 134,
+  131, 128, 123, 120, 122, 126, 129, 127, 123, 120, 122, 125, 127, 129, 128, 123, 120, 125, 131, 137,
+  136, 131, 128, 125, 117, 114, 118, 126, 133, 129, 121, 120, 125, 132, 134, 130, 127, 126, 128, 131,
+  131, 126, 118, 110, 108, 115, 128, 140, 143, 139, 134, 130, 129, 129, 129, 128, 125, 124, 125, 131,
+  130, 119, 107, 104, 114, 133, 146, 146, 138, 126, 121, 121, 122, 124, 125, 126, 125, 124, 124, 121,
+  120, 122, 127, 133, 134, 131, 128, 130, 137, 143, 141, 136, 124, 115, 111, 113, 116, 121, 122, 119,
+  118, 122, 132, 138, 135, 129, 127, 132, 142, 148, 144, 131, 111, 94, 90, 108, 132, 149, 146, 130,
+  119, 121, 132, 141, 137, 126, 121, 125, 132, 132, 125, 113, 108, 110, 119, 132, 141, 143, 133, 126,
+  124, 124, 124, 124, 126, 129, 135, 143, 140, 129, 115, 108, 108, 114, 121, 125, 126, 130, 138, 145,
+  143, 132, 119, 109, 112, 125, 141, 148, 139, 126, 116, 114, 117, 122, 128, 126, 122, 120, 122, 128,
+  135, 136, 131, 128, 129, 134, 140, 139, 131, 121, 116, 112, 112, 113, 118, 126, 131, 136, 140, 139,
+  129, 118, 116, 127, 138, 145, 142, 131, 128, 131, 138, 139, 125, 104, 91, 94, 116, 140, 151, 148,
+  135, 123, 118, 121, 125, 127, 130, 133, 139, 142, 136, 123, 109, 99, 101, 113, 130, 144, 143, 134,
+  123, 120, 126, 129, 124, 120, 121, 128, 135, 139, 138, 132, 123, 111, 104, 107, 117, 129, 135, 133,
+  133, 135, 137, 136, 132, 127, 123, 122, 124, 128, 125, 119, 114, 117, 126, 131, 130, 128, 128, 133,
+  139, 143, 140, 133, 121, 109, 105, 109, 125, 141, 149, 146, 133, 118, 107, 104, 113, 124, 134, 139,
+  137, 133, 130, 125, 120, 117, 118, 127, 135, 136, 127, 113, 109, 113, 124, 133, 134, 128, 126, 129,
+  129, 129, 128, 126, 126, 129, 137, 145, 144, 131, 111, 101, 102, 113, 125, 133, 134, 129, 128, 133,
+  139, 136, 125, 117, 118, 130, 140, 142, 137, 130, 130, 133, 132, 122, 110, 105, 110, 124, 135, 142,
+  140, 133, 124, 118, 121, 126, 128, 128, 130, 131, 131, 128, 121, 114, 117, 127, 141, 149, 148, 138,
+  123, 110, 105, 109, 114, 120, 126, 131, 132, 126, 122, 122, 124, 126, 127, 127, 130, 132, 130, 124,
+  122, 126, 126, 120, 115, 118, 127, 135, 134, 127, 122, 120, 122, 126, 130, 135, 135, 133, 130, 132,
+  140, 146, 140, 122, 106, 101, 107, 117, 127, 136, 143, 143, 134, 124, 119, 122, 131, 142, 150, 148,
+  136, 121, 117, 124, 135, 138, 126, 109, 97, 102, 113, 127, 136, 137, 133, 132, 134, 136, 137, 132,
+  127, 120, 114, 111, 111, 109, 109, 112, 121, 130, 136, 137, 129, 123, 122, 125, 129, 126, 120, 120,
+  128, 135, 136, 132, 126, 115, 106, 110, 128, 147, 152, 136, 118, 114, 126, 140, 140, 131, 129, 135,
+  142, 142, 140, 136, 129, 122, 117, 120, 122, 121, 116, 113, 123, 141, 154, 151, 133, 116, 111, 116,
+  126, 137, 144, 139, 129, 119, 116, 116, 113, 109, 109, 116, 124, 126, 123, 118, 113, 115, 119, 120,
+  118, 122, 129, 135, 131, 125, 122, 127, 132, 136, 134, 128, 126, 128, 132, 133, 129, 128, 126, 120,
+  118, 121, 130, 137, 140, 137, 135, 136, 139, 143, 143, 137, 132, 132, 136, 138, 135, 129, 123, 122,
+  124, 127, 131, 134, 135, 133, 128, 122, 120, 124, 122, 116, 109, 115, 129, 142, 140, 126, 110, 103,
+  104, 105, 105, 112, 126, 135, 131, 121, 113, 108, 103, 100, 100, 115, 135, 152, 155, 145, 132, 119,
+  109, 107, 114, 129, 147, 154, 152, 149, 144, 133, 117, 105, 107, 122, 142, 159, 164, 156, 138, 120,
+  111, 116, 131, 147, 157, 155, 146, 136, 129, 126, 120, 110, 102, 105, 119, 137, 143, 138, 124, 112,
+  104, 101, 107, 114, 122, 126, 124, 119, 114, 111, 107, 102, 96, 97, 105, 118, 128, 137, 145, 146,
+  143, 136, 131, 129, 129, 127, 126, 126, 126, 129, 129, 124, 117, 114, 122, 136, 150, 160, 159, 152,
+  144, 143, 143, 139, 134, 127, 126, 125, 125, 127, 133, 136, 133, 128, 128, 134, 139, 138, 129, 121,
+  116, 115, 114, 112, 104, 96, 90, 99, 118, 139, 147, 136, 115, 99, 98, 108, 116, 113, 107, 105,
+  109, 113, 119, 125, 131, 136, 143, 156, 168, 167, 149, 128, 112, 105, 111, 122, 132, 140, 139, 135,
+  138, 140, 141, 135, 128, 127, 136, 146, 156, 158, 153, 144, 135, 127, 127, 129, 133, 130, 121, 114,
+  116, 121, 123, 118, 110, 107, 107, 112, 121, 126, 128, 124, 122, 119, 115, 110, 102, 97, 95, 98,
+  102, 105, 107, 114, 123, 128, 132, 138, 150, 159, 162, 158, 150, 140, 127, 113, 103, 101, 105, 111,
+  119, 133, 145, 150, 143, 137, 138, 147, 156, 159, 155, 148, 145, 140, 137, 135, 131, 124, 116, 112,
+  118, 132, 143, 146, 143, 132, 121, 111, 102, 98, 100, 105, 110, 112, 115, 119, 119, 114, 105, 100,
+  101, 106, 112, 116, 118, 121, 120, 116, 112, 115, 122, 131, 137, 144, 151, 154, 152, 144, 131, 122,
+  116, 115, 120, 127, 132, 136, 135, 133, 134, 138, 143, 147, 148, 150, 153, 157, 156, 151, 142, 131,
+  121, 117, 119, 124, 130, 130, 128, 126, 126, 124, 121, 116, 113, 112, 113, 116, 118, 122, 123, 115,
+  105, 94, 90, 90, 90, 91, 94, 102, 111, 118, 127, 141, 153, 161, 161, 157, 149, 141, 131, 122,
+  116, 116, 116, 114, 112, 112, 119, 129, 139, 149, 155, 156, 154, 147, 140, 139, 139, 140, 141, 141,
+  141, 142, 143, 142, 138, 135, 136, 138, 139, 138, 134, 125, 113, 102, 98, 99, 104, 108, 109, 111,
+  112, 114, 114, 112, 109, 106, 101, 95, 90, 90, 96, 106, 120, 133, 143, 150, 152, 148, 142, 138,
+  138, 139, 133, 126, 120, 115, 111, 111, 115, 120, 123, 126, 129, 138, 148, 155, 159, 160, 157, 155,
+  151, 146, 144, 141, 137, 131, 128, 128, 132, 133, 135, 135, 134, 130, 123, 117, 113, 112, 118, 124,
+  127, 127, 121, 112, 102, 93, 87, 88, 94, 103, 108, 110, 109, 105, 100, 95, 95, 102, 116, 133,
+  152, 167, 177, 178, 166, 147, 126, 109, 102, 102, 109, 119, 126, 129, 129, 126, 126, 129, 136, 143,
+  153, 162, 169, 175, 173, 163, 147, 130, 118, 114, 119, 130, 140, 140, 135, 129, 127, 126, 124, 122,
+  122, 125, 127, 128, 127, 121, 114, 101, 89, 82, 85, 89, 91, 92, 93, 95, 97, 98, 102, 111,
+  129, 149, 163, 170, 172, 164, 147, 126, 111, 109, 115, 119, 120, 121, 124, 126, 125, 124, 127, 132,
+  141, 150, 158, 161, 158, 150, 142, 138, 139, 141, 140, 139, 139, 143, 146, 144, 138, 135, 135, 137,
+  139, 139, 134, 126, 114, 106, 103, 103, 105, 105, 105, 105, 106, 104, 101, 101, 100, 96, 88, 83,
+  85, 93, 106, 118, 130, 145, 155, 161, 163, 162, 157, 146, 133, 121, 114, 114, 114, 113, 110, 109,
+  112, 119, 130, 145, 156, 159, 154, 147, 145, 147, 150, 148, 146, 143, 141, 140, 144, 146, 141, 132,
+  126, 124, 128, 132, 135, 132, 129, 124, 121, 120, 116, 111, 102, 96, 94, 103, 113, 118, 114, 105,
+  93, 82, 73, 71, 79, 94, 114, 135, 154, 170, 174, 164, 144, 126, 125, 134, 140, 138, 128, 116,
+  106, 102, 102, 109, 116, 122, 129, 144, 162, 177, 179, 170, 159, 152, 149, 144, 139, 134, 133, 131,
+  131, 131, 131, 131, 129, 128, 132, 138, 143, 143, 140, 138, 134, 126, 116, 106, 101, 96, 94, 92,
+  89, 87, 84, 82, 80, 80, 81, 82, 85, 93, 116, 151, 186, 205, 205, 187, 162, 136, 116, 106,
+  103, 102, 101, 102, 109, 116, 122, 121, 115, 115, 122, 135, 152, 169, 182, 186, 184, 177, 168, 150,
+  129, 112, 106, 112, 124, 133, 136, 136, 135, 134, 135, 137, 139, 139, 137, 135, 134, 129, 119, 107,
+  97, 94, 95, 94, 92, 90, 90, 88, 86, 81, 76, 71, 67, 71, 91, 132, 183, 222, 234, 220,
+  190, 152, 120, 101, 94, 96, 98, 99, 104, 109, 112, 112, 110, 110, 119, 138, 158, 178, 192, 200,
+  196, 183, 164, 142, 124, 111, 107, 113, 121, 127, 128, 125, 122, 123, 130, 136, 143, 149, 153, 151,
+  143, 130, 115, 102, 95, 92, 92, 92, 94, 92, 89, 85, 82, 77, 67, 59, 61, 80, 115, 156,
+  194, 217, 221, 206, 176, 145, 123, 111, 105, 100, 97, 96, 99, 101, 104, 106, 111, 119, 131, 147,
+  165, 181, 191, 192, 189, 179, 166, 146, 129, 116, 112, 112, 114, 119, 123, 127, 130, 132, 135, 139,
+  143, 143, 141, 135, 128, 122, 117, 112, 108, 101, 97, 97, 97, 94, 88, 81, 76, 75, 71, 69,
+  75, 95, 128, 166, 196, 207, 196, 172, 145, 128, 125, 127, 125, 116, 108, 105, 107, 110, 109, 104,
+  103, 108, 125, 148, 170, 187, 194, 192, 182, 167, 153, 140, 130, 125, 124, 126, 127, 123, 116, 115,
+  120, 127, 135, 141, 146, 148, 146, 140, 130, 121, 111, 103, 104, 106, 109, 102, 90, 79, 77, 79,
+  79, 72, 60, 54, 62, 90, 134, 185, 222, 234, 217, 186, 156, 133, 119, 110, 103, 99, 97, 97,
+  99, 101, 99, 96, 98, 111, 135, 160, 178, 188, 192, 192, 190, 181, 166, 145, 127, 118, 118, 121,
+  122, 116, 108, 103, 107, 118, 135, 149, 157, 156, 150, 138, 128, 118, 111, 107, 107, 109, 107, 100,
+  91, 84, 78, 70, 58, 46, 37, 45, 71, 115, 170, 218, 242, 235, 205, 168, 139, 121, 114, 114,
+  114, 111, 107, 102, 96, 88, 82, 82, 96, 121, 153, 180, 198, 201, 196, 187, 177, 164, 149, 135,
+  126, 123, 122, 119, 116, 109, 104, 102, 110, 127, 146, 159, 163, 155, 143, 130, 120, 112, 111, 111,
+  110, 104, 99, 94, 90, 86, 76, 64, 56, 52, 52, 65, 94, 137, 181, 215, 225, 215, 191, 160,
+  135, 119, 112, 112, 112, 110, 108, 104, 99, 94, 92, 97, 113, 136, 160, 178, 187, 188, 184, 176,
+  165, 154, 142, 135, 130, 126, 125, 124, 121, 117, 116, 120, 128, 135, 139, 138, 136, 133, 131, 126,
+  121, 118, 113, 108, 101, 99, 96, 95, 95, 89, 81, 74, 67, 64, 64, 77, 106, 144, 181, 204,
+  210, 200, 179, 156, 133, 118, 110, 105, 105, 108, 112, 114, 112, 106, 104, 111, 127, 144, 160, 171,
+  177, 180, 180, 175, 165, 149, 131, 119, 115, 122, 130, 131, 127, 122, 120, 124, 129, 132, 133, 133,
+  133, 130, 128, 124, 120, 111, 101, 93, 90, 90, 92, 91, 88, 86, 84, 83, 80, 87, 103, 126,
+  152, 173, 187, 187, 174, 152, 129, 116, 114, 116, 118, 118, 118, 120, 120, 118, 116, 120, 128, 139,
+  151, 161, 165, 162, 155, 147, 144, 143, 143, 141, 138, 138, 141, 143, 140, 135, 131, 132, 136, 139,
+  138, 134, 125, 115, 107, 103, 105, 105, 105, 105, 107, 105, 103, 101, 101, 101, 95, 86, 82, 86,
+  95, 107, 120, 133, 146, 156, 161, 163, 161, 155, 143, 130, 119, 114, 114, 114, 113, 108, 107, 112,
+  121, 133, 147, 157, 160, 153, 147, 146, 149, 149, 148, 146, 142, 139, 141, 145, 145, 140, 130, 125,
+  124, 128, 133, 134, 131, 126, 123, 120, 120, 116, 110, 100, 95, 96, 105, 115, 118, 114, 102, 90,
+  79, 72, 73, 81, 97, 119, 140, 158, 171, 172, 160, 141, 126, 125, 135, 141, 136, 125, 114, 105,
+  101, 103, 110, 118, 123, 133, 148, 167, 178, 178, 168, 157, 151, 148, 143, 138, 134, 133, 131, 131,
+  131, 131, 130, 128, 128, 133, 139, 143, 143, 139, 136, 131, 123, 114, 104, 100, 95, 93, 90, 90,
+  87, 84, 81, 80, 80, 82, 82, 86, 97, 123, 158, 191, 208, 202, 182, 156, 131, 114, 106, 103,
+  101, 101, 103, 110, 117, 122, 119, 115, 116, 125, 138, 156, 173, 183, 186, 183, 175, 163, 147, 125,
+  109, 106, 115, 127, 134, 137, 135, 134, 135, 135, 138, 139, 139, 138, 136, 133, 127, 118, 103, 96,
+  94, 95, 93, 91, 88, 90, 89, 85, 78, 73, 70, 67, 74, 99, 144, 193, 227, 234, 215, 181,
+  144, 113, 98, 94, 97, 99, 100, 104, 109, 112, 111, 109, 111, 124, 142, 164, 181, 194, 199, 194,
+  179, 160, 138, 120, 109, 108, 114, 123, 128, 126, 124, 122, 125, 132, 139, 145, 151, 154, 150, 141,
+  125, 110, 100, 94, 92, 92, 93, 93, 91, 87, 84, 79, 73, 64, 58, 65, 87, 123, 164, 200,
+  222, 220, 200, 169, 139, 119, 109, 102, 98, 96, 96, 100, 102, 105, 107, 112, 121, 134, 150, 169,
+  183, 191, 192, 188, 177, 162, 143, 126, 115, 111, 111, 116, 120, 124, 128, 131, 133, 136, 141, 144,
+  144, 141, 134, 127, 122, 117, 112, 105, 99, 95, 96, 96, 92, 87, 80, 77, 74, 71, 69, 77,
+  101, 138, 175, 200, 206, 193, 165, 140, 125, 124, 127, 123, 114, 107, 106, 108, 111, 108, 104, 104,
+  111, 129, 151, 174, 189, 195, 190, 179, 165, 150, 137, 129, 124, 125, 127, 126, 122, 116, 114, 121,
+  129, 136, 141, 146, 148, 146, 138, 128, 118, 109, 104, 103, 107, 108, 100, 88, 79, 78, 80, 78,
+  68, 58, 55, 68, 98, 145, 194, 228, 234, 211, 178, 149, 129, 117, 107, 102, 98, 96, 98, 100,
+  101, 99, 95, 99, 115, 141, 165, 181, 189, 192, 192, 189, 179, 161, 140, 124, 117, 118, 122, 121,
+  115, 106, 104, 109, 122, 138, 151, 158, 155, 147, 135, 126, 117, 109, 107, 108, 109, 106, 98, 90,
+  84, 77, 68, 55, 43, 37, 46, 78, 126, 181, 227, 242, 229, 198, 162, 134, 119, 114, 114, 113,
+  110, 105, 100, 93, 86, 81, 84, 100, 128, 160, 185, 198, 200, 195, 185, 175, 161, 147, 133, 124,
+  122, 121, 120, 115, 109, 104, 103, 113, 130, 150, 161, 161, 153, 141, 128, 118, 112, 111, 111, 108,
+  103, 97, 92, 89, 83, 72, 60, 51, 47, 47, 64, 99, 147, 194, 226, 235, 221, 190, 156, 129,
+  114, 111, 111, 112, 109, 105, 100, 94, 87, 85, 93, 111, 138, 166, 186, 195, 195, 190, 181, 168,
+  153, 140, 132, 128, 124, 124, 120, 114, 109, 109, 116, 129, 142, 149, 150, 146, 138, 131, 123, 119,
+  115, 114, 110, 106, 103, 99, 95, 87, 73, 61, 52, 44, 41, 47, 72, 118, 175, 222, 243, 235,
+  208, 174, 143, 122, 112, 110, 109, 107, 105, 105, 102, 92, 83, 83, 99, 127, 158, 180, 189, 192,
+  190, 185, 176, 167, 152, 135, 122, 116, 121, 124, 118, 109, 106, 113, 125, 137, 147, 152, 151, 144,
+  135, 126, 121, 118, 113, 108, 105, 101, 97, 93, 87, 79, 68, 56, 45, 41, 49, 75, 115, 162,
+  206, 230, 228, 204, 173, 147, 130, 122, 116, 113, 110, 105, 100, 95, 90, 88, 90, 102, 124, 152,
+  174, 184, 188, 186, 182, 176, 165, 152, 139, 129, 125, 123, 120, 117, 112, 109, 113, 124, 136, 146,
+  148, 144, 139, 132, 124, 119, 118, 118, 117, 112, 104, 98, 93, 85, 76, 66, 58, 52, 47, 52,
+  72, 107, 151, 192, 220, 228, 205, 169, 136, 120, 123, 132, 135, 128, 117, 108, 102, 97, 92, 91,
+  99, 115, 137, 159, 175, 182, 180, 176, 173, 167, 159, 149, 140, 138, 137, 132, 123, 112, 103, 104,
+  113, 129, 143, 149, 148, 141, 131, 124, 120, 120, 120, 120, 115, 109, 101, 92, 82, 70, 58, 46,
+  37, 36, 50, 83, 130, 182, 220, 233, 215, 183, 152, 132, 128, 132, 135, 133, 123, 112, 103, 92,
+  81, 75, 81, 101, 132, 157, 176, 180, 180, 176, 173, 170, 165, 157, 147, 138, 134, 133, 128, 118,
+  107, 104, 111, 125, 139, 148, 150, 145, 136, 127, 122, 118, 119, 120, 121, 118, 111, 99, 87, 74,
+  66, 59, 50, 40, 39, 54, 88, 138, 187, 219, 226, 204, 169, 140, 128, 130, 137, 139, 136, 128,
+  118, 105, 93, 83, 78, 86, 105, 134, 160, 175, 175, 171, 166, 163, 162, 160, 157, 152, 149, 144,
+  138, 127, 115, 106, 107, 117, 130, 143, 149, 146, 138, 131, 126, 123, 122, 122, 122, 120, 115, 105,
+  93, 81, 70, 60, 49, 37, 32, 41, 70, 120, 175, 214, 225, 210, 183, 157, 143, 138, 137, 136,
+  130, 123, 115, 107, 97, 85, 78, 84, 101, 127, 150, 165, 169, 169, 171, 173, 172, 168, 161, 153,
+  148, 143, 137, 124, 110, 103, 105, 119, 136, 146, 148, 146, 139, 131, 126, 122, 122, 123, 126, 124,
+  117, 106, 91, 77, 67, 62, 57, 52, 45, 45, 56, 92, 143, 193, 222, 221, 198, 167, 142, 128,
+  127, 132, 135, 134, 127, 119, 111, 99, 85, 82, 91, 112, 135, 154, 166, 171, 171, 167, 163, 161,
+  161, 158, 153, 149, 143, 134, 120, 108, 107, 116, 132, 143, 145, 141, 133, 128, 128, 130, 132, 132,
+  127, 121, 114, 108, 98, 84, 69, 59, 51, 43, 39, 43, 62, 97, 144, 187, 214, 213, 196, 170,
+  147, 131, 128, 134, 140, 139, 131, 117, 100, 86, 80, 84, 98, 117, 136, 150, 160, 166, 167, 165,
+  163, 160, 160, 161, 159, 156, 147, 136, 124, 116, 115, 122, 131, 141, 144, 139, 131, 123, 117, 117,
+  122, 128, 131, 128, 120, 109, 99, 89, 79, 67, 53, 40, 35, 43, 62, 95, 139, 180, 204, 204,
+  189, 169, 150, 140, 135, 137, 141, 141, 133, 117, 98, 85, 81, 86, 103, 124, 142, 153, 154, 154,
+  157, 161, 168, 169, 167, 163, 157, 148, 138, 130, 121, 118, 121, 129, 139, 145, 144, 136, 126, 120,
+  117, 118, 122, 128, 131, 129, 120, 107, 94, 84, 75, 62, 48, 38, 37, 48, 74, 114, 157, 188,
+  195, 185, 166, 153, 148, 146, 146, 146, 144, 139, 128, 113, 96, 83, 79, 90, 107, 127, 142, 150,
+  152, 155, 158, 165, 169, 171, 169, 163, 155, 146, 135, 125, 119, 122, 127, 134, 138, 139, 140, 136,
+  131, 126, 122, 122, 122, 124, 126, 125, 119, 108, 92, 80, 72, 67, 58, 50, 44, 49, 66, 97,
+  143, 183, 205, 196, 171, 147, 135, 136, 140, 141, 143, 144, 139, 127, 108, 90, 82, 85, 98, 119,
+  140, 152, 156, 156, 156, 159, 162, 162, 161, 163, 163, 161, 150, 131, 119, 114, 119, 125, 131, 138,
+  142, 140, 135, 128, 123, 122, 122, 126, 129, 128, 119, 105, 90, 79, 69, 59, 49, 41, 41, 55,
+  84, 122, 160, 187, 194, 182, 161, 145, 137, 140, 144, 146, 145, 140, 129, 114, 100, 91, 90, 94,
+  105, 122, 136, 147, 154, 157, 160, 161, 161, 161, 163, 165, 165, 158, 147, 130, 118, 114, 119, 128,
+  136, 141, 142, 138, 129, 124, 122, 124, 126, 126, 124, 123, 117, 106, 91, 77, 64, 56, 49, 45,
+  48, 61, 84, 117, 155, 183, 193, 182, 160, 144, 141, 147, 155, 158, 150, 138, 126, 111, 100, 91,
+  88, 94, 105, 119, 134, 144, 148, 153, 158, 164, 167, 165, 163, 162, 160, 155, 147, 135, 125, 120,
+  120, 126, 132, 137, 136, 134, 130, 125, 122, 120, 121, 126, 132, 133, 122, 105, 86, 74, 65, 56,
+  44, 39, 47, 69, 102, 136, 166, 177, 171, 158, 148, 146, 148, 151, 153, 155, 155, 143, 122, 102,
+  88, 84, 90, 102, 117, 128, 134, 136, 138, 145, 155, 164, 169, 171, 170, 166, 157, 146, 138, 133,
+  129, 128, 130, 133, 140, 141, 137, 129, 122, 118, 118, 121, 126, 129, 129, 125, 118, 109, 98, 81,
+  67, 60, 60, 62, 63, 68, 86, 116, 149, 165, 165, 156, 147, 142, 141, 145, 153, 157, 155, 147,
+  137, 124, 107, 93, 88, 100, 117, 130, 133, 134, 136, 143, 150, 158, 163, 165, 163, 158, 155, 150,
+  145, 136, 129, 126, 130, 138, 142, 139, 130, 124, 123, 126, 126, 126, 125, 124, 124, 124, 120, 107,
+  93, 79, 71, 67, 64, 58, 54, 60, 80, 111, 145, 170, 178, 174, 164, 154, 146, 141, 140, 141,
+  141, 137, 128, 117, 107, 99, 97, 100, 107, 120, 130, 139, 146, 156, 163, 169, 169, 164, 159, 153,
+  148, 144, 140, 135, 128, 124, 124, 129, 133, 138, 141, 139, 132, 127, 126, 126, 126, 127, 123, 118,
+  111, 107, 100, 93, 84, 74, 67, 62, 58, 59, 67, 85, 114, 148, 176, 189, 183, 167, 153, 146,
+  144, 141, 137, 133, 128, 121, 113, 106, 98, 93, 93, 103, 118, 137, 154, 165, 171, 173, 171, 167,
+  162, 155, 150, 144, 138, 135, 130, 126, 122, 120, 119, 123, 130, 139, 142, 141, 138, 134, 130, 125,
+  120, 116, 114, 111, 104, 97, 90, 84, 78, 71, 64, 60, 60, 66, 80, 105, 135, 166, 189, 198,
+  197, 186, 166, 147, 132, 125, 121, 117, 112, 107, 103, 99, 95, 94, 97, 108, 127, 148, 167, 179,
+  184, 184, 178, 171, 159, 150, 141, 135, 130, 126, 124, 121, 117, 116, 118, 126, 133, 141, 141, 140,
+  137, 132, 127, 123, 118, 115, 110, 105, 102, 97, 92, 84, 74, 66, 59, 57, 54, 59, 74, 104,
+  149, 191, 220, 226, 212, 185, 155, 131, 119, 113, 110, 108, 105, 105, 106, 100, 90, 86, 95, 117,
+  145, 168, 182, 188, 188, 185, 179, 170, 158, 142, 128, 119, 121, 126, 123, 115, 109, 110, 120, 131,
+  142, 148, 150, 145, 138, 129, 123, 119, 115, 111, 106, 102, 99, 95, 90, 83, 73, 61, 49, 41,
+  44, 62, 96, 141, 189, 223, 233, 216, 185, 156, 136, 125, 118, 114, 111, 107, 102, 97, 92, 88,
+  89, 96, 114, 140, 166, 182, 187, 187, 184, 179, 170, 157, 144, 134, 127, 124, 121, 119, 114, 110,
+  111, 119, 131, 143, 148, 146, 141, 135, 127, 121, 118, 118, 118, 114, 108, 100, 96, 89, 80, 70,
+  61, 54, 49, 49, 60, 91, 132, 176, 211, 227, 216, 185, 149, 124, 120, 128, 134, 132, 122, 112,
+  104, 99, 94, 90, 94, 107, 127, 151, 169, 180, 182, 178, 174, 170, 163, 153, 143, 139, 137, 135,
+  128, 116, 107, 103, 108, 122, 138, 148, 149, 145, 135, 126, 122, 120, 120, 120, 117, 112, 104, 96,
+  86, 75, 63, 51, 41, 35, 41, 66, 109, 161, 208, 230, 224, 198, 164, 139, 128, 130, 134, 135,
+  128, 117, 107, 97, 85, 77, 76, 91, 119, 148, 169, 179, 180, 178, 174, 171, 167, 161, 151, 141,
+  135, 133, 132, 123, 112, 104, 106, 119, 133, 146, 150, 148, 140, 132, 124, 119, 118, 120, 121, 120,
+  114, 104, 92, 80, 69, 62, 54, 44, 38, 44, 72, 117, 168, 208, 225, 217, 185, 151, 131, 126,
+  133, 138, 139, 132, 122, 111, 98, 87, 79, 80, 96, 122, 150, 169, 176, 173, 168, 164, 163, 161,
+  159, 154, 150, 146, 141, 132, 120, 109, 105, 112, 124, 138, 147, 148, 142, 134, 128, 124, 122, 122,
+  122, 122, 117, 110, 98, 86, 74, 65, 55, 42, 33, 34, 56, 98, 154, 200, 222, 219, 195, 167,
+  147, 139, 137, 137, 133, 126, 118, 111, 101, 90, 80, 80, 93, 116, 142, 159, 168, 169, 170, 172,
+  173, 170, 164, 155, 150, 145, 140, 131, 116, 105, 101, 112, 129, 143, 148, 147, 142, 134, 128, 123,
+  122, 122, 125, 126, 120, 111, 97, 83, 71, 64, 59, 54, 48, 43, 50, 75, 120, 173, 212, 225,
+  210, 181, 152, 131, 126, 130, 135, 135, 130, 123, 115, 103, 90, 80, 86, 102, 126, 147, 162, 171,
+  171, 169, 164, 161, 161, 160, 156, 151, 146, 139, 126, 112, 105, 111, 125, 139, 146, 143, 137, 129,
+  128, 129, 131, 133, 129, 124, 117, 111, 103, 90, 76, 64, 54, 46, 40, 39, 52, 81, 124, 170,
+  204, 216, 206, 182, 156, 135, 128, 131, 138, 140, 135, 123, 107, 91, 82, 81, 91, 109, 129, 145,
+  156, 165, 167, 166, 164, 160, 160, 161, 160, 157, 151, 141, 129, 119, 115, 117, 127, 137, 144, 142,
+  135, 126, 119, 116, 120, 125, 130, 130, 125, 114, 103, 93, 83, 72, 58, 46, 37, 38, 52, 80,
+  121, 164, 196, 206, 197, 177, 158, 143, 136, 136, 140, 142, 137, 124, 106, 90, 81, 82, 94, 115,
+  136, 149, 154, 154, 154, 159, 166, 169, 168, 165, 160, 152, 142, 134, 125, 119, 120, 125, 134, 143,
+  146, 140, 130, 122, 118, 117, 120, 126, 130, 131, 125, 113, 99, 88, 79, 68, 53, 41, 37, 42,
+  61, 96, 140, 179, 194, 191, 173, 158, 150, 147, 146, 146, 145, 142, 133, 119, 103, 89, 80, 84,
+  99, 119, 137, 147, 152, 154, 156, 162, 168, 171, 170, 166, 158, 150, 140, 129, 120, 119, 124, 131,
+  136, 139, 141, 138, 133, 128, 123, 122, 122, 124, 124, 126, 124, 113, 98, 85, 75, 69, 62, 53,
+  46, 46, 57, 83, 124, 169, 199, 202, 182, 156, 139, 135, 139, 141, 142, 144, 142, 133, 117, 97,
+  85, 82, 90, 109, 132, 149, 155, 156, 156, 157, 161, 163, 161, 163, 163, 163, 155, 139, 123, 115,
+  117, 122, 129, 135, 140, 142, 137, 130, 125, 122, 122, 124, 128, 129, 124, 111, 96, 83, 73, 63,
+  53, 44, 40, 47, 70, 105, 145, 179, 194, 188, 170, 151, 140, 138, 143, 145, 146, 143, 134, 121,
+  106, 94, 90, 91, 99, 114, 130, 143, 152, 155, 159, 160, 161, 161, 162, 164, 165, 163, 152, 137,
+  122, 114, 117, 125, 133, 139, 142, 140, 133, 126, 122, 123, 125, 126, 125, 124, 120, 112, 97, 82,
+  70, 59, 52, 46, 46, 54, 72, 103, 139, 174, 192, 188, 169, 149, 141, 143, 152, 158, 154, 143,
+  131, 117, 104, 94, 89, 91, 100, 113, 128, 141, 147, 151, 155, 161, 166, 166, 163, 163, 161, 158,
+  151, 140, 128, 121, 120, 123, 130, 135, 137, 135, 132, 127, 124, 120, 120, 123, 130, 133, 128, 112,
+  94, 79, 69, 60, 49, 39, 42, 58, 88, 122, 154, 175, 176, 164, 151, 146, 147, 150, 152, 154,
+  156, 149, 132, 111, 92, 84, 86, 96, 111, 124, 132, 135, 137, 142, 151, 161, 167, 171, 171, 168,
+  161, 150, 141, 135, 130, 128, 128, 131, 137, 141, 139, 133, 124, 119, 118, 119, 124, 127, 129, 128,
+  121, 113, 103, 88, 73, 62, 60, 61, 63, 65, 77, 102, 135, 160, 167, 160, 151, 143, 141, 143,
+  150, 156, 157, 151, 142, 130, 114, 97, 88, 94, 110, 124, 132, 132, 134, 138, 145, 155, 162, 167,
+  167, 163, 158, 154, 149, 141, 134, 127, 128, 136, 141, 140, 132, 122, 121, 123, 125, 128, 128, 128,
+  128, 127, 124, 116, 102, 85, 73, 67, 64, 60, 55, 57, 70, 96, 127, 154, 167, 166, 161, 154,
+  149, 145, 144, 149, 151, 151, 142, 129, 114, 101, 97, 98, 104, 112, 119, 127, 132, 139, 150, 160,
+  163, 163, 162, 161, 160, 156, 151, 143, 136, 131, 132, 135, 139, 141, 140, 134, 126, 118, 116, 121,
+  127, 132, 133, 126, 117, 109, 102, 96, 88, 76, 66, 62, 62, 68, 76, 90, 110, 133, 152, 157,
+  150, 140, 136, 143, 154, 159, 156, 150, 142, 134, 126, 117, 109, 104, 103, 108, 118, 128, 133, 137,
+  143, 148, 153, 155, 156, 158, 161, 160, 157, 151, 142, 135, 133, 133, 137, 139, 141, 137, 128, 121,
+  117, 118, 123, 127, 126, 123, 121, 115, 107, 99, 89, 79, 71, 64, 61, 63, 70, 84, 106, 128,
+  147, 152, 149, 145, 145, 153, 160, 161, 156, 150, 143, 132, 120, 109, 105, 105, 105, 107, 113, 120,
+  126, 133, 140, 148, 157, 161, 161, 163, 162, 161, 157, 152, 144, 137, 132, 129, 133, 136, 139, 136,
+  129, 122, 117, 116, 122, 128, 133, 132, 127, 119, 109, 99, 92, 85, 76, 65, 58, 61, 71, 87,
+  104, 119, 132, 139, 140, 139, 143, 150, 158, 163, 161, 156, 145, 133, 122, 113, 109, 110, 117, 120,
+  121, 120, 120, 125, 131, 138, 148, 157, 161, 159, 157, 156, 154, 151, 146, 141, 139, 141, 142, 145,
+  146, 142, 133, 123, 116, 114, 117, 122, 125, 129, 128, 123, 111, 99, 89, 88, 86, 80, 71, 64,
+  64, 74, 91, 113, 132, 143, 144, 141, 141, 146, 153, 156, 155, 154, 152, 145, 132, 118, 108, 107,
+  111, 116, 118, 117, 116, 121, 129, 138, 147, 155, 159, 162, 163, 162, 160, 154, 145, 139, 137, 138,
+  140, 141, 138, 136, 131, 128, 123, 118, 117, 120, 127, 130, 130, 125, 116, 106, 99, 94, 93, 89,
+  83, 73, 62, 61, 69, 88, 110, 130, 143, 145, 141, 136, 137, 142, 149, 154, 157, 158, 155, 147,
+  131, 117, 107, 107, 110, 117, 123, 128, 129, 128, 130, 134, 144, 152, 158, 160, 160, 157, 151, 145,
+  141, 142, 144, 144, 142, 139, 137, 134, 129, 124, 120, 117, 116, 118, 123, 128, 129, 122, 107, 96,
+  89, 86, 84, 82, 77, 73, 73, 84, 99, 114, 124, 131, 135, 137, 138, 142, 147, 154, 157, 160,
+  156, 148, 135, 123, 113, 109, 112, 118, 123, 124, 121, 121, 124, 132, 142, 150, 155, 159, 160, 159,
+  155, 151, 148, 146, 143, 143, 143, 141, 139, 136, 131, 126, 122, 119, 119, 120, 120, 121, 122, 121,
+  119, 113, 105, 96, 89, 86, 86, 83, 78, 74, 78, 93, 114, 130, 133, 129, 126, 129, 136, 144,
+  152, 160, 161, 156, 149, 137, 127, 121, 116, 119, 121, 124, 123, 121, 120, 125, 133, 140, 143, 146,
+  151, 154, 157, 154, 150, 144, 141, 141, 143, 146, 146, 144, 135, 127, 124, 124, 124, 122, 122, 123,
+  125, 128, 127, 122, 114, 105, 97, 93, 92, 90, 84, 74, 66, 70, 85, 104, 117, 122, 126, 129,
+  131, 139, 146, 154, 156, 155, 154, 154, 149, 142, 133, 123, 117, 114, 116, 117, 118, 121, 126, 131,
+  135, 139, 142, 145, 150, 155, 158, 159, 154, 147, 140, 140, 144, 146, 144, 140, 133, 130, 126, 124,
+  122, 121, 120, 120, 121, 122, 122, 120, 115, 111, 103, 96, 88, 84, 80, 75, 73, 75, 87, 106,
+  121, 129, 128, 124, 125, 132, 142, 152, 160, 163, 160, 152, 144, 139, 131, 122, 116, 115, 121, 126,
+  125, 122, 122, 124, 128, 135, 143, 152, 156, 155, 153, 152, 150, 147, 142, 139, 141, 144, 144, 142,
+  136, 130, 125, 120, 118, 118, 122, 126, 129, 127, 122, 115, 107, 101, 98, 95, 95, 92, 83, 72,
+  69, 76, 94, 109, 118, 120, 123, 127, 132, 137, 143, 148, 152, 152, 152, 153, 150, 142, 132, 126,
+  124, 122, 122, 122, 122, 124, 126, 127, 131, 138, 144, 148, 149, 150, 150, 150, 149, 148, 146, 142,
+  139, 137, 140, 142, 142, 138, 131, 124, 120, 121, 124, 128, 128, 124, 115, 108, 103, 107, 109, 106,
+  97, 87, 84, 86, 92, 95, 94, 92, 97, 110, 122, 130, 129, 126, 127, 137, 146, 148, 148, 147,
+  148, 148, 147, 142, 135, 129, 126, 129, 132, 131, 127, 127, 131, 133, 135, 135, 137, 141, 145, 146,
+  148, 145, 143, 143, 145, 146, 144, 142, 139, 137, 134, 130, 129, 129, 127, 122, 118, 116, 118, 118,
+  117, 115, 107, 97, 89, 86, 90, 92, 87, 78, 74, 81, 100, 118, 127, 128, 125, 126, 132, 140,
+  147, 155, 158, 155, 151, 146, 141, 133, 124, 120, 124, 130, 133, 127, 118, 114, 121, 132, 141, 146,
+  145, 144, 145, 147, 150, 150, 146, 142, 141, 143, 144, 143, 138, 133, 130, 129, 129, 128, 128, 127,
+  124, 122, 120, 119, 118, 115, 110, 105, 103, 101, 100, 93, 83, 71, 71, 82, 99, 115, 122, 121,
+  115, 113, 117, 128, 141, 150, 154, 154, 152, 149, 145, 140, 136, 134, 135, 135, 134, 129, 124, 119,
+  120, 125, 135, 142, 142, 137, 132, 133, 137, 143, 148, 150, 146, 143, 143, 143, 143, 141, 138, 136,
+  133, 133, 133, 130, 127, 125, 124, 123, 121, 117, 114, 112, 111, 107, 101, 93, 85, 80, 78, 82,
+  91, 102, 108, 111, 111, 113, 118, 123, 131, 138, 145, 149, 149, 146, 144, 144, 144, 142, 140, 137,
+  132, 128, 128, 128, 129, 129, 129, 129, 131, 133, 136, 138, 141, 143, 142, 141, 141, 143, 143, 143,
+  143, 143, 141, 138, 135, 135, 135, 135, 134, 131, 128, 124, 122, 120, 121, 122, 117, 111, 105, 103,
+  101, 100, 93, 86, 78, 75, 81, 94, 111, 122, 121, 109, 99, 106, 125, 145, 154, 153, 147, 144,
+  143, 143, 143, 142, 141, 141, 141, 141, 137, 129, 120, 116, 122, 136, 146, 145, 137, 126, 120, 127,
+  138, 148, 152, 149, 139, 135, 135, 140, 143, 143, 141, 139, 137, 134, 131, 129, 128, 128, 128, 127,
+  124, 120, 115, 112, 110, 107, 101, 94, 87, 85, 84, 86, 88, 94, 100, 106, 107, 109, 110, 115,
+  121, 130, 136, 140, 143, 143, 143, 145, 147, 148, 146, 142, 138, 137, 137, 135, 134, 133, 133, 132,
+  129, 125, 124, 127, 132, 136, 139, 139, 137, 137, 139, 141, 144, 146, 144, 143, 143, 140, 138, 135,
+  133, 133, 133, 131, 131, 130, 128, 123, 118, 116, 117, 118, 117, 112, 105, 100, 95, 92, 90, 88,
+  87, 86, 86, 87, 92, 98, 108, 121, 135, 146, 148, 144, 141, 143, 149, 154, 156, 152, 147, 139,
+  131, 125, 122, 122, 122, 122, 122, 126, 129, 130, 132, 137, 145, 150, 152, 150, 148, 148, 147, 146,
+  145, 141, 135, 132, 133, 135, 139, 137, 132, 126, 121, 122, 124, 128, 131, 129, 124, 118, 111, 105,
+  99, 92, 84, 75, 68, 66, 74, 87, 101, 114, 124, 129, 129, 130, 135, 144, 153, 159, 157, 152,
+  145, 137, 130, 122, 118, 118, 122, 124, 124, 123, 122, 126, 131, 137, 144, 153, 157, 156, 152, 150,
+  152, 150, 147, 142, 139, 139, 140, 144, 144, 142, 134, 126, 118, 116, 118, 121, 125, 129, 129, 124,
+  115, 101, 92, 88, 88, 83, 75, 65, 63, 70, 86, 108, 128, 142, 144, 142, 141, 145, 152, 155,
+  156, 155, 153, 147, 134, 120, 110, 107, 110, 115, 118, 118, 117, 118, 126, 136, 146, 153, 159, 161,
+  163, 163, 160, 155, 146, 140, 137, 137, 140, 141, 138, 136, 132, 129, 124, 119, 116, 119, 124, 129,
+  131, 126, 119, 109, 100, 96, 93, 90, 84, 75, 64, 61, 67, 84, 106, 127, 142, 146, 142, 137,
+  136, 141, 148, 153, 157, 158, 157, 149, 134, 119, 108, 105, 109, 116, 122, 127, 129, 129, 129, 133,
+  142, 150, 158, 160, 160, 158, 152, 146, 141, 141, 143, 144, 142, 140, 137, 135, 130, 125, 120, 118,
+  116, 118, 123, 128, 131, 125, 111, 98, 90, 86, 85, 82, 77, 74, 73, 80, 95, 110, 122, 130,
+  134, 137, 138, 141, 146, 151, 156, 159, 157, 151, 139, 125, 114, 109, 110, 117, 122, 124, 121, 121,
+  123, 130, 139, 148, 154, 157, 160, 160, 155, 152, 149, 146, 144, 143, 143, 142, 139, 137, 132, 127,
+  122, 120, 119, 120, 120, 121, 122, 122, 119, 114, 107, 98, 91, 86, 86, 85, 80, 74, 75, 89,
+  111, 128, 133, 130, 127, 128, 134, 142, 151, 158, 161, 158, 151, 139, 129, 121, 118, 118, 121, 123,
+  123, 121, 120, 124, 131, 139, 143, 145, 149, 154, 157, 155, 151, 146, 142, 141, 143, 145, 146, 145,
+  137, 128, 124, 124, 124, 122, 122, 123, 125, 128, 127, 123, 115, 107, 98, 94, 92, 91, 85, 76,
+  68, 69, 82, 100, 114, 121, 126, 128, 131, 136, 145, 152, 156, 155, 154, 154, 151, 144, 134, 125,
+  118, 115, 116, 117, 118, 120, 125, 130, 135, 138, 142, 144, 149, 154, 157, 159, 156, 148, 141, 139,
+  143, 146, 144, 141, 136, 131, 127, 124, 122, 121, 120, 120, 120, 122, 122, 121, 117, 112, 104, 97,
+  91, 86, 81, 76, 73, 74, 84, 102, 119, 128, 128, 124, 124, 131, 141, 150, 159, 163, 161, 154,
+  146, 140, 133, 124, 116, 115, 120, 125, 125, 123, 122, 124, 127, 134, 141, 150, 155, 156, 153, 152,
+  150, 149, 143, 139, 141, 143, 144, 142, 137, 131, 126, 121, 118, 118, 121, 126, 129, 127, 123, 116,
+  108, 102, 98, 96, 95, 93, 85, 75, 69, 75, 91, 107, 116, 120, 122, 126, 131, 136, 142, 148,
+  152, 152, 152, 154, 151, 143, 133, 126, 124, 122, 122, 122, 122, 124, 125, 127, 130, 137, 143, 148,
+  149, 150, 150, 150, 149, 148, 146, 143, 139, 137, 139, 142, 143, 139, 132, 125, 120, 121, 123, 128,
+  128, 125, 118, 109, 104, 106, 109, 107, 99, 89, 84, 85, 90, 94, 94, 92, 95, 106, 120, 130,
+  129, 126, 126, 134, 144, 148, 148, 147, 148, 148, 147, 143, 136, 130, 126, 128, 132, 132, 128, 126,
+  130, 133, 135, 135, 137, 141, 144, 146, 148, 146, 143, 143, 145, 146, 145, 142, 140, 137, 135, 131,
+  129, 129, 127, 123, 118, 116, 117, 118, 118, 115, 110, 99, 90, 87, 90, 92, 88, 79, 73, 79,
+  96, 115, 125, 128, 126, 125, 131, 139, 146, 153, 157, 156, 152, 147, 142, 135, 126, 120, 123, 129,
+  133, 130, 120, 115, 119, 129, 139, 146, 146, 144, 143, 146, 149, 150, 148, 144, 141, 143, 144, 143,
+  139, 134, 130, 129, 129, 128, 128, 127, 125, 122, 120, 119, 118, 116, 111, 106, 103, 101, 100, 94,
+  85, 73, 69, 77, 95, 111, 122, 121, 117, 113, 115, 125, 139, 149, 154, 154, 152, 150, 146, 141,
+  136, 134, 135, 135, 134, 130, 125, 119, 119, 124, 134, 141, 143, 138, 133, 133, 136, 142, 147, 150,
+  147, 143, 143, 143, 143, 141, 138, 136, 134, 135, 133, 132, 127, 125, 124, 124, 121, 118, 115, 112,
+  111, 108, 102, 94, 86, 80, 78, 81, 89, 100, 107, 110, 111, 112, 117, 122, 130, 137, 144, 149,
+  149, 147, 144, 144, 144, 142, 140, 137, 133, 129, 128, 128, 129, 129, 129, 129, 130, 133, 135, 138,
+  140, 143, 142, 141, 141, 143, 143, 143, 143, 143, 141, 139, 135, 135, 135, 135, 134, 131, 129, 125,
+  122, 120, 121, 122, 118, 112, 106, 103, 101, 100, 94, 88, 79, 75, 77, 89, 108, 122, 122, 111,
+  100, 102, 120, 142, 152, 153, 149, 144, 144, 143, 143, 142, 141, 141, 141, 141, 138, 130, 121, 117,
+  120, 133, 144, 146, 139, 128, 120, 125, 134, 146, 152, 150, 141, 135, 134, 139, 142, 143, 142, 139,
+  137, 135, 132, 129, 128, 128, 128, 127, 125, 120, 116, 113, 111, 108, 102, 95, 88, 85, 84, 84,
+  87, 92, 98, 105, 108, 110, 113, 117, 125, 133, 140, 144, 146, 144, 143, 143, 145, 148, 147, 142,
+  137, 134, 133, 133, 131, 131, 134, 135, 134, 129, 129, 131, 135, 138, 139, 139, 136, 135, 135, 137,
+  141, 143, 141, 138, 137, 137, 137, 136, 135, 133, 132, 130, 128, 128, 126, 124, 119, 115, 114, 114,
+  112, 105, 98, 93, 89, 88, 89, 91, 95, 98, 100, 103, 105, 108, 110, 117, 128, 139, 146, 145,
+  140, 137, 141, 147, 152, 152, 149, 144, 138, 135, 136, 139, 138, 136, 133, 133, 132, 130, 125, 125,
+  130, 137, 139, 137, 133, 131, 132, 137, 141, 143, 141, 137, 135, 137, 137, 137, 134, 131, 128, 128,
+  129, 131, 130, 126, 119, 113, 111, 112, 112, 107, 99, 90, 84, 82, 83, 91, 100, 107, 107, 104,
+  101, 104, 113, 127, 141, 147, 145, 140, 137, 138, 145, 149, 149, 146, 144, 141, 139, 136, 132, 131,
+  132, 135, 140, 142, 137, 130, 124, 125, 131, 140, 142, 138, 130, 128, 131, 136, 137, 136, 134, 135,
+  136, 137, 135, 131, 128, 129, 133, 138, 139, 133, 124, 118, 116, 120, 121, 118, 113, 106, 100, 93,
+  87, 86, 88, 93, 98, 103, 105, 104, 101, 102, 110, 123, 133, 139, 140, 137, 134, 137, 144, 152,
+  153, 149, 142, 140, 140, 143, 143, 143, 141, 138, 136, 135, 133, 132, 130, 130, 131, 133, 133, 130,
+  126, 126, 128, 133, 137, 135, 130, 127, 128, 131, 136, 141, 140, 134, 128, 126, 132, 138, 139, 134,
+  127, 122, 117, 116, 114, 112, 107, 102, 95, 89, 86, 90, 97, 105, 107, 104, 101, 97, 103, 113,
+  126, 135, 134, 130, 128, 133, 139, 144, 148, 147, 145, 143, 143, 143, 143, 141, 139, 141, 144, 146,
+  143, 135, 125, 124, 130, 140, 146, 142, 132, 123, 122, 128, 135, 140, 138, 130, 126, 124, 129, 133,
+  135, 134, 132, 128, 128, 130, 133, 133, 130, 126, 122, 117, 113, 111, 110, 106, 101, 93, 88, 88,
+  93, 103, 111, 114, 105, 94, 92, 103, 121, 136, 140, 134, 127, 124, 128, 137, 147, 152, 150, 145,
+  140, 138, 139, 141, 143, 143, 147, 148, 146, 139, 128, 123, 125, 135, 145, 146, 140, 130, 121, 120,
+  126, 133, 139, 140, 135, 128, 124, 125, 129, 133, 135, 135, 135, 133, 130, 129, 129, 128, 126, 123,
+  118, 113, 108, 106, 104, 99, 92, 90, 95, 104, 111, 109, 102, 95, 95, 106, 120, 129, 129, 125,
+  121, 123, 131, 137, 142, 142, 141, 141, 143, 144, 144, 143, 141, 144, 146, 148, 146, 142, 137, 135,
+  136, 137, 139, 138, 135, 132, 129, 129, 131, 131, 131, 131, 131, 128, 128, 128, 128, 129, 131, 131,
+  131, 129, 129, 129, 129, 129, 128, 126, 121, 116, 113, 112, 111, 108, 101, 94, 92, 97, 107, 113,
+  111, 101, 93, 93, 105, 120, 130, 131, 124, 116, 114, 121, 134, 144, 146, 140, 135, 135, 141, 146,
+  146, 146, 146, 148, 150, 148, 145, 140, 137, 137, 141, 144, 143, 137, 130, 128, 129, 132, 133, 132,
+  129, 125, 124, 124, 126, 126, 126, 128, 129, 131, 129, 128, 128, 128, 128, 128, 126, 123, 121, 116,
+  111, 108, 105, 103, 103, 101, 103, 106, 109, 112, 107, 99, 97, 105, 116, 125, 123, 118, 113, 113,
+  121, 129, 137, 136, 132, 131, 134, 139, 142, 144, 145, 148, 148, 150, 150, 147, 144, 143, 144, 145,
+  145, 143, 139, 136, 135, 135, 134, 133, 130, 128, 128, 128, 126, 126, 126, 126, 126, 128, 128, 129,
+  128, 128, 126, 126, 126, 125, 123, 120, 118, 116, 112, 109, 105, 104, 105, 107, 110, 112, 112, 106,
+  98, 95, 103, 114, 123, 125, 118, 108, 103, 112, 127, 137, 137, 131, 128, 129, 134, 140, 145, 147,
+  150, 150, 150, 149, 146, 144, 144, 148, 152, 151, 145, 138, 135, 135, 139, 143, 140, 133, 128, 124,
+  125, 128, 129, 129, 127, 125, 124, 124, 126, 124, 124, 122, 123, 125, 126, 124, 120, 116, 112, 111,
+  112, 112, 109, 105, 103, 105, 110, 112, 109, 102, 100, 105, 114, 120, 117, 112, 109, 111, 116, 121,
+  128, 130, 131, 129, 130, 134, 139, 141, 143, 144, 149, 150, 150, 148, 148, 150, 150, 152, 151, 148,
+  145, 143, 141, 140, 139, 139, 137, 134, 130, 127, 126, 126, 126, 126, 126, 124, 122, 122, 122, 124,
+  124, 124, 122, 122, 122, 120, 117, 113, 112, 112, 112, 111, 107, 102, 101, 105, 110, 111, 107, 102,
+  100, 106, 113, 117, 117, 114, 112, 114, 120, 125, 130, 131, 129, 130, 134, 139, 141, 141, 143, 146,
+  149, 152, 150, 147, 146, 147, 149, 152, 150, 147, 142, 139, 137, 138, 139, 137, 136, 132, 129, 127,
+  124, 126, 126, 129, 129, 129, 125, 122, 122, 125, 129, 129, 127, 124, 122, 120, 120, 120, 118, 116,
+  113, 110, 108, 105, 105, 108, 113, 114, 111, 104, 98, 98, 104, 111, 116, 115, 113, 111, 113, 118,
+  125, 130, 133, 133, 133, 137, 140, 143, 143, 146, 148, 150, 149, 147, 142, 140, 140, 143, 146, 145,
+  139, 134, 133, 135, 139, 141, 139, 136, 131, 129, 130, 132, 133, 133, 131, 130, 129, 128, 128, 128,
+  128, 128, 128, 125, 124, 122, 120, 119, 117, 116, 114, 113, 109, 105, 103, 103, 105, 104, 101, 94,
+  90, 94, 105, 117, 122, 119, 110, 106, 112, 126, 137, 143, 141, 138, 137, 139, 141, 142, 143, 143,
+  144, 146, 145, 142, 137, 132, 132, 138, 145, 148, 144, 137, 129, 129, 134, 140, 144, 143, 138, 131,
+  130, 133, 135, 136, 134, 131, 131, 131, 130, 129, 126, 126, 126, 126, 126, 124, 120, 116, 114, 112,
+  109, 105, 98, 93, 90, 90, 92, 96, 101, 105, 107, 107, 107, 112, 119, 126, 131, 133, 135, 135,
+  135, 137, 139, 142, 144, 142, 138, 135, 135, 135, 135, 135, 138, 139, 139, 136, 133, 133, 136, 140,
+  141, 141, 140, 137, 135, 138, 140, 141, 140, 138, 135, 135, 135, 135, 133, 133, 132, 129, 128, 126,
+  126, 125, 122, 118, 116, 116, 115, 112, 105, 99, 95, 91, 90, 91, 94, 98, 99, 101, 105, 108,
+  109, 112, 119, 131, 140, 144, 141, 137, 136, 140, 147, 151, 151, 146, 141, 136, 135, 135, 138, 137,
+  135, 133, 133, 131, 128, 124, 126, 133, 138, 139, 135, 132, 131, 134, 139, 142, 143, 139, 136, 135,
+  137, 137, 137, 133, 129, 128, 128, 130, 131, 129, 124, 116, 113, 111, 112, 111, 104, 96, 87, 82,
+  82, 86, 93, 103, 107, 107, 103, 102, 106, 118, 132, 144, 148, 143, 138, 137, 140, 147, 150, 148,
+  145, 143, 141, 138, 134, 131, 131, 132, 137, 141, 141, 136, 127, 124, 127, 134, 141, 141, 135, 129,
+  129, 133, 137, 137, 135, 133, 135, 136, 137, 134, 130, 128, 130, 135, 139, 138, 130, 121, 116, 118,
+  121, 120, 117, 111, 103, 98, 90, 86, 86, 90, 94, 99, 104, 105, 103, 101, 104, 114, 127, 136,
+  140, 139, 135, 135, 139, 147, 153, 152, 147, 142, 139, 141, 143, 143, 142, 140, 138, 135, 134, 133,
+  131, 129, 130, 131, 133, 132, 128, 126, 126, 130, 135, 136, 133, 130, 126, 128, 132, 137, 141, 138,
+  131, 127, 128, 135, 139, 137, 132, 125, 120, 117, 116, 114, 111, 105, 99, 92, 88, 87, 93, 100,
+  107, 106, 103, 99, 99, 106, 118, 130, 135, 133, 129, 129, 134, 141, 146, 148, 146, 144, 143, 143,
+  143, 143, 139, 139, 142, 146, 146, 140, 130, 124, 126, 134, 144, 146, 139, 127, 122, 124, 131, 137,
+  140, 135, 128, 125, 126, 131, 134, 135, 134, 131, 128, 129, 131, 133, 132, 129, 125, 120, 115, 112,
+  111, 109, 104, 98, 91, 86, 89, 96, 106, 113, 111, 101, 92, 95, 109, 128, 138, 138, 131, 125,
+  125, 131, 140, 149, 152, 148, 143, 138, 139, 139, 142, 143, 144, 147, 148, 144, 134, 125, 122, 129,
+  140, 146, 145, 136, 126, 120, 122, 128, 136, 140, 138, 133, 126, 124, 126, 130, 134, 135, 135, 134,
+  132, 129, 129, 129, 127, 125, 121, 116, 111, 108, 105, 102, 96, 91, 90, 98, 107, 112, 107, 98,
+  94, 98, 111, 124, 131, 128, 123, 120, 126, 133, 139, 141, 141, 141, 141, 144, 144, 144, 142, 142,
+  145, 147, 148, 145, 140, 136, 135, 137, 138, 139, 137, 134, 131, 129, 130, 131, 131, 131, 131, 130,
+  128, 128, 128, 128, 130, 131, 131, 131, 129, 129, 129, 129, 129, 127, 124, 119, 114, 112, 112, 111,
+  105, 98, 92, 93, 101, 109, 114, 107, 98, 92, 96, 111, 125, 131, 128, 121, 114, 116, 125, 139,
+  145, 144, 137, 135, 137, 144, 146, 146, 146, 147, 149, 149, 148, 143, 138, 137, 138, 143, 144, 142,
+  134, 128, 128, 130, 133, 133, 131, 127, 124, 124, 125, 126, 126, 126, 129, 130, 131, 129, 128, 128,
+  128, 128, 127, 125, 122, 119, 115, 110, 107, 104, 103, 103, 102, 104, 106, 111, 111, 104, 97, 100,
+  110, 120, 125, 121, 116, 112, 115, 124, 132, 137, 134, 131, 132, 136, 141, 143, 144, 146, 148, 149,
+  150, 150, 146, 143, 143, 144, 146, 145, 142, 138, 135, 135, 135, 134, 133, 129, 128, 128, 127, 126,
+  126, 126, 126, 127, 128, 128, 129, 128, 127, 126, 126, 126, 124, 122, 120, 117, 115, 110, 107, 105,
+  103, 105, 108, 110, 112, 110, 102, 97, 98, 107, 119, 124, 123, 114, 106, 105, 117, 131, 138, 136,
+  129, 128, 130, 135, 142, 146, 148, 150, 150, 150, 148, 145, 143, 145, 150, 152, 150, 143, 136, 135,
+  136, 141, 143, 138, 131, 126, 124, 126, 129, 129, 129, 126, 124, 124, 125, 126, 124, 123, 122, 124,
+  126, 126, 122, 119, 114, 111, 111, 112, 111, 108, 104, 103, 107, 111, 111, 107, 101, 101, 108, 117,
+  119, 115, 110, 109, 113, 118, 124, 129, 131, 131, 129, 131, 136, 140, 142, 143, 146, 150, 150, 150,
+  148, 148, 150, 151, 152, 150, 147, 144, 143, 141, 139, 139, 138, 136, 132, 129, 127, 126, 126, 126,
+  126, 126, 123, 122, 122, 122, 124, 124, 123, 122, 122, 122, 119, 115, 112, 112, 112, 112, 110, 105,
+  101, 102, 106, 111, 110, 105, 100, 101, 108, 115, 118, 116, 113, 112, 115, 121, 128, 131, 129, 129,
+  131, 136, 140, 141, 141, 144, 148, 150, 151, 149, 146, 146, 148, 150, 152, 150, 145, 140, 138, 138,
+  139, 139, 138, 135, 130, 126, 124, 124, 125, 126, 128, 127, 124, 120, 120, 121, 124, 126, 126, 124,
+  121, 118, 117, 116, 116, 116, 114, 110, 106, 103, 101, 105, 110, 115, 115, 110, 103, 100, 105, 114,
+  122, 124, 119, 114, 112, 115, 123, 131, 135, 135, 133, 132, 135, 139, 142, 144, 147, 151, 152, 150,
+  147, 143, 143, 147, 151, 152, 147, 142, 136, 135, 139, 142, 142, 137, 129, 124, 122, 125, 129, 129,
+  127, 124, 122, 121, 121, 122, 124, 126, 124, 122, 121, 120, 120, 118, 117, 114, 112, 111, 109, 108,
+  104, 103, 106, 111, 112, 110, 103, 101, 105, 114, 121, 120, 115, 111, 112, 118, 126, 132, 133, 131,
+  129, 131, 134, 139, 142, 145, 146, 148, 150, 149, 148, 146, 147, 150, 152, 152, 148, 141, 138, 137,
+  138, 141, 142, 137, 129, 125, 124, 126, 128, 128, 126, 123, 121, 121, 122, 124, 124, 124, 122, 122,
+  122, 124, 123, 120, 118, 116, 116, 116, 114, 110, 105, 103, 104, 108, 115, 118, 115, 106, 100, 102,
+  111, 119, 122, 118, 113, 112, 114, 119, 126, 129, 131, 129, 131, 133, 136, 138, 141, 143, 148, 152,
+  152, 149, 147, 145, 147, 150, 152, 151, 146, 141, 138, 138, 140, 141, 140, 136, 129, 125, 124, 124,
+  128, 129, 128, 125, 121, 118, 120, 123, 125, 124, 123, 122, 120, 120, 118, 116, 118, 116, 113, 110,
+  108, 107, 107, 109, 113, 116, 113, 106, 100, 102, 110, 118, 122, 120, 112, 107, 108, 116, 128, 133,
+  131, 126, 124, 127, 132, 139, 143, 146, 146, 146, 146, 146, 146, 146, 149, 152, 151, 149, 146, 142,
+  141, 141, 143, 144, 141, 136, 130, 126, 126, 128, 129, 129, 127, 123, 120, 120, 122, 123, 122, 122,
+  122, 122, 121, 120, 120, 118, 118, 118, 118, 116, 113, 108, 106, 105, 107, 110, 117, 118, 113, 107,
+  103, 106, 113, 119, 120, 117, 112, 111, 115, 120, 123, 124, 126, 129, 131, 132, 133, 135, 138, 141,
+  146, 150, 150, 149, 144, 144, 146, 150, 152, 152, 148, 143, 140, 141, 143, 144, 143, 138, 133, 127,
+  124, 125, 129, 129, 128, 125, 120, 120, 120, 121, 124, 124, 122, 120, 117, 117, 118, 120, 119, 116,
+  114, 111, 109, 109, 108, 107, 107, 110, 114, 113, 108, 106, 106, 111, 115, 118, 116, 114, 114, 116,
+  119, 124, 127, 129, 128, 128, 130, 134, 138, 141, 141, 144, 146, 148, 148, 147, 146, 147, 148, 150,
+  148, 147, 145, 142, 140, 139, 141, 141, 138, 133, 129, 126, 128, 128, 128, 126, 125, 124, 122, 122,
+  122, 122, 124, 124, 122, 120, 119, 118, 118, 120, 119, 118, 114, 112, 111, 110, 109, 109, 110, 113,
+  116, 116, 111, 106, 105, 111, 120, 122, 120, 115, 111, 112, 118, 124, 129, 129, 128, 128, 128, 133,
+  136, 141, 143, 144, 144, 146, 146, 145, 144, 145, 148, 150, 149, 146, 141, 139, 139, 141, 142, 140,
+  136, 131, 127, 127, 129, 130, 130, 128, 123, 122, 122, 124, 124, 124, 122, 120, 120, 118, 120, 120,
+  120, 118, 117, 115, 114, 114, 113, 112, 108, 107, 109, 114, 118, 116, 110, 106, 106, 113, 120, 122,
+  120, 116, 113, 114, 119, 124, 129, 129, 128, 128, 130, 133, 138, 141, 141, 143, 144, 146, 146, 145,
+  144, 144, 146, 148, 148, 145, 143, 140, 139, 139, 141, 141, 138, 133, 128, 124, 126, 128, 129, 128,
+  125, 121, 120, 120, 123, 125, 124, 121, 119, 118, 119, 120, 122, 120, 117, 115, 114, 113, 114, 114,
+  112, 109, 109, 112, 117, 118, 115, 110, 107, 111, 117, 121, 120, 117, 115, 114, 117, 122, 127, 129,
+  128, 126, 128, 131, 136, 139, 139, 141, 142, 144, 144, 144, 144, 143, 144, 146, 146, 146, 145, 140,
+  139, 139, 141, 141, 139, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+  126, 126, 126, 126, 126, 126, 126, 126, 126, 125, 125, 125, 125, 126, 126, 126, 126, 126, 126, 126,
+  127, 128, 128, 128, 129, 129, 130, 130, 130, 130, 130, 130, 130, 130, 131, 132, 132, 132, 132, 132,
+  131, 130, 129, 129, 129, 128, 128, 128, 128, 128, 128, 128, 127, 126, 126, 126, 126, 126, 126, 126,
+  126, 125, 124, 123, 122, 120, 119, 118, 116, 114, 114, 114, 116, 118, 120, 120, 122, 123, 125, 125,
+  125, 125, 125, 125, 126, 128, 130, 130, 132, 133, 135, 136, 136, 136, 136, 135, 136, 136, 136, 136,
+  136, 136, 137, 137, 136, 134, 132, 131, 129, 128, 126, 126, 125, 125, 125, 125, 126, 126, 128, 128,
+  128, 129, 129, 129, 129, 128, 126, 126, 123, 121, 117, 114, 110, 106, 102, 99, 101, 104, 108, 112,
+  114, 118, 122, 124, 128, 128, 126, 124, 124, 126, 129, 133, 134, 136, 139, 143, 145, 148, 147, 144,
+  142, 142, 142, 142, 140, 139, 139, 140, 141, 139, 138, 135, 131, 127, 125, 123, 122, 120, 118, 117,
+  119, 122, 124, 126, 128, 129, 129, 131, 133, 133, 133, 130, 126, 122, 119, 115, 109, 101, 93, 87,
+  85, 86, 90, 98, 103, 109, 114, 121, 127, 131, 131, 129, 128, 128, 128, 132, 136, 139, 142, 144,
+  148, 153, 156, 155, 152, 148, 148, 147, 145, 145, 143, 141, 141, 141, 141, 139, 136, 130, 126, 122,
+  119, 117, 115, 113, 113, 116, 120, 125, 129, 131, 133, 135, 137, 139, 139, 137, 133, 128, 123, 117,
+  110, 99, 87, 75, 66, 64, 69, 77, 89, 98, 106, 115, 124, 133, 138, 136, 131, 126, 125, 128,
+  133, 138, 144, 147, 151, 159, 166, 169, 166, 160, 155, 151, 149, 146, 142, 139, 138, 139, 141, 141,
+  139, 135, 128, 122, 118, 116, 115, 110, 108, 109, 113, 120, 127, 132, 135, 136, 138, 141, 142, 141,
+  138, 133, 126, 120, 115, 107, 95, 81, 69, 59, 58, 65, 76, 89, 99, 109, 122, 135, 144, 145,
+  142, 137, 133, 130, 131, 134, 138, 142, 146, 155, 163, 169, 170, 165, 160, 155, 151, 147, 140, 135,
+  132, 133, 135, 138, 139, 138, 135, 129, 125, 122, 118, 112, 107, 104, 107, 113, 121, 126, 131, 135,
+  141, 146, 148, 149, 146, 140, 132, 123, 115, 104, 90, 75, 61, 51, 49, 55, 67, 82, 95, 109,
+  124, 140, 150, 154, 152, 145, 140, 136, 134, 136, 139, 145, 150, 157, 164, 172, 174, 171, 165, 155,
+  149, 141, 134, 127, 122, 122, 124, 128, 132, 134, 134, 131, 126, 121, 118, 113, 108, 106, 106, 111,
+  118, 128, 137, 144, 148, 152, 154, 154, 151, 146, 137, 126, 115, 105, 94, 80, 64, 50, 45, 48,
+  57, 71, 87, 102, 119, 135, 148, 155, 157, 153, 147, 142, 138, 138, 141, 146, 151, 157, 164, 170,
+  173, 172, 164, 155, 146, 137, 129, 123, 120, 119, 122, 126, 131, 135, 135, 132, 128, 123, 117, 114,
+  111, 108, 110, 115, 125, 135, 143, 150, 154, 156, 155, 153, 148, 139, 129, 119, 108, 99, 90, 77,
+  64, 52, 44, 44, 53, 67, 83, 98, 114, 130, 147, 160, 167, 165, 160, 155, 153, 151, 152, 154,
+  154, 155, 158, 162, 163, 161, 153, 144, 137, 130, 126, 121, 116, 116, 118, 123, 126, 130, 130, 129,
+  127, 125, 123, 123, 122, 120, 121, 126, 135, 143, 149, 152, 154, 154, 151, 147, 141, 133, 123, 111,
+  102, 92, 82, 71, 58, 45, 38, 39, 47, 62, 81, 100, 121, 142, 162, 178, 184, 182, 176, 171,
+  164, 158, 152, 149, 147, 147, 148, 151, 153, 150, 143, 135, 129, 124, 119, 113, 108, 108, 113, 121,
+  128, 130, 134, 136, 138, 138, 136, 132, 130, 128, 130, 135, 140, 144, 147, 149, 150, 148, 146, 141,
+  133, 124, 113, 103, 93, 83, 72, 60, 47, 38, 35, 39, 51, 72, 95, 119, 140, 162, 182, 197,
+  201, 194, 183, 172, 162, 153, 146, 141, 139, 138, 139, 143, 143, 140, 133, 125, 117, 109, 106, 102,
+  99, 102, 110, 124, 135, 144, 149, 153, 154, 154, 151, 145, 138, 133, 132, 135, 139, 141, 141, 141,
+  142, 142, 139, 132, 122, 111, 101, 90, 79, 68, 54, 42, 34, 33, 39, 52, 72, 99, 125, 149,
+  172, 191, 205, 207, 201, 190, 177, 165, 154, 144, 136, 133, 132, 132, 133, 132, 130, 124, 117, 111,
+  104, 101, 99, 102, 108, 118, 129, 141, 150, 157, 161, 164, 163, 157, 149, 141, 137, 134, 132, 132,
+  132, 133, 135, 136, 136, 133, 127, 119, 110, 101, 91, 81, 72, 60, 48, 40, 36, 39, 50, 71,
+  98, 125, 149, 170, 191, 210, 220, 215, 201, 184, 168, 155, 141, 129, 120, 114, 115, 119, 123, 124,
+  120, 116, 112, 108, 105, 105, 106, 109, 115, 129, 145, 159, 166, 169, 172, 171, 167, 158, 145, 134,
+  127, 124, 122, 122, 122, 123, 126, 129, 130, 127, 121, 113, 104, 96, 87, 75, 61, 48, 39, 37,
+  41, 55, 76, 103, 133, 159, 181, 202, 216, 222, 213, 198, 179, 161, 143, 127, 116, 108, 106, 109,
+  114, 119, 120, 120, 118, 116, 113, 110, 110, 112, 116, 125, 138, 151, 162, 170, 173, 175, 172, 164,
+  153, 140, 129, 121, 116, 113, 113, 115, 118, 123, 128, 129, 128, 124, 119, 111, 101, 90, 78, 63,
+  49, 38, 35, 39, 53, 77, 106, 134, 160, 184, 205, 221, 228, 219, 201, 178, 157, 141, 126, 111,
+  100, 96, 99, 107, 115, 118, 119, 118, 117, 117, 116, 116, 116, 120, 128, 140, 155, 167, 173, 175,
+  176, 174, 167, 154, 139, 126, 119, 113, 110, 108, 108, 111, 118, 124, 127, 127, 123, 119, 111, 105,
+  96, 83, 68, 55, 45, 40, 44, 57, 79, 108, 136, 162, 186, 207, 222, 227, 217, 198, 175, 152,
+  132, 111, 95, 87, 86, 91, 100, 111, 119, 123, 127, 129, 129, 128, 126, 128, 130, 134, 144, 156,
+  165, 169, 171, 173, 170, 161, 149, 135, 123, 114, 107, 104, 102, 104, 109, 117, 123, 128, 129, 127,
+  122, 115, 106, 95, 81, 65, 51, 41, 38, 47, 65, 92, 120, 147, 173, 196, 216, 227, 223, 208,
+  188, 165, 144, 122, 105, 91, 84, 86, 94, 105, 113, 120, 125, 129, 130, 130, 129, 129, 128, 130,
+  138, 149, 158, 165, 169, 171, 173, 169, 159, 145, 130, 119, 111, 103, 99, 98, 100, 107, 115, 123,
+  128, 129, 128, 125, 119, 109, 96, 81, 66, 51, 42, 42, 51, 73, 99, 128, 156, 183, 207, 224,
+  228, 219, 200, 179, 155, 130, 105, 88, 77, 75, 80, 92, 106, 118, 128, 136, 141, 142, 141, 139,
+  136, 134, 135, 142, 150, 157, 162, 165, 167, 167, 162, 153, 138, 124, 113, 105, 98, 94, 93, 99,
+  107, 116, 124, 130, 133, 133, 130, 122, 111, 95, 80, 63, 48, 40, 41, 55, 81, 109, 138, 165,
+  190, 210, 224, 224, 211, 190, 165, 142, 121, 100, 84, 76, 77, 86, 99, 112, 123, 131, 138, 142,
+  144, 142, 140, 138, 136, 139, 145, 152, 159, 162, 164, 164, 163, 157, 146, 132, 120, 110, 101, 95,
+  93, 96, 103, 110, 119, 127, 131, 135, 134, 128, 117, 104, 89, 74, 59, 47, 41, 48, 66, 94,
+  124, 151, 177, 201, 218, 224, 219, 201, 177, 151, 128, 106, 87, 73, 71, 77, 90, 104, 119, 132,
+  141, 147, 149, 150, 147, 143, 139, 138, 140, 145, 152, 158, 159, 159, 159, 156, 149, 138, 126, 115,
+  105, 98, 94, 95, 99, 107, 115, 121, 129, 135, 137, 134, 126, 115, 101, 85, 70, 55, 44, 41,
+  52, 75, 105, 133, 160, 186, 209, 223, 227, 216, 196, 170, 143, 119, 98, 79, 69, 68, 78, 91,
+  107, 121, 134, 143, 149, 151, 151, 148, 143, 140, 141, 145, 150, 156, 160, 163, 163, 161, 156, 144,
+  132, 120, 110, 100, 93, 89, 91, 99, 109, 118, 124, 130, 134, 136, 133, 123, 108, 90, 73, 56,
+  45, 42, 53, 74, 103, 133, 161, 187, 209, 223, 223, 211, 188, 162, 135, 111, 88, 72, 64, 68,
+  80, 95, 112, 129, 143, 152, 157, 157, 154, 149, 143, 139, 139, 140, 146, 151, 157, 162, 163, 160,
+  153, 143, 132, 120, 108, 98, 92, 89, 94, 101, 111, 122, 131, 137, 141, 141, 135, 123, 109, 90,
+  69, 53, 40, 36, 45, 67, 96, 128, 157, 184, 207, 223, 228, 221, 198, 170, 142, 118, 95, 75,
+  64, 64, 74, 88, 107, 125, 139, 149, 157, 159, 156, 150, 145, 139, 138, 139, 144, 150, 155, 158,
+  162, 162, 158, 147, 134, 122, 111, 102, 94, 91, 92, 100, 109, 120, 129, 136, 140, 139, 134, 125,
+  111, 95, 78, 61, 47, 41, 46, 65, 91, 118, 146, 172, 199, 219, 228, 223, 203, 178, 152, 127,
+  101, 77, 62, 59, 66, 80, 99, 116, 133, 147, 158, 165, 166, 162, 155, 148, 143, 142, 142, 144,
+  146, 149, 153, 156, 155, 148, 139, 128, 118, 109, 100, 95, 94, 97, 105, 114, 124, 133, 140, 142,
+  138, 129, 115, 99, 80, 61, 44, 34, 39, 58, 85, 116, 145, 173, 200, 221, 231, 226, 206, 181,
+  155, 129, 103, 80, 64, 59, 65, 80, 97, 114, 130, 145, 155, 162, 163, 160, 153, 147, 142, 142,
+  144, 146, 148, 151, 155, 157, 156, 149, 140, 130, 120, 107, 97, 91, 91, 96, 103, 112, 122, 131,
+  139, 144, 141, 132, 119, 103, 85, 66, 49, 40, 43, 57, 81, 108, 137, 166, 194, 214, 223, 220,
+  207, 185, 159, 134, 108, 84, 67, 61, 66, 78, 94, 112, 129, 144, 155, 162, 164, 160, 154, 148,
+  143, 140, 141, 143, 147, 151, 154, 157, 156, 151, 144, 134, 122, 111, 101, 94, 92, 95, 101, 109,
+  118, 127, 135, 140, 139, 133, 122, 108, 92, 73, 56, 44, 39, 51, 74, 103, 131, 156, 181, 205,
+  222, 225, 213, 191, 165, 138, 115, 93, 74, 62, 62, 73, 90, 108, 125, 139, 151, 161, 164, 162,
+  157, 149, 145, 143, 143, 144, 146, 149, 154, 158, 157, 151, 143, 134, 124, 114, 104, 95, 91, 92,
+  100, 108, 118, 125, 133, 140, 142, 139, 129, 113, 94, 76, 58, 45, 37, 45, 64, 91, 120, 148,
+  175, 200, 219, 226, 217, 198, 173, 148, 121, 95, 75, 63, 61, 69, 84, 102, 121, 138, 152, 162,
+  167, 165, 161, 154, 145, 140, 139, 139, 141, 144, 151, 156, 159, 155, 148, 140, 130, 119, 106, 95,
+  90, 90, 95, 103, 112, 124, 134, 141, 144, 141, 132, 118, 101, 80, 59, 42, 33, 39, 57, 83,
+  112, 141, 172, 201, 222, 229, 222, 204, 181, 155, 126, 98, 74, 61, 59, 66, 81, 99, 119, 139,
+  154, 165, 171, 170, 163, 155, 146, 141, 137, 135, 136, 141, 148, 154, 157, 156, 150, 143, 134, 122,
+  109, 97, 91, 89, 94, 102, 111, 122, 133, 143, 145, 143, 135, 122, 105, 83, 62, 45, 35, 39,
+  55, 78, 104, 135, 167, 197, 216, 223, 220, 207, 186, 160, 132, 103, 78, 64, 61, 66, 78, 96,
+  116, 135, 152, 163, 170, 170, 165, 156, 148, 141, 136, 133, 134, 139, 146, 153, 158, 160, 157, 150,
+  140, 129, 115, 101, 92, 89, 89, 94, 102, 114, 125, 137, 143, 143, 138, 127, 112, 94, 72, 53,
+  40, 40, 51, 71, 96, 123, 153, 183, 206, 220, 220, 210, 193, 171, 145, 116, 91, 73, 65, 67,
+  77, 91, 109, 127, 144, 157, 166, 169, 164, 158, 148, 141, 136, 134, 133, 135, 140, 149, 156, 160,
+  158, 152, 144, 134, 120, 108, 97, 92, 91, 94, 101, 110, 120, 132, 139, 141, 137, 127, 112, 96,
+  77, 59, 45, 44, 53, 72, 93, 119, 147, 176, 200, 213, 216, 209, 194, 176, 152, 125, 99, 79,
+  69, 68, 73, 87, 102, 119, 136, 152, 164, 169, 168, 163, 156, 148, 141, 136, 133, 133, 136, 140,
+  145, 149, 150, 149, 145, 138, 129, 119, 108, 102, 99, 100, 104, 109, 117, 124, 131, 134, 134, 127,
+  114, 99, 82, 65, 51, 45, 49, 64, 85, 110, 135, 162, 189, 208, 217, 214, 201, 184, 163, 140,
+  115, 91, 76, 71, 73, 83, 96, 112, 128, 143, 154, 163, 164, 160, 155, 149, 143, 138, 135, 135,
+  137, 142, 148, 151, 151, 149, 145, 140, 131, 121, 111, 104, 101, 101, 104, 110, 116, 124, 131, 134,
+  132, 125, 114, 97, 80, 62, 49, 45, 51, 66, 85, 109, 137, 166, 190, 206, 213, 210, 198, 182,
+  161, 136, 111, 91, 79, 74, 78, 87, 99, 113, 129, 143, 154, 160, 163, 160, 155, 149, 143, 139,
+  135, 133, 135, 139, 143, 146, 147, 145, 143, 139, 133, 125, 117, 113, 109, 109, 111, 115, 119, 124,
+  128, 129, 127, 120, 109, 95, 79, 63, 51, 46, 52, 66, 83, 103, 128, 156, 181, 201, 209, 209,
+  199, 184, 166, 145, 123, 101, 86, 80, 81, 89, 99, 112, 125, 137, 149, 156, 160, 157, 153, 148,
+  144, 139, 135, 133, 134, 136, 141, 145, 146, 145, 143, 140, 135, 128, 121, 114, 112, 111, 113, 115,
+  119, 122, 128, 129, 126, 119, 108, 94, 80, 64, 53, 49, 55, 67, 83, 102, 126, 152, 176, 193,
+  200, 200, 195, 184, 168, 149, 128, 109, 96, 90, 89, 92, 100, 110, 122, 134, 144, 152, 156, 155,
+  152, 150, 145, 140, 135, 133, 134, 137, 141, 143, 144, 144, 145, 143, 138, 130, 122, 115, 112, 111,
+  111, 113, 115, 120, 126, 129, 129, 123, 115, 102, 88, 72, 58, 50, 50, 58, 72, 92, 114, 140,
+  166, 188, 202, 207, 204, 193, 177, 157, 135, 115, 98, 88, 85, 87, 96, 107, 120, 132, 142, 151,
+  156, 155, 151, 147, 142, 138, 135, 135, 136, 139, 143, 146, 149, 150, 147, 142, 135, 128, 120, 112,
+  108, 106, 108, 111, 116, 123, 129, 132, 133, 129, 122, 110, 96, 80, 65, 53, 46, 50, 63, 81,
+  106, 131, 156, 181, 200, 212, 213, 203, 185, 164, 143, 119, 99, 83, 76, 77, 85, 98, 113, 128,
+  141, 152, 158, 162, 160, 155, 149, 143, 138, 136, 137, 138, 139, 144, 148, 150, 147, 143, 136, 128,
+  119, 112, 105, 103, 103, 107, 113, 121, 129, 134, 137, 135, 129, 117, 102, 85, 68, 51, 40, 40,
+  53, 75, 102, 130, 158, 184, 206, 221, 223, 210, 190, 167, 142, 117, 94, 76, 67, 68, 77, 93,
+  109, 125, 140, 151, 160, 163, 161, 156, 149, 142, 141, 141, 143, 146, 148, 152, 155, 156, 151, 143,
+  133, 124, 113, 100, 92, 90, 93, 101, 109, 118, 128, 136, 142, 143, 137, 124, 109, 92, 73, 54,
+  41, 40, 51, 72, 98, 127, 155, 184, 208, 221, 224, 213, 194, 169, 143, 117, 92, 73, 63, 63,
+  73, 88, 105, 122, 139, 152, 161, 164, 162, 157, 151, 146, 142, 139, 142, 145, 148, 152, 156, 157,
+  153, 147, 138, 127, 115, 105, 97, 93, 93, 97, 105, 114, 123, 133, 138, 139, 136, 127, 115, 99,
+  80, 62, 47, 40, 45, 65, 91, 120, 147, 172, 197, 217, 226, 219, 200, 174, 148, 124, 101, 81,
+  66, 61, 67, 83, 101, 119, 134, 147, 158, 164, 163, 158, 151, 146, 143, 142, 144, 145, 148, 152,
+  156, 157, 154, 147, 139, 129, 119, 108, 98, 92, 91, 97, 105, 114, 123, 131, 138, 142, 141, 132,
+  119, 101, 83, 65, 48, 39, 41, 56, 80, 109, 137, 165, 192, 213, 226, 222, 205, 183, 158, 131,
+  104, 82, 66, 61, 65, 77, 96, 115, 132, 148, 160, 166, 167, 163, 156, 148, 141, 139, 140, 141,
+  143, 147, 155, 158, 157, 151, 143, 134, 123, 111, 99, 91, 90, 93, 100, 108, 119, 131, 139, 144,
+  144, 136, 124, 107, 88, 67, 48, 36, 36, 49, 72, 100, 130, 161, 189, 214, 228, 225, 211, 190,
+  165, 138, 109, 83, 65, 59, 62, 74, 92, 111, 130, 149, 162, 169, 171, 166, 158, 150, 143, 138,
+  135, 136, 139, 144, 152, 157, 157, 153, 146, 137, 127, 113, 101, 93, 90, 91, 98, 108, 118, 129,
+  139, 145, 145, 139, 127, 111, 92, 69, 50, 37, 36, 48, 69, 94, 123, 155, 187, 210, 222, 223,
+  212, 195, 171, 143, 113, 87, 68, 61, 63, 73, 89, 107, 128, 145, 159, 167, 170, 166, 159, 151,
+  143, 137, 135, 134, 137, 144, 150, 157, 160, 158, 153, 145, 133, 120, 106, 95, 89, 89, 92, 99,
+  109, 121, 132, 141, 144, 141, 131, 118, 102, 80, 60, 44, 39, 45, 62, 85, 112, 142, 173, 199,
+  216, 222, 215, 201, 180, 155, 127, 101, 78, 66, 65, 72, 85, 101, 120, 138, 153, 164, 167, 166,
+  161, 152, 143, 138, 133, 133, 134, 138, 145, 153, 158, 158, 155, 148, 138, 126, 113, 101, 94, 91,
+  93, 98, 106, 117, 127, 137, 140, 139, 131, 118, 103, 83, 65, 49, 44, 49, 64, 85, 109, 135,
+  165, 191, 210, 216, 213, 201, 184, 161, 134, 108, 86, 73, 67, 70, 81, 96, 112, 129, 147, 160,
+  168, 169, 166, 160, 152, 144, 138, 134, 132, 133, 139, 144, 148, 150, 149, 146, 141, 132, 123, 112,
+  104, 99, 99, 102, 107, 113, 121, 128, 134, 135, 130, 120, 105, 89, 72, 55, 46, 47, 57, 77,
+  100, 125, 151, 179, 202, 216, 216, 206, 191, 171, 149, 124, 99, 81, 71, 71, 78, 91, 105, 122,
+  138, 151, 160, 164, 162, 157, 151, 145, 140, 136, 135, 136, 140, 146, 149, 151, 149, 147, 142, 134,
+  125, 114, 106, 102, 101, 103, 107, 113, 120, 128, 133, 133, 129, 118, 104, 86, 68, 53, 45, 47,
+  59, 77, 100, 126, 154, 180, 201, 212, 211, 203, 189, 169, 145, 120, 98, 82, 75, 76, 83, 94,
+  108, 123, 138, 150, 159, 162, 161, 157, 151, 146, 140, 136, 134, 135, 137, 141, 145, 147, 146, 144,
+  141, 135, 129, 121, 114, 111, 110, 110, 113, 117, 122, 126, 128, 128, 123, 114, 101, 86, 69, 55,
+  46, 50, 60, 77, 95, 119, 146, 172, 195, 208, 210, 202, 190, 175, 153, 131, 109, 91, 81, 80,
+  86, 95, 107, 119, 133, 145, 154, 159, 159, 155, 150, 145, 141, 137, 134, 133, 135, 139, 144, 147,
+  146, 144, 141, 137, 131, 124, 117, 113, 111, 113, 114, 118, 121, 125, 128, 128, 122, 112, 100, 85,
+  70, 56, 49, 52, 62, 77, 95, 117, 142, 168, 187, 199, 201, 198, 188, 175, 156, 136, 116, 101,
+  91, 88, 89, 96, 106, 117, 129, 140, 149, 154, 155, 153, 151, 147, 142, 138, 134, 133, 135, 139,
+  142, 144, 144, 145, 144, 142, 135, 126, 119, 115, 113, 113, 113, 114, 118, 124, 127, 128, 124, 116,
+  105, 92, 77, 63, 53, 51, 56, 69, 87, 107, 129, 155, 178, 194, 201, 200, 193, 182, 166, 145,
+  126, 109, 98, 93, 92, 98, 106, 117, 127, 138, 147, 153, 153, 151, 148, 144, 139, 135, 131, 130,
+  130, 134, 138, 141, 143, 144, 145, 142, 138, 131, 125, 119, 116, 114, 114, 116, 120, 124, 128, 129,
+  126, 120, 110, 97, 81, 67, 56, 51, 53, 62, 77, 96, 118, 143, 165, 183, 195, 198, 195, 188,
+  173, 156, 137, 121, 108, 99, 95, 98, 104, 113, 123, 135, 144, 152, 155, 155, 151, 147, 141, 135,
+  130, 127, 126, 127, 130, 133, 137, 139, 142, 142, 140, 137, 134, 128, 125, 122, 121, 120, 121, 123,
+  125, 126, 125, 120, 111, 99, 84, 70, 61, 55, 55, 61, 70, 87, 107, 130, 152, 171, 183, 190,
+  192, 189, 178, 164, 148, 132, 119, 109, 105, 104, 108, 115, 123, 132, 141, 148, 152, 154, 151, 147,
+  143, 137, 131, 125, 122, 122, 124, 127, 129, 133, 137, 139, 139, 138, 137, 133, 130, 128, 126, 124,
+  123, 125, 126, 128, 125, 119, 111, 101, 89, 74, 63, 56, 56, 60, 68, 83, 101, 123, 144, 164,
+  178, 186, 190, 187, 180, 168, 152, 137, 124, 114, 109, 107, 110, 115, 122, 132, 142, 148, 154, 156,
+  154, 150, 146, 139, 131, 124, 119, 117, 119, 120, 122, 125, 129, 134, 137, 138, 138, 136, 134, 133,
+  132, 130, 128, 128, 128, 128, 125, 121, 112, 102, 91, 80, 68, 59, 57, 61, 68, 80, 96, 115,
+  134, 153, 167, 177, 181, 181, 176, 167, 155, 143, 132, 123, 116, 116, 117, 121, 126, 134, 142, 148,
+  152, 153, 153, 149, 145, 139, 131, 125, 119, 117, 117, 118, 120, 122, 126, 130, 134, 136, 136, 136,
+  135, 135, 133, 133, 130, 129, 128, 127, 124, 118, 110, 101, 92, 80, 69, 63, 63, 66, 72, 84,
+  98, 116, 133, 149, 162, 172, 175, 175, 171, 161, 152, 141, 131, 123, 118, 117, 119, 123, 129, 138,
+  146, 152, 156, 157, 156, 152, 148, 140, 132, 124, 119, 116, 114, 114, 115, 119, 123, 128, 132, 135,
+  136, 136, 136, 135, 134, 132, 130, 126, 126, 125, 123, 118, 113, 106, 98, 90, 80, 72, 68, 70,
+  75, 83, 93, 106, 122, 139, 154, 164, 170, 173, 172, 166, 158, 147, 137, 128, 122, 120, 119, 122,
+  127, 133, 141, 149, 154, 156, 157, 154, 150, 145, 138, 130, 122, 117, 114, 114, 114, 116, 118, 122,
+  128, 131, 134, 135, 136, 136, 136, 135, 133, 130, 127, 125, 121, 114, 106, 98, 89, 80, 73, 70,
+  70, 74, 80, 90, 103, 118, 132, 145, 156, 164, 168, 168, 165, 159, 151, 141, 133, 127, 123, 122,
+  122, 126, 131, 137, 144, 150, 154, 157, 157, 154, 150, 144, 137, 129, 123, 118, 114, 113, 113, 113,
+  116, 120, 125, 128, 132, 135, 136, 137, 138, 138, 136, 134, 130, 126, 122, 114, 107, 98, 88, 79,
+  74, 70, 72, 77, 84, 94, 106, 119, 134, 146, 154, 161, 163, 162, 159, 154, 146, 138, 132, 127,
+  125, 125, 127, 131, 136, 142, 149, 153, 157, 157, 156, 153, 148, 143, 136, 128, 122, 118, 116, 114,
+  113, 114, 118, 120, 124, 128, 131, 133, 134, 135, 135, 135, 133, 131, 128, 125, 120, 113, 106, 97,
+  89, 81, 76, 74, 76, 80, 88, 96, 108, 122, 134, 145, 153, 158, 162, 160, 156, 151, 143, 137,
+  131, 127, 125, 126, 128, 133, 138, 146, 151, 156, 159, 159, 158, 154, 148, 141, 134, 127, 121, 116,
+  113, 111, 111, 113, 116, 120, 124, 128, 130, 132, 133, 134, 134, 133, 131, 130, 129, 125, 121, 115,
+  107, 100, 92, 84, 79, 76, 77, 81, 88, 97, 109, 121, 133, 145, 152, 156, 158, 157, 154, 148,
+  142, 135, 130, 126, 125, 126, 128, 133, 139, 145, 151, 156, 158, 160, 158, 155, 149, 143, 136, 129,
+  121, 117, 114, 112, 112, 113, 115, 119, 123, 126, 130, 132, 133, 133, 133, 133, 132, 130, 126, 124,
+  119, 112, 106, 98, 89, 83, 80, 79, 80, 84, 91, 100, 111, 123, 134, 144, 151, 156, 159, 158,
+  154, 149, 141, 136, 130, 127, 126, 126, 128, 132, 138, 145, 151, 156, 158, 159, 158, 155, 149, 143,
+  135, 127, 122, 117, 113, 111, 111, 111, 114, 117, 121, 125, 128, 130, 132, 133, 134, 134, 133, 132,
+  130, 127, 123, 117, 109, 102, 94, 86, 81, 79, 80, 84, 89, 97, 108, 119, 131, 141, 148, 153,
+  156, 155, 153, 149, 143, 136, 130, 127, 126, 127, 129, 132, 138, 143, 151, 156, 158, 160, 159, 156,
+  152, 146, 138, 132, 125, 119, 116, 114, 113, 114, 114, 117, 120, 123, 125, 126, 127, 128, 129, 130,
+  130, 130, 129, 129, 125, 121, 114, 107, 98, 90, 83, 79, 77, 79, 86, 95, 106, 118, 131, 145,
+  154, 161, 164, 163, 159, 152, 143, 133, 125, 117, 114, 114, 116, 122, 129, 137, 146, 154, 159, 162,
+  162, 159, 156, 149, 142, 135, 128, 124, 122, 120, 120, 120, 122, 123, 124, 125, 124, 123, 122, 122,
+  122, 123, 123, 125, 126, 128, 127, 124, 120, 112, 103, 93, 84, 76, 72, 72, 77, 87, 99, 115,
+  131, 147, 162, 172, 177, 176, 169, 160, 149, 136, 122, 112, 105, 102, 105, 111, 119, 129, 140, 150,
+  157, 162, 163, 160, 156, 150, 144, 139, 133, 129, 128, 128, 128, 129, 129, 129, 129, 128, 124, 122,
+  118, 116, 116, 117, 119, 121, 124, 127, 129, 128, 124, 116, 105, 94, 81, 71, 65, 64, 71, 82,
+  97, 115, 135, 155, 172, 183, 186, 185, 176, 165, 150, 132, 116, 103, 96, 93, 96, 103, 113, 125,
+  137, 148, 156, 160, 161, 159, 156, 150, 145, 139, 135, 132, 132, 132, 134, 135, 135, 135, 133, 131,
+  127, 123, 119, 116, 116, 117, 119, 121, 123, 126, 128, 127, 122, 115, 104, 92, 78, 65, 57, 56,
+  63, 77, 92, 112, 135, 158, 179, 193, 198, 195, 185, 173, 156, 137, 118, 101, 90, 86, 90, 97,
+  108, 119, 130, 143, 153, 158, 160, 157, 152, 148, 142, 139, 135, 133, 133, 136, 140, 142, 142, 142,
+  140, 137, 133, 126, 119, 114, 113, 113, 114, 116, 120, 124, 128, 128, 124, 115, 103, 90, 74, 60,
+  51, 50, 59, 73, 90, 111, 134, 161, 183, 197, 201, 200, 192, 179, 162, 142, 122, 105, 93, 88,
+  89, 94, 103, 114, 125, 137, 147, 153, 155, 153, 152, 148, 144, 139, 135, 133, 134, 138, 141, 143,
+  144, 144, 145, 143, 138, 128, 121, 116, 114, 113, 113, 113, 117, 122, 126, 128, 125, 118, 108, 96,
+  81, 67, 55, 51, 54, 65, 82, 101, 122, 148, 172, 191, 200, 201, 196, 186, 171, 151, 131, 113,
+  101, 94, 92, 96, 103, 113, 124, 135, 144, 152, 154, 152, 149, 145, 141, 136, 132, 130, 130, 133,
+  137, 140, 142, 144, 145, 143, 139, 133, 126, 121, 117, 115, 114, 116, 118, 122, 128, 129, 127, 122,
+  113, 101, 86, 71, 59, 52, 51, 60, 72, 89, 111, 135, 159, 178, 192, 198, 197, 191, 178, 162,
+  143, 125, 111, 101, 96, 96, 102, 111, 120, 132, 142, 150, 154, 155, 152, 148, 143, 137, 131, 127,
+  126, 126, 129, 132, 136, 138, 141, 142, 141, 139, 135, 130, 126, 123, 122, 120, 121, 123, 125, 126,
+  125, 122, 114, 103, 88, 74, 63, 56, 54, 59, 67, 81, 101, 123, 146, 165, 180, 188, 192, 190,
+  182, 169, 153, 136, 122, 111, 106, 104, 106, 113, 120, 130, 139, 146, 151, 154, 152, 148, 144, 139,
+  133, 127, 122, 122, 123, 126, 128, 132, 136, 139, 141, 139, 137, 134, 130, 128, 126, 125, 123, 124,
+  126, 128, 126, 121, 113, 104, 93, 78, 66, 58, 55, 58, 65, 78, 95, 116, 138, 159, 174, 184,
+  190, 189, 183, 172, 157, 141, 127, 116, 110, 107, 109, 113, 120, 129, 139, 148, 152, 156, 155, 152,
+  148, 141, 133, 126, 120, 118, 119, 119, 121, 124, 128, 133, 136, 138, 138, 137, 135, 133, 132, 131,
+  129, 128, 128, 128, 126, 122, 115, 105, 95, 83, 71, 62, 57, 59, 66, 76, 91, 109, 129, 148,
+  163, 174, 181, 182, 178, 170, 159, 147, 135, 125, 118, 115, 116, 120, 125, 132, 139, 146, 151, 153,
+  153, 150, 146, 140, 134, 127, 121, 118, 117, 118, 119, 121, 125, 129, 133, 136, 136, 136, 135, 135,
+  134, 132, 130, 129, 128, 127, 125, 120, 112, 104, 95, 83, 72, 64, 62, 65, 71, 80, 93, 110,
+  128, 145, 158, 169, 175, 176, 172, 164, 154, 144, 134, 124, 119, 117, 119, 121, 127, 136, 144, 151,
+  155, 157, 156, 153, 149, 143, 134, 126, 120, 116, 114, 114, 115, 118, 122, 126, 131, 135, 136, 136,
+  136, 136, 134, 132, 130, 128, 126, 125, 124, 120, 114, 108, 100, 93, 83, 74, 69, 69, 73, 80,
+  89, 102, 117, 134, 150, 161, 168, 172, 173, 168, 161, 150, 140, 130, 124, 121, 119, 121, 125, 131,
+  139, 147, 153, 156, 157, 155, 151, 147, 140, 132, 125, 119, 115, 114, 114, 115, 117, 121, 126, 130,
+  134, 135, 136, 136, 136, 135, 133, 131, 128, 126, 122, 116, 109, 101, 92, 83, 75, 71, 70, 73,
+  78, 87, 99, 113, 128, 141, 154, 162, 167, 169, 166, 161, 154, 144, 135, 129, 124, 122, 122, 124,
+  130, 135, 143, 149, 153, 157, 157, 155, 151, 146, 139, 131, 125, 119, 115, 113, 113, 113, 116, 118,
+  123, 127, 131, 134, 136, 137, 138, 138, 136, 134, 131, 128, 123, 117, 109, 101, 91, 82, 75, 71,
+  71, 74, 82, 91, 102, 115, 130, 142, 152, 159, 163, 163, 160, 156, 148, 141, 134, 128, 126, 125,
+  126, 129, 134, 140, 147, 152, 156, 157, 157, 154, 150, 144, 138, 130, 124, 119, 116, 114, 113, 114,
+  117, 119, 123, 127, 131, 133, 133, 135, 135, 135, 133, 131, 129, 126, 122, 116, 108, 100, 91, 83,
+  77, 74, 75, 79, 85, 94, 104, 118, 130, 142, 152, 157, 160, 161, 158, 153, 146, 138, 132, 128,
+  125, 125, 127, 131, 137, 143, 150, 155, 158, 159, 158, 156, 150, 143, 137, 129, 123, 118, 114, 111,
+  111, 112, 115, 119, 123, 127, 129, 131, 133, 133, 134, 133, 132, 130, 130, 126, 122, 117, 110, 102,
+  94, 86, 80, 77, 77, 80, 86, 94, 105, 117, 130, 141, 150, 155, 158, 157, 155, 150, 144, 137,
+  131, 127, 125, 125, 127, 132, 137, 144, 149, 155, 158, 160, 158, 156, 151, 145, 138, 131, 123, 118,
+  115, 113, 112, 113, 115, 118, 121, 125, 129, 131, 133, 133, 133, 133, 132, 130, 128, 125, 120, 115,
+  108, 101, 92, 85, 80, 79, 80, 83, 89, 97, 108, 119, 132, 141, 150, 155, 158, 159, 156, 150,
+  143, 137, 131, 128, 126, 126, 127, 130, 136, 143, 149, 155, 158, 159, 158, 156, 151, 145, 137, 130,
+  123, 118, 114, 111, 111, 111, 114, 116, 120, 124, 127, 129, 131, 133, 134, 134, 133, 132, 131, 128,
+  124, 119, 112, 104, 96, 89, 82, 79, 79, 83, 88, 94, 104, 116, 127, 138, 146, 152, 155, 156,
+  154, 151, 145, 139, 132, 128, 126, 126, 128, 132, 136, 142, 149, 155, 158, 160, 160, 158, 154, 148,
+  142, 134, 127, 120, 116, 112, 111, 110, 111, 113, 117, 121, 124, 128, 130, 132, 133, 133, 133, 132,
+  130, 128, 125, 120, 114, 106, 98, 92, 85, 83, 82, 84, 89, 96, 103, 114, 124, 133, 142, 148,
+  152, 154, 154, 150, 145, 139, 134, 130, 126, 126, 127, 129, 133, 138, 145, 152, 157, 160, 160, 160,
+  157, 152, 145, 138, 130, 122, 117, 113, 111, 110, 110, 113, 115, 119, 123, 125, 128, 130, 132, 133,
+  132, 132, 130, 128, 125, 121, 115, 109, 102, 95, 90, 86, 85, 86, 89, 95, 102, 111, 120, 130,
+  138, 146, 150, 152, 153, 150, 146, 141, 136, 131, 128, 126, 126, 128, 131, 137, 144, 150, 156, 159,
+  161, 161, 159, 155, 149, 141, 133, 126, 118, 114, 110, 108, 107, 108, 112, 117, 121, 125, 127, 130,
+  132, 133, 133, 132, 130, 128, 125, 121, 116, 111, 105, 98, 93, 89, 88, 89, 90, 95, 101, 109,
+  118, 127, 135, 141, 146, 149, 151, 149, 146, 143, 137, 133, 128, 126, 125, 126, 129, 134, 139, 147,
+  152, 157, 160, 161, 159, 157, 152, 145, 138, 130, 123, 117, 112, 109, 107, 108, 110, 113, 116, 122,
+  126, 129, 132, 133, 134, 135, 133, 130, 128, 123, 118, 111, 105, 98, 93, 89, 88, 88, 92, 96,
+  102, 111, 119, 128, 136, 142, 146, 148, 148, 146, 143, 138, 133, 129, 126, 125, 125, 127, 130, 136,
+  142, 149, 155, 159, 161, 161, 159, 156, 151, 144, 136, 128, 122, 117, 113, 111, 110, 110, 112, 115,
+  119, 122, 125, 128, 130, 132, 132, 131, 130, 128, 126, 123, 117, 111, 105, 100, 95, 91, 89, 90,
+  93, 97, 103, 111, 119, 128, 136, 142, 146, 149, 150, 149, 145, 140, 136, 131, 127, 125, 123, 124,
+  127, 133, 139, 146, 152, 157, 160, 162, 161, 158, 153, 146, 139, 131, 123, 116, 112, 108, 107, 107,
+  108, 111, 115, 119, 122, 126, 130, 132, 134, 135, 133, 131, 129, 126, 120, 113, 106, 100, 94, 89,
+  89, 89, 91, 97, 103, 112, 120, 129, 136, 142, 147, 149, 150, 148, 144, 139, 135, 129, 126, 123,
+  122, 124, 127, 131, 138, 144, 152, 157, 161, 163, 161, 158, 154, 148, 140, 131, 124, 117, 112, 108,
+  107, 107, 108, 112, 116, 120, 124, 128, 130, 132, 133, 132, 130, 128, 124, 120, 114, 107, 101, 96,
+  92, 89, 89, 92, 97, 103, 110, 118, 126, 135, 140, 146, 148, 150, 149, 146, 141, 136, 132, 128,
+  124, 123, 123, 126, 131, 136, 143, 149, 154, 158, 161, 162, 159, 155, 149, 141, 133, 126, 118, 113,
+  109, 105, 105, 106, 108, 113, 117, 121, 125, 129, 132, 134, 135, 134, 132, 128, 124, 119, 113, 107,
+  101, 96, 93, 92, 94, 96, 101, 108, 116, 124, 131, 139, 144, 146, 148, 146, 144, 141, 136, 132,
+  128, 124, 123, 124, 127, 130, 135, 141, 147, 153, 157, 159, 160, 159, 155, 149, 142, 136, 128, 121,
+  116, 112, 110, 108, 110, 112, 115, 119, 122, 125, 128, 130, 130, 129, 127, 124, 120, 116, 110, 104,
+  100, 96, 94, 94, 96, 98, 104, 110, 118, 126, 133, 139, 144, 147, 149, 149, 147, 143, 138, 134,
+  130, 127, 126, 126, 127, 131, 135, 141, 147, 151, 155, 158, 157, 156, 152, 147, 140, 134, 126, 120,
+  115, 111, 108, 107, 108, 111, 113, 117, 121, 125, 128, 130, 132, 130, 128, 123, 119, 113, 107, 100,
+  96, 92, 92, 93, 97, 102, 109, 117, 126, 135, 141, 146, 150, 151, 150, 146, 143, 138, 132, 128,
+  125, 123, 124, 127, 131, 136, 143, 149, 153, 158, 159, 159, 156, 152, 146, 138, 130, 123, 117, 111,
+  109, 107, 107, 109, 113, 116, 120, 124, 127, 130, 130, 130, 127, 123, 119, 113, 107, 101, 96, 94,
+  93, 94, 98, 103, 109, 117, 126, 133, 141, 145, 149, 151, 150, 147, 143, 139, 134, 130, 127, 125,
+  125, 127, 131, 134, 140, 146, 150, 154, 156, 156, 154, 150, 145, 138, 131, 124, 118, 114, 110, 107,
+  107, 109, 112, 116, 119, 123, 127, 131, 132, 132, 130, 126, 122, 117, 111, 104, 98, 94, 92, 92,
+  94, 99, 105, 113, 121, 130, 138, 144, 149, 151, 151, 149, 145, 140, 135, 130, 126, 124, 123, 124,
+  128, 132, 137, 145, 150, 154, 157, 157, 156, 153, 148, 141, 135, 128, 121, 115, 111, 108, 107, 108,
+  111, 115, 119, 122, 126, 129, 132, 133, 131, 129, 124, 118, 112, 107, 101, 95, 93, 92, 93, 97,
+  102, 109, 116, 125, 133, 139, 145, 148, 150, 149, 147, 143, 139, 134, 128, 126, 124, 123, 125, 128,
+  133, 139, 144, 149, 154, 156, 156, 154, 151, 147, 141, 134, 127, 120, 116, 112, 109, 108, 110, 112,
+  116, 120, 124, 126, 130, 132, 132, 132, 128, 125, 121, 115, 110, 105, 99, 96, 95, 95, 97, 101,
+  106, 113, 120, 127, 134, 139, 143, 145, 146, 144, 141, 137, 133, 130, 127, 125, 125, 126, 129, 134,
+  139, 145, 149, 154, 156, 156, 154, 152, 148, 142, 136, 131, 125, 119, 115, 113, 111, 111, 113, 116,
+  119, 122, 125, 127, 129, 130, 129, 127, 123, 119, 114, 108, 103, 99, 96, 95, 95, 97, 102, 108,
+  114, 121, 129, 135, 140, 144, 147, 146, 144, 141, 137, 133, 129, 127, 126, 126, 128, 130, 135, 139,
+  145, 150, 154, 156, 156, 154, 152, 147, 142, 135, 129, 123, 117, 114, 112, 111, 111, 113, 115, 119,
+  123, 126, 129, 131, 132, 132, 130, 126, 122, 117, 111, 105, 99, 95, 93, 93, 96, 100, 105, 111,
+  119, 126, 132, 138, 143, 145, 145, 144, 142, 139, 135, 131, 127, 126, 126, 126, 129, 133, 136, 142,
+  146, 151, 153, 154, 154, 152, 148, 145, 139, 132, 127, 122, 118, 115, 113, 113, 113, 115, 117, 121,
+  124, 128, 129, 130, 132, 132, 130, 128, 126, 122, 118, 114, 109, 105, 101, 97, 96, 98, 100, 102,
+  108, 113, 120, 126, 134, 138, 142, 144, 145, 143, 141, 137, 133, 128, 124, 123, 123, 125, 127, 132,
+  138, 143, 149, 154, 157, 157, 157, 154, 149, 144, 138, 131, 125, 119, 115, 113, 111, 113, 113, 116,
+  120, 123, 126, 129, 130, 131, 132, 130, 130, 128, 126, 124, 122, 119, 115, 112, 108, 104, 99, 97,
+  96, 97, 99, 103, 107, 113, 120, 127, 133, 139, 143, 145, 145, 145, 141, 137, 133, 128, 125, 123,
+  123, 125, 129, 133, 139, 144, 150, 154, 157, 157, 157, 154, 150, 144, 138, 131, 125, 120, 116, 114,
+  113, 114, 116, 118, 121, 124, 126, 128, 129, 129, 129, 128, 127, 126, 125, 125, 125, 124, 123, 121,
+  118, 115, 111, 106, 101, 96, 95, 95, 96, 100, 105, 112, 120, 127, 135, 141, 145, 148, 148, 146,
+  143, 137, 132, 127, 124, 122, 122, 124, 128, 133, 139, 147, 152, 157, 160, 160, 159, 155, 149, 143,
+  135, 127, 121, 115, 111, 110, 109, 110, 112, 116, 119, 123, 126, 129, 130, 132, 132, 132, 130, 130,
+  128, 124, 122, 118, 114, 109, 105, 101, 98, 96, 96, 97, 101, 105, 112, 118, 126, 132, 137, 142,
+  145, 146, 145, 143, 139, 135, 131, 127, 125, 125, 125, 128, 133, 139, 145, 151, 155, 159, 160, 159,
+  155, 151, 144, 137, 129, 122, 116, 111, 108, 107, 108, 111, 115, 119, 123, 126, 130, 132, 133, 133,
+  132, 129, 125, 121, 115, 110, 102, 97, 93, 91, 89, 91, 94, 100, 108, 116, 125, 133, 139, 145,
+  149, 150, 148, 146, 142, 137, 133, 128, 125, 123, 124, 125, 130, 135, 141, 148, 153, 157, 161, 161,
+  159, 155, 150, 143, 136, 127, 120, 113, 109, 107, 105, 105, 108, 112, 116, 120, 124, 128, 132, 134,
+  135, 134, 132, 129, 125, 120, 114, 108, 103, 97, 94, 92, 92, 95, 100, 106, 114, 121, 130, 136,
+  142, 146, 147, 147, 145, 142, 137, 133, 127, 125, 124, 123, 125, 129, 134, 140, 146, 152, 156, 159,
+  160, 158, 155, 150, 144, 136, 129, 122, 117, 113, 110, 108, 109, 112, 114, 118, 122, 124, 127, 129,
+  130, 129, 127, 125, 121, 117, 111, 105, 101, 96, 94, 93, 95, 98, 103, 109, 116, 123, 131, 138,
+  144, 147, 149, 148, 146, 144, 139, 135, 131, 128, 126, 125, 127, 130, 134, 140, 146, 150, 155, 157,
+  158, 157, 154, 148, 142, 134, 128, 121, 116, 112, 108, 107, 108, 110, 114, 118, 121, 124, 128, 130,
+  132, 131, 128, 124, 120, 114, 108, 102, 97, 94, 92, 93, 96, 100, 108, 116, 125, 133, 139, 145,
+  149, 151, 150, 148, 144, 139, 133, 129, 125, 123, 124, 125, 130, 135, 140, 147, 152, 156, 158, 158,
+  157, 153, 147, 139, 131, 125, 118, 113, 109, 107, 107, 109, 111, 115, 119, 123, 126, 129, 130, 130,
+  127, 124, 120, 114, 108, 102, 97, 94, 93, 94, 97, 102, 108, 116, 123, 131, 138, 144, 148, 150,
+  150, 148, 145, 140, 135, 132, 128, 125, 125, 127, 129, 133, 139, 145, 149, 153, 155, 156, 154, 151,
+  146, 139, 133, 126, 120, 115, 110, 107, 107, 109, 111, 114, 118, 122, 126, 129, 131, 132, 131, 127,
+  124, 118, 112, 105, 99, 95, 93, 92, 94, 98, 103, 111, 119, 128, 136, 143, 147, 150, 151, 149,
+  145, 141, 136, 131, 127, 124, 123, 123, 127, 131, 136, 142, 148, 154, 156, 157, 157, 154, 149, 143,
+  136, 129, 122, 116, 112, 109, 107, 107, 110, 114, 117, 121, 125, 129, 131, 133, 132, 130, 125, 119,
+  115, 108, 102, 96, 93, 92, 93, 96, 101, 106, 114, 123, 131, 138, 144, 147, 150, 149, 147, 144,
+  140, 135, 129, 126, 124, 123, 125, 127, 132, 137, 142, 148, 152, 154, 156, 154, 152, 148, 142, 136,
+  129, 122, 117, 113, 110, 108, 109, 111, 115, 119, 123, 127, 129, 131, 132, 132, 130, 126, 122, 117,
+  112, 106, 101, 97, 95, 95, 97, 100, 105, 111, 118, 125, 133, 138, 143, 145, 146, 145, 142, 138,
+  135, 131, 127, 125, 125, 126, 129, 133, 138, 142, 148, 153, 155, 156, 156, 154, 149, 143, 137, 132,
+  126, 120, 116, 113, 111, 112, 114, 115, 119, 122, 124, 128, 129, 130, 129, 127, 124, 120, 115, 109,
+  104, 99, 97, 95, 95, 97, 101, 107, 113, 120, 127, 134, 139, 143, 145, 146, 144, 142, 138, 134,
+  131, 127, 126, 126, 127, 130, 134, 138, 144, 149, 153, 156, 156, 156, 152, 148, 143, 137, 130, 124,
+  118, 115, 112, 111, 111, 112, 115, 118, 122, 125, 128, 130, 132, 132, 130, 127, 123, 118, 112, 106,
+  100, 97, 94, 94, 96, 99, 104, 110, 116, 124, 131, 137, 142, 145, 145, 145, 144, 140, 136, 132,
+  129, 127, 125, 126, 128, 131, 135, 141, 146, 150, 153, 154, 154, 152, 150, 146, 140, 134, 128, 123,
+  119, 115, 113, 113, 113, 114, 117, 120, 124, 126, 128, 130, 132, 131, 130, 129, 126, 123, 119, 115,
+  110, 106, 102, 99, 97, 96, 99, 102, 107, 111, 118, 125, 131, 137, 142, 144, 145, 144, 141, 138,
+  134, 129, 126, 124, 123, 123, 127, 131, 137, 142, 148, 153, 156, 158, 157, 155, 150, 146, 139, 132,
+  126, 120, 116, 113, 113, 112, 114, 115, 119, 122, 125, 128, 130, 131, 132, 130, 130, 128, 126, 124,
+  122, 120, 116, 112, 108, 104, 100, 97, 95, 96, 99, 102, 108, 113, 121, 129, 136, 141, 145, 147,
+  147, 146, 142, 137, 131, 126, 122, 120, 121, 123, 128, 133, 140, 146, 152, 157, 160, 160, 157, 153,
+  148, 141, 133, 125, 117, 112, 110, 108, 109, 112, 115, 120, 125, 129, 131, 133, 133, 133, 131, 129,
+  127, 124, 122, 122, 122, 122, 120, 120, 119, 117, 114, 110, 105, 101, 99, 99, 99, 102, 106, 113,
+  119, 127, 134, 140, 144, 146, 148, 145, 141, 135, 129, 124, 120, 119, 119, 121, 127, 133, 140, 147,
+  154, 159, 162, 161, 157, 153, 147, 139, 131, 124, 117, 112, 110, 110, 111, 114, 118, 121, 126, 129,
+  131, 132, 132, 131, 129, 127, 126, 124, 122, 122, 122, 123, 125, 125, 123, 121, 119, 114, 108, 102,
+  97, 94, 94, 96, 99, 104, 112, 120, 129, 139, 145, 148, 150, 150, 147, 143, 135, 128, 123, 118,
+  117, 117, 121, 126, 133, 141, 149, 155, 160, 162, 160, 157, 150, 143, 135, 127, 119, 113, 109, 108,
+  108, 112, 116, 119, 125, 130, 134, 136, 136, 136, 132, 130, 127, 125, 123, 120, 120, 120, 122, 125,
+  127, 128, 127, 126, 123, 118, 111, 103, 96, 92, 91, 91, 94, 99, 106, 115, 126, 136, 144, 150,
+  153, 154, 152, 148, 141, 133, 126, 121, 118, 117, 119, 123, 129, 137, 144, 151, 157, 160, 161, 157,
+  152, 146, 139, 131, 122, 116, 110, 107, 107, 110, 113, 117, 121, 127, 132, 136, 138, 137, 135, 133,
+  130, 128, 126, 123, 122, 122, 122, 124, 127, 128, 128, 128, 126, 122, 118, 111, 103, 94, 90, 88,
+  90, 93, 96, 103, 112, 124, 135, 144, 150, 153, 153, 153, 149, 144, 137, 129, 122, 119, 119, 122,
+  126, 131, 137, 144, 151, 157, 160, 159, 156, 150, 143, 136, 129, 122, 115, 109, 107, 108, 111, 115,
+  120, 124, 128, 133, 136, 139, 139, 136, 133, 129, 127, 125, 123, 122, 122, 122, 125, 128, 131, 132,
+  131, 129, 127, 122, 114, 105, 95, 87, 83, 84, 86, 89, 96, 105, 117, 129, 141, 149, 155, 157,
+  157, 155, 149, 142, 134, 126, 121, 117, 118, 122, 126, 132, 139, 146, 153, 158, 161, 160, 156, 149,
+  143, 135, 127, 119, 112, 107, 105, 106, 109, 113, 119, 123, 129, 133, 139, 141, 141, 139, 137, 133,
+  130, 128, 124, 122, 122, 122, 124, 126, 128, 130, 130, 129, 126, 121, 115, 106, 97, 88, 81, 80,
+  82, 87, 93, 100, 112, 125, 138, 148, 154, 157, 159, 157, 153, 146, 138, 130, 124, 121, 120, 122,
+  126, 132, 137, 145, 151, 157, 160, 159, 155, 150, 143, 136, 128, 120, 112, 106, 104, 104, 106, 110,
+  116, 122, 129, 134, 138, 142, 142, 142, 138, 134, 131, 128, 124, 123, 122, 122, 123, 126, 130, 132,
+  133, 132, 130, 125, 119, 111, 100, 90, 82, 79, 80, 81, 85, 93, 102, 115, 128, 140, 150, 155,
+  158, 159, 156, 152, 145, 137, 129, 123, 120, 121, 123, 127, 132, 138, 146, 152, 157, 160, 158, 154,
+  149, 142, 136, 127, 119, 112, 108, 106, 106, 108, 112, 117, 122, 128, 132, 136, 139, 141, 139, 137,
+  134, 132, 130, 128, 126, 125, 125, 126, 128, 131, 133, 133, 131, 128, 124, 118, 110, 101, 89, 79,
+  74, 75, 79, 84, 90, 99, 110, 124, 137, 147, 153, 156, 157, 157, 155, 149, 142, 134, 129, 126,
+  125, 127, 129, 133, 139, 145, 151, 156, 158, 159, 155, 149, 143, 136, 128, 121, 113, 108, 104, 104,
+  106, 109, 115, 121, 126, 132, 136, 140, 143, 142, 140, 138, 134, 132, 128, 126, 124, 123, 124, 126,
+  129, 131, 132, 132, 130, 127, 121, 115, 106, 95, 84, 77, 74, 76, 79, 83, 90, 101, 115, 130,
+  141, 150, 154, 158, 159, 159, 155, 148, 139, 131, 127, 125, 126, 128, 131, 135, 141, 147, 154, 159,
+  160, 159, 154, 149, 143, 136, 128, 120, 112, 108, 104, 104, 106, 110, 114, 119, 125, 131, 135, 140,
+  142, 141, 140, 137, 135, 133, 131, 128, 126, 126, 127, 129, 131, 133, 133, 132, 129, 125, 119, 111,
+  101, 90, 80, 74, 73, 75, 79, 84, 91, 103, 116, 131, 142, 149, 154, 156, 157, 156, 152, 145,
+  137, 131, 127, 126, 128, 131, 135, 139, 145, 152, 158, 163, 163, 161, 155, 148, 141, 133, 124, 115,
+  108, 103, 102, 104, 107, 112, 118, 123, 129, 134, 138, 141, 141, 139, 136, 133, 131, 127, 125, 123,
+  123, 125, 127, 130, 133, 136, 138, 138, 136, 131, 125, 116, 106, 95, 83, 73, 67, 69, 72, 78,
+  86, 95, 109, 123, 135, 146, 153, 155, 157, 156, 153, 147, 142, 136, 131, 128, 128, 130, 132, 138,
+  144, 149, 155, 161, 163, 162, 158, 154, 147, 139, 131, 122, 114, 108, 104, 103, 104, 107, 111, 116,
+  122, 128, 133, 137, 139, 139, 138, 136, 134, 132, 130, 128, 126, 127, 128, 130, 132, 134, 136, 138,
+  136, 132, 127, 119, 110, 101, 89, 78, 70, 69, 71, 75, 81, 88, 99, 114, 127, 139, 145, 150,
+  152, 154, 153, 150, 144, 137, 134, 131, 130, 132, 134, 139, 144, 149, 155, 161, 164, 164, 161, 157,
+  150, 144, 135, 127, 118, 110, 106, 104, 104, 105, 108, 113, 118, 123, 128, 133, 136, 138, 138, 136,
+  134, 133, 131, 130, 129, 128, 128, 130, 132, 134, 136, 136, 136, 135, 131, 125, 118, 111, 101, 91,
+  81, 74, 73, 75, 79, 83, 89, 99, 111, 123, 133, 140, 144, 147, 149, 149, 146, 142, 136, 131,
+  129, 129, 130, 133, 136, 140, 145, 152, 157, 160, 161, 159, 155, 151, 145, 138, 129, 122, 115, 110,
+  108, 108, 109, 112, 116, 122, 126, 131, 135, 139, 139, 139, 138, 135, 133, 130, 127, 125, 125, 125,
+  126, 128, 130, 134, 136, 136, 136, 134, 130, 126, 120, 112, 104, 96, 90, 85, 85, 87, 90, 92,
+  98, 104, 113, 119, 124, 127, 129, 131, 133, 135, 135, 134, 133, 134, 136, 138, 141, 143, 145, 147,
+  147, 148, 150, 149, 147, 144, 142, 140, 138, 136, 134, 132, 130, 130, 129, 128, 127, 126, 125, 124,
+  123, 122, 122, 122, 123, 123, 123, 124, 125, 127, 129, 130, 130, 131, 132, 133, 133, 132, 132, 131,
+  129, 129, 126, 123, 119, 115, 109, 103, 97, 92, 88, 86, 87, 89, 92, 100, 108, 117, 125, 133,
+  140, 146, 149, 150, 148, 146, 142, 136, 133, 129, 126, 126, 128, 131, 137, 143, 148, 154, 158, 160,
+  160, 158, 153, 147, 140, 131, 123, 117, 112, 108, 105, 107, 110, 114, 118, 123, 128, 132, 134, 135,
+  135, 133, 131, 129, 127, 124, 123, 122, 124, 126, 128, 130, 130, 130, 130, 127, 122, 116, 108, 99,
+  93, 89, 88, 88, 92, 97, 104, 115, 126, 136, 143, 148, 151, 151, 149, 145, 139, 132, 126, 120,
+  120, 121, 124, 128, 134, 141, 149, 155, 160, 162, 161, 156, 150, 144, 136, 128, 121, 114, 109, 107,
+  108, 111, 114, 119, 123, 129, 133, 136, 138, 136, 134, 131, 129, 127, 124, 122, 122, 122, 123, 126,
+  128, 129, 128, 127, 124, 120, 114, 106, 97, 91, 88, 89, 91, 95, 100, 108, 119, 131, 141, 148,
+  152, 154, 153, 151, 146, 140, 132, 124, 120, 119, 121, 124, 129, 135, 142, 148, 155, 159, 160, 157,
+  152, 147, 139, 132, 125, 117, 112, 107, 107, 110, 114, 118, 123, 127, 130, 135, 138, 139, 138, 135,
+  131, 127, 125, 123, 122, 122, 122, 123, 127, 130, 132, 132, 130, 128, 124, 118, 109, 99, 90, 84,
+  83, 85, 88, 93, 101, 112, 124, 137, 146, 153, 157, 157, 156, 153, 145, 138, 129, 123, 119, 117,
+  120, 124, 129, 136, 144, 150, 157, 160, 161, 158, 152, 145, 138, 130, 123, 115, 108, 105, 105, 108,
+  112, 116, 121, 126, 132, 137, 141, 141, 140, 138, 134, 131, 129, 126, 122, 122, 122, 124, 126, 127,
+  129, 130, 130, 127, 124, 118, 110, 101, 91, 83, 80, 81, 84, 90, 97, 107, 119, 133, 145, 152,
+  156, 158, 159, 155, 149, 141, 134, 127, 122, 120, 121, 124, 129, 135, 142, 148, 155, 159, 160, 158,
+  152, 146, 140, 132, 123, 114, 108, 104, 104, 105, 108, 114, 119, 126, 132, 137, 141, 142, 142, 140,
+  136, 132, 129, 126, 123, 122, 122, 123, 125, 129, 131, 133, 133, 131, 126, 122, 114, 104, 94, 85,
+  79, 79, 81, 84, 89, 98, 110, 123, 135, 146, 153, 157, 159, 158, 154, 148, 140, 132, 125, 121,
+  120, 122, 125, 130, 135, 143, 150, 156, 159, 159, 156, 152, 145, 139, 131, 122, 114, 110, 106, 105,
+  107, 111, 115, 120, 125, 130, 134, 138, 140, 140, 138, 136, 133, 131, 129, 127, 125, 125, 125, 127,
+  131, 132, 133, 132, 130, 126, 121, 113, 105, 94, 82, 76, 74, 77, 82, 87, 95, 105, 119, 132,
+  144, 151, 155, 156, 157, 156, 151, 145, 137, 131, 127, 125, 126, 128, 132, 137, 143, 148, 154, 157,
+  159, 157, 152, 146, 139, 132, 124, 116, 109, 105, 104, 105, 107, 112, 118, 124, 130, 135, 139, 142,
+  143, 141, 139, 135, 132, 129, 127, 125, 123, 123, 125, 128, 131, 132, 132, 130, 128, 123, 118, 110,
+  99, 88, 78, 75, 75, 77, 81, 87, 96, 108, 124, 137, 148, 153, 156, 159, 159, 156, 151, 143,
+  134, 128, 126, 125, 127, 129, 133, 138, 144, 151, 157, 160, 160, 156, 151, 146, 139, 132, 124, 115,
+  109, 105, 104, 105, 108, 112, 117, 122, 128, 133, 138, 141, 142, 140, 138, 136, 134, 132, 129, 127,
+  126, 126, 128, 130, 132, 133, 132, 130, 127, 122, 115, 105, 95, 83, 75, 73, 74, 77, 82, 87,
+  98, 111, 125, 138, 146, 153, 155, 157, 156, 154, 148, 140, 134, 128, 126, 127, 130, 133, 138, 143,
+  150, 156, 162, 163, 162, 157, 150, 144, 136, 127, 119, 111, 105, 102, 103, 106, 110, 115, 121, 127,
+  132, 136, 140, 141, 140, 137, 135, 131, 129, 126, 124, 123, 124, 126, 129, 132, 135, 137, 138, 138,
+  134, 128, 119, 111, 99, 88, 77, 69, 68, 70, 76, 83, 90, 102, 117, 131, 142, 150, 154, 157,
+  156, 155, 151, 144, 138, 132, 129, 128, 129, 131, 135, 141, 147, 153, 159, 163, 163, 160, 156, 150,
+  142, 135, 125, 118, 110, 105, 103, 103, 105, 109, 114, 120, 125, 131, 136, 138, 139, 138, 136, 134,
+  132, 131, 129, 127, 126, 128, 129, 132, 134, 135, 137, 136, 134, 129, 122, 114, 104, 94, 82, 73,
+  69, 70, 73, 79, 84, 94, 108, 122, 135, 143, 149, 151, 153, 154, 151, 147, 140, 135, 132, 130,
+  130, 134, 137, 142, 147, 153, 159, 163, 164, 163, 159, 153, 146, 139, 130, 121, 113, 107, 105, 104,
+  104, 106, 111, 117, 121, 127, 131, 135, 137, 138, 136, 134, 133, 132, 130, 130, 128, 128, 130, 132,
+  134, 135, 136, 136, 136, 133, 128, 122, 114, 105, 94, 82, 73, 70, 70, 73, 77, 83, 91, 104,
+  118, 130, 140, 144, 149, 152, 154, 152, 148, 143, 137, 134, 133, 134, 136, 139, 142, 147, 153, 158,
+  162, 164, 163, 159, 154, 149, 142, 134, 125, 117, 110, 106, 104, 103, 105, 108, 112, 116, 122, 126,
+  132, 134, 136, 136, 135, 134, 133, 133, 131, 130, 130, 132, 134, 135, 136, 138, 138, 138, 137, 131,
+  125, 118, 109, 100, 88, 78, 70, 68, 70, 74, 78, 84, 94, 107, 121, 132, 140, 144, 148, 151,
+  151, 150, 146, 141, 137, 135, 135, 137, 140, 143, 147, 153, 158, 163, 167, 167, 164, 159, 154, 147,
+  139, 130, 121, 113, 107, 105, 104, 104, 106, 110, 114, 119, 123, 128, 132, 133, 133, 133, 132, 131,
+  130, 130, 129, 129, 129, 132, 134, 138, 138, 140, 141, 141, 138, 132, 124, 116, 107, 96, 85, 74,
+  67, 67, 70, 74, 78, 86, 97, 111, 124, 134, 141, 145, 149, 151, 151, 148, 143, 139, 136, 135,
+  135, 138, 141, 145, 151, 157, 163, 168, 170, 169, 165, 160, 154, 146, 138, 129, 119, 110, 107, 103,
+  102, 102, 104, 109, 113, 118, 123, 127, 130, 132, 133, 133, 131, 130, 130, 129, 129, 128, 130, 133,
+  136, 139, 141, 143, 144, 144, 140, 134, 126, 117, 107, 95, 84, 74, 67, 65, 67, 71, 76, 84,
+  96, 110, 122, 131, 139, 144, 147, 150, 150, 146, 142, 138, 136, 136, 137, 139, 143, 148, 154, 161,
+  166, 170, 172, 171, 168, 163, 155, 147, 138, 128, 118, 111, 105, 102, 100, 100, 102, 106, 111, 116,
+  120, 124, 128, 130, 130, 130, 129, 128, 128, 128, 128, 129, 131, 134, 138, 140, 143, 145, 145, 145,
+  143, 138, 130, 121, 112, 100, 90, 80, 71, 66, 65, 69, 75, 80, 89, 101, 115, 125, 134, 139,
+  143, 147, 148, 147, 144, 140, 137, 136, 137, 140, 142, 147, 153, 159, 165, 170, 173, 173, 172, 167,
+  160, 153, 143, 133, 123, 114, 106, 102, 99, 98, 99, 102, 107, 112, 116, 120, 124, 126, 128, 128,
+  127, 126, 126, 126, 126, 128, 129, 133, 136, 140, 144, 147, 149, 150, 149, 146, 140, 131, 120, 109,
+  99, 88, 77, 68, 65, 66, 70, 76, 82, 91, 102, 115, 125, 133, 138, 140, 144, 145, 145, 142,
+  139, 137, 138, 140, 142, 145, 149, 155, 160, 166, 171, 173, 173, 171, 167, 161, 153, 143, 133, 124,
+  114, 107, 101, 99, 97, 96, 99, 103, 109, 113, 117, 121, 125, 127, 129, 129, 129, 129, 129, 130,
+  130, 132, 134, 136, 140, 142, 144, 145, 147, 145, 144, 138, 131, 122, 113, 103, 92, 82, 74, 69,
+  69, 73, 76, 81, 88, 96, 108, 118, 128, 133, 137, 141, 143, 145, 145, 143, 141, 141, 142, 144,
+  146, 150, 154, 158, 163, 168, 170, 172, 170, 167, 162, 155, 147, 139, 129, 119, 110, 104, 99, 97,
+  95, 97, 99, 104, 109, 114, 119, 123, 126, 128, 129, 129, 129, 129, 130, 130, 132, 133, 136, 140,
+  142, 144, 145, 147, 145, 144, 140, 134, 127, 118, 110, 100, 92, 84, 76, 72, 73, 75, 79, 82,
+  88, 98, 108, 119, 126, 132, 136, 140, 144, 146, 147, 145, 143, 142, 144, 146, 148, 150, 154, 158,
+  162, 167, 169, 170, 168, 166, 161, 156, 148, 140, 130, 121, 114, 108, 102, 99, 96, 97, 99, 102,
+  108, 112, 115, 119, 122, 124, 126, 128, 129, 129, 131, 132, 133, 135, 136, 138, 141, 143, 144, 144,
+  142, 141, 139, 133, 128, 119, 111, 104, 95, 87, 80, 75, 74, 76, 79, 83, 89, 97, 107, 117,
+  125, 131, 135, 139, 143, 145, 145, 144, 144, 143, 145, 147, 148, 150, 154, 157, 162, 166, 167, 169,
+  168, 165, 161, 155, 148, 140, 131, 122, 114, 107, 102, 98, 96, 96, 99, 102, 106, 111, 115, 118,
+  122, 126, 128, 128, 129, 129, 130, 132, 132, 133, 135, 137, 138, 140, 142, 142, 142, 142, 140, 136,
+  131, 124, 117, 110, 100, 93, 85, 79, 77, 77, 79, 82, 85, 92, 100, 110, 120, 126, 131, 136,
+  141, 144, 145, 145, 144, 142, 142, 144, 144, 146, 148, 152, 157, 161, 165, 167, 169, 169, 166, 162,
+  157, 149, 141, 132, 123, 115, 109, 103, 99, 98, 97, 99, 102, 106, 111, 115, 119, 122, 126, 129,
+  130, 131, 132, 132, 132, 133, 133, 133, 134, 136, 137, 138, 139, 139, 138, 137, 133, 129, 122, 116,
+  108, 100, 93, 85, 81, 79, 80, 82, 85, 89, 96, 106, 115, 123, 129, 134, 138, 142, 143, 144,
+  143, 141, 139, 140, 142, 144, 146, 148, 152, 156, 161, 165, 168, 169, 168, 165, 161, 156, 149, 140,
+  131, 121, 114, 108, 103, 99, 97, 97, 99, 104, 108, 112, 118, 122, 125, 128, 130, 132, 132, 130,
+  130, 130, 130, 130, 130, 132, 133, 135, 136, 136, 137, 136, 136, 133, 129, 124, 118, 111, 103, 97,
+  89, 83, 81, 80, 82, 85, 89, 94, 103, 112, 122, 129, 134, 138, 142, 144, 145, 144, 142, 140,
+  139, 139, 140, 142, 144, 148, 152, 156, 161, 164, 166, 167, 165, 162, 158, 152, 145, 136, 128, 119,
+  113, 107, 104, 100, 99, 100, 103, 107, 112, 116, 120, 124, 127, 130, 132, 132, 132, 130, 130, 130,
+  130, 130, 130, 130, 131, 132, 133, 133, 133, 132, 130, 128, 124, 120, 114, 108, 103, 97, 92, 89,
+  88, 88, 89, 92, 96, 102, 110, 117, 123, 129, 133, 137, 140, 142, 142, 141, 139, 139, 138, 139,
+  139, 140, 143, 146, 150, 155, 157, 161, 163, 163, 161, 159, 156, 150, 143, 136, 128, 121, 115, 109,
+  106, 104, 104, 104, 107, 110, 113, 117, 121, 125, 127, 129, 130, 131, 131, 130, 130, 130, 129, 129,
+  129, 129, 130, 130, 130, 132, 132, 132, 131, 128, 125, 122, 118, 113, 108, 102, 97, 94, 92, 91,
+  91, 93, 96, 100, 106, 112, 118, 125, 129, 133, 137, 139, 139, 139, 139, 138, 136, 135, 136, 137,
+  139, 141, 145, 149, 153, 156, 159, 161, 162, 161, 158, 154, 148, 141, 133, 126, 120, 114, 111, 107,
+  106, 106, 107, 111, 114, 118, 122, 125, 128, 130, 132, 132, 131, 130, 130, 130, 129, 129, 129, 130,
+  132, 133, 134, 135, 135, 135, 134, 130, 126, 120, 114, 108, 101, 94, 87, 84, 83, 85, 87, 91,
+  95, 104, 113, 122, 128, 132, 136, 138, 141, 141, 139, 137, 135, 133, 135, 136, 138, 142, 145, 151,
+  156, 160, 164, 164, 164, 162, 158, 153, 146, 138, 130, 122, 115, 111, 107, 105, 105, 106, 109, 113,
+  117, 120, 123, 125, 127, 128, 128, 128, 128, 128, 128, 129, 130, 132, 135, 139, 141, 143, 145, 147,
+  145, 143, 138, 131, 121, 112, 102, 92, 83, 74, 69, 69, 73, 77, 83, 90, 101, 112, 124, 131,
+  136, 139, 142, 144, 144, 142, 140, 137, 138, 139, 142, 145, 149, 153, 159, 166, 170, 173, 173, 172,
+  168, 162, 154, 146, 135, 125, 115, 108, 102, 99, 97, 96, 99, 103, 108, 113, 117, 121, 123, 127,
+  129, 129, 129, 129, 129, 129, 130, 132, 134, 136, 139, 142, 144, 145, 147, 146, 143, 140, 132, 123,
+  114, 104, 95, 84, 75, 70, 68, 71, 76, 81, 87, 95, 106, 117, 127, 132, 137, 139, 143, 145,
+  145, 143, 141, 141, 141, 144, 146, 150, 152, 157, 163, 167, 170, 172, 170, 167, 163, 156, 148, 140,
+  130, 120, 112, 105, 100, 97, 95, 97, 99, 103, 109, 113, 118, 122, 126, 128, 129, 129, 129, 129,
+  130, 130, 132, 134, 136, 139, 142, 144, 145, 145, 145, 144, 141, 135, 128, 119, 111, 102, 93, 85,
+  77, 72, 71, 75, 77, 82, 88, 96, 106, 117, 125, 131, 135, 139, 144, 147, 146, 145, 143, 142,
+  144, 145, 147, 150, 153, 157, 162, 166, 169, 170, 170, 167, 163, 157, 150, 141, 131, 122, 115, 108,
+  103, 100, 98, 97, 99, 102, 106, 110, 114, 118, 122, 124, 126, 128, 129, 129, 130, 132, 133, 134,
+  136, 138, 140, 142, 144, 144, 143, 141, 139, 135, 128, 120, 112, 105, 96, 88, 81, 75, 74, 76,
+  79, 83, 89, 96, 105, 115, 123, 130, 135, 139, 143, 145, 145, 144, 144, 143, 145, 147, 149, 150,
+  154, 158, 161, 165, 168, 169, 168, 166, 162, 156, 149, 141, 132, 123, 115, 108, 103, 99, 97, 96,
+  98, 102, 106, 109, 114, 119, 122, 125, 128, 129, 129, 129, 130, 132, 132, 133, 135, 137, 139, 140,
+  142, 142, 142, 142, 140, 138, 132, 125, 118, 111, 103, 94, 86, 80, 77, 77, 79, 81, 85, 91,
+  99, 109, 119, 125, 131, 136, 141, 144, 145, 145, 143, 142, 142, 143, 144, 146, 148, 151, 156, 160,
+  164, 167, 169, 169, 167, 162, 158, 150, 142, 133, 124, 116, 110, 105, 101, 98, 97, 99, 102, 106,
+  109, 113, 117, 121, 125, 129, 130, 130, 132, 132, 132, 133, 133, 133, 134, 136, 137, 138, 139, 139,
+  138, 137, 133, 129, 123, 117, 109, 101, 94, 86, 81, 79, 80, 82, 84, 88, 96, 105, 114, 122,
+  129, 133, 137, 141, 144, 144, 143, 141, 139, 140, 142, 142, 144, 147, 151, 156, 160, 164, 168, 169,
+  168, 166, 162, 156, 150, 141, 132, 122, 115, 108, 103, 99, 97, 97, 99, 103, 107, 112, 116, 120,
+  124, 128, 130, 132, 132, 130, 130, 130, 130, 130, 130, 132, 133, 135, 136, 136, 137, 136, 136, 134,
+  131, 125, 119, 112, 104, 97, 90, 84, 81, 80, 82, 84, 88, 93, 101, 111, 120, 128, 133, 138,
+  142, 144, 145, 145, 143, 140, 139, 139, 140, 141, 144, 147, 150, 156, 160, 163, 166, 167, 165, 163,
+  159, 153, 146, 137, 129, 120, 114, 108, 103, 101, 99, 100, 102, 106, 111, 115, 119, 123, 127, 129,
+  131, 132, 132, 132, 130, 130, 130, 130, 130, 130, 131, 132, 132, 133, 133, 132, 131, 128, 125, 120,
+  115, 110, 104, 98, 92, 89, 88, 88, 89, 91, 96, 101, 109, 116, 122, 127, 132, 137, 139, 141,
+  142, 141, 139, 139, 138, 139, 139, 140, 142, 146, 150, 154, 158, 161, 163, 163, 162, 159, 156, 150,
+  144, 137, 129, 122, 116, 111, 107, 104, 104, 104, 106, 110, 114, 117, 121, 124, 127, 129, 131, 132,
+  131, 130, 130, 129, 129, 129, 129, 129, 130, 130, 130, 132, 132, 131, 129, 127, 123, 119, 115, 110,
+  106, 100, 97, 94, 93, 94, 96, 98, 102, 107, 112, 118, 124, 128, 131, 134, 136, 138, 138, 137,
+  136, 135, 135, 135, 135, 137, 139, 141, 145, 149, 153, 155, 157, 158, 157, 156, 153, 149, 145, 139,
+  132, 126, 121, 117, 113, 110, 108, 109, 111, 114, 116, 119, 122, 126, 128, 130, 132, 133, 133, 132,
+  132, 131, 130, 129, 129, 128, 128, 128, 128, 126, 126, 126, 125, 123, 121, 119, 117, 115, 111, 108,
+  105, 103, 102, 103, 104, 105, 106, 109, 113, 117, 121, 124, 126, 128, 130, 132, 132, 132, 132, 130,
+  130, 132, 132, 133, 134, 136, 139, 142, 145, 147, 149, 151, 151, 151, 150, 148, 144, 141, 137, 133,
+  129, 125, 121, 119, 118, 117, 117, 118, 120, 122, 125, 127, 129, 131, 133, 134, 135, 135, 135, 133,
+  132, 132, 130, 129, 128, 126, 125, 125, 123, 123, 122, 120, 120, 118, 116, 115, 113, 111, 110, 108,
+  107, 107, 107, 108, 108, 110, 111, 114, 116, 119, 121, 123, 125, 126, 128, 128, 129, 129, 129, 130,
+  130, 132, 133, 135, 136, 137, 139, 142, 144, 145, 147, 147, 147, 147, 145, 143, 140, 138, 134, 131,
+  128, 125, 122, 120, 120, 119, 120, 120, 122, 124, 126, 128, 130, 132, 134, 135, 136, 136, 136, 136,
+  135, 134, 133, 132, 130, 130, 128, 126, 124, 122, 121, 119, 118, 116, 114, 113, 111, 109, 108, 107,
+  107, 108, 108, 110, 110, 112, 113, 115, 117, 119, 120, 122, 123, 125, 125, 126, 128, 128, 129, 129,
+  131, 133, 133, 135, 137, 138, 140, 141, 143, 144, 144, 144, 144, 143, 141, 140, 137, 134, 131, 127,
+  125, 123, 122, 120, 120, 120, 120, 122, 124, 126, 128, 130, 134, 135, 136, 138, 138, 138, 138, 138,
+  137, 135, 135, 133, 131, 129, 127, 125, 123, 122, 121, 119, 117, 115, 114, 113, 112, 111, 111, 110,
+  111, 111, 111, 112, 113, 113, 115, 116, 117, 118, 119, 119, 121, 122, 123, 123, 125, 126, 126, 128,
+  129, 131, 132, 133, 135, 135, 137, 138, 139, 139, 139, 139, 139, 139, 138, 136, 135, 134, 132, 130,
+  128, 127, 126, 125, 125, 125, 126, 126, 128, 128, 130, 132, 134, 135, 137, 138, 139, 139, 139, 139,
+  138, 137, 136, 134, 132, 130, 128, 126, 124, 122, 120, 118, 117, 116, 114, 114, 113, 113, 113, 113,
+  113, 113, 113, 113, 114, 114, 116, 116, 116, 116, 117, 118, 119, 120, 121, 122, 123, 123, 125, 126,
+  128, 128, 130, 131, 133, 133, 135, 135, 136, 136, 136, 136, 136, 136, 136, 135, 133, 133, 132, 130,
+  130, 130, 129, 129, 129, 129, 129, 130, 132, 132, 133, 134, 136, 138, 139, 139, 139, 139, 139, 139,
+  139, 137, 136, 134, 132, 131, 129, 127, 125, 123, 120, 117, 117, 115, 114, 113, 112, 111, 111, 111,
+  112, 113, 113, 113, 114, 114, 115, 116, 116, 117, 117, 118, 119, 120, 121, 122, 122, 124, 125, 126,
+  127, 129, 129, 130, 132, 132, 133, 133, 133, 133, 134, 135, 133, 133, 133, 132, 132, 131, 130, 130,
+  130, 129, 129, 129, 129, 130, 131, 132, 132, 133, 135, 136, 137, 138, 139, 139, 139, 139, 139, 139,
+  138, 138, 136, 135, 133, 131, 129, 128, 126, 124, 122, 120, 118, 117, 115, 114, 113, 113, 111, 111,
+  111, 113, 113, 113, 113, 113, 114, 114, 116, 116, 117, 118, 119, 120, 120, 122, 123, 125, 125, 127,
+  128, 129, 130, 130, 132, 132, 132, 132, 133, 132, 132, 132, 132, 132, 130, 130, 129, 129, 129, 128,
+  128, 128, 128, 128, 129, 130, 130, 132, 133, 133, 135, 136, 138, 139, 140, 141, 141, 141, 141, 141,
+  139, 138, 138, 136, 134, 132, 130, 128, 126, 124, 123, 122, 120, 118, 117, 116, 114, 113, 113, 113,
+  113, 113, 113, 113, 113, 113, 113, 114, 114, 114, 116, 117, 117, 119, 120, 122, 122, 124, 125, 126,
+  128, 129, 129, 130, 130, 130, 131, 132, 131, 130, 130, 130, 130, 130, 130, 129, 129, 129, 129, 129,
+  129, 129, 129, 130, 130, 131, 132, 132, 133, 134, 135, 136, 137, 138, 139, 139, 139, 139, 139, 139,
+  139, 138, 137, 136, 135, 133, 132, 131, 129, 127, 125, 123, 122, 121, 119, 117, 116, 116, 114, 114,
+  114, 113, 113, 113, 113, 114, 114, 114, 114, 115, 116, 116, 117, 117, 119, 119, 120, 122, 123, 124,
+  125, 126, 128, 128, 129, 129, 130, 130, 130, 130, 130, 130, 130, 129, 129, 129, 129, 129, 129, 129,
+  129, 129, 129, 130, 130, 131, 132, 133, 134, 135, 136, 137, 138, 138, 139, 139, 139, 139, 139, 139,
+  139, 138, 137, 136, 135, 134, 132, 130, 129, 128, 126, 124, 122, 121, 119, 119, 117, 117, 116, 116,
+  116, 116, 116, 116, 116, 116, 116, 116, 116, 116, 117, 117, 117, 119, 119, 120, 120, 122, 123, 123,
+  125, 125, 126, 127, 128, 128, 128, 128, 129, 129, 129, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+  128, 129, 129, 130, 130, 132, 132, 133, 135, 135, 136, 136, 138, 138, 139, 139, 139, 139, 139, 139,
+  138, 138, 136, 136, 135, 133, 132, 131, 129, 128, 126, 125, 124, 122, 122, 120, 119, 119, 119, 118,
+  117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 118, 119, 119, 120, 120, 122, 122, 123,
+  123, 125, 125, 126, 126, 126, 126, 127, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
+  128, 129, 129, 130, 130, 131, 132, 133, 133, 134, 135, 136, 136, 138, 138, 138, 138, 138, 138, 138,
+  138, 137, 136, 136, 135, 134, 132, 132, 130, 129, 128, 127, 125, 124, 123, 122, 122, 120, 119, 119,
+  119, 118, 117, 117, 117, 117, 116, 116, 116, 116, 117, 117, 117, 119, 119, 120, 120, 122, 122, 123,
+  124, 125, 126, 126, 126, 126, 128, 128, 128, 128, 128, 128, 128, 127, 126, 126, 126, 127, 128, 128,
+  128, 128, 129, 129, 130, 130, 132, 132, 133, 134, 135, 135, 136, 136, 137, 138, 138, 138, 138, 138,
+  136, 136, 136, 135, 135, 133, 133, 132, 131, 130, 129, 128, 126, 125, 125, 123, 122, 122, 120, 120,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 120, 120, 120, 122, 122,
+  123, 123, 124, 125, 125, 125, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 128, 128,
+  128, 128, 129, 129, 129, 130, 131, 132, 132, 133, 133, 135, 136, 136, 136, 136, 137, 138, 137, 136,
+  136, 136, 136, 135, 135, 133, 132, 132, 130, 129, 129, 127, 126, 125, 124, 123, 122, 122, 121, 120,
+  120, 120, 120, 120, 120, 120, 119, 119, 119, 119, 119, 119, 120, 120, 120, 120, 120, 122, 122, 122,
+  123, 123, 123, 123, 125, 125, 125, 125, 125, 126, 126, 126, 126, 126, 126, 126, 126, 128, 128, 128,
+  128, 128, 129, 129, 130, 130, 132, 133, 133, 133, 134, 135, 135, 136, 136, 136, 136, 136, 136, 136,
+  136, 135, 135, 134, 133, 132, 132, 131, 129, 129, 128, 126, 126, 125, 124, 123, 122, 122, 120, 120,
+  120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 121, 122, 122, 122, 122, 122, 123,
+  123, 123, 123, 125, 125, 125, 125, 125, 125, 126, 126, 126, 126, 126, 127, 128, 128, 128, 128, 129,
+  129, 129, 130, 130, 130, 132, 132, 132, 133, 133, 135, 135, 135, 136, 136, 137, 138, 138, 138, 138,
+  138, 138, 137, 136, 135, 133, 132, 130, 129, 127, 125, 123, 121, 120, 119, 118, 117, 119, 119, 119,
+  119, 120, 120, 121, 122, 122, 122, 122, 122, 123, 123, 123, 123, 124, 125, 125, 126, 126, 126, 126,
+  126, 125, 125, 123, 121, 120, 119, 117, 116, 116, 116, 116, 117, 117, 119, 122, 124, 127, 129, 130,
+  132, 133, 135, 135, 135, 135, 135, 135, 136, 136, 138, 139, 141, 143, 144, 145, 147, 147, 147, 145,
+  143, 141, 138, 134, 130, 127, 123, 119, 118, 114, 113, 113, 113, 113, 114, 116, 117, 119, 121, 122,
+  124, 125, 125, 125, 125, 125, 125, 125, 126, 126, 127, 128, 128, 129, 129, 129, 129, 128, 126, 124,
+  122, 119, 115, 111, 108, 105, 104, 104, 104, 106, 108, 111, 115, 120, 125, 129, 133, 134, 136, 138,
+  139, 139, 138, 137, 136, 136, 137, 138, 139, 141, 144, 147, 150, 152, 154, 154, 154, 152, 149, 145,
+  140, 135, 129, 123, 117, 113, 110, 108, 107, 107, 108, 110, 112, 115, 119, 121, 123, 126, 126, 128,
+  128, 128, 128, 128, 128, 128, 128, 129, 129, 130, 130, 130, 130, 130, 129, 127, 125, 121, 118, 114,
+  108, 105, 101, 98, 96, 97, 98, 100, 104, 107, 113, 119, 124, 129, 133, 136, 139, 140, 141, 140,
+  139, 138, 138, 138, 138, 139, 141, 144, 147, 151, 154, 156, 158, 159, 158, 156, 153, 148, 143, 136,
+  129, 122, 117, 112, 108, 106, 104, 105, 107, 110, 113, 116, 120, 123, 126, 129, 130, 130, 130, 130,
+  130, 130, 129, 129, 129, 129, 130, 130, 130, 132, 132, 131, 129, 127, 123, 119, 115, 111, 106, 101,
+  97, 94, 93, 94, 96, 98, 102, 106, 112, 118, 124, 128, 131, 134, 136, 138, 138, 137, 136, 135,
+  135, 135, 135, 137, 139, 141, 145, 149, 153, 155, 157, 158, 157, 156, 153, 149, 145, 139, 132, 126,
+  121, 117, 113, 110, 108, 109, 110, 114, 116, 119, 122, 126, 128, 130, 132, 133, 133, 132, 132, 131,
+  130, 129, 129, 128, 128, 128, 128, 126, 126, 126, 125, 123, 121, 119, 117, 115, 111, 108, 105, 103,
+  102, 103, 104, 105, 106, 109, 113, 117, 121, 123, 126, 128, 130, 132, 132, 132, 132, 130, 130, 131,
+  132, 133, 134, 136, 138, 142, 145, 147, 149, 151, 151, 151, 150, 148, 145, 141, 137, 133, 129, 125,
+  121, 120, 118, 117, 117, 118, 120, 122, 125, 127, 129, 131, 133, 133, 135, 135, 135, 133, 133, 132,
+  130, 129, 128, 126, 125, 125, 123, 123, 122, 120, 120, 118, 116, 115, 113, 112, 110, 108, 107, 107,
+  107, 108, 108, 110, 111, 114, 116, 118, 121, 123, 125, 126, 127, 128, 129, 129, 129, 130, 130, 132,
+  133, 134, 136, 137, 139, 142, 144, 145, 147, 147, 147, 147, 145, 143, 140, 138, 134, 131, 128, 125,
+  122, 120, 120, 119, 120, 120, 122, 124, 126, 128, 130, 132, 134, 135, 136, 136, 136, 136, 135, 134,
+  133, 132, 130, 130, 128, 126, 124, 122, 121, 120, 118, 116, 114, 113, 111, 109, 108, 107, 107, 108,
+  108, 110, 110, 112, 113, 115, 117, 118, 120, 122, 123, 125, 125, 126, 128, 128, 128, 129, 131, 133,
+  133, 135, 137, 138, 139, 141, 143, 144, 144, 144, 144, 143, 142, 140, 137, 134, 131, 127, 125, 124,
+  122, 120, 120, 120, 120, 122, 124, 126, 128, 130, 133, 135, 136, 138, 138, 138, 138, 138, 137, 135,
+  135, 133, 131, 129, 127, 125, 123, 122, 121, 119, 117, 115, 114, 113, 112, 111, 111, 110, 111, 111,
+  112, 113, 113, 113, 115, 116, 117, 118, 119, 119, 120, 122, 123, 123, 125, 126, 126, 128, 129, 130,
+  132, 133, 135, 135, 137, 138, 139, 139, 139, 139, 139, 139, 138, 136, 136, 134, 132, 130, 128, 127,
+  126, 125, 125, 125, 125, 126, 128, 128, 130, 132, 134, 135, 136, 138, 139, 139, 139, 139, 138, 138,
+  136, 134, 132, 130, 128, 126, 124, 122, 120, 118, 117, 116, 115, 114, 113, 113, 113, 113, 113, 113,
+  113, 113, 114, 114, 115, 116, 116, 116, 117, 118, 119, 120, 121, 122, 123, 123, 125, 126, 128, 128,
+  130, 131, 132, 133, 135, 135, 136, 136, 136, 136, 136, 136, 136, 135, 133, 133, 132, 131, 130, 130,
+  129, 129, 129, 129, 129, 130, 131, 132, 133, 134, 136, 138, 139, 139, 139, 139, 139, 139, 139, 137,
+  136, 134, 133, 131, 129, 127, 125, 123, 120, 118, 117, 115, 114, 113, 112, 111, 111, 111, 112, 113,
+  113, 113, 114, 114, 115, 116, 116, 117, 117, 118, 119, 120, 121, 122, 122, 124, 125, 126, 127, 129,
+  129, 130, 132, 132, 133, 133, 133, 133, 134, 135, 133, 133, 133, 132, 132, 131, 130, 130, 130, 129,
+  129, 129, 129, 130, 131, 132, 132, 133, 135, 136, 137, 138, 139, 139, 139, 139, 139, 139, 138, 138,
+  136, 135, 133, 131, 130, 128, 126, 124, 122, 120, 118, 117, 116, 114, 113, 113, 111, 111, 111, 113,
+  113, 113, 113, 113, 114, 114, 116, 116, 117, 118, 119, 120, 120, 122, 123, 125, 125, 127, 128, 129,
+  130, 130, 132, 132, 132, 132, 133, 132, 132, 132, 132, 130, 130, 130, 129, 129, 129, 128, 128, 128,
+  128, 128, 129, 130, 130, 132, 133, 133, 135, 136, 138, 139, 140, 141, 141, 141, 141, 141, 139, 139,
+  138, 136, 134, 132, 130, 128, 126, 125, 123, 122, 120, 118, 117, 116, 114, 114, 113, 113, 113, 113,
+  113, 113, 113, 113, 113, 114, 114, 114, 116, 117, 117, 119, 120, 122, 122, 124, 125, 126, 128, 129,
+  129, 130, 130, 130, 131, 132, 132, 130, 130, 130, 130, 130, 130, 129, 129, 129, 129, 129, 129, 129,
+  129, 130, 130, 131, 132, 132, 133, 134, 135, 136, 137, 138, 139, 139, 139, 139, 139, 139, 139, 138,
+  137, 136, 135, 133, 132, 131, 129, 127, 125, 123, 122, 121, 119, 117, 116, 116, 114, 114, 114, 113,
+  113, 113, 113, 113, 114, 114, 114, 115, 116, 116, 117, 117, 119, 119, 120, 122, 123, 124, 126, 126,
+  128, 128, 129, 129, 130, 130, 130, 130, 130, 130, 130, 129, 129, 129, 129, 129, 129, 129, 129, 129,
+  129, 130, 130, 131, 132, 133, 134, 135, 136, 137, 138, 138, 139, 139, 139, 139, 139, 139, 139, 138,
+  137, 136, 135, 134, 132, 130, 129, 128, 126, 124, 122, 121, 119, 119, 117, 117, 116, 116, 116, 116,
+  116, 116, 116, 116, 116, 116, 116, 116, 117, 117, 117, 119, 119, 120, 120, 122, 122, 123, 125, 125,
+  126, 126, 128, 128, 128, 128, 129, 129, 129, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 129,
+  129, 130, 130, 132, 132, 133, 135, 135, 136, 136, 138, 138, 139, 139, 139, 139, 139, 139, 138, 138,
+  136, 136, 135, 133, 132, 131, 129, 128, 127, 125, 124, 122, 122, 120, 119, 119, 119, 118, 117, 117,
+  117, 117, 117, 117, 117, 117, 117, 117, 117, 117, 118, 119, 119, 120, 120, 121, 122, 123, 123, 125,
+  125, 126, 126, 126, 126, 127, 128, 128, 128, 128, 128, 126, 128, 128, 128, 128, 128, 128, 128, 129,
+  129, 130, 130, 131, 132, 133, 133, 134, 135, 136, 136, 138, 138, 138, 138, 138, 138, 138, 138, 137,
+  136, 136, 135, 134, 132, 132, 130, 129, 127, 126, 125, 125, 123, 122, 122, 120, 119, 119, 119, 118,
+  117, 117, 117, 117, 116, 116, 116, 116, 117, 117, 117, 119, 119, 120, 120, 122, 122, 123, 123, 125,
+  126, 126, 126, 126, 128, 128, 128, 128, 128, 128, 128, 127, 126, 126, 126, 127, 128, 128, 128, 128,
+  129, 129, 130, 130, 132, 132, 133, 134, 135, 135, 136, 136, 137, 138, 138, 138, 138, 138, 136, 136,
+  136, 135, 135, 133, 133, 132, 131, 130, 129, 128, 126, 125, 125, 123, 123, 122, 120, 120, 119, 119,
+  119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 119, 120, 120, 120, 122, 122, 123, 123,
+  124, 125, 125, 125, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 128, 128, 128, 128,
+  128, 129, 129, 130, 131, 132, 132, 133, 133, 135, 136, 136, 136, 136, 137, 138, 138, 137, 136, 136,
+  136, 135, 135, 133, 132, 132, 130, 129, 129, 127, 126, 125, 124, 123, 122, 122, 121, 120, 120, 120,
+  120, 120, 120, 119, 119, 119, 119, 119, 119, 119, 120, 120, 120, 120, 120, 122, 122, 122, 123, 123,
+  123, 123, 125, 125, 125, 125, 125, 126, 126, 126, 126, 126, 126, 126, 126, 127, 128, 128, 128, 128,
+  129, 129, 130, 130, 132, 133, 133, 133, 134, 135, 135, 136, 136, 136, 136, 136, 136, 136, 136, 135,
+  135, 134, 133, 132, 132, 131, 129, 129, 128, 126, 126, 125, 124, 123, 122, 122, 120, 120, 120, 120,
+  120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 121, 122, 122, 122, 122, 122, 123, 123, 123,
+  123, 125, 125, 125, 125, 125, 125, 126, 126, 126, 126, 126, 127, 128, 128, 128, 128, 129, 129, 129,
+  129, 130, 130, 131, 132, 132, 133, 133, 133, 135, 135, 135, 135, 136, 136, 136, 136, 136, 135, 135,
+  134, 133, 132, 132, 131, 129, 129, 128, 126, 125, 124, 123, 122, 121, 120, 120, 120, 119, 119, 119,
+  119, 120, 120, 120, 120, 120, 120, 120, 120, 121, 122, 122, 122, 122, 123, 123, 123, 123, 125, 125,
+  125, 125, 125, 125, 126, 126, 126, 126, 128, 128, 128, 128, 128, 129, 129, 129, 129, 129, 130, 130,
+  130, 131, 132, 132, 133, 133, 133, 135, 135, 135, 136, 136, 136, 136, 136, 136, 135, 135, 135, 133,
+  132, 132, 130, 129, 128, 127, 125, 125, 123, 122, 120, 120, 119, 119, 119, 119, 119, 119, 119, 119,
+  119, 120, 120, 120, 120, 121, 122, 122, 122, 122, 122, 122, 123, 123, 123, 123, 123, 125, 125, 125,
+  125, 125, 126, 126, 128, 128, 128, 129, 129, 129, 130, 130, 130, 130, 130, 130, 132, 132, 132, 132,
+  133, 133, 133, 133, 133, 134, 135, 135, 135, 136, 136, 136, 136, 136, 135, 135, 133, 133, 131, 130,
+  129, 127, 126, 124, 122, 122, 120, 119, 118, 117, 116, 116, 116, 116, 117, 117, 117, 119, 119, 120,
+  121, 122, 122, 122, 123, 123, 123, 125, 125, 125, 125, 125, 125, 125, 124, 123, 125, 125, 125, 126,
+  126, 127, 128, 129, 130, 131, 132, 132, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133,
+  133, 133, 133, 133, 133, 133, 134, 135, 135, 135, 135, 135, 133, 133, 132, 132, 130, 128, 126, 124,
+  122, 120, 118, 116, 114, 114, 113, 113, 113, 113, 114, 114, 116, 117, 119, 119, 120, 122, 123, 124,
+  125, 125, 126, 126, 126, 126, 125, 125, 125, 125, 125, 125, 125, 125, 125, 126, 127, 128, 130, 130,
+  132, 132, 134, 135, 135, 136, 136, 135, 135, 135, 135, 133, 132, 132, 132, 132, 131, 130, 131, 132,
+  132, 133, 133, 135, 135, 135, 136, 136, 135, 135, 133, 132, 131, 129, 125, 124, 122, 119, 116, 114,
+  112, 111, 110, 110, 109, 109, 110, 110, 112, 114, 115, 117, 118, 121, 124, 125, 126, 128, 129, 129,
+  129, 129, 129, 128, 128, 126, 126, 126, 126, 125, 126, 126, 127, 129, 130, 132, 133, 134, 136, 138,
+  138, 138, 138, 138, 137, 136, 135, 134, 132, 130, 129, 129, 128, 128, 128, 129, 129, 130, 132, 134,
+  136, 136, 137, 138, 137, 136, 136, 134, 132, 130, 127, 123, 121, 118, 115, 112, 109, 107, 107, 105,
+  105, 105, 106, 107, 108, 110, 112, 115, 117, 120, 123, 126, 128, 129, 130, 132, 133, 133, 133, 132,
+  132, 130, 130, 129, 129, 129, 129, 130, 131, 132, 133, 135, 136, 136, 138, 138, 138, 138, 136, 136,
+  135, 133, 131, 129, 128, 127, 126, 126, 126, 126, 126, 128, 130, 130, 132, 134, 135, 136, 136, 136,
+  136, 136, 134, 132, 130, 128, 126, 123, 119, 116, 114, 111, 109, 105, 103, 102, 102, 103, 104, 105,
+  105, 108, 112, 114, 118, 121, 123, 127, 130, 132, 134, 135, 135, 135, 135, 135, 135, 133, 133, 132,
+  132, 133, 133, 134, 135, 136, 136, 138, 139, 139, 139, 139, 138, 136, 134, 132, 130, 128, 126, 125,
+  123, 123, 123, 123, 124, 125, 126, 129, 132, 134, 135, 137, 139, 141, 141, 141, 139, 137, 135, 132,
+  128, 124, 119, 115, 111, 106, 102, 99, 95, 93, 93, 93, 95, 97, 100, 102, 108, 112, 117, 122,
+  126, 131, 135, 138, 140, 142, 144, 144, 142, 142, 141, 139, 138, 137, 136, 135, 135, 136, 136, 138,
+  138, 139, 140, 141, 141, 141, 139, 137, 135, 132, 129, 126, 124, 121, 120, 119, 118, 118, 120, 122,
+  125, 128, 131, 133, 136, 140, 142, 142, 141, 140, 138, 136, 132, 128, 123, 119, 113, 107, 103, 98,
+  94, 90, 86, 85, 85, 87, 90, 94, 98, 105, 112, 120, 128, 134, 140, 145, 149, 153, 155, 155,
+  153, 151, 148, 145, 143, 140, 137, 135, 134, 134, 136, 137, 139, 139, 141, 141, 141, 141, 139, 136,
+  132, 128, 124, 122, 118, 116, 114, 114, 115, 117, 121, 124, 128, 132, 135, 138, 142, 144, 145, 144,
+  143, 141, 138, 135, 131, 127, 121, 116, 111, 106, 102, 97, 92, 89, 85, 82, 82, 84, 87, 91,
+  96, 102, 109, 119, 128, 135, 141, 147, 152, 156, 158, 159, 156, 153, 148, 145, 142, 139, 137, 133,
+  132, 132, 133, 135, 137, 138, 138, 138, 139, 139, 137, 134, 130, 126, 124, 122, 120, 119, 119, 119,
+  122, 124, 128, 132, 135, 138, 139, 140, 142, 142, 141, 138, 136, 132, 129, 126, 123, 119, 116, 112,
+  108, 104, 102, 99, 95, 93, 91, 91, 94, 98, 101, 105, 110, 116, 124, 131, 137, 142, 144, 146,
+  148, 148, 148, 145, 141, 137, 134, 132, 130, 128, 128, 126, 128, 129, 131, 132, 133, 133, 133, 133,
+  133, 133, 131, 129, 127, 126, 126, 126, 128, 128, 129, 131, 134, 136, 138, 139, 140, 141, 141, 141,
+  139, 137, 136, 132, 130, 128, 126, 123, 120, 118, 114, 113, 112, 110, 108, 106, 105, 105, 106, 108,
+  111, 113, 115, 117, 121, 125, 127, 129, 130, 130, 132, 132, 131, 130, 128, 127, 126, 125, 125, 123,
+  123, 123, 123, 125, 125, 127, 128, 128, 129, 130, 131, 132, 132, 133, 133, 133, 133, 133, 133, 133,
+  133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 133, 134, 135, 135, 135, 135, 135, 133, 133, 133,
+  131, 130, 129, 126, 124, 123, 121, 119, 117, 115, 114, 113, 113, 113, 113, 114, 114, 115, 117, 117,
+  119, 120, 122, 123, 124, 125, 125, 126, 126, 126, 126, 125, 125, 125, 125, 125, 125, 125, 125, 125,
+  126, 127, 128, 130, 130, 132, 133, 135, 135, 135, 136, 136, 135, 135, 135, 135, 133, 133, 132, 132,
+  132, 130, 130, 130, 132, 132, 133, 133, 135, 135, 135, 136, 136, 135, 135, 133, 132, 131, 129, 127,
+  123, 121, 119, 117, 116, 114, 112, 110, 110, 110, 110, 110, 111, 111, 113, 115, 117, 119, 121, 123,
+  125, 126, 128, 128, 129, 129, 129, 129, 128, 128, 126, 126, 126, 126, 125, 126, 126, 128, 128, 130,
+  132, 133, 134, 136, 137, 138, 138, 138, 138, 137, 136, 136, 134, 132, 130, 129, 129, 128, 128, 128,
+  128, 129, 130, 132, 134, 135, 136, 136, 137, 138, 136, 136, 134, 132, 130, 127, 124, 121, 118, 116,
+  112, 110, 108, 106, 105, 105, 105, 105, 106, 108, 110, 112, 114, 118, 120, 123, 125, 127, 129, 131,
+  132, 133, 133, 133, 132, 132, 130, 130, 129, 129, 129, 129, 129, 130, 131, 133, 134, 136, 136, 138,
+  138, 138, 138, 137, 136, 135, 133, 131, 129, 129, 127, 126, 126, 126, 126, 126, 128, 129, 131, 132,
+  134, 135, 136, 136, 136, 136, 136, 135, 133, 131, 129, 126, 124, 120, 117, 114, 111, 109, 106, 104,
+  103, 102, 103, 104, 105, 106, 108, 111, 115, 118, 121, 123, 126, 130, 132, 134, 135, 135, 135, 136,
+  135, 135, 134, 133, 132, 132, 133, 133, 134, 135, 136, 137, 138, 139, 139, 139, 138, 138, 136, 134,
+  133, 130, 128, 126, 125, 124, 123, 123, 123, 123, 125, 127, 128, 130, 134, 136, 138, 140, 141, 141,
+  141, 139, 138, 135, 132, 129, 125, 119, 115, 110, 106, 103, 99, 96, 94, 93, 93, 95, 97, 99,
+  103, 107, 112, 116, 121, 126, 131, 134, 137, 141, 142, 143, 144, 144, 142, 141, 139, 139, 137, 136,
+  136, 135, 136, 136, 137, 138, 139, 139, 140, 141, 140, 138, 136, 134, 133, 129, 127, 124, 122, 120,
+  119, 118, 119, 119, 122, 124, 128, 130, 133, 137, 139, 142, 142, 142, 140, 138, 136, 133, 129, 124,
+  119, 113, 108, 103, 99, 95, 90, 87, 85, 85, 87, 90, 94, 98, 103, 111, 120, 127, 134, 139,
+  144, 149, 152, 155, 156, 154, 151, 149, 145, 143, 140, 138, 136, 134, 135, 135, 137, 139, 140, 141,
+  141, 141, 141, 140, 136, 133, 129, 125, 121, 119, 116, 114, 114, 114, 117, 120, 124, 127, 131, 135,
+  139, 141, 144, 145, 145, 143, 141, 139, 136, 132, 128, 122, 116, 110, 105, 100, 96, 90, 85, 80,
+  77, 76, 78, 81, 87, 91, 97, 106, 116, 127, 137, 144, 151, 157, 161, 165, 166, 164, 159, 155,
+  149, 146, 143, 139, 136, 134, 133, 134, 137, 139, 141, 141, 141, 141, 141, 139, 135, 129, 123, 119,
+  117, 113, 112, 111, 112, 114, 119, 124, 130, 135, 140, 143, 146, 148, 150, 150, 146, 143, 139, 133,
+  130, 125, 119, 113, 107, 100, 94, 89, 84, 77, 71, 66, 65, 70, 75, 83, 89, 98, 110, 124,
+  139, 152, 160, 166, 172, 176, 178, 175, 169, 160, 153, 146, 140, 135, 131, 127, 125, 125, 129, 133,
+  136, 139, 139, 139, 139, 138, 137, 132, 125, 119, 115, 114, 114, 114, 115, 118, 122, 129, 137, 144,
+  149, 151, 152, 153, 154, 152, 149, 142, 136, 130, 125, 122, 115, 108, 100, 93, 88, 85, 81, 75,
+  66, 59, 57, 62, 71, 80, 88, 96, 109, 127, 148, 166, 175, 180, 182, 186, 188, 187, 177, 162,
+  148, 138, 131, 125, 120, 114, 113, 114, 120, 127, 133, 137, 138, 138, 138, 139, 138, 133, 125, 119,
+  114, 116, 118, 121, 123, 126, 132, 140, 151, 157, 160, 160, 158, 156, 154, 150, 143, 134, 127, 121,
+  117, 114, 108, 102, 95, 90, 86, 82, 76, 68, 57, 51, 52, 60, 70, 81, 90, 103, 122, 146,
+  169, 185, 194, 197, 198, 198, 197, 186, 168, 149, 132, 120, 113, 106, 101, 97, 98, 105, 115, 125,
+  131, 134, 136, 138, 140, 141, 137, 131, 126, 122, 122, 126, 130, 134, 138, 143, 151, 160, 165, 167,
+  165, 160, 155, 150, 143, 134, 124, 115, 109, 107, 105, 103, 101, 97, 95, 93, 91, 86, 79, 68,
+  58, 53, 56, 64, 74, 84, 96, 116, 142, 168, 189, 202, 206, 209, 209, 203, 190, 170, 148, 125,
+  108, 95, 88, 81, 79, 81, 90, 103, 118, 131, 141, 145, 149, 152, 153, 150, 145, 136, 130, 128,
+  129, 132, 137, 141, 147, 153, 161, 166, 167, 162, 155, 147, 139, 129, 120, 110, 102, 98, 99, 103,
+  106, 110, 113, 114, 114, 113, 108, 101, 86, 69, 56, 51, 56, 64, 74, 86, 104, 130, 159, 185,
+  203, 209, 210, 209, 201, 188, 166, 140, 113, 92, 77, 70, 67, 67, 74, 87, 105, 124, 144, 157,
+  163, 164, 164, 163, 158, 150, 138, 128, 124, 124, 128, 135, 141, 147, 154, 160, 166, 165, 160, 152,
+  140, 129, 117, 107, 98, 92, 91, 95, 103, 114, 124, 134, 140, 144, 142, 136, 126, 108, 85, 62,
+  45, 38, 41, 51, 64, 81, 104, 137, 170, 198, 213, 217, 215, 207, 194, 174, 146, 115, 88, 70,
+  61, 59, 63, 70, 83, 102, 125, 146, 163, 172, 173, 171, 166, 159, 150, 139, 128, 120, 119, 124,
+  132, 140, 148, 155, 162, 166, 167, 163, 154, 142, 127, 114, 102, 94, 90, 88, 93, 103, 118, 131,
+  145, 154, 159, 158, 152, 139, 121, 98, 71, 45, 27, 21, 27, 43, 61, 84, 112, 147, 181, 208,
+  222, 223, 216, 205, 188, 166, 137, 108, 82, 68, 61, 63, 69, 79, 93, 110, 130, 148, 159, 164,
+  163, 159, 154, 149, 142, 134, 127, 125, 127, 135, 145, 153, 159, 164, 167, 167, 165, 158, 146, 131,
+  117, 105, 96, 91, 89, 93, 101, 113, 128, 142, 153, 159, 159, 154, 144, 129, 110, 87, 61, 38,
+  24, 25, 37, 55, 75, 99, 126, 159, 192, 215, 223, 217, 204, 189, 170, 147, 120, 92, 71, 60,
+  61, 69, 80, 92, 106, 122, 140, 154, 162, 163, 158, 152, 147, 143, 139, 136, 132, 133, 139, 148,
+  157, 163, 164, 164, 161, 156, 148, 137, 124, 111, 101, 94, 93, 96, 103, 112, 123, 136, 148, 157,
+  161, 160, 154, 143, 129, 112, 94, 75, 54, 37, 28, 32, 46, 68, 91, 113, 139, 166, 195, 213,
+  217, 207, 191, 173, 155, 135, 113, 90, 73, 67, 70, 81, 92, 104, 116, 127, 137, 147, 151, 150,
+  144, 138, 135, 133, 136, 140, 144, 148, 155, 163, 171, 173, 170, 163, 152, 142, 131, 120, 110, 101,
+  95, 92, 97, 104, 116, 127, 135, 145, 152, 159, 160, 158, 149, 139, 126, 112, 96, 81, 63, 46,
+  34, 31, 40, 60, 83, 107, 132, 160, 188, 210, 220, 216, 202, 182, 161, 138, 114, 90, 71, 61,
+  61, 71, 85, 100, 113, 125, 138, 147, 153, 153, 149, 142, 137, 136, 140, 144, 148, 152, 156, 163,
+  169, 171, 166, 155, 144, 132, 122, 112, 104, 96, 92, 96, 104, 115, 126, 136, 145, 153, 160, 163,
+  162, 156, 147, 135, 122, 107, 91, 74, 55, 38, 27, 27, 40, 62, 89, 115, 143, 174, 204, 227,
+  230, 219, 200, 175, 150, 123, 95, 70, 54, 49, 57, 73, 90, 108, 124, 140, 150, 157, 157, 153,
+  144, 136, 130, 131, 136, 142, 149, 156, 165, 173, 177, 175, 166, 152, 137, 123, 110, 98, 91, 86,
+  88, 95, 109, 124, 138, 150, 159, 165, 169, 167, 161, 151, 137, 124, 109, 93, 77, 60, 44, 32,
+  28, 36, 53, 79, 107, 136, 165, 194, 217, 227, 224, 209, 183, 154, 127, 102, 79, 61, 54, 58,
+  69, 86, 102, 118, 130, 140, 146, 148, 148, 144, 140, 138, 141, 147, 154, 163, 169, 172, 173, 170,
+  165, 154, 139, 123, 107, 96, 90, 89, 93, 100, 111, 123, 136, 150, 159, 166, 166, 163, 157, 150,
+  141, 130, 117, 103, 90, 79, 66, 54, 42, 34, 35, 47, 73, 106, 138, 167, 193, 216, 230, 232,
+  217, 189, 156, 124, 98, 77, 60, 50, 52, 61, 80, 100, 118, 132, 140, 144, 147, 147, 146, 144,
+  142, 142, 149, 158, 167, 174, 175, 172, 166, 159, 147, 133, 116, 101, 91, 89, 91, 99, 107, 117,
+  129, 141, 154, 162, 164, 163, 158, 151, 144, 134, 122, 109, 95, 83, 70, 58, 46, 36, 37, 47,
+  72, 103, 137, 167, 192, 214, 228, 228, 215, 188, 155, 124, 96, 76, 61, 52, 54, 63, 79, 98,
+  117, 131, 139, 144, 146, 150, 150, 149, 148, 151, 155, 162, 170, 172, 169, 162, 152, 143, 132, 118,
+  105, 95, 92, 95, 103, 113, 122, 132, 141, 149, 156, 159, 158, 153, 147, 139, 132, 124, 116, 106,
+  94, 82, 67, 55, 46, 47, 57, 77, 104, 134, 163, 189, 207, 218, 217, 204, 181, 154, 126, 102,
+  83, 72, 68, 69, 78, 90, 104, 117, 126, 132, 136, 138, 140, 143, 146, 150, 155, 160, 166, 168,
+  167, 161, 151, 140, 129, 117, 107, 99, 94, 93, 97, 104, 112, 120, 126, 132, 136, 140, 141, 140,
+  138, 134, 129, 123, 117, 110, 103, 93, 84, 76, 75, 83, 98, 118, 141, 161, 178, 188, 193, 191,
+  181, 164, 143, 121, 106, 95, 90, 90, 92, 99, 109, 118, 125, 129, 130, 130, 132, 133, 136, 138,
+  140, 144, 149, 153, 156, 155, 149, 141, 133, 127, 122, 118, 116, 115, 117, 123, 127, 129, 129, 127,
+  125, 121, 117, 111, 105, 101, 99, 97, 96, 96, 94, 92, 89, 88, 90, 97, 109, 125, 144, 163,
+  177, 186, 191, 188, 181, 167, 151, 133, 119, 108, 103, 102, 107, 114, 122, 130, 135, 139, 139, 139,
+  136, 133, 130, 129, 129, 129, 131, 133, 133, 133, 132, 130, 128, 128, 128, 128, 130, 133, 137, 141,
+  143, 144, 142, 140, 136, 132, 127, 122, 115, 109, 103, 98, 94, 88, 80, 71, 65, 62, 65, 70,
+  79, 93, 110, 129, 148, 164, 173, 179, 180, 178, 174, 166, 156, 146, 137, 132, 129, 127, 125, 125,
+  125, 126, 129, 133, 136, 138, 139, 141, 141, 142, 142, 138, 133, 126, 120, 116, 114, 113, 113, 114,
+  118, 124, 133, 141, 147, 151, 153, 153, 154, 153, 149, 144, 137, 132, 126, 123, 117, 110, 102, 95,
+  88, 85, 81, 75, 68, 61, 57, 60, 69, 78, 86, 94, 106, 122, 143, 162, 174, 179, 182, 185,
+  188, 187, 180, 166, 151, 140, 133, 127, 121, 115, 113, 114, 117, 125, 132, 136, 138, 138, 138, 139,
+  139, 135, 127, 120, 115, 116, 118, 120, 123, 125, 130, 138, 149, 156, 160, 160, 158, 156, 154, 152,
+  145, 136, 128, 123, 118, 115, 110, 104, 97, 91, 87, 83, 77, 70, 60, 52, 51, 58, 67, 78,
+  87, 99, 117, 140, 164, 182, 192, 197, 198, 198, 197, 189, 173, 154, 136, 123, 115, 108, 102, 98,
+  98, 103, 113, 122, 130, 134, 136, 138, 140, 141, 138, 133, 127, 122, 122, 125, 129, 133, 137, 142,
+  149, 158, 164, 167, 166, 161, 156, 151, 145, 136, 127, 117, 110, 107, 105, 103, 101, 98, 96, 94,
+  92, 88, 81, 71, 61, 54, 55, 62, 72, 81, 93, 110, 135, 162, 184, 199, 206, 209, 209, 205,
+  194, 176, 153, 130, 112, 98, 89, 82, 79, 80, 87, 100, 114, 128, 139, 144, 148, 151, 153, 151,
+  147, 138, 131, 128, 128, 131, 137, 140, 144, 151, 159, 165, 167, 164, 157, 149, 142, 132, 122, 113,
+  104, 99, 98, 102, 105, 109, 113, 114, 114, 114, 110, 103, 91, 73, 59, 51, 53, 62, 71, 83,
+  99, 124, 152, 180, 199, 209, 210, 209, 204, 193, 172, 147, 118, 96, 80, 71, 67, 67, 71, 83,
+  100, 119, 140, 154, 162, 164, 164, 163, 160, 152, 141, 130, 124, 124, 127, 134, 140, 146, 153, 159,
+  164, 166, 162, 154, 143, 132, 120, 110, 100, 93, 91, 94, 100, 111, 121, 132, 139, 143, 143, 138,
+  129, 113, 91, 68, 48, 38, 40, 48, 60, 76, 98, 128, 162, 192, 211, 217, 216, 209, 198, 179,
+  154, 122, 94, 74, 62, 59, 62, 67, 80, 97, 119, 141, 159, 171, 173, 172, 167, 161, 153, 142,
+  131, 122, 119, 123, 130, 138, 146, 153, 160, 165, 167, 164, 157, 146, 131, 117, 105, 96, 91, 88,
+  91, 100, 114, 128, 141, 152, 158, 159, 154, 142, 126, 104, 78, 51, 30, 22, 24, 38, 57, 77,
+  104, 138, 173, 203, 219, 224, 219, 208, 193, 172, 145, 115, 87, 70, 62, 62, 67, 76, 89, 106,
+  125, 143, 156, 163, 164, 160, 155, 151, 144, 136, 129, 125, 126, 133, 142, 151, 158, 163, 167, 167,
+  166, 160, 149, 135, 121, 107, 98, 92, 89, 91, 99, 109, 124, 139, 151, 159, 160, 156, 147, 133,
+  115, 93, 67, 43, 26, 23, 33, 50, 70, 93, 119, 150, 184, 211, 223, 220, 207, 193, 176, 153,
+  127, 99, 75, 62, 59, 67, 77, 89, 102, 118, 135, 151, 161, 163, 160, 153, 148, 144, 140, 136,
+  133, 132, 137, 146, 156, 161, 164, 164, 162, 158, 151, 140, 127, 114, 104, 95, 93, 95, 101, 110,
+  121, 132, 145, 156, 160, 161, 156, 147, 133, 116, 99, 80, 59, 41, 29, 30, 42, 62, 85, 108,
+  132, 159, 188, 210, 217, 211, 195, 178, 160, 140, 119, 95, 77, 67, 68, 78, 89, 101, 113, 124,
+  134, 145, 150, 151, 145, 139, 135, 133, 135, 139, 143, 147, 153, 161, 169, 173, 172, 165, 155, 144,
+  133, 123, 113, 103, 96, 92, 95, 102, 113, 124, 134, 142, 150, 158, 160, 159, 152, 142, 129, 115,
+  100, 85, 68, 50, 36, 30, 36, 54, 78, 101, 126, 153, 182, 205, 218, 218, 206, 187, 166, 144,
+  121, 96, 75, 62, 60, 68, 81, 96, 110, 122, 135, 145, 153, 154, 151, 144, 138, 136, 139, 143,
+  147, 151, 155, 161, 168, 172, 168, 158, 147, 135, 125, 115, 106, 98, 93, 94, 101, 112, 123, 134,
+  143, 151, 158, 162, 163, 157, 149, 138, 125, 111, 95, 78, 60, 42, 29, 25, 35, 55, 82, 108,
+  136, 166, 197, 221, 231, 223, 205, 181, 156, 130, 102, 75, 57, 50, 54, 69, 86, 103, 120, 135,
+  147, 156, 158, 155, 146, 138, 132, 131, 135, 141, 148, 154, 163, 171, 177, 176, 169, 156, 141, 126,
+  113, 101, 92, 87, 87, 93, 105, 120, 135, 147, 157, 164, 168, 167, 163, 153, 141, 127, 113, 97,
+  80, 64, 48, 34, 28, 33, 47, 72, 100, 129, 158, 187, 212, 227, 226, 213, 190, 161, 134, 109,
+  84, 65, 55, 56, 65, 81, 98, 114, 127, 138, 145, 148, 148, 145, 141, 138, 140, 145, 152, 162,
+  167, 171, 173, 171, 166, 157, 143, 127, 111, 99, 91, 89, 92, 98, 108, 119, 133, 146, 157, 165,
+  167, 164, 158, 152, 143, 134, 120, 107, 93, 81, 69, 57, 44, 35, 34, 42, 66, 97, 130, 161,
+  187, 211, 228, 233, 222, 197, 165, 132, 104, 82, 64, 51, 50, 58, 75, 95, 114, 129, 138, 143,
+  146, 147, 146, 144, 142, 141, 147, 156, 165, 172, 175, 173, 167, 161, 150, 136, 120, 104, 93, 89,
+  90, 97, 105, 114, 126, 138, 151, 161, 164, 164, 159, 152, 146, 137, 126, 112, 99, 86, 73, 61,
+  49, 38, 36, 43, 65, 95, 129, 160, 187, 209, 226, 230, 219, 196, 163, 131, 103, 81, 64, 54,
+  52, 60, 75, 94, 113, 128, 138, 143, 146, 149, 150, 149, 148, 150, 154, 160, 168, 172, 170, 165,
+  156, 146, 134, 123, 109, 98, 92, 93, 100, 110, 120, 130, 141, 149, 156, 160, 160, 156, 149, 141,
+  133, 124, 115, 106, 93, 79, 63, 48, 38, 34, 42, 62, 91, 125, 159, 190, 213, 228, 231, 222,
+  197, 165, 132, 104, 80, 64, 56, 57, 66, 80, 97, 112, 124, 133, 137, 139, 143, 145, 148, 150,
+  156, 163, 171, 177, 177, 172, 162, 148, 135, 121, 109, 98, 92, 91, 96, 107, 119, 130, 140, 148,
+  153, 157, 157, 154, 149, 140, 131, 120, 108, 97, 83, 68, 51, 39, 36, 44, 66, 97, 132, 165,
+  194, 216, 227, 227, 213, 188, 154, 119, 90, 70, 59, 55, 60, 73, 90, 109, 124, 135, 140, 142,
+  145, 147, 149, 152, 154, 157, 163, 169, 172, 167, 157, 142, 127, 115, 107, 99, 95, 96, 105, 118,
+  132, 143, 150, 154, 154, 153, 149, 144, 138, 131, 125, 118, 111, 104, 96, 82, 64, 47, 34, 35,
+  51, 79, 115, 152, 184, 211, 229, 236, 227, 204, 170, 133, 100, 73, 59, 54, 57, 69, 86, 104,
+  121, 131, 137, 138, 136, 137, 139, 145, 151, 158, 165, 173, 179, 177, 166, 150, 131, 116, 104, 96,
+  92, 94, 103, 116, 131, 142, 148, 150, 150, 147, 144, 140, 135, 131, 126, 122, 120, 115, 106, 90,
+  69, 49, 35, 33, 47, 74, 110, 149, 185, 213, 230, 235, 227, 202, 168, 130, 96, 70, 55, 52,
+  59, 73, 90, 105, 120, 132, 137, 137, 135, 135, 141, 148, 158, 167, 175, 181, 183, 178, 164, 141,
+  118, 100, 89, 85, 86, 93, 106, 123, 141, 153, 159, 160, 156, 151, 143, 134, 127, 123, 122, 122,
+  121, 119, 113, 101, 85, 63, 45, 34, 35, 51, 80, 118, 158, 195, 222, 238, 237, 223, 196, 162,
+  129, 96, 73, 59, 55, 62, 75, 88, 103, 115, 125, 129, 130, 130, 132, 140, 151, 163, 172, 180,
+  186, 186, 178, 162, 137, 113, 94, 83, 83, 87, 97, 111, 127, 144, 155, 159, 158, 152, 144, 137,
+  130, 127, 126, 126, 126, 124, 121, 113, 97, 74, 48, 31, 26, 38, 67, 108, 150, 188, 217, 234,
+  236, 224, 198, 165, 130, 99, 75, 63, 61, 69, 80, 93, 104, 112, 117, 120, 120, 121, 126, 136,
+  150, 166, 179, 189, 193, 190, 180, 161, 137, 112, 92, 81, 80, 86, 97, 112, 127, 142, 153, 159,
+  157, 150, 143, 135, 130, 128, 128, 130, 133, 135, 134, 130, 122, 103, 78, 51, 29, 20, 26, 48,
+  84, 129, 175, 211, 234, 243, 235, 215, 184, 147, 112, 84, 68, 65, 70, 80, 92, 103, 109, 111,
+  111, 111, 113, 114, 121, 135, 155, 176, 192, 199, 197, 187, 172, 150, 125, 100, 84, 78, 81, 91,
+  106, 121, 136, 148, 155, 157, 153, 146, 139, 132, 128, 128, 132, 137, 139, 139, 138, 134, 125, 111,
+  91, 68, 45, 29, 21, 31, 56, 95, 141, 184, 217, 233, 235, 225, 205, 176, 141, 108, 81, 68,
+  68, 76, 87, 94, 100, 101, 103, 105, 108, 112, 118, 129, 145, 165, 184, 195, 198, 193, 181, 163,
+  144, 123, 102, 88, 83, 86, 96, 109, 121, 132, 141, 146, 149, 148, 144, 141, 137, 135, 137, 139,
+  141, 140, 137, 133, 129, 122, 115, 105, 94, 83, 69, 55, 42, 36, 44, 67, 104, 150, 190, 219,
+  230, 228, 218, 200, 172, 139, 104, 78, 66, 67, 77, 87, 96, 101, 103, 104, 106, 109, 114, 122,
+  133, 150, 169, 188, 198, 199, 188, 172, 153, 134, 116, 101, 91, 89, 95, 106, 118, 128, 134, 137,
+  138, 138, 138, 137, 136, 138, 140, 143, 146, 148, 145, 139, 130, 122, 114, 110, 107, 106, 101, 93,
+  80, 63, 48, 41, 45, 63, 95, 139, 182, 212, 228, 232, 222, 203, 176, 143, 110, 85, 70, 68,
+  74, 84, 93, 96, 96, 97, 100, 107, 115, 127, 142, 160, 181, 198, 206, 201, 187, 167, 146, 125,
+  109, 97, 91, 89, 95, 107, 121, 131, 133, 133, 132, 134, 136, 137, 139, 140, 143, 145, 149, 150,
+  146, 138, 126, 117, 112, 110, 110, 108, 104, 100, 92, 81, 66, 51, 40, 43, 64, 102, 152, 196,
+  225, 232, 226, 211, 190, 162, 130, 98, 76, 68, 73, 85, 97, 102, 100, 98, 96, 100, 106, 116,
+  129, 145, 166, 185, 200, 203, 196, 177, 156, 136, 120, 109, 102, 98, 101, 106, 117, 124, 128, 129,
+  127, 126, 126, 130, 135, 140, 145, 149, 152, 153, 150, 144, 133, 120, 111, 104, 104, 105, 110, 114,
+  113, 104, 88, 67, 48, 37, 39, 61, 97, 144, 189, 220, 234, 228, 213, 191, 162, 131, 104, 85,
+  77, 79, 88, 97, 102, 101, 95, 90, 89, 95, 109, 126, 149, 172, 193, 207, 209, 199, 179, 155,
+  132, 114, 103, 100, 99, 103, 109, 116, 123, 126, 124, 122, 121, 125, 131, 138, 144, 150, 154, 157,
+  156, 151, 141, 129, 115, 106, 104, 106, 110, 115, 116, 114, 109, 100, 84, 65, 47, 37, 41, 65,
+  105, 155, 198, 225, 231, 220, 203, 184, 158, 128, 100, 81, 78, 83, 94, 102, 103, 101, 96, 93,
+  93, 101, 113, 129, 148, 170, 190, 204, 206, 195, 176, 153, 133, 116, 106, 100, 98, 101, 106, 115,
+  123, 126, 126, 122, 120, 124, 132, 140, 147, 152, 153, 154, 153, 150, 141, 129, 115, 105, 102, 106,
+  112, 118, 120, 118, 110, 98, 82, 65, 48, 37, 39, 62, 104, 156, 201, 227, 232, 222, 204, 182,
+  157, 128, 100, 82, 79, 86, 97, 103, 103, 98, 89, 84, 87, 97, 114, 133, 155, 177, 197, 210,
+  209, 196, 173, 148, 128, 113, 105, 103, 102, 104, 110, 116, 120, 121, 118, 116, 118, 125, 134, 142,
+  149, 155, 157, 158, 154, 147, 136, 125, 115, 107, 103, 104, 106, 109, 113, 116, 112, 102, 85, 68,
+  55, 47, 51, 73, 109, 154, 197, 222, 228, 214, 193, 169, 144, 120, 102, 90, 89, 95, 106, 112,
+  112, 103, 90, 81, 80, 92, 112, 136, 159, 182, 200, 207, 201, 186, 164, 141, 122, 112, 109, 111,
+  114, 114, 114, 115, 116, 113, 110, 110, 114, 126, 138, 149, 156, 160, 158, 155, 149, 141, 130, 120,
+  112, 109, 111, 115, 120, 124, 123, 123, 118, 109, 94, 75, 60, 51, 54, 70, 101, 139, 176, 202,
+  212, 205, 191, 175, 155, 135, 116, 106, 102, 103, 104, 103, 99, 92, 82, 72, 70, 75, 90, 112,
+  137, 160, 182, 199, 206, 201, 189, 170, 151, 135, 123, 112, 104, 95, 91, 90, 93, 99, 105, 111,
+  119, 129, 140, 149, 155, 157, 152, 147, 141, 136, 134, 132, 129, 129, 132, 137, 142, 143, 140, 133,
+  123, 112, 100, 87, 78, 70, 71, 79, 98, 125, 155, 178, 190, 190, 184, 174, 160, 144, 127, 113,
+  103, 95, 87, 80, 70, 60, 55, 55, 63, 82, 105, 131, 158, 184, 206, 219, 218, 204, 182, 155,
+  130, 108, 90, 78, 72, 73, 81, 92, 105, 116, 125, 133, 137, 142, 144, 144, 143, 142, 144, 148,
+  153, 157, 160, 162, 162, 159, 154, 145, 134, 122, 109, 99, 94, 92, 93, 98, 104, 113, 123, 136,
+  148, 159, 164, 167, 164, 158, 149, 137, 122, 108, 94, 82, 70, 57, 46, 39, 39, 49, 73, 103,
+  135, 164, 190, 213, 229, 231, 217, 190, 158, 127, 99, 78, 61, 51, 50, 61, 78, 99, 117, 131,
+  139, 144, 146, 147, 146, 144, 141, 143, 148, 157, 168, 174, 175, 172, 166, 158, 148, 134, 116, 101,
+  92, 89, 91, 98, 106, 116, 128, 142, 153, 162, 166, 163, 158, 151, 143, 134, 123, 110, 96, 84,
+  71, 58, 46, 37, 36, 47, 70, 103, 135, 167, 192, 213, 228, 230, 216, 190, 157, 125, 97, 77,
+  61, 52, 52, 62, 78, 97, 116, 130, 139, 144, 146, 149, 150, 149, 148, 150, 154, 162, 169, 173,
+  170, 163, 154, 144, 132, 120, 107, 96, 92, 94, 102, 111, 122, 132, 142, 150, 157, 160, 160, 155,
+  148, 140, 131, 123, 114, 103, 91, 76, 60, 45, 36, 36, 46, 67, 98, 133, 166, 195, 217, 230,
+  231, 218, 190, 159, 126, 99, 77, 62, 55, 59, 69, 83, 100, 115, 127, 133, 137, 140, 143, 145,
+  148, 152, 157, 164, 172, 178, 177, 170, 159, 146, 132, 119, 106, 97, 91, 92, 98, 109, 121, 132,
+  141, 149, 154, 157, 157, 154, 147, 138, 128, 117, 106, 94, 81, 64, 49, 37, 37, 46, 71, 103,
+  139, 172, 199, 219, 228, 225, 210, 182, 147, 113, 85, 67, 58, 57, 63, 76, 93, 111, 127, 137,
+  141, 143, 145, 147, 149, 152, 154, 158, 164, 170, 172, 167, 154, 138, 124, 114, 105, 99, 96, 96,
+  106, 120, 135, 145, 151, 154, 154, 152, 148, 144, 137, 130, 122, 116, 110, 103, 94, 79, 61, 43,
+  34, 38, 56, 86, 122, 158, 190, 215, 232, 236, 223, 197, 163, 125, 93, 70, 57, 54, 58, 72,
+  90, 108, 124, 134, 137, 138, 136, 137, 140, 146, 152, 159, 167, 174, 179, 176, 164, 146, 127, 112,
+  102, 96, 92, 96, 105, 119, 133, 143, 150, 151, 149, 147, 143, 139, 134, 130, 126, 122, 120, 114,
+  104, 87, 65, 45, 34, 35, 51, 81, 118, 157, 190, 218, 232, 234, 223, 195, 161, 124, 90, 67,
+  54, 53, 62, 77, 92, 109, 123, 133, 137, 137, 135, 136, 142, 151, 160, 168, 176, 182, 183, 176,
+  159, 136, 114, 97, 87, 85, 87, 94, 108, 127, 143, 154, 159, 160, 156, 150, 141, 133, 126, 124,
+  122, 122, 121, 117, 111, 99, 80, 59, 42, 32, 37, 57, 88, 125, 166, 200, 226, 238, 235, 218,
+  190, 156, 122, 92, 70, 57, 55, 64, 77, 92, 106, 118, 126, 129, 130, 130, 133, 142, 153, 165,
+  175, 182, 186, 186, 175, 157, 132, 108, 91, 82, 83, 90, 100, 114, 131, 146, 156, 160, 158, 151,
+  143, 136, 129, 127, 126, 126, 125, 124, 120, 110, 93, 69, 45, 28, 28, 43, 75, 116, 158, 194,
+  221, 235, 236, 220, 192, 158, 123, 93, 71, 61, 62, 71, 83, 95, 105, 113, 118, 120, 120, 122,
+  128, 138, 153, 169, 182, 191, 193, 188, 178, 157, 132, 108, 90, 80, 80, 87, 100, 114, 130, 145,
+  155, 159, 156, 149, 141, 134, 129, 128, 128, 132, 134, 135, 134, 128, 118, 99, 73, 46, 26, 20,
+  29, 53, 92, 138, 184, 217, 236, 241, 232, 209, 176, 140, 105, 80, 67, 65, 71, 83, 94, 104,
+  109, 111, 111, 111, 113, 116, 124, 138, 160, 180, 194, 200, 195, 185, 168, 145, 120, 97, 82, 77,
+  82, 94, 108, 125, 139, 150, 156, 157, 152, 145, 136, 130, 128, 129, 133, 137, 139, 139, 137, 133,
+  123, 107, 88, 63, 41, 26, 23, 36, 64, 104, 151, 193, 221, 236, 235, 222, 200, 169, 134, 101,
+  78, 67, 69, 78, 88, 95, 99, 101, 103, 107, 109, 112, 119, 132, 150, 169, 186, 197, 197, 191,
+  178, 159, 139, 118, 99, 86, 83, 88, 99, 112, 124, 134, 142, 147, 149, 148, 144, 139, 137, 136,
+  138, 140, 141, 139, 136, 132, 128, 121, 112, 102, 92, 80, 67, 52, 40, 36, 47, 74, 112, 158,
+  196, 221, 230, 227, 216, 195, 165, 131, 98, 75, 65, 68, 79, 90, 98, 103, 104, 105, 107, 110,
+  116, 123, 136, 154, 173, 191, 198, 196, 185, 169, 149, 130, 112, 98, 91, 90, 96, 108, 120, 129,
+  134, 136, 137, 138, 138, 137, 136, 138, 140, 144, 146, 148, 144, 137, 129, 120, 113, 108, 106, 104,
+  100, 90, 76, 59, 46, 40, 47, 68, 103, 147, 189, 217, 230, 231, 220, 198, 170, 136, 104, 80,
+  68, 68, 76, 85, 94, 96, 96, 97, 101, 108, 118, 130, 145, 164, 184, 199, 206, 199, 184, 163,
+  141, 122, 107, 96, 90, 89, 98, 111, 124, 131, 133, 133, 132, 134, 135, 137, 139, 141, 143, 146,
+  150, 150, 145, 135, 124, 116, 111, 110, 110, 107, 103, 97, 90, 78, 62, 48, 40, 46, 71, 112,
+  162, 204, 229, 233, 224, 208, 186, 157, 123, 92, 72, 68, 76, 88, 99, 102, 100, 97, 98, 100,
+  107, 118, 131, 149, 169, 189, 202, 203, 192, 173, 152, 132, 118, 107, 101, 98, 101, 109, 118, 126,
+  129, 128, 126, 126, 127, 131, 137, 141, 145, 149, 152, 153, 150, 141, 130, 119, 109, 105, 104, 106,
+  111, 114, 111, 101, 83, 63, 45, 36, 42, 66, 105, 154, 196, 224, 234, 227, 209, 185, 156, 126,
+  99, 81, 76, 80, 89, 98, 102, 100, 94, 89, 90, 98, 112, 131, 154, 177, 197, 210, 208, 195,
+  175, 151, 128, 112, 102, 99, 99, 104, 110, 118, 124, 126, 124, 122, 122, 125, 132, 140, 146, 151,
+  156, 157, 156, 150, 140, 126, 114, 105, 104, 107, 111, 115, 116, 114, 108, 96, 80, 61, 44, 36,
+  44, 71, 114, 165, 205, 227, 230, 217, 199, 179, 152, 122, 95, 80, 78, 85, 95, 103, 103, 100,
+  96, 93, 95, 102, 117, 133, 153, 173, 194, 206, 204, 192, 171, 148, 128, 113, 104, 100, 99, 101,
+  108, 117, 124, 127, 125, 122, 121, 126, 134, 143, 148, 152, 153, 154, 152, 148, 139, 126, 113, 104,
+  103, 107, 113, 118, 120, 117, 109, 95, 79, 61, 45, 37, 42, 69, 114, 167, 209, 229, 231, 219,
+  200, 177, 150, 121, 96, 80, 79, 87, 98, 104, 103, 95, 87, 83, 88, 100, 118, 138, 160, 182,
+  200, 212, 207, 191, 168, 144, 124, 110, 104, 102, 102, 105, 110, 117, 121, 121, 118, 116, 119, 126,
+  135, 144, 151, 156, 159, 158, 153, 144, 134, 123, 112, 106, 103, 103, 107, 111, 115, 116, 111, 98,
+  82, 66, 53, 47, 54, 79, 117, 164, 203, 225, 227, 211, 189, 164, 138, 115, 99, 89, 89, 97,
+  107, 113, 111, 100, 89, 80, 82, 96, 116, 140, 164, 186, 201, 207, 200, 182, 159, 136, 119, 111,
+  110, 112, 114, 114, 114, 115, 116, 112, 110, 110, 117, 128, 141, 152, 158, 160, 159, 154, 148, 138,
+  127, 116, 109, 106, 108, 113, 117, 119, 118, 116, 111, 99, 83, 64, 48, 41, 48, 71, 111, 157,
+  198, 223, 228, 217, 197, 174, 149, 123, 102, 92, 90, 95, 101, 102, 101, 95, 88, 83, 84, 95,
+  113, 136, 160, 183, 200, 210, 204, 188, 166, 144, 127, 114, 109, 107, 107, 108, 110, 112, 114, 114,
+  114, 114, 118, 125, 136, 147, 156, 160, 157, 153, 146, 140, 132, 122, 114, 108, 107, 109, 113, 116,
+  117, 114, 108, 100, 87, 74, 62, 54, 54, 66, 95, 137, 180, 212, 225, 217, 198, 176, 154, 131,
+  110, 96, 94, 97, 102, 107, 105, 98, 91, 84, 82, 91, 108, 131, 154, 174, 193, 206, 204, 192,
+  171, 148, 129, 116, 110, 108, 108, 110, 110, 111, 113, 115, 116, 116, 119, 126, 135, 144, 151, 156,
+  156, 153, 146, 138, 132, 127, 121, 117, 112, 110, 111, 113, 115, 114, 110, 102, 93, 83, 71, 60,
+  55, 61, 83, 121, 165, 202, 222, 220, 204, 182, 157, 135, 118, 106, 100, 99, 102, 106, 106, 100,
+  89, 79, 76, 84, 103, 127, 154, 176, 193, 200, 198, 186, 170, 151, 136, 124, 119, 119, 120, 117,
+  111, 106, 103, 101, 104, 108, 115, 125, 136, 147, 156, 160, 160, 154, 146, 137, 130, 126, 122, 120,
+  117, 113, 111, 109, 108, 108, 108, 105, 99, 87, 76, 69, 65, 68, 81, 106, 144, 186, 215, 220,
+  206, 182, 157, 137, 122, 112, 107, 104, 105, 109, 110, 106, 96, 84, 76, 80, 95, 119, 145, 167,
+  184, 194, 194, 186, 170, 153, 139, 127, 125, 125, 125, 123, 115, 106, 101, 100, 103, 106, 112, 124,
+  137, 147, 155, 157, 156, 149, 142, 135, 130, 128, 126, 126, 123, 119, 115, 112, 110, 108, 108, 108,
+  106, 96, 82, 67, 58, 57, 69, 96, 136, 178, 208, 217, 207, 189, 169, 151, 133, 119, 112, 109,
+  108, 108, 105, 98, 89, 80, 76, 80, 93, 113, 136, 158, 176, 189, 195, 190, 177, 161, 147, 136,
+  132, 130, 127, 120, 112, 104, 100, 101, 104, 108, 112, 118, 127, 138, 148, 153, 154, 150, 143, 137,
+  135, 135, 135, 132, 127, 120, 115, 111, 108, 104, 102, 102, 102, 100, 94, 85, 75, 69, 70, 84,
+  113, 153, 190, 210, 209, 193, 171, 153, 140, 128, 119, 112, 110, 110, 109, 104, 96, 87, 79, 79,
+  88, 105, 127, 148, 164, 176, 183, 184, 178, 168, 154, 143, 135, 131, 130, 129, 122, 112, 103, 96,
+  98, 105, 113, 120, 127, 134, 141, 146, 148, 147, 142, 137, 135, 136, 139, 141, 137, 129, 120, 114,
+  112, 110, 109, 105, 99, 93, 87, 80, 72, 66, 64, 75, 102, 141, 182, 209, 215, 206, 186, 166,
+  148, 131, 120, 110, 104, 102, 103, 101, 97, 88, 80, 78, 84, 99, 121, 142, 162, 176, 185, 188,
+  185, 176, 162, 149, 137, 131, 127, 124, 118, 110, 104, 101, 103, 106, 112, 119, 125, 131, 138, 143,
+  147, 148, 146, 144, 141, 140, 139, 139, 134, 127, 117, 109, 104, 104, 106, 108, 104, 94, 81, 69,
+  59, 59, 67, 87, 120, 158, 196, 216, 218, 205, 183, 159, 138, 121, 109, 102, 99, 100, 102, 101,
+  98, 92, 84, 81, 87, 102, 121, 144, 164, 182, 192, 195, 189, 175, 159, 143, 131, 123, 118, 114,
+  112, 109, 108, 110, 113, 115, 116, 119, 122, 130, 137, 144, 148, 150, 150, 148, 146, 143, 137, 129,
+  121, 115, 111, 111, 112, 113, 112, 108, 103, 93, 77, 62, 50, 48, 60, 89, 132, 177, 211, 224,
+  218, 202, 182, 161, 139, 116, 99, 91, 91, 96, 101, 102, 97, 92, 88, 88, 96, 110, 125, 144,
+  163, 180, 194, 198, 193, 178, 158, 140, 125, 116, 111, 107, 105, 105, 110, 115, 120, 123, 121, 120,
+  122, 128, 137, 145, 150, 152, 153, 151, 149, 144, 135, 123, 112, 106, 105, 110, 115, 119, 118, 112,
+  102, 88, 72, 55, 44, 42, 55, 89, 138, 186, 221, 230, 223, 208, 187, 164, 137, 110, 90, 81,
+  83, 93, 102, 104, 100, 91, 84, 84, 94, 108, 127, 148, 170, 191, 206, 209, 201, 181, 156, 134,
+  116, 106, 103, 102, 103, 107, 114, 119, 122, 119, 117, 117, 122, 130, 139, 148, 153, 158, 159, 156,
+  149, 140, 129, 118, 109, 105, 102, 105, 109, 113, 116, 114, 106, 91, 74, 59, 49, 49, 64, 95,
+  139, 184, 218, 228, 220, 201, 177, 152, 127, 106, 94, 88, 92, 102, 110, 114, 106, 95, 83, 79,
+  88, 105, 127, 152, 175, 195, 205, 205, 192, 171, 148, 127, 114, 110, 111, 113, 114, 114, 114, 116,
+  114, 111, 109, 113, 121, 134, 147, 155, 160, 160, 157, 152, 144, 133, 122, 112, 107, 106, 110, 115,
+  118, 119, 117, 114, 106, 92, 74, 56, 43, 43, 57, 87, 132, 178, 213, 228, 224, 209, 187, 163,
+  136, 112, 96, 90, 92, 98, 102, 102, 98, 92, 85, 82, 89, 102, 123, 147, 171, 192, 206, 209,
+  198, 179, 155, 135, 121, 111, 107, 107, 107, 109, 110, 113, 114, 114, 114, 116, 121, 130, 141, 152,
+  159, 159, 155, 150, 143, 136, 127, 118, 111, 107, 107, 111, 115, 117, 116, 112, 104, 94, 81, 67,
+  57, 54, 58, 77, 114, 158, 199, 221, 223, 209, 188, 166, 143, 120, 103, 94, 95, 99, 105, 107,
+  102, 95, 87, 82, 85, 98, 118, 141, 164, 183, 199, 205, 201, 183, 160, 138, 122, 112, 109, 108,
+  109, 110, 111, 112, 114, 115, 116, 117, 122, 130, 139, 148, 154, 157, 154, 150, 142, 135, 130, 124,
+  119, 114, 111, 110, 112, 114, 115, 112, 106, 98, 88, 77, 66, 57, 56, 69, 100, 142, 185, 213,
+  222, 214, 194, 170, 146, 126, 112, 103, 99, 100, 104, 107, 104, 95, 83, 76, 78, 92, 114, 140,
+  165, 186, 197, 200, 193, 180, 161, 143, 130, 121, 119, 120, 119, 114, 108, 105, 102, 102, 106, 111,
+  120, 130, 141, 152, 159, 160, 157, 150, 142, 133, 128, 124, 121, 119, 115, 112, 110, 108, 108, 108,
+  107, 103, 93, 82, 72, 67, 65, 72, 92, 123, 164, 202, 220, 216, 195, 170, 147, 130, 117, 110,
+  104, 104, 107, 110, 109, 101, 89, 80, 77, 85, 105, 132, 156, 176, 190, 195, 192, 180, 162, 146,
+  133, 125, 125, 125, 124, 119, 110, 103, 100, 101, 104, 109, 117, 130, 142, 152, 157, 157, 153, 146,
+  138, 133, 128, 127, 126, 125, 121, 118, 114, 111, 109, 108, 108, 108, 102, 90, 75, 62, 56, 60,
+  80, 114, 157, 193, 214, 214, 200, 180, 160, 143, 126, 115, 110, 108, 108, 107, 102, 94, 84, 77,
+  77, 85, 101, 124, 147, 167, 183, 193, 194, 185, 170, 153, 141, 134, 131, 129, 124, 116, 107, 102,
+  100, 102, 106, 110, 115, 122, 132, 143, 151, 154, 152, 147, 140, 136, 135, 135, 134, 130, 124, 118,
+  113, 110, 106, 103, 102, 102, 102, 98, 90, 79, 71, 68, 75, 97, 131, 171, 201, 213, 203, 183,
+  162, 146, 134, 124, 114, 111, 110, 110, 107, 101, 92, 82, 79, 82, 94, 115, 137, 157, 170, 180,
+  185, 183, 173, 160, 147, 137, 131, 130, 130, 127, 119, 108, 100, 97, 100, 108, 116, 122, 130, 138,
+  145, 149, 149, 145, 140, 136, 134, 137, 139, 138, 133, 124, 116, 113, 111, 110, 107, 101, 96, 90,
+  84, 78, 71, 67, 71, 90, 122, 162, 195, 212, 208, 191, 169, 150, 136, 126, 120, 115, 112, 110,
+  107, 100, 90, 79, 73, 74, 87, 109, 136, 158, 176, 185, 187, 183, 173, 160, 149, 140, 134, 133,
+  133, 130, 122, 110, 99, 94, 94, 101, 110, 119, 129, 138, 145, 150, 151, 148, 143, 138, 134, 135,
+  138, 140, 138, 130, 118, 107, 102, 102, 104, 104, 99, 90, 81, 74, 73, 74, 82, 101, 128, 164,
+  195, 211, 205, 184, 161, 143, 131, 125, 123, 121, 116, 110, 104, 99, 90, 82, 76, 78, 89, 110,
+  135, 155, 171, 179, 182, 177, 170, 159, 150, 144, 141, 139, 135, 128, 118, 106, 98, 96, 100, 106,
+  112, 119, 127, 136, 144, 147, 146, 143, 139, 137, 139, 141, 144, 142, 135, 126, 118, 111, 108, 106,
+  104, 102, 99, 93, 84, 73, 65, 63, 75, 102, 139, 178, 203, 210, 197, 177, 158, 146, 137, 129,
+  123, 118, 114, 109, 102, 92, 82, 74, 74, 82, 99, 120, 140, 157, 168, 174, 179, 175, 168, 157,
+  148, 143, 142, 141, 136, 127, 115, 104, 98, 98, 103, 110, 116, 120, 124, 130, 138, 145, 148, 147,
+  143, 140, 141, 143, 144, 140, 131, 120, 110, 107, 108, 110, 107, 101, 91, 82, 76, 74, 74, 78,
+  92, 119, 154, 186, 202, 199, 181, 162, 149, 142, 138, 134, 127, 121, 114, 109, 102, 92, 80, 73,
+  73, 85, 105, 127, 145, 160, 167, 171, 171, 168, 162, 155, 149, 146, 145, 144, 137, 128, 113, 102,
+  97, 98, 103, 110, 119, 126, 132, 135, 136, 137, 138, 138, 140, 142, 144, 144, 145, 142, 134, 125,
+  115, 108, 105, 104, 103, 98, 89, 79, 69, 65, 70, 84, 111, 145, 177, 197, 200, 188, 171, 154,
+  144, 139, 134, 130, 126, 119, 111, 101, 91, 81, 73, 75, 85, 102, 121, 137, 150, 160, 167, 171,
+  171, 165, 159, 155, 153, 152, 149, 140, 126, 111, 98, 95, 99, 105, 110, 113, 117, 122, 128, 136,
+  141, 141, 141, 142, 145, 150, 154, 150, 141, 128, 117, 112, 112, 113, 110, 102, 93, 83, 75, 72,
+  70, 72, 83, 105, 137, 171, 196, 200, 187, 169, 153, 143, 141, 141, 138, 133, 124, 116, 106, 96,
+  83, 74, 70, 77, 95, 116, 136, 148, 156, 160, 162, 161, 159, 156, 156, 156, 157, 156, 151, 140,
+  124, 108, 95, 92, 97, 105, 114, 121, 124, 126, 128, 130, 133, 138, 143, 147, 149, 150, 150, 146,
+  139, 128, 118, 111, 107, 108, 107, 101, 90, 75, 65, 61, 66, 81, 104, 136, 170, 194, 200, 189,
+  170, 154, 146, 143, 143, 142, 138, 129, 116, 102, 87, 76, 69, 68, 77, 94, 114, 132, 144, 152,
+  158, 160, 162, 161, 161, 164, 167, 167, 162, 150, 131, 112, 98, 93, 96, 102, 108, 111, 113, 116,
+  119, 126, 132, 137, 141, 145, 149, 155, 159, 157, 148, 135, 124, 118, 116, 115, 112, 105, 96, 88,
+  81, 75, 71, 70, 74, 88, 112, 143, 175, 194, 197, 185, 168, 154, 146, 143, 141, 139, 135, 127,
+  116, 103, 88, 75, 68, 69, 81, 99, 118, 134, 144, 151, 154, 154, 154, 155, 158, 162, 166, 169,
+  167, 156, 139, 118, 102, 91, 90, 100, 110, 118, 120, 119, 117, 120, 125, 132, 138, 143, 147, 150,
+  152, 153, 150, 142, 131, 122, 117, 120, 123, 120, 110, 98, 86, 78, 73, 69, 69, 73, 89, 115,
+  148, 176, 191, 191, 178, 164, 153, 149, 148, 148, 143, 136, 124, 112, 100, 87, 76, 69, 72, 84,
+  101, 118, 133, 142, 148, 153, 155, 156, 157, 159, 162, 164, 164, 159, 149, 134, 119, 105, 98, 99,
+  104, 111, 116, 119, 120, 119, 121, 124, 131, 138, 145, 148, 150, 149, 147, 145, 140, 132, 123, 118,
+  117, 120, 121, 116, 106, 93, 82, 75, 74, 76, 80, 88, 106, 133, 162, 181, 185, 173, 157, 146,
+  145, 148, 151, 149, 142, 131, 120, 109, 99, 90, 81, 79, 86, 98, 113, 126, 133, 138, 142, 147,
+  150, 152, 155, 157, 159, 159, 157, 152, 142, 131, 119, 112, 110, 110, 111, 114, 117, 120, 120, 119,
+  120, 123, 131, 139, 143, 144, 143, 141, 139, 139, 138, 132, 127, 123, 123, 125, 125, 120, 109, 97,
+  87, 85, 85, 85, 84, 85, 93, 115, 142, 167, 178, 173, 163, 154, 149, 148, 147, 144, 140, 134,
+  128, 119, 109, 98, 87, 82, 85, 96, 109, 123, 130, 134, 138, 142, 147, 151, 153, 153, 154, 156,
+  155, 151, 144, 134, 124, 118, 116, 116, 117, 117, 117, 117, 117, 117, 118, 121, 127, 133, 137, 140,
+  140, 139, 138, 136, 136, 136, 134, 133, 131, 129, 127, 124, 118, 112, 104, 96, 91, 86, 82, 82,
+  83, 91, 107, 132, 156, 172, 173, 163, 151, 144, 143, 147, 148, 148, 144, 137, 127, 116, 103, 94,
+  86, 86, 93, 106, 118, 125, 128, 130, 132, 137, 142, 145, 149, 153, 156, 155, 152, 147, 138, 128,
+  121, 120, 123, 127, 126, 122, 116, 113, 113, 117, 121, 123, 126, 130, 134, 137, 138, 136, 134, 133,
+  133, 135, 137, 137, 135, 131, 129, 127, 125, 120, 112, 103, 95, 91, 89, 89, 88, 88, 90, 102,
+  122, 146, 165, 170, 162, 152, 144, 144, 147, 149, 148, 143, 136, 128, 119, 110, 99, 91, 89, 95,
+  107, 119, 125, 127, 127, 128, 133, 138, 143, 148, 150, 151, 151, 151, 146, 140, 132, 125, 123, 124,
+  128, 128, 125, 121, 118, 116, 116, 118, 121, 124, 127, 131, 135, 136, 136, 135, 135, 133, 135, 136,
+  138, 136, 132, 128, 125, 123, 123, 120, 114, 106, 97, 90, 88, 88, 88, 90, 95, 107, 128, 149,
+  161, 160, 149, 139, 138, 145, 152, 156, 153, 146, 138, 129, 121, 113, 105, 99, 99, 104, 111, 116,
+  117, 115, 113, 116, 122, 131, 138, 144, 147, 150, 151, 150, 146, 142, 138, 137, 139, 139, 139, 134,
+  125, 116, 111, 111, 114, 117, 119, 121, 123, 127, 128, 129, 131, 133, 135, 138, 140, 142, 142, 142,
+  138, 134, 129, 125, 123, 122, 122, 120, 114, 106, 96, 88, 84, 83, 83, 86, 93, 105, 129, 153,
+  171, 172, 162, 151, 145, 147, 150, 153, 150, 143, 135, 126, 116, 106, 97, 88, 86, 91, 103, 115,
+  123, 126, 128, 132, 137, 142, 146, 150, 152, 154, 156, 154, 150, 142, 134, 125, 120, 119, 119, 119,
+  117, 119, 119, 119, 119, 119, 121, 126, 133, 137, 139, 139, 139, 138, 138, 137, 135, 131, 128, 128,
+  128, 128, 124, 115, 105, 96, 92, 91, 91, 89, 88, 93, 107, 129, 149, 162, 161, 155, 150, 148,
+  150, 149, 147, 141, 135, 131, 123, 116, 106, 94, 88, 89, 97, 108, 119, 127, 131, 135, 140, 144,
+  148, 151, 153, 153, 154, 154, 151, 145, 136, 126, 119, 115, 116, 116, 117, 117, 117, 117, 117, 118,
+  120, 125, 131, 136, 139, 141, 139, 138, 136, 136, 136, 135, 133, 131, 129, 127, 125, 120, 112, 105,
+  98, 92, 87, 83, 82, 83, 90, 104, 127, 151, 169, 175, 165, 153, 144, 143, 145, 148, 148, 145,
+  139, 130, 118, 106, 95, 87, 86, 92, 103, 115, 124, 129, 130, 132, 137, 140, 145, 150, 152, 155,
+  156, 154, 148, 139, 130, 122, 120, 123, 127, 127, 123, 117, 113, 113, 116, 120, 123, 126, 129, 133,
+  136, 138, 137, 135, 133, 133, 135, 137, 137, 135, 132, 128, 128, 126, 121, 114, 105, 97, 92, 89,
+  89, 88, 88, 89, 99, 118, 143, 162, 169, 164, 153, 145, 144, 147, 150, 148, 144, 137, 130, 121,
+  111, 101, 92, 88, 94, 105, 118, 124, 127, 126, 128, 132, 137, 143, 147, 149, 151, 151, 150, 148,
+  140, 133, 126, 123, 125, 127, 127, 125, 122, 118, 117, 116, 117, 121, 123, 127, 130, 134, 136, 136,
+  136, 134, 133, 134, 136, 138, 137, 133, 128, 126, 124, 123, 121, 115, 107, 98, 91, 87, 86, 88,
+  89, 93, 105, 126, 150, 166, 167, 157, 144, 141, 145, 149, 151, 149, 143, 135, 128, 119, 109, 100,
+  93, 92, 99, 109, 118, 123, 123, 123, 125, 130, 137, 144, 147, 149, 150, 150, 149, 144, 139, 133,
+  129, 129, 131, 132, 129, 123, 116, 111, 114, 119, 123, 123, 125, 126, 128, 131, 133, 133, 134, 135,
+  135, 136, 137, 139, 138, 135, 131, 127, 126, 126, 125, 124, 120, 113, 106, 98, 93, 90, 89, 90,
+  91, 94, 107, 126, 147, 160, 160, 152, 144, 143, 147, 152, 153, 150, 145, 137, 131, 123, 115, 104,
+  96, 94, 99, 109, 117, 121, 120, 119, 119, 124, 130, 136, 143, 147, 149, 149, 148, 146, 142, 137,
+  133, 133, 135, 135, 134, 129, 123, 118, 116, 116, 116, 117, 120, 124, 128, 130, 132, 133, 133, 133,
+  134, 136, 139, 141, 141, 138, 135, 133, 130, 127, 123, 119, 116, 113, 108, 103, 98, 94, 91, 88,
+  88, 91, 100, 115, 136, 154, 162, 158, 148, 142, 145, 152, 156, 155, 151, 145, 137, 129, 119, 108,
+  99, 94, 96, 103, 111, 117, 118, 116, 114, 119, 125, 132, 137, 141, 144, 146, 149, 150, 147, 142,
+  135, 132, 132, 136, 139, 138, 132, 123, 115, 112, 112, 116, 119, 122, 126, 129, 130, 129, 128, 128,
+  131, 135, 141, 143, 144, 141, 137, 134, 130, 129, 128, 126, 124, 123, 121, 118, 112, 104, 98, 93,
+  91, 91, 91, 92, 95, 107, 127, 147, 158, 155, 146, 139, 143, 150, 156, 157, 152, 145, 137, 131,
+  126, 119, 110, 101, 98, 100, 109, 116, 117, 116, 114, 115, 120, 126, 133, 137, 141, 142, 143, 145,
+  145, 145, 143, 139, 139, 138, 138, 136, 131, 126, 123, 121, 119, 117, 118, 119, 120, 124, 125, 127,
+  129, 130, 132, 132, 135, 138, 139, 141, 140, 138, 134, 132, 129, 126, 124, 123, 122, 121, 119, 114,
+  108, 101, 95, 92, 93, 95, 96, 97, 101, 114, 134, 152, 160, 153, 142, 138, 142, 150, 154, 152,
+  146, 139, 133, 129, 124, 119, 110, 104, 102, 108, 116, 121, 121, 117, 114, 116, 121, 127, 132, 135,
+  137, 139, 141, 142, 142, 141, 139, 137, 138, 140, 141, 137, 131, 125, 122, 122, 122, 120, 120, 120,
+  121, 122, 124, 127, 128, 128, 128, 131, 134, 137, 138, 136, 136, 135, 133, 133, 131, 129, 126, 125,
+  125, 125, 124, 122, 117, 111, 104, 101, 99, 99, 99, 97, 95, 97, 105, 122, 141, 155, 153, 143,
+  134, 136, 145, 155, 155, 151, 145, 139, 135, 130, 125, 117, 110, 106, 107, 113, 119, 121, 117, 114,
+  111, 115, 122, 129, 132, 133, 133, 135, 137, 139, 139, 139, 137, 136, 139, 142, 142, 140, 134, 127,
+  121, 119, 121, 126, 127, 125, 122, 121, 122, 124, 125, 126, 127, 129, 131, 133, 135, 135, 135, 134,
+  133, 133, 132, 132, 130, 129, 129, 127, 125, 123, 120, 117, 113, 109, 103, 97, 93, 93, 96, 100,
+  105, 113, 126, 139, 147, 144, 136, 132, 138, 149, 157, 159, 156, 147, 139, 132, 129, 126, 122, 116,
+  112, 112, 117, 120, 119, 114, 109, 109, 112, 120, 125, 127, 129, 131, 133, 133, 132, 133, 135, 138,
+  143, 148, 148, 145, 136, 129, 125, 127, 132, 134, 132, 126, 121, 119, 119, 119, 120, 121, 123, 125,
+  127, 129, 130, 130, 130, 130, 131, 134, 136, 136, 134, 133, 131, 129, 129, 129, 127, 125, 121, 114,
+  109, 107, 105, 102, 99, 96, 95, 98, 106, 121, 136, 144, 141, 132, 126, 132, 143, 154, 158, 154,
+  149, 143, 138, 134, 130, 126, 123, 120, 120, 121, 122, 121, 117, 112, 108, 110, 115, 120, 124, 125,
+  123, 124, 125, 127, 131, 133, 135, 137, 139, 143, 144, 145, 142, 136, 133, 131, 132, 134, 134, 131,
+  125, 120, 118, 117, 119, 121, 122, 122, 121, 120, 121, 125, 127, 129, 131, 132, 133, 135, 135, 135,
+  135, 133, 133, 133, 133, 132, 129, 126, 121, 117, 113, 110, 108, 105, 102, 100, 100, 102, 106, 113,
+  123, 133, 139, 137, 130, 126, 130, 140, 150, 154, 151, 145, 139, 134, 133, 133, 133, 130, 128, 126,
+  125, 125, 123, 119, 115, 113, 113, 116, 118, 120, 120, 119, 117, 119, 121, 125, 129, 132, 136, 138,
+  140, 141, 139, 138, 137, 137, 138, 139, 138, 135, 131, 125, 122, 122, 126, 128, 126, 122, 119, 118,
+  120, 122, 123, 124, 125, 125, 126, 127, 129, 130, 130, 132, 132, 133, 133, 133, 131, 130, 129, 129,
+  129, 127, 123, 116, 110, 107, 108, 110, 111, 110, 107, 107, 112, 121, 129, 133, 131, 128, 126, 131,
+  139, 144, 146, 143, 139, 137, 135, 135, 136, 135, 133, 132, 130, 128, 127, 125, 122, 120, 118, 117,
+  119, 120, 120, 119, 117, 116, 117, 121, 124, 127, 129, 130, 130, 132, 134, 136, 138, 138, 137, 136,
+  135, 135, 135, 133, 131, 128, 128, 128, 129, 129, 127, 123, 120, 120, 121, 123, 125, 125, 124, 123,
+  125, 127, 129, 129, 129, 129, 130, 131, 133, 133, 133, 130, 128, 126, 124, 122, 121, 119, 115, 110,
+  108, 108, 111, 115, 117, 118, 120, 122, 123, 123, 122, 124, 129, 136, 141, 142, 139, 136, 134, 134,
+  137, 139, 141, 139, 136, 132, 130, 128, 128, 126, 125, 123, 121, 119, 119, 119, 119, 118, 116, 116,
+  117, 120, 123, 125, 127, 128, 128, 129, 130, 132, 134, 136, 138, 138, 137, 136, 135, 135, 135, 133,
+  131, 130, 132, 131, 128, 125, 122, 123, 123, 125, 126, 124, 123, 123, 123, 125, 126, 127, 128, 128,
+  128, 129, 129, 130, 130, 130, 128, 126, 126, 125, 125, 123, 118, 112, 108, 107, 109, 111, 113, 114,
+  116, 119, 122, 123, 121, 121, 124, 129, 136, 141, 141, 139, 136, 135, 135, 138, 141, 142, 140, 136,
+  133, 132, 132, 131, 129, 126, 123, 121, 121, 122, 120, 118, 116, 114, 115, 117, 120, 122, 124, 125,
+  126, 126, 127, 129, 131, 134, 135, 136, 137, 138, 138, 137, 135, 135, 133, 133, 135, 134, 132, 129,
+  127, 125, 125, 125, 125, 125, 124, 123, 123, 123, 123, 123, 124, 125, 125, 125, 126, 127, 128, 127,
+  126, 124, 122, 121, 120, 119, 118, 116, 112, 110, 109, 112, 116, 121, 125, 127, 125, 121, 117, 121,
+  128, 136, 142, 141, 137, 133, 132, 133, 136, 140, 141, 141, 139, 135, 132, 132, 130, 129, 129, 127,
+  126, 125, 123, 121, 119, 117, 116, 118, 119, 121, 122, 122, 122, 122, 123, 125, 127, 129, 131, 132,
+  134, 135, 135, 135, 135, 136, 136, 136, 136, 136, 135, 133, 130, 128, 129, 129, 130, 129, 126, 124,
+  123, 123, 125, 125, 123, 123, 123, 123, 123, 122, 123, 123, 123, 123, 122, 121, 118, 116, 114, 114,
+  116, 117, 116, 114, 114, 117, 122, 128, 128, 125, 122, 123, 129, 136, 139, 138, 134, 130, 130, 133,
+  136, 140, 140, 137, 135, 133, 133, 133, 133, 132, 130, 128, 126, 127, 127, 125, 122, 118, 118, 120,
+  122, 122, 122, 122, 121, 122, 123, 125, 127, 129, 129, 131, 132, 130, 131, 133, 135, 135, 134, 132,
+  132, 133, 133, 132, 130, 129, 129, 130, 129, 129, 127, 124, 123, 125, 126, 126, 124, 122, 122, 122,
+  122, 123, 124, 125, 124, 122, 119, 118, 118, 119, 120, 120, 117, 114, 112, 114, 120, 127, 130, 128,
+  122, 117, 119, 127, 135, 139, 137, 132, 128, 128, 130, 133, 136, 136, 135, 133, 132, 132, 132, 133,
+  133, 132, 132, 132, 131, 129, 126, 123, 123, 125, 127, 128, 126, 124, 122, 122, 124, 125, 126, 127,
+  128, 128, 126, 125, 126, 129, 131, 132, 130, 128, 128, 129, 131, 132, 131, 130, 130, 130, 129, 128,
+  126, 126, 128, 129, 129, 129, 127, 125, 123, 124, 126, 128, 129, 128, 124, 122, 120, 120, 121, 122,
+  120, 118, 115, 113, 113, 115, 117, 122, 127, 127, 123, 118, 117, 121, 129, 135, 135, 133, 128, 125,
+  126, 131, 135, 138, 137, 136, 134, 133, 133, 135, 136, 136, 135, 133, 132, 131, 129, 127, 126, 126,
+  126, 126, 125, 123, 121, 120, 122, 123, 123, 123, 123, 122, 123, 125, 126, 127, 128, 128, 128, 128,
+  129, 132, 133, 133, 131, 129, 131, 133, 133, 135, 133, 131, 129, 129, 129, 129, 129, 129, 129, 127,
+  126, 124, 123, 123, 123, 122, 121, 120, 119, 117, 115, 113, 113, 114, 114, 114, 114, 115, 118, 122,
+  125, 123, 120, 120, 123, 129, 134, 135, 134, 130, 128, 129, 132, 136, 139, 139, 137, 135, 135, 135,
+  136, 136, 136, 136, 135, 133, 133, 131, 127, 126, 125, 126, 126, 125, 123, 121, 120, 120, 120, 122,
+  123, 123, 123, 123, 123, 122, 122, 124, 126, 130, 130, 130, 129, 129, 129, 129, 132, 133, 135, 134,
+  132, 130, 130, 129, 130, 132, 133, 132, 130, 127, 126, 125, 126, 127, 127, 125, 123, 122, 120, 120,
+  119, 117, 116, 116, 116, 115, 114, 113, 115, 119, 123, 125, 124, 120, 119, 122, 127, 131, 133, 131,
+  129, 128, 128, 130, 134, 137, 138, 136, 135, 134, 135, 135, 136, 136, 136, 135, 135, 133, 131, 128,
+  126, 126, 127, 128, 127, 125, 122, 121, 121, 123, 123, 124, 123, 122, 122, 122, 122, 124, 125, 127,
+  128, 127, 126, 126, 128, 130, 130, 130, 130, 130, 131, 132, 132, 132, 130, 130, 131, 132, 132, 130,
+  128, 128, 128, 128, 128, 128, 126, 125, 125, 123, 121, 119, 119, 119, 119, 117, 115, 113, 113, 116,
+  120, 124, 124, 122, 118, 116, 118, 125, 132, 133, 131, 128, 125, 125, 128, 134, 137, 138, 136, 133,
+  132, 133, 135, 136, 136, 136, 136, 134, 132, 130, 130, 128, 128, 128, 129, 127, 125, 122, 120, 122,
+  123, 125, 126, 124, 122, 120, 121, 122, 123, 125, 127, 127, 125, 124, 124, 128, 132, 133, 131, 128,
+  126, 129, 133, 133, 132, 130, 128, 129, 131, 132, 132, 130, 129, 129, 129, 128, 128, 128, 127, 126,
+  125, 123, 122, 120, 118, 117, 117, 117, 117, 116, 114, 113, 116, 121, 123, 122, 118, 116, 117, 124,
+  131, 133, 130, 125, 123, 126, 131, 135, 138, 137, 135, 133, 133, 135, 137, 138, 138, 136, 134, 133,
+  133, 133, 131, 127, 126, 127, 128, 127, 125, 123, 122, 122, 122, 123, 123, 122, 122, 122, 122, 122,
+  122, 124, 125, 125, 125, 126, 126, 128, 129, 129, 129, 129, 130, 130, 131, 132, 132, 132, 132, 130,
+  131, 133, 133, 134, 133, 131, 129, 128, 129, 130, 130, 128, 126, 124, 122, 120, 119, 119, 120, 118,
+  116, 112, 111, 114, 118, 120, 118, 114, 111, 114, 119, 126, 130, 130, 127, 125, 125, 129, 135, 138,
+  139, 138, 136, 135, 135, 135, 136, 136, 135, 133, 132, 132, 130, 130, 128, 126, 125, 125, 126, 126,
+  125, 123, 122, 122, 123, 125, 126, 125, 123, 123, 124, 126, 128, 129, 129, 127, 125, 125, 126, 129,
+  132, 130, 128, 125, 123, 125, 128, 130, 130, 129, 128, 128, 130, 132, 132, 131, 131, 132, 133, 133,
+  132, 132, 130, 130, 130, 129, 128, 126, 123, 121, 119, 117, 115, 113, 112, 111, 111, 110, 110, 110,
+  111, 116, 122, 129, 132, 130, 125, 124, 127, 134, 140, 143, 143, 138, 134, 133, 133, 135, 136, 135,
+  133, 131, 129, 129, 128, 127, 125, 123, 122, 123, 123, 123, 123, 122, 122, 122, 123, 124, 125, 127,
+  129, 131, 132, 132, 131, 130, 129, 130, 131, 132, 132, 131, 128, 125, 123, 124, 126, 128, 128, 126,
+  123, 123, 123, 125, 127, 128, 129, 129, 129, 129, 130, 132, 132, 132, 133, 132, 132, 131, 129, 129,
+  128, 128, 126, 124, 120, 114, 111, 110, 111, 113, 113, 111, 108, 110, 115, 122, 129, 130, 129, 126,
+  125, 130, 137, 142, 142, 140, 137, 135, 135, 135, 136, 135, 135, 133, 131, 129, 128, 126, 124, 122,
+  121, 120, 122, 122, 122, 120, 118, 117, 119, 121, 125, 128, 128, 128, 129, 131, 133, 135, 136, 136,
+  135, 133, 133, 133, 133, 133, 130, 128, 128, 128, 129, 129, 126, 123, 121, 120, 121, 123, 125, 125,
+  125, 125, 125, 127, 129, 129, 129, 129, 131, 132, 133, 133, 133, 129, 127, 125, 123, 122, 121, 118,
+  114, 109, 107, 108, 112, 115, 117, 119, 121, 123, 123, 122, 122, 125, 131, 138, 142, 142, 138, 135,
+  133, 135, 137, 139, 140, 138, 135, 132, 130, 128, 127, 126, 125, 123, 120, 119, 119, 119, 119, 117,
+  116, 116, 117, 121, 124, 126, 128, 128, 129, 129, 131, 133, 135, 137, 138, 138, 136, 136, 135, 135,
+  134, 132, 131, 131, 132, 131, 127, 125, 122, 123, 124, 126, 126, 124, 123, 123, 123, 125, 126, 128,
+  128, 128, 128, 129, 129, 130, 130, 130, 128, 126, 125, 125, 124, 122, 117, 111, 108, 108, 110, 112,
+  114, 114, 116, 120, 123, 123, 121, 121, 125, 131, 139, 142, 140, 138, 135, 135, 136, 139, 141, 142,
+  139, 135, 133, 132, 132, 130, 128, 125, 123, 121, 121, 122, 120, 118, 116, 114, 115, 117, 120, 122,
+  124, 125, 126, 126, 128, 129, 132, 135, 135, 136, 138, 138, 137, 136, 135, 134, 133, 133, 135, 134,
+  132, 129, 127, 125, 125, 125, 125, 125, 124, 123, 123, 123, 123, 123, 125, 125, 125, 125, 126, 127,
+  128, 127, 125, 123, 123, 121, 120, 119, 118, 115, 111, 109, 109, 113, 117, 121, 126, 127, 124, 119,
+  118, 122, 130, 138, 142, 140, 136, 133, 132, 133, 137, 140, 141, 141, 138, 134, 132, 131, 130, 129,
+  129, 127, 126, 124, 122, 120, 119, 117, 117, 117, 119, 121, 122, 122, 122, 122, 123, 125, 127, 129,
+  131, 133, 135, 135, 135, 135, 135, 136, 136, 137, 137, 136, 135, 132, 130, 128, 129, 130, 130, 129,
+  125, 123, 123, 124, 125, 125, 123, 123, 123, 123, 122, 123, 123, 123, 123, 123, 122, 120, 117, 115,
+  113, 114, 116, 117, 116, 114, 115, 118, 123, 128, 128, 123, 122, 124, 131, 137, 139, 137, 133, 130,
+  130, 133, 137, 140, 139, 136, 134, 133, 133, 133, 133, 132, 130, 128, 126, 128, 127, 125, 121, 118,
+  118, 120, 122, 122, 122, 120, 121, 122, 123, 125, 127, 129, 130, 132, 132, 130, 131, 133, 135, 135,
+  134, 132, 133, 133, 133, 131, 130, 129, 129, 130, 129, 129, 126, 123, 123, 125, 126, 126, 124, 122,
+  122, 122, 122, 123, 125, 125, 123, 121, 119, 117, 119, 119, 120, 120, 116, 113, 111, 115, 122, 128,
+  130, 127, 120, 117, 121, 128, 136, 139, 135, 131, 128, 128, 130, 134, 136, 136, 135, 133, 132, 132,
+  132, 133, 132, 132, 132, 132, 130, 128, 125, 123, 124, 125, 127, 127, 125, 123, 122, 122, 124, 125,
+  126, 127, 128, 127, 125, 125, 127, 130, 132, 132, 130, 128, 128, 129, 131, 132, 130, 130, 130, 130,
+  128, 128, 126, 127, 129, 129, 129, 128, 126, 124, 123, 124, 126, 128, 129, 127, 124, 121, 120, 120,
+  121, 122, 120, 117, 114, 113, 113, 115, 117, 123, 127, 126, 122, 117, 117, 123, 130, 136, 135, 132,
+  127, 125, 127, 132, 136, 138, 137, 135, 133, 133, 133, 135, 136, 136, 135, 133, 132, 131, 129, 127,
+  126, 126, 126, 126, 125, 123, 121, 120, 122, 123, 123, 123, 122, 123, 123, 125, 126, 127, 128, 128,
+  128, 128, 131, 133, 133, 133, 131, 130, 131, 133, 133, 134, 133, 131, 129, 129, 129, 129, 129, 129,
+  129, 127, 125, 123, 123, 123, 123, 122, 121, 120, 119, 117, 115, 113, 114, 114, 114, 114, 114, 115,
+  119, 123, 125, 123, 120, 120, 124, 130, 134, 135, 133, 130, 129, 129, 133, 137, 139, 139, 137, 135,
+  135, 135, 135, 136, 136, 135, 135, 133, 132, 130, 127, 125, 125, 126, 126, 125, 123, 121, 120, 120,
+  121, 122, 123, 123, 123, 123, 123, 122, 122, 125, 127, 130, 130, 130, 129, 129, 129, 130, 133, 134,
+  135, 134, 132, 130, 129, 129, 131, 133, 133, 132, 130, 127, 126, 125, 127, 128, 127, 125, 122, 121,
+  120, 120, 118, 116, 116, 116, 116, 115, 114, 113, 116, 120, 123, 125, 123, 120, 119, 122, 128, 132,
+  132, 130, 129, 128, 129, 131, 135, 138, 138, 136, 135, 133, 135, 136, 136, 136, 136, 135, 135, 133,
+  131, 127, 126, 126, 128, 128, 127, 125, 122, 121, 121, 123, 124, 123, 123, 122, 122, 122, 122, 124,
+  126, 128, 128, 126, 126, 127, 129, 130, 130, 130, 130, 130, 131, 132, 132, 131, 129, 130, 131, 132,
+  132, 130, 128, 128, 128, 128, 128, 127, 126, 125, 124, 122, 121, 119, 119, 119, 119, 117, 115, 113,
+  113, 117, 121, 125, 124, 121, 117, 116, 120, 127, 132, 133, 131, 126, 125, 126, 129, 134, 137, 138,
+  136, 133, 132, 134, 136, 136, 136, 136, 135, 133, 131, 130, 129, 128, 128, 129, 129, 127, 125, 122,
+  121, 122, 123, 125, 125, 123, 121, 120, 121, 122, 124, 126, 128, 127, 125, 123, 125, 129, 133, 133,
+  131, 127, 126, 130, 133, 133, 131, 130, 128, 129, 131, 132, 132, 130, 129, 129, 129, 128, 128, 128,
+  127, 126, 124, 122, 122, 120, 118, 117, 117, 117, 116, 116, 114, 114, 117, 122, 123, 121, 117, 116,
+  119, 126, 131, 133, 129, 124, 124, 127, 132, 136, 138, 136, 134, 133, 133, 135, 137, 138, 138, 136,
+  134, 133, 133, 132, 130, 127, 126, 127, 128, 127, 125, 123, 122, 122, 122, 123, 123, 122, 122, 122,
+  122, 122, 122, 124, 125, 125, 125, 126, 127, 128, 129, 129, 129, 129, 130, 130, 132, 132, 132, 132,
+  132, 131, 131, 133, 134, 134, 132, 130, 128, 128, 129, 130, 129, 128, 126, 123, 120, 119, 119, 119,
+  119, 117, 115, 111, 112, 116, 120, 122, 120, 116, 114, 116, 122, 128, 130, 128, 125, 124, 125, 129,
+  133, 136, 136, 136, 134, 133, 135, 136, 137, 138, 137, 135, 135, 133, 133, 132, 130, 129, 129, 129,
+  129, 128, 125, 123, 122, 122, 123, 124, 123, 121, 119, 119, 119, 121, 123, 124, 125, 124, 122, 122,
+  124, 128, 131, 131, 129, 126, 126, 128, 132, 135, 134, 131, 130, 131, 133, 135, 133, 132, 132, 132,
+  133, 132, 130, 130, 129, 128, 128, 126, 125, 123, 121, 119, 117, 116, 116, 116, 116, 116, 117, 117,
+  116, 114, 115, 117, 121, 125, 127, 125, 123, 122, 124, 128, 133, 136, 136, 134, 132, 132, 134, 137,
+  139, 141, 139, 136, 133, 133, 134, 135, 135, 133, 131, 129, 127, 126, 126, 126, 126, 125, 123, 122,
+  120, 120, 121, 122, 122, 121, 120, 120, 121, 122, 122, 123, 124, 126, 126, 126, 126, 126, 128, 130,
+  130, 132, 131, 130, 131, 132, 133, 135, 136, 135, 133, 132, 132, 133, 134, 134, 132, 130, 128, 128,
+  126, 125, 125, 123, 121, 119, 116, 114, 114, 117, 119, 119, 116, 114, 113, 114, 117, 122, 124, 125,
+  123, 121, 121, 124, 127, 131, 133, 133, 132, 130, 131, 133, 136, 138, 138, 138, 136, 135, 134, 133,
+  133, 133, 133, 133, 133, 129, 128, 127, 126, 126, 126, 126, 125, 123, 121, 119, 119, 119, 121, 122,
+  122, 122, 120, 119, 120, 123, 125, 128, 126, 125, 125, 126, 128, 130, 130, 132, 132, 132, 133, 133,
+  133, 133, 135, 136, 136, 136, 134, 132, 132, 132, 132, 132, 130, 128, 126, 123, 122, 122, 120, 118,
+  117, 116, 116, 117, 117, 115, 113, 113, 114, 118, 121, 123, 123, 121, 119, 119, 123, 127, 131, 132,
+  132, 130, 129, 130, 133, 137, 139, 138, 136, 135, 135, 135, 136, 136, 135, 134, 132, 130, 129, 129,
+  129, 129, 128, 126, 124, 123, 122, 122, 122, 122, 122, 121, 120, 119, 119, 119, 120, 120, 122, 122,
+  122, 123, 123, 124, 125, 127, 128, 129, 130, 130, 132, 133, 134, 133, 133, 133, 135, 136, 136, 136,
+  135, 134, 133, 133, 133, 132, 132, 130, 128, 126, 124, 122, 120, 120, 119, 119, 117, 117, 117, 117,
+  115, 113, 114, 116, 119, 121, 121, 120, 118, 117, 121, 125, 129, 130, 130, 129, 128, 130, 132, 135,
+  136, 136, 135, 135, 135, 135, 135, 136, 136, 135, 134, 132, 132, 130, 130, 130, 130, 128, 126, 124,
+  123, 123, 123, 122, 122, 122, 120, 119, 119, 119, 119, 120, 122, 122, 122, 122, 122, 123, 125, 126,
+  128, 129, 129, 129, 130, 132, 133, 134, 135, 135, 135, 135, 135, 136, 136, 136, 135, 134, 133, 132,
+  132, 132, 130, 128, 126, 124, 123, 122, 120, 119, 118, 117, 119, 118, 117, 115, 114, 114, 115,
+};
+
+//===============================================================
+// Every clip ends where the next one starts, the last one at the
+// end of the data, with the clip size of the decoder
+//===============================================================
+static_assert(SoundBankClips[SoundClip_Hey].Offset + SoundClipSize(SoundBankClips[SoundClip_Hey]) == SoundBankClips[SoundClip_GoAway].Offset, "Hey: clip table does not match the sound data");
+static_assert(SoundBankClips[SoundClip_GoAway].Offset + SoundClipSize(SoundBankClips[SoundClip_GoAway]) == sizeof(SoundBankData), "GoAway: clip table does not match the sound data");
+
+#endif
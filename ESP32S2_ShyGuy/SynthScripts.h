@@ -0,0 +1,87 @@
+/**
+ * Synthesizer scripts of procedural sound effects
+ *
+ * @author    Florian Staeblein
+ * @date      2026/10/18
+ * @copyright © 2026 Florian Staeblein
+ *
+ * ==============================================================
+ *
+ * Every effect is a short note list rendered by XT_Synth_Class,
+ * a few dozen bytes of flash instead of kilobytes of samples.
+ * Notes: MIDI note, glide target (0 = none), length in 10 ms,
+ * waveform. A note 0 is a rest.
+ *
+ * ==============================================================
+ */
+
+#ifndef SYNTHSCRIPTS_H
+#define SYNTHSCRIPTS_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <Arduino.h>
+#include "XT_DAC_Audio.h"
+
+
+//===============================================================
+// Door creak, rough low glides alternating with pitched noise
+//===============================================================
+const SynthNote SynthCreakNotes[] =
+{
+  { 45, 50, 12, SynthWave_Saw },
+  { 50, 47,  8, SynthWave_Noise },
+  { 47, 55, 15, SynthWave_Saw },
+  { 55, 52, 10, SynthWave_Noise },
+  { 52, 58, 18, SynthWave_Saw },
+};
+
+const SynthScript SynthCreak =
+{
+  SynthCreakNotes, sizeof(SynthCreakNotes) / sizeof(SynthNote),
+  5, 40, 160, 15,   // Attack, decay, sustain, release
+  180               // Volume
+};
+
+//===============================================================
+// Giggle, three short rising "hee" falling in pitch
+//===============================================================
+const SynthNote SynthGiggleNotes[] =
+{
+  { 81, 84, 6, SynthWave_Triangle },
+  {  0,  0, 4, SynthWave_Triangle },
+  { 79, 83, 6, SynthWave_Triangle },
+  {  0,  0, 4, SynthWave_Triangle },
+  { 77, 81, 6, SynthWave_Triangle },
+  {  0,  0, 4, SynthWave_Triangle },
+  { 74, 79, 8, SynthWave_Triangle },
+};
+
+const SynthScript SynthGiggle =
+{
+  SynthGiggleNotes, sizeof(SynthGiggleNotes) / sizeof(SynthNote),
+  3, 20, 180, 20,   // Attack, decay, sustain, release
+  200               // Volume
+};
+
+//===============================================================
+// Alarm chirp, three fast upward square sweeps
+//===============================================================
+const SynthNote SynthChirpNotes[] =
+{
+  { 84, 96, 8, SynthWave_Square },
+  {  0,  0, 4, SynthWave_Square },
+  { 84, 96, 8, SynthWave_Square },
+  {  0,  0, 4, SynthWave_Square },
+  { 84, 96, 8, SynthWave_Square },
+};
+
+const SynthScript SynthChirp =
+{
+  SynthChirpNotes, sizeof(SynthChirpNotes) / sizeof(SynthNote),
+  2, 10, 200, 10,   // Attack, decay, sustain, release
+  140               // Volume
+};
+
+#endif
@@ -0,0 +1,125 @@
+/**
+ * Accelerometer trace capture over the serial port
+ *
+ * @author    Florian Staeblein
+ * @date      2026/10/18
+ * @copyright © 2026 Florian Staeblein
+ */
+
+//===============================================================
+// Includes
+//===============================================================
+#include "TraceCapture.h"
+
+
+//===============================================================
+// Constructor
+//===============================================================
+TraceCapture::TraceCapture(Stream* stream)
+{
+  _stream = stream;
+}
+
+//===============================================================
+// Starts the capture and sends the header
+//===============================================================
+void TraceCapture::Start(uint16_t sampleRate)
+{
+  uint8_t payload[3] = { (uint8_t)sampleRate, (uint8_t)(sampleRate >> 8), TRACE_VERSION };
+  Frames = 0;
+  Dropped = 0;
+  _running = true;
+  WriteFrame(TRACE_TYPE_HEADER, payload, sizeof(payload));
+}
+
+//===============================================================
+// Stops the capture
+//===============================================================
+void TraceCapture::Stop()
+{
+  _running = false;
+}
+
+//===============================================================
+// Returns true while capturing
+//===============================================================
+bool TraceCapture::IsRunning()
+{
+  return _running;
+}
+
+//===============================================================
+// Sends a sample frame, dropped instead of blocking if the port
+// is busy
+//===============================================================
+void TraceCapture::WriteSamples(const RawSample* samples, uint8_t count, uint32_t timeMs, uint8_t flags)
+{
+  if (!_running ||
+    count == 0)
+  {
+    return;
+  }
+
+  count = min(count, (uint8_t)ADXL345_FIFO_SIZE);
+  uint8_t payload[6 + ADXL345_FIFO_SIZE * 6];
+  uint8_t length = 0;
+  payload[length++] = timeMs;
+  payload[length++] = timeMs >> 8;
+  payload[length++] = timeMs >> 16;
+  payload[length++] = timeMs >> 24;
+  payload[length++] = flags;
+  payload[length++] = count;
+  for (uint8_t index = 0; index < count; index++)
+  {
+    payload[length++] = samples[index].XAxis;
+    payload[length++] = samples[index].XAxis >> 8;
+    payload[length++] = samples[index].YAxis;
+    payload[length++] = samples[index].YAxis >> 8;
+    payload[length++] = samples[index].ZAxis;
+    payload[length++] = samples[index].ZAxis >> 8;
+  }
+  WriteFrame(TRACE_TYPE_SAMPLES, payload, length);
+}
+
+//===============================================================
+// Packs the activities into TRACE_FLAG_* bits
+//===============================================================
+uint8_t TraceCapture::PackActivites(const Activites& activities)
+{
+  return (activities.isTap ? TRACE_FLAG_TAP : 0) |
+    (activities.isDoubleTap ? TRACE_FLAG_DOUBLE_TAP : 0) |
+    (activities.isActivity ? TRACE_FLAG_ACTIVITY : 0) |
+    (activities.isInactivity ? TRACE_FLAG_INACTIVITY : 0) |
+    (activities.isFreeFall ? TRACE_FLAG_FREE_FALL : 0) |
+    (activities.isWatermark ? TRACE_FLAG_WATERMARK : 0) |
+    (activities.isOverrun ? TRACE_FLAG_OVERRUN : 0);
+}
+
+//===============================================================
+// Frames and sends a payload, returns false if it was dropped
+//===============================================================
+bool TraceCapture::WriteFrame(uint8_t type, const uint8_t* payload, uint8_t length)
+{
+  // The whole frame or nothing, a partial frame would cost the recorder a resync
+  uint16_t size = length + 4;
+  if (_stream->availableForWrite() < size)
+  {
+    Dropped++;
+    return false;
+  }
+
+  uint8_t checksum = type + length;
+  _frame[0] = TRACE_SYNC;
+  _frame[1] = type;
+  _frame[2] = length;
+  for (uint8_t index = 0; index < length; index++)
+  {
+    _frame[3 + index] = payload[index];
+    checksum += payload[index];
+  }
+  _frame[3 + length] = checksum;
+
+  _stream->write(_frame, size);
+  Frames++;
+  return true;
+}
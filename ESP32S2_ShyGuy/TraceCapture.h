@@ -0,0 +1,93 @@
+/**
+ * Accelerometer trace capture over the serial port
+ *
+ * @author    Florian Staeblein
+ * @date      2026/10/18
+ * @copyright © 2026 Florian Staeblein
+ *
+ * ==============================================================
+ *
+ * Streams raw FIFO samples and the activity flags of the ADXL345
+ * in binary frames, recorded on the host by
+ * Tools/TraceRecorder.py. The frames can be mixed with the text
+ * output of the sketch, the sync byte never occurs in text.
+ *
+ * Frame: sync (0xA5), type, payload length, payload, checksum
+ * (sum of type, length and payload bytes, modulo 256).
+ * All values are little endian.
+ *
+ * Types:
+ *   'H' Header, sent on start:  sample rate (uint16), version (uint8)
+ *   'S' Samples:                time of the last sample in ms (uint32),
+ *                               activity flags (uint8, TRACE_FLAG_*),
+ *                               count (uint8), count x X, Y, Z (int16)
+ *
+ * ==============================================================
+ */
+
+#ifndef TRACECAPTURE_H
+#define TRACECAPTURE_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <Arduino.h>
+#include "ADXL345.h"
+
+
+//===============================================================
+// Defines
+//===============================================================
+#define TRACE_SYNC              0xA5
+#define TRACE_VERSION           1
+#define TRACE_TYPE_HEADER       'H'
+#define TRACE_TYPE_SAMPLES      'S'
+#define TRACE_FRAME_MAX         (3 + 6 + ADXL345_FIFO_SIZE * 6 + 1)
+
+// Activity flags of a sample frame
+#define TRACE_FLAG_TAP          0x01
+#define TRACE_FLAG_DOUBLE_TAP   0x02
+#define TRACE_FLAG_ACTIVITY     0x04
+#define TRACE_FLAG_INACTIVITY   0x08
+#define TRACE_FLAG_FREE_FALL    0x10
+#define TRACE_FLAG_WATERMARK    0x20
+#define TRACE_FLAG_OVERRUN      0x40
+
+
+//===============================================================
+// Trace capture class
+//===============================================================
+class TraceCapture
+{
+  public:
+    // Constructor
+    TraceCapture(Stream* stream);
+
+    // Starts the capture and sends the header
+    void Start(uint16_t sampleRate);
+
+    // Stops the capture
+    void Stop();
+
+    // Returns true while capturing
+    bool IsRunning();
+
+    // Sends a sample frame, dropped instead of blocking if the port is busy
+    void WriteSamples(const RawSample* samples, uint8_t count, uint32_t timeMs, uint8_t flags);
+
+    // Packs the activities into TRACE_FLAG_* bits
+    static uint8_t PackActivites(const Activites& activities);
+
+    uint32_t Frames = 0;                // Sent frames
+    uint32_t Dropped = 0;               // Frames dropped on a busy port
+
+  private:
+    Stream* _stream;
+    bool _running = false;
+    uint8_t _frame[TRACE_FRAME_MAX];
+
+    // Frames and sends a payload, returns false if it was dropped
+    bool WriteFrame(uint8_t type, const uint8_t* payload, uint8_t length);
+};
+
+#endif
@@ -25,12 +25,31 @@
 uint32_t NextFillPos = 0;					// position in buffer of next byte to fill
 int32_t NextPlayPos = 0;					// position in buffer of next byte to play
 int32_t EndFillPos = BUFFER_SIZE;	// position in buffer of last byte+1 that can be filled
-uint8_t LastDacValue;							// Next Idx pos in buffer to send to DAC
+uint8_t LastDacValue;							// Last value sent to the DAC
+uint8_t PlayValue = 0x7f;         // Last value taken from the buffer, before the fade envelope
 uint8_t Buffer[BUFFER_SIZE];			// The buffer to store the data that will be sent to the 
 uint8_t _dacPin;                   // pin to send DAC data to, presumably one of the DAC pins!
-XT_Wav_Class *playItem = 0;       // Play item to play
-uint16_t BufferUsedCount = 0;			// how much buffer used since last buffer fill
+MixerVoice Voices[MIXER_VOICES];  // Mixer voices, filled into the buffer by FillBuffer
+volatile bool Playing = false;    // At least one voice has a clip to play
+uint32_t MixCyclesPerSample = 0;  // Smoothed CPU cycles per mixed sample (8 bit fraction)
 bool _enabled = false;            // Only plays if enabled
+bool _pinAttached = false;        // DAC pin is in analog mode
+volatile int32_t FadeLevel = 0;   // Click suppression envelope, FADE_LEVEL_MAX = 1.0
+volatile int8_t FadeDirection = 0;// 1 = fade in, -1 = fade out, 0 = idle
+volatile bool FadeDone = true;    // Last fade has finished
+
+// Telemetry, counters of the ISR are only written by the ISR
+volatile uint32_t Underruns = 0;
+volatile uint32_t SamplesDropped = 0;
+volatile uint32_t IsrCalls = 0;
+volatile uint32_t IsrCyclesMax = 0;
+volatile uint32_t IsrHistogram[ISR_HISTOGRAM_BINS];
+bool IsrStarved = false;          // Last ISR call found no data while playing
+uint32_t OccupancyMin = UINT32_MAX;
+uint32_t OccupancyMax = 0;
+uint64_t OccupancySum = 0;
+uint32_t Fills = 0;
+portMUX_TYPE TelemetryMux = portMUX_INITIALIZER_UNLOCKED;
 
 // because of the difficulty in passing parameters to interrupt handlers we have a global
 // object of this type that points to the object the user creates.
@@ -38,6 +57,7 @@ XT_DAC_Audio_Class *XTDacAudioClassGlobalObject;
 
 // Timer variable
 hw_timer_t * timer = NULL;
+bool _timerRunning = false;       // Output timer is started, stopped while the output is idle
 
 //===============================================================
 // The main interrupt routine called 50,000 times per second
@@ -48,20 +68,13 @@ void IRAM_ATTR onTimer()
   {
     return;
   }
+  uint32_t startCycles = ESP.getCycleCount();
 
 	// Sound playing code, plays whatevers in the buffer.
   // If not up against the next fill position then valid data to play
 	if (NextPlayPos != NextFillPos)
 	{
-    // Send value to DAC only of changed since last value else no need
-		if (LastDacValue != Buffer[NextPlayPos])
-		{
-			// value to DAC has changed, send to actual hardware, else we just leave setting as is as it's not changed
-			LastDacValue = Buffer[NextPlayPos];
-
-      // Write out the data
-			dacWrite(_dacPin, LastDacValue);
-		}
+		PlayValue = Buffer[NextPlayPos];
 
     // Move play pos to next byte in buffer
 		NextPlayPos++;
@@ -82,30 +95,148 @@ void IRAM_ATTR onTimer()
       // BUFFER_SIZE (we can fill up to one less than this)
       EndFillPos = BUFFER_SIZE;
     }
+    IsrStarved = false;
 	}
+  else if (Playing)
+  {
+    // Buffer ran empty while a clip plays, the DAC holds the last value
+    SamplesDropped++;
+    if (!IsrStarved)
+    {
+      Underruns++;
+      IsrStarved = true;
+    }
+  }
 
-  // sounds in Q
-	if (playItem != 0)
-	{
-    BufferUsedCount++;
+  // Click suppression envelope, ramps the output between zero and the played value
+  uint8_t value = PlayValue;
+  if (FadeDirection != 0)
+  {
+    FadeLevel += FadeDirection * FADE_STEP;
+    if (FadeLevel >= FADE_LEVEL_MAX)
+    {
+      FadeLevel = FADE_LEVEL_MAX;
+      FadeDirection = 0;
+      FadeDone = true;
+    }
+    else if (FadeLevel <= 0)
+    {
+      // Faded out, stop output until enabled again
+      FadeLevel = 0;
+      FadeDirection = 0;
+      FadeDone = true;
+      _enabled = false;
+    }
+    value = ((uint32_t)PlayValue * FadeLevel) >> 16;
+  }
+
+  // Send value to DAC only of changed since last value else no need
+  if (LastDacValue != value)
+  {
+    // value to DAC has changed, send to actual hardware, else we just leave setting as is as it's not changed
+    LastDacValue = value;
+
+    // Write out the data
+    dacWrite(_dacPin, LastDacValue);
   }
+
+  // Cost of this call, binned by powers of two
+  uint32_t cycles = ESP.getCycleCount() - startCycles;
+  int8_t bin = cycles == 0 ? 0 : (31 - __builtin_clz(cycles)) - (ISR_HISTOGRAM_BASE - 1);
+  IsrHistogram[constrain(bin, 0, ISR_HISTOGRAM_BINS - 1)]++;
+  if (cycles > IsrCyclesMax)
+  {
+    IsrCyclesMax = cycles;
+  }
+  IsrCalls++;
 }
 
 
+//===============================================================
+// IMA-ADPCM tables
+//===============================================================
+const int8_t AdpcmIndexTable[16] =
+{
+  -1, -1, -1, -1, 2, 4, 6, 8,
+  -1, -1, -1, -1, 2, 4, 6, 8
+};
+
+const int16_t AdpcmStepTable[89] =
+{
+  7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+  19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+  50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+  130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+  337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+  876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+  2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+  5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+  15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+
 //===============================================================
 // Constructor
 //===============================================================
-XT_Wav_Class::XT_Wav_Class(unsigned char *WavData, uint32_t datasize)
+XT_Wav_Class::XT_Wav_Class(const uint8_t *BankData, const SoundClip &Clip)
 {
-  // Create a new wav class object
-  SampleRate = (WavData[25] * 256) + WavData[24];
-  DataSize = datasize; //(WavData[42] * 65536) + (WavData[41] * 256) + WavData[40] + 44;
+  // Create a new wav class object, the samples stay in flash
+  SampleRate = Clip.SampleRate;
+  DataSize = Clip.Length;
+  Format = Clip.Format;
   IncreaseBy = float(SampleRate) / 50000;
-  Data = WavData;
+  Data = BankData + Clip.Offset;
+  Completed = true;
+  Rewind();
+}
+
+//===============================================================
+// Rewinds the clip to the first sample
+//===============================================================
+void XT_Wav_Class::Rewind()
+{
   Count = 0;
   LastIntCount = 0;
-  DataIdx = 44;
-  Completed = true;
+  DataIdx = 0;
+  LastValue = DecodeSample();
+}
+
+//===============================================================
+// Decodes the sample at DataIdx, must be called in sample order
+//===============================================================
+uint8_t XT_Wav_Class::DecodeSample()
+{
+  if (Format == SoundFormat_PCM8)
+  {
+    return Data[DataIdx];
+  }
+
+  // First sample is the predictor of the header
+  if (DataIdx == 0)
+  {
+    _adpcmPredictor = (int16_t)(Data[0] | (Data[1] << 8));
+    _adpcmStepIndex = min((uint8_t)88, Data[2]);
+    return (_adpcmPredictor >> 8) + 128;
+  }
+
+  // Every further sample is one nibble, low nibble first
+  uint32_t nibbleIdx = DataIdx - 1;
+  uint8_t code = Data[ADPCM_HEADER_SIZE + (nibbleIdx >> 1)];
+  code = (nibbleIdx & 1) ? (code >> 4) : (code & 0x0f);
+
+  // Standard IMA-ADPCM expansion: diff = (code + 0.5) * step / 4
+  int32_t step = AdpcmStepTable[_adpcmStepIndex];
+  int32_t diff = step >> 3;
+  if (code & 4) diff += step;
+  if (code & 2) diff += step >> 1;
+  if (code & 1) diff += step >> 2;
+  _adpcmPredictor += (code & 8) ? -diff : diff;
+  _adpcmPredictor = constrain(_adpcmPredictor, -32768, 32767);
+
+  _adpcmStepIndex += AdpcmIndexTable[code];
+  _adpcmStepIndex = constrain(_adpcmStepIndex, 0, 88);
+
+  return (_adpcmPredictor >> 8) + 128;
 }
 
 //===============================================================
@@ -120,7 +251,7 @@ uint8_t IRAM_ATTR XT_Wav_Class::NextByte()
 	// Note it is up to the calling routine to check if this WAV file has NOT completed playing
 	// before calling. If you call it and it has completed playing then it will always return
 	// 0x7F (speaker mid point).
-	uint16_t IntPartOfCount;
+	int32_t IntPartOfCount;
 	uint8_t ReturnValue;
 	
 	if (Completed)
@@ -131,28 +262,420 @@ uint8_t IRAM_ATTR XT_Wav_Class::NextByte()
 	// increase the counter, if it goes to a new integer digit then write to DAC
 	Count += IncreaseBy; 
 	IntPartOfCount = floor(Count);
-	ReturnValue = Data[DataIdx];				// by default we return previous value; 
+	ReturnValue = LastValue;				// by default we return the current sample
 	
 	if (IntPartOfCount > LastIntCount)
 	{   
 		// gone to a new integer of count, we need to send a new value to the DAC 
 		LastIntCount = IntPartOfCount; // crashes on this line with panic
-		ReturnValue = Data[DataIdx];
 		DataIdx++;
 
     // End of data, flag end
 		if (DataIdx >= DataSize)
 		{
-			Count = 0;				// reset frequency counter
-			DataIdx = 44;			// reset data pointer back to beginning of WAV data
 			Completed = true; // mark as completed
+			Rewind();         // reset counter and data pointer back to beginning of clip data
 		}
+    else
+    {
+      // Expand the next sample, at most one decode per output byte
+      LastValue = DecodeSample();
+    }
 	}
 	
 	return ReturnValue;
 }
 
 
+//===============================================================
+// Constructor
+//===============================================================
+XT_SpiffsWav_Class::XT_SpiffsWav_Class(const char *Path)
+{
+  Open(Path);
+}
+
+//===============================================================
+// Destructor
+//===============================================================
+XT_SpiffsWav_Class::~XT_SpiffsWav_Class()
+{
+  if (_file)
+  {
+    _file.close();
+  }
+}
+
+//===============================================================
+// Opens another WAV file, returns false if it is missing or not 8 bit mono PCM
+//===============================================================
+bool XT_SpiffsWav_Class::Open(const char *Path)
+{
+  if (_file)
+  {
+    _file.close();
+  }
+  Completed = true;
+  DataSize = 0;
+  Format = SoundFormat_PCM8;
+
+  _file = SPIFFS.open(Path, "r");
+  if (!_file)
+  {
+    return false;
+  }
+
+  // RIFF header
+  uint8_t header[12];
+  if (_file.read(header, 12) != 12 ||
+    memcmp(header, "RIFF", 4) != 0 ||
+    memcmp(header + 8, "WAVE", 4) != 0)
+  {
+    _file.close();
+    return false;
+  }
+
+  // Walk the chunks until the data chunk, the fmt chunk comes first
+  bool formatValid = false;
+  uint8_t chunkHeader[8];
+  while (_file.read(chunkHeader, 8) == 8)
+  {
+    uint32_t chunkSize = chunkHeader[4] | (chunkHeader[5] << 8) | (chunkHeader[6] << 16) | ((uint32_t)chunkHeader[7] << 24);
+    if (memcmp(chunkHeader, "fmt ", 4) == 0 && chunkSize >= 16)
+    {
+      uint8_t fmt[16];
+      if (_file.read(fmt, 16) != 16)
+      {
+        break;
+      }
+      uint16_t audioFormat = fmt[0] | (fmt[1] << 8);
+      uint16_t channels = fmt[2] | (fmt[3] << 8);
+      uint32_t sampleRate = fmt[4] | (fmt[5] << 8) | (fmt[6] << 16) | ((uint32_t)fmt[7] << 24);
+      uint16_t bitsPerSample = fmt[14] | (fmt[15] << 8);
+      formatValid = audioFormat == 1 && channels == 1 && bitsPerSample == 8 && sampleRate > 0 && sampleRate <= 50000;
+      SampleRate = sampleRate;
+      _file.seek(_file.position() + chunkSize - 16 + (chunkSize & 1));
+    }
+    else if (memcmp(chunkHeader, "data", 4) == 0)
+    {
+      if (formatValid)
+      {
+        DataSize = min(chunkSize, (uint32_t)(_file.size() - _file.position()));
+        _dataStart = _file.position();
+      }
+      break;
+    }
+    else
+    {
+      // Chunks are padded to an even size
+      _file.seek(_file.position() + chunkSize + (chunkSize & 1));
+    }
+  }
+
+  if (DataSize == 0)
+  {
+    _file.close();
+    return false;
+  }
+
+  IncreaseBy = float(SampleRate) / 50000;
+
+  // A cold start or a late loop refills the whole ring in one fill, the read-ahead has to hold it
+  _refill = min((uint32_t)STREAM_CHUNK_MAX, (uint32_t)((uint64_t)BUFFER_SIZE * SampleRate / 50000) + 1);
+  _readAhead = _refill;
+  _consumedAvg = 0;
+  Rewind();
+  return true;
+}
+
+//===============================================================
+// Returns true if a valid WAV file is open
+//===============================================================
+bool XT_SpiffsWav_Class::IsOpen()
+{
+  return _file && DataSize > 0;
+}
+
+//===============================================================
+// Rewinds the clip to the first sample
+//===============================================================
+void XT_SpiffsWav_Class::Rewind()
+{
+  _chunkLength = 0;
+  _chunkPos = 0;
+  _consumed = 0;
+  if (_file)
+  {
+    _file.seek(_dataStart);
+    ReadChunk(_readAhead);
+  }
+  XT_Wav_Class::Rewind();
+}
+
+//===============================================================
+// Refills the read-ahead, sized from the samples consumed per fill
+//===============================================================
+void XT_SpiffsWav_Class::Prefetch()
+{
+  if (Completed || !_file)
+  {
+    return;
+  }
+
+  // Smooth the consumption of the last fill and keep twice of it buffered,
+  // so the next fill normally never touches the file
+  _consumedAvg = (_consumedAvg * 3 + _consumed) / 4;
+  _consumed = 0;
+  _readAhead = constrain(_consumedAvg * 2, _refill, STREAM_CHUNK_MAX);
+
+  if (_chunkLength - _chunkPos < _readAhead)
+  {
+    ReadChunk(_readAhead);
+  }
+}
+
+//===============================================================
+// Reads from file until the read-ahead holds at least the given bytes
+//===============================================================
+void XT_SpiffsWav_Class::ReadChunk(uint16_t bytes)
+{
+  // Move the remaining bytes to the front
+  uint16_t remaining = _chunkLength - _chunkPos;
+  memmove(_chunk, _chunk + _chunkPos, remaining);
+  _chunkPos = 0;
+  _chunkLength = remaining;
+
+  if (remaining < bytes)
+  {
+    _chunkLength += _file.read(_chunk + remaining, bytes - remaining);
+  }
+}
+
+//===============================================================
+// Returns the next sample of the read-ahead
+//===============================================================
+uint8_t XT_SpiffsWav_Class::DecodeSample()
+{
+  if (_chunkPos >= _chunkLength)
+  {
+    // Read-ahead ran dry inside the fill loop
+    Stalls++;
+    ReadChunk(_readAhead);
+    if (_chunkPos >= _chunkLength)
+    {
+      return 0x7f;
+    }
+  }
+  _consumed++;
+  return _chunk[_chunkPos++];
+}
+
+
+//===============================================================
+// Synthesizer sine wavetable, one period
+//===============================================================
+const int8_t SynthSineTable[256] =
+{
+  0, 3, 6, 9, 12, 16, 19, 22, 25, 28, 31, 34, 37, 40, 43, 46,
+  49, 51, 54, 57, 60, 63, 65, 68, 71, 73, 76, 78, 81, 83, 85, 88,
+  90, 92, 94, 96, 98, 100, 102, 104, 106, 107, 109, 111, 112, 113, 115, 116,
+  117, 118, 120, 121, 122, 122, 123, 124, 125, 125, 126, 126, 126, 127, 127, 127,
+  127, 127, 127, 127, 126, 126, 126, 125, 125, 124, 123, 122, 122, 121, 120, 118,
+  117, 116, 115, 113, 112, 111, 109, 107, 106, 104, 102, 100, 98, 96, 94, 92,
+  90, 88, 85, 83, 81, 78, 76, 73, 71, 68, 65, 63, 60, 57, 54, 51,
+  49, 46, 43, 40, 37, 34, 31, 28, 25, 22, 19, 16, 12, 9, 6, 3,
+  0, -3, -6, -9, -12, -16, -19, -22, -25, -28, -31, -34, -37, -40, -43, -46,
+  -49, -51, -54, -57, -60, -63, -65, -68, -71, -73, -76, -78, -81, -83, -85, -88,
+  -90, -92, -94, -96, -98, -100, -102, -104, -106, -107, -109, -111, -112, -113, -115, -116,
+  -117, -118, -120, -121, -122, -122, -123, -124, -125, -125, -126, -126, -126, -127, -127, -127,
+  -127, -127, -127, -127, -126, -126, -126, -125, -125, -124, -123, -122, -122, -121, -120, -118,
+  -117, -116, -115, -113, -112, -111, -109, -107, -106, -104, -102, -100, -98, -96, -94, -92,
+  -90, -88, -85, -83, -81, -78, -76, -73, -71, -68, -65, -63, -60, -57, -54, -51,
+  -49, -46, -43, -40, -37, -34, -31, -28, -25, -22, -19, -16, -12, -9, -6, -3,
+};
+
+// Envelope stages and levels
+#define SYNTH_ENV_ATTACK  0
+#define SYNTH_ENV_DECAY   1
+#define SYNTH_ENV_SUSTAIN 2
+#define SYNTH_ENV_RELEASE 3
+#define SYNTH_ENV_FULL    (1 << 24)
+#define SYNTH_SAMPLES_PER_MS (SYNTH_SAMPLE_RATE / 1000)
+
+//===============================================================
+// Returns the phase increment per sample of a MIDI note
+//===============================================================
+static uint32_t NotePhaseStep(uint8_t note)
+{
+  float frequency = 440.0f * powf(2.0f, (note - 69) / 12.0f);
+  return (uint32_t)(frequency * 4294967296.0f / SYNTH_SAMPLE_RATE);
+}
+
+//===============================================================
+// Constructor
+//===============================================================
+XT_Synth_Class::XT_Synth_Class(const SynthScript &Script)
+{
+  _script = &Script;
+  SampleRate = SYNTH_SAMPLE_RATE;
+  IncreaseBy = float(SampleRate) / 50000;
+
+  // The length of the clip is the sum of all notes
+  DataSize = 0;
+  for (uint8_t index = 0; index < Script.NoteCount; index++)
+  {
+    DataSize += (uint32_t)Script.Notes[index].Length * SYNTH_TICK_MS * SYNTH_SAMPLES_PER_MS;
+  }
+  Completed = true;
+  Rewind();
+}
+
+//===============================================================
+// Rewinds the script to the first note
+//===============================================================
+void XT_Synth_Class::Rewind()
+{
+  _noteIdx = 0;
+  _noteEnd = 0;
+  _phase = 0;
+  _phaseStep = 0;
+  _glideStep = 0;
+  _lfsr = 0xACE1;
+  _envStage = SYNTH_ENV_RELEASE;
+  _envLevel = 0;
+  _envStep = 0;
+  XT_Wav_Class::Rewind();
+}
+
+//===============================================================
+// Starts the note at _noteIdx
+//===============================================================
+void XT_Synth_Class::StartNote()
+{
+  const SynthNote &note = _script->Notes[_noteIdx++];
+  uint32_t length = (uint32_t)note.Length * SYNTH_TICK_MS * SYNTH_SAMPLES_PER_MS;
+  uint32_t release = max((uint32_t)1, (uint32_t)_script->ReleaseMs * SYNTH_SAMPLES_PER_MS);
+  _noteEnd += length;
+  _releaseStart = _noteEnd - min(release, length);
+
+  if (note.Note == 0)
+  {
+    // Rest, the last note fades out with the release time
+    _glideStep = 0;
+    _envStage = SYNTH_ENV_RELEASE;
+    _envStep = _envLevel / (int32_t)release + 1;
+    return;
+  }
+
+  // Glide linearly in frequency to the target note over the whole note
+  _wave = note.Wave;
+  _phaseStep = NotePhaseStep(note.Note);
+  _glideStep = note.GlideTo == 0 ? 0 :
+    (int32_t)(((int64_t)NotePhaseStep(note.GlideTo) - _phaseStep) / (int32_t)max((uint32_t)1, length));
+
+  // Attack from the current level, no click between notes
+  _envStage = SYNTH_ENV_ATTACK;
+  _envStep = SYNTH_ENV_FULL / max((int32_t)1, (int32_t)_script->AttackMs * SYNTH_SAMPLES_PER_MS);
+  _envSustain = (int32_t)((int64_t)SYNTH_ENV_FULL * _script->Sustain / 255);
+}
+
+//===============================================================
+// Renders the sample at DataIdx, called once per sample in order
+//===============================================================
+uint8_t XT_Synth_Class::DecodeSample()
+{
+  uint32_t startCycles = ESP.getCycleCount();
+
+  // Next note, notes of length 0 are skipped
+  while (DataIdx >= _noteEnd &&
+    _noteIdx < _script->NoteCount)
+  {
+    StartNote();
+  }
+
+  // Envelope
+  if (DataIdx == _releaseStart &&
+    _envStage != SYNTH_ENV_RELEASE)
+  {
+    _envStage = SYNTH_ENV_RELEASE;
+    _envStep = _envLevel / (int32_t)max((uint32_t)1, _noteEnd - DataIdx) + 1;
+  }
+  switch (_envStage)
+  {
+    case SYNTH_ENV_ATTACK:
+      _envLevel += _envStep;
+      if (_envLevel >= SYNTH_ENV_FULL)
+      {
+        _envLevel = SYNTH_ENV_FULL;
+        _envStage = SYNTH_ENV_DECAY;
+        _envStep = (SYNTH_ENV_FULL - _envSustain) / max((int32_t)1, (int32_t)_script->DecayMs * SYNTH_SAMPLES_PER_MS) + 1;
+      }
+      break;
+    case SYNTH_ENV_DECAY:
+      _envLevel -= _envStep;
+      if (_envLevel <= _envSustain)
+      {
+        _envLevel = _envSustain;
+        _envStage = SYNTH_ENV_SUSTAIN;
+      }
+      break;
+    case SYNTH_ENV_RELEASE:
+      _envLevel = max((int32_t)0, _envLevel - _envStep);
+      break;
+    default:
+      break;
+  }
+
+  // Oscillator
+  uint32_t previousPhase = _phase;
+  _phase += _phaseStep;
+  _phaseStep += _glideStep;
+  uint8_t index = _phase >> 24;
+  int32_t value;
+  switch (_wave)
+  {
+    case SynthWave_Sine:
+      value = SynthSineTable[index];
+      break;
+    case SynthWave_Triangle:
+      value = index < 128 ? index * 2 - 128 : 383 - index * 2;
+      break;
+    case SynthWave_Square:
+      value = index < 128 ? 127 : -128;
+      break;
+    case SynthWave_Saw:
+      value = (int32_t)index - 128;
+      break;
+    default:
+      // New noise value every eighth of a period (Galois LFSR)
+      if ((previousPhase ^ _phase) >> 29)
+      {
+        _lfsr = (_lfsr >> 1) ^ (-(_lfsr & 1) & 0xB400);
+        _noise = (int8_t)_lfsr;
+      }
+      value = _noise;
+      break;
+  }
+
+  // Envelope (12 bit) and volume
+  int32_t amplitude = ((_envLevel >> 12) * _script->Volume) >> 8;
+  uint8_t sample = ((value * amplitude) >> 12) + 128;
+
+  CyclesPerSample = (CyclesPerSample * 15 + (uint32_t)(ESP.getCycleCount() - startCycles)) / 16;
+  return sample;
+}
+
+
+//===============================================================
+// Adds two samples, saturating at the 16 bit range
+//===============================================================
+static inline int16_t SaturatingAdd(int16_t a, int16_t b)
+{
+  int32_t sum = (int32_t)a + b;
+  return constrain(sum, -32768, 32767);
+}
+
+
 //===============================================================
 // Constructor
 //===============================================================
@@ -177,6 +700,7 @@ void XT_DAC_Audio_Class::Begin()
   timerAttachInterrupt(timer, &onTimer);
   timerStart(timer);
   timerAlarm(timer, 20, true, 0);
+  _timerRunning = true;
 
   // Allow system to settle, otherwise garbage can play for first second
   dacWrite(_dacPin, 0);
@@ -185,37 +709,58 @@ void XT_DAC_Audio_Class::Begin()
 }
 
 //===============================================================
-// Enables or disables DAC output
+// Enables or disables DAC output, the output fades in or out in the background
 //===============================================================
 void XT_DAC_Audio_Class::Enable(bool enable)
 {
-  if (enable && !_enabled)
+  if (enable)
   {
-    // Set speaker to mid point, stops click at start of first sound
-    pinMode(_dacPin, ANALOG);
+    // Restart the output timer stopped by an idle FillBuffer
+    if (!_timerRunning &&
+      timer != NULL)
+    {
+      timerStart(timer);
+      _timerRunning = true;
+    }
 
-    // Ramp up to last value
-    uint8_t steps = 20;
-    for (int index = 0; index < steps; index++)
+    // Start at zero, the envelope ramps up to the played value (mid point)
+    if (!_pinAttached)
     {
-      dacWrite(_dacPin, LastDacValue * index / steps);
-      delay(10);
+      pinMode(_dacPin, ANALOG);
+      dacWrite(_dacPin, 0);
+      LastDacValue = 0;
+      _pinAttached = true;
     }
-    dacWrite(_dacPin, LastDacValue);
-  }
-  else if (!enable && _enabled)
-  {    
-    // Ramp down to zero value
-    uint8_t steps = 20;
-    for (int index = 0; index < steps; index++)
+
+    if (!_enabled || FadeDirection < 0)
     {
-      dacWrite(_dacPin, LastDacValue - (LastDacValue * index / steps));
-      delay(10);
+      FadeDone = false;
+      FadeDirection = 1;
+      _enabled = true;
     }
-    dacWrite(_dacPin, 0);
-    pinMode(_dacPin, INPUT);
   }
-  _enabled = enable;
+  else if (_enabled && FadeDirection >= 0)
+  {
+    // Ramp down to zero, the ISR disables the output at the end
+    FadeDone = false;
+    FadeDirection = -1;
+  }
+}
+
+//===============================================================
+// Returns true if the output is disabled and its timer is stopped
+//===============================================================
+bool XT_DAC_Audio_Class::IsIdle()
+{
+  return !_timerRunning;
+}
+
+//===============================================================
+// Returns true if the last fade in or out has finished
+//===============================================================
+bool XT_DAC_Audio_Class::IsRampDone()
+{
+  return FadeDone;
 }
 
 //===============================================================
@@ -223,6 +768,23 @@ void XT_DAC_Audio_Class::Enable(bool enable)
 //===============================================================
 void XT_DAC_Audio_Class::FillBuffer()
 {
+  // Release the DAC pin and stop the output timer after a finished fade out,
+  // 50,000 interrupts per second for a disabled output only cost power
+  if (!_enabled &&
+    FadeDone)
+  {
+    if (_pinAttached)
+    {
+      pinMode(_dacPin, INPUT);
+      _pinAttached = false;
+    }
+    if (_timerRunning)
+    {
+      timerStop(timer);
+      _timerRunning = false;
+    }
+  }
+
 	// Fill buffer with the sound to output
 	if (NextFillPos == BUFFER_SIZE && 
     EndFillPos != 0 &&
@@ -231,17 +793,107 @@ void XT_DAC_Audio_Class::FillBuffer()
     NextFillPos = 0;
   }	
 	
+	// Let streamed items read ahead outside of the fill loop
+  bool playing = false;
+  for (uint8_t voice = 0; voice < MIXER_VOICES; voice++)
+  {
+    XT_Wav_Class *item = Voices[voice].Item;
+    if (item != 0)
+    {
+      playing = true;
+      if (item->Completed == false)
+      {
+        item->Prefetch();
+      }
+    }
+  }
+  bool wasPlaying = Playing;
+  Playing = playing;
+
+  // Queued clips start once the output is fully faded in
+  bool cueReady = _cueCount > 0 && _enabled && FadeDone;
+  playing |= cueReady;
+  // The playing clip and every queued clip can complete in one fill
+  XT_Wav_Class *completedCues[CUE_QUEUE_SIZE + 1];
+  uint8_t completedCount = 0;
+
+  // Buffer occupancy before filling, the lowest value shows how close audio came to an underrun.
+  // The first fill after starting a clip is skipped, the buffer is empty by design there
+  if (playing && wasPlaying)
+  {
+    uint32_t occupancy = (NextFillPos + BUFFER_SIZE - NextPlayPos) % BUFFER_SIZE;
+    OccupancyMin = min(OccupancyMin, occupancy);
+    OccupancyMax = max(OccupancyMax, occupancy);
+    OccupancySum += occupancy;
+    Fills++;
+  }
+
+  uint32_t startCycles = ESP.getCycleCount();
+  uint32_t samples = 0;
+
 	// If there are items that need to be played & room for more in buffer
-	while (playItem != 0 && NextFillPos != EndFillPos && NextFillPos != BUFFER_SIZE)
+	while (playing && NextFillPos != EndFillPos && NextFillPos != BUFFER_SIZE)
 	{
-    // Get the byte to play and put into buffer
+    // Start the next queued clip right after the previous one and its gap
+    if (cueReady &&
+      _cuePlaying == 0)
+    {
+      AudioCue &cue = _cues[_cueHead];
+      if (cue.GapSamples > 0)
+      {
+        cue.GapSamples--;
+      }
+      else
+      {
+        cue.Item->Rewind();
+        cue.Item->Completed = false;
+        Voices[CUE_VOICE].Item = cue.Item;
+        Voices[CUE_VOICE].Gain = MIXER_GAIN_UNITY;
+        Voices[CUE_VOICE].Loop = false;
+        _cuePlaying = cue.Item;
+        _cueHead = (_cueHead + 1) % CUE_QUEUE_SIZE;
+        _cueCount--;
+        cueReady = _cueCount > 0;
+      }
+    }
+
+    // Mix all sounding voices, silence is the speaker mid point
 	  uint8_t ByteToPlay = 0x7f;
-    if (playItem != 0 &&
-      playItem->Completed == false)
+    int16_t mix = 0;
+    bool sounding = false;
+    for (uint8_t voice = 0; voice < MIXER_VOICES; voice++)
     {
-      ByteToPlay = playItem->NextByte();
+      XT_Wav_Class *item = Voices[voice].Item;
+      if (item != 0 &&
+        item->Completed == false)
+      {
+        // Scale to 16 bit with the gain (unity is a shift by 8), then add saturating
+        int32_t sample = ((int16_t)item->NextByte() - 128) * (int32_t)Voices[voice].Gain;
+        mix = SaturatingAdd(mix, constrain(sample, -32768, 32767));
+        sounding = true;
+
+        // Restart looping clips right at their end, the clip is already rewound
+        if (item->Completed &&
+          Voices[voice].Loop)
+        {
+          item->Completed = false;
+        }
+      }
+    }
+    if (sounding)
+    {
+      ByteToPlay = (mix >> 8) + 128;
+    }
+
+    // Queued clip finished with this sample
+    if (_cuePlaying != 0 &&
+      _cuePlaying->Completed)
+    {
+      completedCues[completedCount++] = _cuePlaying;
+      _cuePlaying = 0;
     }
 		Buffer[NextFillPos] = ByteToPlay;
+    samples++;
     
     // Move to next buffer position
 		NextFillPos++;
@@ -253,59 +905,190 @@ void XT_DAC_Audio_Class::FillBuffer()
         NextFillPos = 0;
       }
 		}
-	}		
+	}
+
+  // Smooth the mixing cost (8 bit fraction), only fills with some samples count
+  if (samples >= 64)
+  {
+    uint32_t cyclesPerSample = (uint32_t)(((uint64_t)(ESP.getCycleCount() - startCycles) << 8) / samples);
+    MixCyclesPerSample = (MixCyclesPerSample * 7 + cyclesPerSample) / 8;
+  }
+
+  // Deliver completion events outside of the fill loop
+  for (uint8_t index = 0; index < completedCount; index++)
+  {
+    if (OnCueCompleted != NULL)
+    {
+      OnCueCompleted(completedCues[index]);
+    }
+  }
 } 
 
 //===============================================================
-// Plays wav file
+// Plays wav file on a mixer voice, replacing the clip of that voice
 //===============================================================
-void XT_DAC_Audio_Class::Play(XT_Wav_Class *Wav)
+void XT_DAC_Audio_Class::Play(XT_Wav_Class *Wav, uint8_t Voice, uint16_t Gain, bool Loop)
 {
-  // Stop current sound
-	Stop();
+  if (Voice >= MIXER_VOICES)
+  {
+    return;
+  }
+
+  // Stop current sound of this voice
+	Stop(Voice);
 
 	// Set up this wav to play
-	Wav->LastIntCount = 0;
-	Wav->DataIdx = 44;
-	Wav->Count = 0;
+	Wav->Rewind();
+  Voices[Voice].Gain = Gain;
+  Voices[Voice].Loop = Loop;
   
   // Will start it playing
-  playItem = Wav;
+  Voices[Voice].Item = Wav;
 	Wav->Completed = false;
 }
 
 //===============================================================
-// Stops sound
+// Queues a clip on the cue voice
+//===============================================================
+bool XT_DAC_Audio_Class::Enqueue(XT_Wav_Class *Wav, uint16_t GapMs)
+{
+  if (_cueCount >= CUE_QUEUE_SIZE)
+  {
+    return false;
+  }
+
+  AudioCue &cue = _cues[(_cueHead + _cueCount) % CUE_QUEUE_SIZE];
+  cue.Item = Wav;
+  cue.GapSamples = (uint32_t)GapMs * 50;
+  _cueCount++;
+  return true;
+}
+
+//===============================================================
+// Removes all clips from the queue, a playing clip continues
+//===============================================================
+void XT_DAC_Audio_Class::ClearQueue()
+{
+  _cueCount = 0;
+}
+
+//===============================================================
+// Returns true if the queue is empty and no queued clip is playing
+//===============================================================
+bool XT_DAC_Audio_Class::IsQueueIdle()
+{
+  return _cueCount == 0 && _cuePlaying == 0;
+}
+
+//===============================================================
+// Stops all voices and clears the cue queue
 //===============================================================
 void XT_DAC_Audio_Class::Stop()
 {
-	if (playItem != 0)
-	{
-		playItem->Completed = true;
-	}
+  ClearQueue();
+  _cuePlaying = 0;
+  for (uint8_t voice = 0; voice < MIXER_VOICES; voice++)
+  {
+    Stop(voice);
+  }
 }
 
 //===============================================================
-// Prints average buffer usage
+// Stops one voice
 //===============================================================
-void XT_DAC_Audio_Class::AverageBufferUsage()
+void XT_DAC_Audio_Class::Stop(uint8_t Voice)
 {
-	// returns the average buffer usage over 50 iterations of your main loop. 
-	// Call this routine in your main loop and after 50 calls to this
-	// routine it will display the avg buffer memory used via the serial link, 
-	// so ensure you have enabled serial comms.
-	// This routine should only be used to check how much buffer is being used during your
-	// code executing in order to optimise how much buffer you need to reserve.
-	
-	static bool ResultPrinted = false;
-	static uint8_t LoopCount = 0;
-	
-	if ((LoopCount == 50) & (ResultPrinted == false))
+	if (Voice < MIXER_VOICES &&
+    Voices[Voice].Item != 0)
 	{
-		Serial.print("Avg Buffer Usage : ");
-		Serial.print(BufferUsedCount / 50);
-		Serial.println(" bytes");
-		ResultPrinted = true;
+		Voices[Voice].Item->Completed = true;
+    Voices[Voice].Item = 0;
 	}
-	LoopCount++;
+
+  // An interrupted queued clip is not reported as completed
+  if (Voice == CUE_VOICE)
+  {
+    _cuePlaying = 0;
+  }
+}
+
+//===============================================================
+// Sets the gain of a voice, MIXER_GAIN_UNITY = 1.0
+//===============================================================
+void XT_DAC_Audio_Class::SetGain(uint8_t Voice, uint16_t Gain)
+{
+  if (Voice < MIXER_VOICES)
+  {
+    Voices[Voice].Gain = Gain;
+  }
+}
+
+//===============================================================
+// Returns a snapshot of the telemetry counters
+//===============================================================
+AudioTelemetry XT_DAC_Audio_Class::GetTelemetry()
+{
+  AudioTelemetry telemetry;
+
+  portENTER_CRITICAL(&TelemetryMux);
+  telemetry.Underruns = Underruns;
+  telemetry.SamplesDropped = SamplesDropped;
+  telemetry.IsrCalls = IsrCalls;
+  telemetry.IsrCyclesMax = IsrCyclesMax;
+  for (uint8_t bin = 0; bin < ISR_HISTOGRAM_BINS; bin++)
+  {
+    telemetry.IsrHistogram[bin] = IsrHistogram[bin];
+  }
+  portEXIT_CRITICAL(&TelemetryMux);
+
+  telemetry.Fills = Fills;
+  telemetry.OccupancyMin = Fills > 0 ? OccupancyMin : 0;
+  telemetry.OccupancyMax = OccupancyMax;
+  telemetry.OccupancyAvg = Fills > 0 ? OccupancySum / Fills : 0;
+  telemetry.MixCyclesPerSample = MixCyclesPerSample >> 8;
+
+  return telemetry;
+}
+
+//===============================================================
+// Resets the telemetry counters
+//===============================================================
+void XT_DAC_Audio_Class::ResetTelemetry()
+{
+  portENTER_CRITICAL(&TelemetryMux);
+  Underruns = 0;
+  SamplesDropped = 0;
+  IsrCalls = 0;
+  IsrCyclesMax = 0;
+  for (uint8_t bin = 0; bin < ISR_HISTOGRAM_BINS; bin++)
+  {
+    IsrHistogram[bin] = 0;
+  }
+  portEXIT_CRITICAL(&TelemetryMux);
+
+  OccupancyMin = UINT32_MAX;
+  OccupancyMax = 0;
+  OccupancySum = 0;
+  Fills = 0;
+}
+
+//===============================================================
+// Returns the telemetry as one line string
+//===============================================================
+String XT_DAC_Audio_Class::GetTelemetryString()
+{
+  AudioTelemetry telemetry = GetTelemetry();
+
+  String returnString;
+  returnString += "Underruns: " + String(telemetry.Underruns);
+  returnString += ", Dropped: " + String(telemetry.SamplesDropped);
+  returnString += ", Buffer min/avg/max: " + String(telemetry.OccupancyMin) + "/" + String(telemetry.OccupancyAvg) + "/" + String(telemetry.OccupancyMax);
+  returnString += ", Mix: " + String(telemetry.MixCyclesPerSample) + " cyc/sample";
+  returnString += ", ISR max: " + String(telemetry.IsrCyclesMax) + " cyc, ISR histogram:";
+  for (uint8_t bin = 0; bin < ISR_HISTOGRAM_BINS; bin++)
+  {
+    returnString += " " + String(telemetry.IsrHistogram[bin]);
+  }
+
+  return returnString;
 }
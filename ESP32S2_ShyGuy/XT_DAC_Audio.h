@@ -6,11 +6,60 @@
  * @copyright © 2024 Florian Staeblein
  */
 
+#ifndef XT_DAC_AUDIO_H
+#define XT_DAC_AUDIO_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <Arduino.h>
+#include <FS.h>
+#include <SPIFFS.h>
+
 
 //===============================================================
 // Defines
 //===============================================================
 #define BUFFER_SIZE 4000
+#define ADPCM_HEADER_SIZE 4   // Predictor (int16), step index (uint8), reserved (uint8)
+#define STREAM_CHUNK_MAX  BUFFER_SIZE // Read-ahead buffer of streamed clips in bytes, one refill of the empty ring at 50 kHz
+#define MIXER_VOICES      4     // Number of clips that can play at the same time
+#define MIXER_GAIN_UNITY  256   // Voice gain of 1.0
+#define FADE_LEVEL_MAX    65536 // Output gain of 1.0 of the click suppression envelope
+#define FADE_STEP         7     // Envelope step per output sample, ~190 ms from 0 to mid point
+#define SYNTH_SAMPLE_RATE 25000 // Sample rate of the synthesizer, half the DAC rate
+#define SYNTH_TICK_MS     10    // Time unit of note lengths
+#define SYNTH_CYCLE_BUDGET 300  // Synthesizer CPU cycles per sample on the ESP32-S2 at 240 MHz
+#define CUE_QUEUE_SIZE    8     // Clips that can be queued back to back
+#define CUE_VOICE         (MIXER_VOICES - 1) // Mixer voice that plays the cue queue, reserved for Enqueue
+#define ISR_HISTOGRAM_BINS 8    // Output ISR cost bins: < 64, < 128, ... < 4096, >= 4096 cycles
+#define ISR_HISTOGRAM_BASE 6    // Log2 of the upper bound of the first bin
+
+//===============================================================
+// Sample formats of the sound bank
+//===============================================================
+typedef enum : uint8_t
+{
+  SoundFormat_PCM8,     // 8 bit unsigned PCM, one byte per sample
+  SoundFormat_ADPCM4    // 4 bit IMA-ADPCM, header + two samples per byte (low nibble first)
+} eSoundFormat;
+
+//===============================================================
+// Clip table entry of a flash resident sound bank
+//===============================================================
+typedef struct
+{
+  uint32_t Offset;      // Offset of the first byte (header or sample) in the sound bank data
+  uint32_t Length;      // Number of samples
+  uint16_t SampleRate;  // Sample rate in Hz
+  uint8_t Format;       // Sample format (eSoundFormat)
+} SoundClip;
+
+// Returns the bytes of a clip in the sound bank data, as read by the decoder
+constexpr uint32_t SoundClipSize(const SoundClip &Clip)
+{
+  return Clip.Format == SoundFormat_ADPCM4 ? ADPCM_HEADER_SIZE + Clip.Length / 2 : Clip.Length;
+}
 
 //===============================================================
 // The Main Wave class for sound samples
@@ -19,22 +68,198 @@ class XT_Wav_Class
 {
   public:
     // Constructor
-    XT_Wav_Class(unsigned char *WavData, uint32_t datasize);
+    XT_Wav_Class(const uint8_t *BankData, const SoundClip &Clip);
+    virtual ~XT_Wav_Class() { }
 
     uint16_t SampleRate;  
-    volatile uint32_t DataSize = 0;     // The last integer part of count
-    volatile uint32_t DataIdx = 44;
-    volatile unsigned char *Data;  
+    volatile uint32_t DataSize = 0;     // Number of samples of the clip
+    volatile uint32_t DataIdx = 0;
+    const uint8_t *Data = NULL;         // First sample of the clip, flash resident
     volatile float IncreaseBy = 0;      // The amount to increase the counter by per call to "onTimer"
     volatile float Count = 0;           // The counter counting up, we check this to see if we need to send
     volatile int32_t LastIntCount = -1; // The last integer part of count
     volatile bool Completed = true;
-    volatile uint8_t LastValue;					// Last value returned from NextByte function
+    volatile uint8_t LastValue;					// Current sample, returned from NextByte function
+    uint8_t Format = SoundFormat_PCM8;  // Sample format (eSoundFormat)
     
     // Returns next byte
     uint8_t NextByte();
+
+    // Rewinds the clip to the first sample
+    virtual void Rewind();
+
+    // Prepares data ahead of a buffer fill, called from loop
+    virtual void Prefetch() { }
+
+  protected:
+    // Constructor for derived clip sources without flash data
+    XT_Wav_Class() { }
+
+    // Decodes the sample at DataIdx, must be called in sample order
+    virtual uint8_t DecodeSample();
+
+  private:
+    int32_t _adpcmPredictor = 0;        // ADPCM decoder predictor (16 bit signed range)
+    int8_t _adpcmStepIndex = 0;         // ADPCM decoder step table index
+};
+
+//===============================================================
+// Wave class streaming an 8 bit mono WAV file from SPIFFS
+//===============================================================
+class XT_SpiffsWav_Class : public XT_Wav_Class
+{
+  public:
+    // Constructor
+    XT_SpiffsWav_Class(const char *Path);
+    ~XT_SpiffsWav_Class();
+
+    // Opens another WAV file, returns false if it is missing or not 8 bit mono PCM
+    bool Open(const char *Path);
+
+    // Returns true if a valid WAV file is open
+    bool IsOpen();
+
+    // Rewinds the clip to the first sample
+    void Rewind();
+
+    // Refills the read-ahead, sized from the samples consumed per fill but never below one refill of the empty ring
+    void Prefetch();
+
+    uint32_t Stalls = 0;                // Reads that had to happen inside the fill loop
+
+  protected:
+    // Returns the next sample of the read-ahead
+    uint8_t DecodeSample();
+
+  private:
+    File _file;
+    uint32_t _dataStart = 0;            // File position of the first sample
+    uint8_t _chunk[STREAM_CHUNK_MAX];   // Read-ahead buffer
+    uint16_t _chunkLength = 0;          // Valid bytes in read-ahead buffer
+    uint16_t _chunkPos = 0;             // Next byte to take from read-ahead buffer
+    uint16_t _refill = STREAM_CHUNK_MAX; // Bytes a refill of the empty ring takes at the rate of the clip
+    uint16_t _readAhead = STREAM_CHUNK_MAX;
+    uint16_t _consumed = 0;             // Samples taken since the last prefetch
+    uint16_t _consumedAvg = 0;          // Smoothed samples taken per fill
+
+    // Reads from file until the read-ahead holds at least the given bytes
+    void ReadChunk(uint16_t bytes);
 };
 
+//===============================================================
+// Oscillator waveforms of the synthesizer
+//===============================================================
+typedef enum : uint8_t
+{
+  SynthWave_Sine,       // Wavetable
+  SynthWave_Triangle,
+  SynthWave_Square,
+  SynthWave_Saw,
+  SynthWave_Noise       // Pitched noise, resampled 8 times per period
+} eSynthWave;
+
+//===============================================================
+// One note of a synthesizer script (4 bytes)
+//===============================================================
+typedef struct
+{
+  uint8_t Note;         // MIDI note number, 0 = rest
+  uint8_t GlideTo;      // MIDI note reached at the end of the note, 0 = no glide
+  uint8_t Length;       // Length in SYNTH_TICK_MS units
+  uint8_t Wave;         // Waveform (eSynthWave)
+} SynthNote;
+
+//===============================================================
+// Synthesizer script, the envelope restarts with every note
+//===============================================================
+typedef struct
+{
+  const SynthNote *Notes;
+  uint8_t NoteCount;
+  uint8_t AttackMs;     // Rise to full level
+  uint8_t DecayMs;      // Fall to the sustain level
+  uint8_t Sustain;      // Sustain level, 255 = full level
+  uint8_t ReleaseMs;    // Fall to silence at the end of the note
+  uint8_t Volume;       // Output level, 255 = full scale
+} SynthScript;
+
+//===============================================================
+// Wave class rendering a synthesizer script instead of samples
+//===============================================================
+class XT_Synth_Class : public XT_Wav_Class
+{
+  public:
+    // Constructor
+    XT_Synth_Class(const SynthScript &Script);
+
+    // Rewinds the script to the first note
+    void Rewind();
+
+    uint32_t CyclesPerSample = 0;       // Smoothed CPU cycles per rendered sample
+
+  protected:
+    // Renders the sample at DataIdx
+    uint8_t DecodeSample();
+
+  private:
+    const SynthScript *_script;
+    uint8_t _noteIdx = 0;               // Current note
+    uint32_t _noteEnd = 0;              // DataIdx at which the next note starts
+    uint32_t _releaseStart = 0;         // DataIdx at which the release starts
+    uint32_t _phase = 0;                // Oscillator phase, a full period is 2^32
+    uint32_t _phaseStep = 0;            // Phase increment per sample
+    int32_t _glideStep = 0;             // Change of the phase increment per sample
+    uint8_t _wave = SynthWave_Sine;     // Waveform of the current note (eSynthWave)
+    int8_t _noise = 0;                  // Current noise value
+    uint16_t _lfsr = 0xACE1;            // Noise generator state
+    uint8_t _envStage = 0;              // Attack, decay, sustain or release
+    int32_t _envLevel = 0;              // Envelope level, full level is 2^24
+    int32_t _envStep = 0;               // Envelope change per sample in the current stage
+    int32_t _envSustain = 0;            // Sustain level in envelope units
+
+    // Starts the note at _noteIdx
+    void StartNote();
+};
+
+//===============================================================
+// Mixer voice, one clip with its gain and loop flag
+//===============================================================
+typedef struct
+{
+  XT_Wav_Class *Item;   // Clip of this voice, NULL if never used
+  uint16_t Gain;        // Gain, MIXER_GAIN_UNITY = 1.0
+  bool Loop;            // Restarts the clip when it completes
+} MixerVoice;
+
+//===============================================================
+// Queued clip, started by the engine after the previous one
+//===============================================================
+typedef struct
+{
+  XT_Wav_Class *Item;   // Clip to play
+  uint32_t GapSamples;  // Silence before the clip in output samples
+} AudioCue;
+
+// Called from FillBuffer when a queued clip has finished
+typedef void(*AudioCueCallback)(XT_Wav_Class *Wav);
+
+//===============================================================
+// Audio engine telemetry, counted since Begin or the last reset
+//===============================================================
+typedef struct
+{
+  uint32_t Underruns;           // Times the buffer ran empty while playing
+  uint32_t SamplesDropped;      // Output ticks without buffered data while playing
+  uint32_t OccupancyMin;        // Buffered samples at the start of a fill (lowest)
+  uint32_t OccupancyAvg;        // Buffered samples at the start of a fill (average)
+  uint32_t OccupancyMax;        // Buffered samples at the start of a fill (highest)
+  uint32_t Fills;               // Number of fills with at least one voice
+  uint32_t IsrCalls;            // Output ISR calls while enabled
+  uint32_t IsrCyclesMax;        // Highest output ISR cost in CPU cycles
+  uint32_t IsrHistogram[ISR_HISTOGRAM_BINS]; // Output ISR calls per cost bin
+  uint32_t MixCyclesPerSample;  // Smoothed mixing cost in CPU cycles per sample
+} AudioTelemetry;
+
 //===============================================================
 // the main class for using the DAC to play sounds
 //===============================================================
@@ -48,20 +273,59 @@ class XT_DAC_Audio_Class
     // Begins music
     void Begin();
 
-    // Enables or disables DAC output
+    // Enables or disables DAC output, the output fades in or out in the background
     void Enable(bool enable);
 
+    // Returns true if the last fade in or out has finished
+    bool IsRampDone();
+
+    // Returns true if the output is disabled and its timer is stopped (after FillBuffer), nothing to do until enabled
+    bool IsIdle();
+
     // Fills buffer from loop
 		void FillBuffer();
 
-    // Plays wav file
-		void Play(XT_Wav_Class *Wav);
+    // Plays wav file on a mixer voice, replacing the clip of that voice.
+    // A clip object holds its own play position, so it can only play on one voice at a time.
+    // Playing on CUE_VOICE ends the queued clip there without a completion event
+		void Play(XT_Wav_Class *Wav, uint8_t Voice = 0, uint16_t Gain = MIXER_GAIN_UNITY, bool Loop = false);
 
-    // Stops sound
+    // Stops all voices and clears the cue queue
 		void Stop();
-		
-    // Returns average Buffer usage
-		void AverageBufferUsage();
+
+    // Stops one voice, a queued clip on CUE_VOICE ends without a completion event
+		void Stop(uint8_t Voice);
+
+    // Sets the gain of a voice, MIXER_GAIN_UNITY = 1.0
+    void SetGain(uint8_t Voice, uint16_t Gain);
+
+    // Queues a clip on the cue voice, it starts sample-accurately after the previous
+    // clip and the gap. Queued clips wait for a running fade in. Returns false if full
+    bool Enqueue(XT_Wav_Class *Wav, uint16_t GapMs = 0);
+
+    // Removes all clips from the queue, a playing clip continues
+    void ClearQueue();
+
+    // Returns true if the queue is empty and no queued clip is playing
+    bool IsQueueIdle();
+
+    // Called when a queued clip has finished (from FillBuffer)
+    AudioCueCallback OnCueCompleted = NULL;
+
+    // Returns a snapshot of the telemetry counters
+    AudioTelemetry GetTelemetry();
+
+    // Resets the telemetry counters
+    void ResetTelemetry();
+
+    // Returns the telemetry as one line string
+    String GetTelemetryString();
+
+  private:
+    AudioCue _cues[CUE_QUEUE_SIZE];     // Cue queue (ring)
+    uint8_t _cueHead = 0;
+    uint8_t _cueCount = 0;
+    XT_Wav_Class *_cuePlaying = NULL;   // Queued clip on the cue voice
 };
 
-                                                          
\ No newline at end of file
+#endif
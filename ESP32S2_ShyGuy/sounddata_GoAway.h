@@ -1,1669 +0,0 @@
-// Wav2c recriado em Javascript por Guilherme Rodrigues: https://github.com/guilhermerodrigues680/wav2c-online
-// Baseado no wav2c em C de Olle Jonsson: https://github.com/olleolleolle/wav2c
-
-//const int sounddata_sampleRate = 48000; 
-const int sounddata_length_Go_away = 33036;
-
-unsigned char PROGMEM sounddata_data_Go_away[] = { 128,
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 126, 126, 126, 126, 126, 126, 125, 125,
-125, 125, 125, 126, 126, 126, 126, 126, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 128, 128,
-128, 128, 129, 129, 129, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 131, 131, 131, 131,
-131, 131, 131, 131, 130, 130, 129, 129, 129, 129, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 126, 126, 125, 125, 124, 123, 123, 122, 121,
-120, 119, 119, 119, 119, 120, 121, 122, 123, 123, 124, 125, 125, 126, 126, 126, 126, 126, 126, 126,
-127, 127, 128, 129, 130, 130, 131, 131, 132, 133, 134, 134, 134, 134, 134, 133, 134, 134, 134, 134,
-134, 134, 134, 134, 134, 135, 134, 134, 133, 132, 131, 130, 129, 129, 128, 127, 127, 126, 126, 126,
-126, 126, 127, 127, 127, 128, 128, 128, 128, 129, 129, 129, 129, 129, 128, 128, 127, 127, 126, 124,
-123, 121, 119, 118, 115, 113, 111, 109, 109, 110, 112, 114, 116, 118, 119, 121, 123, 125, 126, 128,
-128, 128, 127, 126, 125, 126, 127, 129, 131, 132, 133, 134, 135, 137, 139, 140, 142, 142, 141, 139,
-138, 138, 138, 138, 138, 137, 136, 136, 136, 136, 137, 137, 136, 135, 134, 132, 130, 128, 127, 126,
-125, 124, 123, 122, 121, 121, 122, 123, 125, 126, 127, 128, 128, 129, 129, 130, 131, 132, 132, 132,
-131, 129, 127, 125, 123, 121, 119, 116, 112, 108, 104, 101,  99,  99, 100, 103, 107, 110, 113, 116,
-118, 122, 125, 128, 130, 131, 130, 129, 128, 128, 128, 129, 131, 133, 135, 136, 138, 139, 141, 143,
-146, 147, 147, 146, 144, 142, 142, 141, 141, 140, 140, 139, 138, 137, 137, 137, 137, 137, 136, 135,
-132, 129, 127, 125, 123, 122, 121, 120, 119, 118, 118, 120, 122, 124, 127, 129, 130, 131, 132, 133,
-134, 135, 136, 136, 135, 133, 131, 128, 125, 122, 119, 115, 109, 103,  96,  90,  86,  85,  86,  90,
- 95, 101, 106, 110, 115, 119, 124, 129, 133, 135, 134, 132, 129, 127, 126, 127, 129, 132, 135, 138,
-140, 142, 144, 148, 152, 155, 156, 155, 152, 148, 146, 144, 143, 142, 140, 138, 136, 136, 135, 136,
-137, 137, 137, 136, 134, 130, 127, 124, 122, 121, 120, 119, 116, 115, 114, 116, 118, 122, 126, 129,
-131, 133, 134, 134, 135, 137, 138, 138, 137, 135, 133, 129, 126, 123, 120, 117, 112, 105,  98,  91,
- 85,  81,  81,  84,  89,  95, 102, 107, 112, 118, 125, 132, 138, 140, 140, 138, 136, 133, 131, 130,
-130, 131, 133, 135, 137, 139, 142, 147, 151, 155, 157, 157, 154, 151, 148, 146, 144, 142, 139, 135,
-133, 131, 131, 132, 133, 135, 136, 136, 135, 133, 130, 128, 126, 124, 122, 120, 116, 114, 112, 113,
-115, 119, 123, 126, 128, 131, 133, 136, 139, 141, 142, 143, 142, 140, 136, 132, 127, 123, 119, 113,
-106,  98,  90,  83,  77,  74,  75,  79,  85,  93, 100, 107, 114, 122, 130, 138, 143, 146, 146, 144,
-140, 137, 135, 133, 132, 133, 135, 137, 140, 143, 146, 150, 154, 158, 160, 159, 157, 153, 148, 144,
-141, 137, 133, 129, 126, 124, 124, 125, 127, 129, 131, 132, 133, 132, 130, 128, 125, 123, 121, 119,
-116, 114, 113, 113, 115, 119, 123, 128, 133, 137, 140, 142, 144, 146, 146, 146, 144, 142, 138, 133,
-127, 122, 116, 111, 105,  98,  90,  82,  75,  72,  72,  76,  81,  89,  97, 105, 113, 122, 131, 138,
-144, 147, 148, 147, 144, 141, 138, 135, 135, 135, 137, 139, 142, 145, 148, 152, 155, 158, 159, 159,
-155, 151, 146, 141, 136, 132, 128, 125, 123, 122, 122, 124, 126, 129, 131, 133, 133, 132, 130, 128,
-125, 122, 120, 118, 117, 115, 115, 117, 120, 125, 130, 135, 139, 143, 145, 147, 147, 147, 146, 144,
-141, 136, 131, 125, 120, 114, 110, 105, 100,  93,  86,  79,  74,  71,  71,  75,  82,  90,  98, 106,
-114, 122, 131, 140, 147, 153, 155, 154, 151, 148, 146, 145, 144, 144, 145, 146, 146, 146, 147, 149,
-151, 152, 152, 150, 146, 141, 137, 133, 130, 128, 125, 123, 120, 120, 120, 123, 125, 127, 129, 130,
-130, 129, 128, 127, 126, 125, 125, 124, 124, 123, 123, 125, 129, 134, 138, 141, 144, 145, 146, 146,
-145, 143, 141, 138, 134, 130, 124, 118, 113, 108, 103,  98,  92,  86,  79,  72,  68,  66,  69,  74,
- 82,  91, 101, 111, 122, 133, 144, 154, 162, 166, 166, 164, 161, 158, 155, 151, 148, 145, 143, 142,
-141, 141, 141, 143, 144, 145, 144, 141, 137, 133, 130, 127, 124, 122, 119, 116, 114, 115, 118, 122,
-126, 129, 130, 132, 133, 134, 135, 135, 134, 133, 131, 130, 128, 128, 130, 133, 136, 138, 140, 141,
-142, 143, 143, 142, 141, 139, 135, 131, 126, 121, 115, 110, 105, 100,  94,  89,  82,  75,  69,  66,
- 65,  67,  72,  81,  93, 105, 118, 129, 140, 151, 162, 171, 177, 178, 174, 169, 163, 157, 152, 147,
-143, 140, 137, 136, 135, 135, 136, 138, 139, 138, 136, 133, 128, 124, 120, 116, 114, 112, 110, 109,
-110, 113, 118, 126, 132, 137, 141, 143, 145, 146, 146, 146, 144, 141, 138, 134, 132, 131, 132, 134,
-136, 137, 137, 137, 137, 138, 138, 137, 135, 131, 126, 121, 115, 110, 104,  99,  93,  87,  80,  73,
- 67,  64,  64,  66,  71,  79,  90, 104, 118, 131, 143, 155, 166, 175, 181, 182, 180, 175, 169, 162,
-156, 150, 144, 139, 135, 132, 131, 131, 131, 132, 132, 131, 130, 127, 124, 120, 117, 113, 111, 110,
-109, 110, 113, 116, 122, 128, 134, 140, 144, 148, 150, 152, 153, 152, 149, 145, 141, 137, 135, 133,
-132, 131, 131, 131, 131, 132, 133, 134, 134, 134, 132, 129, 125, 121, 116, 111, 106, 101,  96,  91,
- 85,  79,  73,  69,  66,  66,  69,  76,  86, 100, 114, 128, 140, 152, 162, 173, 183, 190, 191, 186,
-178, 169, 160, 153, 146, 139, 132, 127, 122, 119, 119, 120, 123, 125, 126, 125, 122, 120, 118, 116,
-114, 113, 113, 113, 114, 116, 119, 125, 134, 142, 149, 153, 155, 157, 158, 158, 157, 153, 148, 141,
-135, 130, 127, 126, 125, 124, 124, 124, 124, 126, 128, 129, 130, 129, 126, 123, 119, 114, 110, 106,
-101,  95,  88,  81,  74,  69,  66,  67,  70,  77,  87,  99, 114, 130, 144, 156, 167, 178, 186, 191,
-192, 186, 178, 169, 159, 150, 140, 132, 124, 119, 115, 113, 114, 116, 119, 122, 123, 123, 123, 122,
-121, 120, 118, 116, 116, 116, 118, 120, 124, 130, 137, 144, 150, 155, 158, 159, 160, 160, 157, 152,
-146, 139, 133, 128, 124, 121, 119, 118, 118, 119, 120, 123, 125, 128, 129, 129, 128, 126, 124, 120,
-116, 110, 105,  99,  92,  84,  77,  70,  66,  65,  67,  73,  83,  97, 112, 127, 141, 154, 166, 177,
-187, 194, 196, 192, 184, 172, 160, 149, 140, 133, 125, 117, 111, 107, 107, 109, 113, 117, 121, 122,
-122, 122, 121, 121, 121, 120, 120, 120, 120, 122, 125, 130, 137, 145, 152, 157, 159, 160, 161, 161,
-159, 155, 149, 141, 134, 127, 123, 120, 117, 116, 115, 115, 115, 117, 121, 125, 127, 128, 128, 126,
-124, 121, 117, 114, 110, 104,  97,  89,  82,  76,  71,  69,  70,  74,  83,  95, 110, 125, 139, 152,
-165, 176, 186, 193, 196, 192, 184, 173, 161, 149, 138, 128, 117, 108, 102, 100, 100, 102, 107, 112,
-118, 122, 124, 126, 128, 129, 129, 129, 128, 127, 128, 129, 130, 133, 138, 145, 150, 154, 156, 157,
-158, 159, 157, 153, 147, 140, 133, 126, 121, 117, 114, 112, 111, 111, 112, 115, 119, 123, 126, 128,
-129, 129, 127, 124, 121, 116, 111, 105,  98,  89,  81,  75,  70,  67,  69,  76,  86, 100, 114, 129,
-143, 156, 169, 180, 190, 195, 195, 190, 180, 169, 157, 146, 135, 124, 115, 107, 101,  98,  99, 103,
-108, 114, 118, 122, 125, 127, 129, 130, 130, 130, 129, 129, 128, 128, 130, 134, 140, 145, 150, 153,
-156, 157, 158, 159, 157, 153, 147, 139, 131, 125, 120, 116, 112, 109, 108, 108, 109, 113, 117, 121,
-125, 128, 129, 129, 128, 127, 124, 120, 114, 107, 100,  92,  84,  76,  71,  68,  71,  77,  88, 101,
-116, 131, 145, 159, 173, 185, 193, 197, 195, 187, 177, 166, 154, 141, 128, 115, 105,  97,  93,  92,
- 94,  99, 106, 113, 120, 125, 130, 134, 137, 138, 138, 137, 136, 135, 133, 132, 133, 136, 140, 145,
-148, 151, 153, 154, 155, 155, 153, 150, 144, 136, 129, 122, 117, 113, 109, 106, 105, 105, 108, 111,
-116, 121, 125, 129, 131, 132, 132, 131, 128, 123, 117, 109, 101,  93,  84,  76,  70,  68,  70,  77,
- 90, 104, 119, 134, 148, 161, 174, 184, 192, 195, 192, 184, 173, 160, 148, 136, 125, 114, 104,  97,
- 93,  93,  96, 102, 109, 116, 122, 127, 131, 135, 137, 139, 139, 138, 137, 135, 135, 134, 135, 138,
-141, 145, 149, 151, 152, 153, 153, 153, 151, 147, 141, 134, 127, 121, 116, 111, 108, 105, 105, 106,
-109, 113, 117, 122, 126, 129, 131, 133, 133, 131, 127, 121, 114, 107,  99,  91,  83,  76,  71,  69,
- 73,  81,  94, 110, 125, 139, 153, 166, 178, 188, 193, 194, 189, 180, 168, 155, 141, 129, 118, 107,
- 98,  91,  89,  91,  96, 103, 110, 118, 126, 132, 137, 140, 142, 143, 143, 142, 140, 138, 136, 135,
-135, 137, 140, 144, 148, 149, 149, 149, 150, 149, 147, 143, 137, 131, 125, 119, 114, 110, 107, 105,
-106, 107, 111, 115, 119, 122, 126, 130, 133, 135, 134, 131, 127, 121, 114, 107,  98,  90,  82,  75,
- 70,  69,  73,  83,  97, 113, 128, 142, 156, 169, 181, 190, 195, 195, 189, 180, 167, 153, 139, 126,
-115, 104,  95,  89,  86,  89,  95, 102, 110, 118, 125, 132, 137, 141, 143, 144, 144, 143, 141, 138,
-137, 136, 138, 140, 143, 146, 149, 150, 152, 152, 152, 150, 147, 141, 135, 128, 122, 117, 112, 107,
-104, 102, 102, 105, 110, 115, 120, 124, 127, 130, 132, 134, 134, 131, 126, 119, 110, 101,  92,  83,
- 75,  71,  70,  75,  84,  97, 113, 128, 143, 157, 170, 182, 191, 195, 192, 185, 174, 161, 147, 133,
-120, 108,  97,  90,  85,  86,  90,  97, 105, 114, 123, 131, 138, 143, 147, 148, 148, 147, 144, 141,
-138, 136, 136, 136, 137, 140, 143, 146, 149, 151, 152, 151, 149, 145, 140, 134, 128, 122, 116, 110,
-106, 103, 102, 104, 107, 112, 117, 123, 128, 132, 135, 137, 138, 136, 132, 126, 119, 110, 100,  89,
- 80,  72,  67,  66,  70,  79,  93, 109, 126, 141, 155, 169, 181, 190, 196, 196, 191, 180, 166, 151,
-137, 124, 112, 101,  91,  85,  84,  87,  93, 101, 111, 120, 129, 136, 141, 146, 149, 149, 148, 145,
-142, 139, 136, 135, 135, 136, 139, 142, 145, 147, 149, 151, 152, 151, 148, 142, 136, 129, 123, 117,
-112, 108, 104, 103, 103, 106, 111, 116, 122, 127, 131, 134, 136, 137, 135, 132, 127, 120, 112, 103,
- 94,  85,  77,  71,  69,  71,  79,  92, 106, 120, 135, 148, 162, 176, 187, 195, 197, 192, 182, 170,
-156, 143, 130, 116, 103,  91,  84,  81,  82,  88,  96, 106, 115, 124, 132, 140, 146, 151, 154, 154,
-153, 149, 146, 142, 139, 138, 138, 138, 139, 140, 141, 143, 145, 147, 148, 146, 142, 138, 133, 127,
-122, 117, 112, 108, 106, 105, 106, 109, 113, 118, 123, 128, 133, 136, 138, 137, 134, 129, 122, 114,
-105,  95,  85,  76,  68,  64,  67,  75,  88, 103, 119, 134, 149, 164, 177, 189, 197, 199, 194, 184,
-171, 158, 144, 131, 117, 104,  93,  85,  81,  82,  88,  96, 105, 114, 123, 131, 139, 145, 149, 152,
-152, 151, 148, 144, 141, 138, 137, 138, 139, 140, 141, 142, 144, 146, 148, 148, 147, 143, 138, 133,
-128, 123, 116, 110, 105, 103, 103, 105, 108, 112, 117, 122, 127, 132, 136, 139, 139, 136, 131, 124,
-116, 108,  98,  88,  78,  71,  68,  70,  76,  87, 101, 115, 130, 144, 160, 174, 185, 192, 193, 190,
-183, 173, 160, 146, 133, 119, 107,  95,  87,  83,  84,  88,  95, 103, 113, 122, 131, 138, 145, 149,
-152, 153, 151, 148, 145, 142, 139, 137, 136, 137, 138, 140, 142, 144, 146, 148, 148, 147, 144, 141,
-136, 130, 124, 118, 113, 108, 105, 104, 105, 107, 111, 115, 120, 124, 129, 133, 136, 137, 135, 131,
-126, 119, 111, 102,  92,  83,  75,  70,  68,  73,  83,  97, 112, 127, 140, 153, 166, 179, 189, 195,
-194, 187, 176, 163, 149, 135, 123, 112, 100,  91,  84,  82,  85,  92, 101, 111, 120, 128, 135, 142,
-148, 152, 153, 152, 150, 146, 142, 140, 139, 138, 139, 139, 140, 141, 143, 146, 148, 149, 147, 144,
-140, 135, 130, 125, 120, 115, 109, 105, 103, 103, 106, 111, 115, 120, 124, 128, 132, 136, 138, 138,
-135, 130, 122, 113, 103,  94,  84,  76,  70,  67,  70,  78,  90, 105, 120, 134, 149, 163, 176, 187,
-194, 195, 189, 180, 167, 154, 141, 127, 113, 101,  91,  85,  82,  84,  90,  98, 107, 117, 126, 135,
-143, 149, 153, 155, 154, 152, 149, 145, 140, 137, 136, 136, 136, 137, 138, 140, 144, 147, 149, 149,
-146, 143, 139, 134, 129, 123, 116, 110, 105, 103, 102, 104, 107, 112, 116, 122, 128, 133, 137, 139,
-139, 137, 132, 125, 117, 107,  96,  85,  75,  67,  64,  66,  74,  86, 100, 115, 130, 146, 162, 177,
-189, 196, 197, 192, 183, 172, 159, 145, 130, 115, 101,  90,  83,  81,  82,  88,  96, 105, 115, 126,
-136, 144, 151, 155, 158, 157, 154, 150, 146, 141, 138, 136, 134, 133, 133, 135, 138, 142, 145, 148,
-148, 147, 144, 140, 136, 131, 125, 118, 111, 106, 103, 102, 103, 107, 111, 116, 121, 127, 133, 138,
-140, 140, 138, 133, 127, 119, 109,  97,  86,  76,  69,  65,  67,  74,  84,  97, 111, 126, 143, 160,
-175, 186, 192, 193, 190, 184, 174, 162, 148, 133, 118, 103,  92,  85,  82,  84,  88,  95, 104, 114,
-124, 134, 143, 150, 154, 157, 157, 155, 151, 146, 142, 138, 135, 133, 132, 132, 134, 137, 141, 145,
-148, 150, 150, 148, 145, 141, 135, 129, 122, 114, 108, 104, 102, 101, 103, 106, 110, 116, 122, 128,
-134, 138, 139, 138, 135, 130, 122, 114, 104,  93,  82,  73,  68,  68,  73,  81,  93, 106, 120, 135,
-151, 166, 179, 188, 192, 190, 185, 177, 167, 155, 141, 126, 112, 100,  91,  86,  85,  88,  94, 101,
-110, 120, 129, 138, 146, 151, 155, 156, 154, 151, 147, 142, 138, 135, 133, 132, 132, 132, 134, 137,
-142, 146, 149, 150, 149, 146, 142, 138, 132, 125, 118, 112, 107, 104, 103, 104, 106, 110, 114, 119,
-125, 131, 135, 137, 137, 134, 129, 122, 114, 105,  95,  85,  77,  71,  71,  75,  83,  94, 105, 118,
-132, 147, 162, 175, 184, 188, 188, 184, 177, 168, 158, 145, 131, 117, 104,  95,  89,  87,  88,  92,
- 99, 107, 115, 124, 133, 142, 149, 154, 156, 156, 154, 151, 147, 143, 139, 136, 133, 132, 131, 132,
-134, 136, 139, 142, 143, 143, 143, 141, 139, 135, 130, 125, 119, 114, 111, 109, 109, 110, 112, 114,
-118, 122, 126, 130, 132, 133, 132, 129, 123, 115, 107,  98,  89,  81,  74,  72,  73,  79,  89, 100,
-113, 126, 139, 154, 168, 179, 187, 189, 187, 181, 173, 163, 152, 140, 127, 114, 102,  94,  90,  89,
- 92,  97, 103, 111, 120, 128, 136, 143, 148, 152, 153, 152, 149, 146, 143, 140, 137, 135, 133, 133,
-133, 135, 138, 141, 143, 144, 144, 143, 141, 139, 136, 131, 126, 120, 116, 112, 110, 110, 110, 112,
-115, 118, 122, 126, 130, 132, 133, 131, 127, 122, 114, 105,  96,  86,  79,  73,  72,  75,  81,  90,
-101, 113, 127, 142, 157, 169, 179, 185, 186, 184, 178, 171, 161, 150, 137, 123, 112, 102,  96,  92,
- 92,  95, 100, 106, 113, 121, 129, 137, 143, 148, 150, 152, 151, 149, 146, 143, 140, 137, 135, 133,
-132, 132, 134, 136, 138, 140, 141, 141, 140, 139, 138, 135, 132, 128, 124, 120, 118, 116, 115, 116,
-117, 119, 121, 123, 126, 128, 129, 129, 127, 123, 118, 111, 104,  95,  87,  79,  74,  73,  76,  82,
- 90, 100, 110, 123, 136, 151, 164, 175, 182, 184, 183, 178, 171, 163, 153, 142, 130, 119, 108, 100,
- 96,  95,  97, 102, 107, 113, 120, 127, 133, 140, 145, 148, 150, 149, 147, 145, 142, 140, 137, 135,
-133, 132, 132, 133, 134, 137, 139, 140, 141, 140, 139, 138, 136, 133, 130, 126, 122, 119, 118, 117,
-117, 118, 119, 121, 123, 125, 128, 129, 129, 126, 122, 117, 110, 103,  95,  87,  80,  76,  75,  78,
- 84,  91, 100, 110, 122, 135, 149, 161, 171, 176, 178, 177, 175, 170, 163, 154, 144, 133, 122, 113,
-107, 103, 101, 102, 104, 108, 113, 119, 125, 131, 137, 142, 145, 147, 147, 146, 144, 143, 141, 138,
-136, 133, 132, 132, 133, 135, 137, 138, 139, 139, 139, 140, 139, 138, 135, 131, 127, 122, 119, 118,
-117, 117, 117, 118, 119, 121, 124, 127, 129, 130, 128, 125, 121, 115, 108, 100,  92,  84,  78,  75,
- 75,  78,  85,  93, 104, 115, 128, 142, 155, 167, 176, 180, 182, 180, 176, 168, 159, 149, 137, 126,
-116, 108, 102,  99,  99, 101, 106, 111, 117, 124, 130, 136, 141, 145, 147, 147, 145, 143, 141, 138,
-136, 134, 133, 133, 133, 134, 136, 138, 140, 142, 143, 143, 142, 140, 137, 133, 129, 125, 121, 117,
-115, 113, 114, 115, 117, 119, 123, 126, 129, 131, 132, 132, 129, 125, 120, 113, 105,  97,  89,  81,
- 76,  73,  74,  79,  87,  97, 110, 123, 136, 149, 162, 173, 182, 186, 186, 182, 174, 164, 153, 142,
-130, 118, 108,  99,  94,  92,  94,  98, 105, 112, 120, 128, 135, 141, 146, 149, 151, 151, 149, 146,
-143, 140, 137, 135, 134, 134, 135, 135, 136, 138, 141, 142, 143, 142, 140, 137, 133, 129, 125, 120,
-117, 113, 112, 111, 112, 114, 117, 121, 125, 129, 132, 134, 135, 133, 130, 124, 117, 109, 100,  91,
- 82,  74,  69,  68,  72,  81,  94, 108, 122, 137, 151, 165, 177, 187, 193, 193, 187, 178, 166, 154,
-141, 128, 115, 104,  94,  88,  86,  88,  93, 101, 110, 118, 126, 134, 141, 146, 150, 152, 152, 150,
-147, 143, 139, 137, 137, 137, 138, 139, 141, 142, 144, 146, 147, 147, 145, 141, 136, 131, 126, 121,
-114, 108, 104, 102, 103, 106, 110, 114, 119, 124, 129, 133, 137, 139, 138, 135, 129, 121, 113, 104,
- 94,  84,  75,  69,  68,  72,  80,  92, 106, 121, 135, 150, 165, 179, 188, 193, 193, 188, 180, 168,
-155, 141, 128, 114, 102,  92,  85,  83,  85,  91,  98, 107, 116, 125, 134, 141, 147, 151, 153, 152,
-150, 147, 144, 141, 139, 137, 136, 137, 139, 140, 142, 144, 147, 148, 148, 146, 143, 139, 134, 128,
-122, 116, 111, 107, 105, 104, 105, 108, 112, 117, 121, 126, 131, 135, 136, 136, 134, 130, 124, 117,
-108,  98,  89,  80,  73,  69,  69,  76,  88, 102, 117, 131, 145, 158, 171, 183, 192, 195, 192, 184,
-171, 157, 144, 131, 119, 107,  97,  88,  83,  83,  87,  95, 105, 114, 123, 131, 138, 144, 150, 153,
-153, 151, 148, 144, 141, 139, 138, 138, 139, 139, 140, 142, 144, 147, 148, 148, 146, 143, 139, 134,
-129, 124, 118, 113, 108, 104, 103, 104, 108, 112, 117, 121, 126, 130, 134, 137, 138, 137, 133, 127,
-119, 109, 100,  90,  81,  73,  68,  68,  72,  82,  95, 110, 125, 140, 154, 168, 181, 190, 195, 193,
-186, 175, 163, 150, 136, 122, 108,  97,  88,  83,  83,  86,  92, 101, 111, 121, 130, 138, 146, 151,
-154, 155, 154, 151, 147, 143, 139, 136, 136, 136, 137, 137, 139, 141, 145, 148, 149, 148, 145, 141,
-137, 132, 127, 120, 114, 108, 104, 102, 103, 105, 109, 113, 118, 124, 130, 135, 138, 140, 139, 135,
-130, 122, 113, 103,  92,  81,  72,  66,  64,  69,  78,  91, 105, 120, 136, 152, 167, 181, 192, 197,
-195, 189, 179, 167, 154, 140, 125, 110,  97,  87,  82,  81,  84,  90,  99, 109, 119, 129, 139, 147,
-153, 156, 158, 156, 153, 148, 144, 140, 137, 135, 133, 133, 134, 136, 139, 143, 147, 148, 148, 146,
-143, 139, 134, 129, 122, 115, 109, 105, 103, 102, 104, 108, 113, 118, 123, 129, 135, 139, 141, 140,
-137, 131, 124, 115, 105,  93,  82,  73,  67,  65,  69,  77,  89, 102, 116, 132, 149, 166, 180, 189,
-193, 193, 188, 181, 170, 157, 143, 127, 112,  99,  89,  84,  82,  85,  90,  98, 107, 117, 128, 137,
-145, 152, 155, 157, 156, 153, 149, 145, 140, 137, 134, 133, 132, 133, 135, 139, 142, 146, 149, 150,
-149, 147, 144, 139, 133, 126, 119, 112, 106, 103, 101, 102, 104, 107, 112, 118, 124, 130, 135, 139,
-139, 138, 133, 127, 120, 111, 100,  89,  79,  71,  68,  69,  75,  85,  97, 111, 125, 141, 157, 172,
-183, 190, 192, 189, 183, 174, 163, 150, 136, 121, 108,  96,  88,  85,  86,  90,  96, 104, 113, 123,
-133, 141, 148, 153, 155, 155, 153, 150, 145, 140, 137, 134, 132, 132, 132, 133, 135, 139, 143, 147,
-149, 149, 148, 145, 141, 136, 130, 123, 116, 110, 106, 104, 103, 105, 107, 111, 116, 122, 127, 133,
-136, 137, 136, 132, 127, 119, 111, 101,  91,  82,  74,  71,  72,  78,  87,  98, 110, 123, 137, 153,
-167, 179, 186, 188, 187, 182, 174, 165, 153, 140, 125, 112, 101,  93,  88,  87,  89,  94, 101, 110,
-118, 127, 137, 145, 151, 155, 156, 156, 153, 150, 146, 142, 138, 135, 133, 131, 131, 132, 135, 138,
-140, 142, 143, 143, 142, 140, 137, 133, 128, 123, 117, 113, 110, 108, 109, 110, 113, 115, 119, 123,
-127, 131, 133, 133, 131, 127, 120, 112, 104,  95,  86,  78,  73,  72,  75,  82,  93, 105, 117, 131,
-144, 159, 172, 183, 188, 189, 185, 178, 169, 159, 148, 135, 122, 109,  99,  92,  89,  90,  93,  99,
-106, 114, 123, 131, 139, 145, 150, 152, 153, 151, 148, 145, 142, 139, 136, 134, 133, 133, 134, 136,
-139, 142, 143, 144, 143, 142, 141, 138, 134, 129, 124, 118, 114, 111, 110, 110, 111, 113, 116, 119,
-123, 127, 131, 132, 132, 130, 125, 119, 111, 102,  92,  83,  76,  72,  72,  76,  84,  94, 105, 118,
-132, 147, 161, 173, 182, 186, 185, 182, 176, 168, 157, 145, 132, 119, 108,  99,  94,  92,  93,  97,
-102, 108, 116, 124, 132, 139, 145, 149, 151, 151, 150, 148, 145, 142, 139, 136, 134, 133, 132, 133,
-134, 136, 139, 140, 141, 141, 140, 139, 137, 134, 131, 127, 123, 119, 117, 116, 116, 116, 118, 119,
-122, 124, 127, 128, 129, 128, 126, 122, 116, 109, 101,  92,  84,  77,  73,  74,  78,  85,  94, 103,
-115, 128, 142, 156, 169, 178, 184, 184, 181, 175, 168, 160, 149, 138, 126, 115, 105,  98,  95,  96,
- 99, 104, 109, 116, 122, 129, 136, 142, 146, 149, 150, 149, 146, 144, 141, 139, 137, 135, 133, 132,
-132, 133, 135, 138, 140, 141, 141, 140, 139, 137, 135, 132, 129, 125, 121, 119, 117, 117, 118, 118,
-120, 122, 124, 126, 128, 129, 128, 125, 120, 114, 108, 100,  92,  84,  78,  75,  76,  80,  86,  95,
-104, 115, 127, 140, 154, 165, 173, 178, 178, 177, 173, 167, 160, 150, 140, 129, 119, 111, 105, 102,
-101, 102, 105, 110, 115, 121, 127, 133, 139, 143, 146, 147, 146, 145, 144, 142, 140, 137, 135, 133,
-132, 132, 133, 135, 137, 138, 139, 139, 139, 140, 139, 138, 135, 130, 126, 122, 120, 119, 118, 118,
-118, 118, 120, 122, 125, 127, 128, 128, 126, 122, 117, 111, 104,  96,  89,  82,  77,  76,  77,  82,
- 90,  99, 109, 120, 132, 146, 158, 169, 175, 178, 178, 175, 171, 164, 156, 145, 135, 125, 116, 110,
-106, 104, 104, 107, 110, 115, 121, 126, 132, 137, 142, 145, 146, 145, 144, 142, 140, 138, 135, 133,
-131, 130, 130, 130, 132, 134, 136, 137, 138, 139, 140, 140, 138, 136, 133, 129, 126, 123, 121, 120,
-119, 119, 120, 121, 123, 125, 128, 129, 129, 127, 124, 120, 114, 107,  99,  91,  84,  79,  76,  76,
- 80,  85,  93, 102, 113, 125, 138, 150, 160, 169, 174, 176, 175, 173, 168, 160, 152, 142, 132, 124,
-117, 111, 108, 106, 107, 110, 114, 119, 124, 130, 136, 140, 144, 146, 147, 146, 144, 142, 139, 136,
-133, 130, 128, 127, 127, 127, 129, 130, 132, 134, 135, 137, 138, 138, 137, 136, 134, 132, 129, 127,
-126, 124, 124, 123, 123, 124, 125, 126, 127, 127, 126, 124, 120, 115, 108, 100,  93,  86,  82,  79,
- 78,  80,  84,  89,  97, 107, 118, 130, 142, 152, 161, 166, 170, 172, 171, 169, 163, 156, 148, 139,
-131, 124, 118, 114, 113, 112, 113, 116, 120, 124, 129, 134, 138, 142, 144, 146, 146, 144, 142, 140,
-137, 134, 131, 128, 125, 124, 124, 125, 126, 128, 129, 131, 133, 135, 136, 136, 136, 135, 134, 132,
-130, 129, 128, 127, 126, 125, 125, 126, 127, 128, 128, 126, 123, 119, 115, 109, 103,  95,  88,  83,
- 80,  79,  80,  83,  88,  95, 104, 114, 126, 137, 148, 157, 163, 167, 170, 170, 168, 164, 158, 150,
-142, 134, 127, 121, 117, 115, 114, 115, 117, 120, 124, 129, 134, 139, 142, 145, 147, 147, 146, 144,
-142, 139, 135, 131, 127, 124, 122, 121, 122, 122, 123, 124, 126, 128, 130, 133, 134, 135, 135, 135,
-134, 133, 132, 132, 131, 130, 129, 128, 128, 128, 129, 128, 126, 124, 120, 115, 110, 104,  98,  92,
- 86,  82,  80,  81,  84,  88,  94, 102, 111, 121, 131, 141, 150, 156, 161, 164, 165, 164, 161, 156,
-151, 144, 138, 132, 127, 123, 120, 120, 120, 122, 124, 127, 131, 135, 139, 142, 144, 145, 145, 145,
-143, 141, 138, 135, 131, 128, 124, 122, 121, 121, 121, 122, 123, 124, 126, 128, 130, 132, 134, 134,
-134, 134, 133, 133, 133, 132, 132, 130, 129, 129, 128, 128, 127, 125, 122, 118, 114, 109, 104,  98,
- 92,  87,  84,  84,  85,  88,  91,  97, 104, 112, 122, 131, 140, 147, 153, 158, 160, 161, 160, 157,
-152, 147, 142, 136, 131, 126, 123, 121, 121, 122, 123, 126, 129, 134, 138, 142, 145, 147, 148, 148,
-147, 145, 143, 140, 135, 131, 127, 124, 121, 120, 119, 119, 119, 120, 122, 124, 126, 129, 131, 133,
-134, 134, 134, 134, 134, 133, 132, 131, 130, 129, 127, 127, 126, 126, 125, 122, 119, 116, 112, 108,
-104,  99,  94,  90,  88,  88,  90,  93,  97, 102, 108, 115, 124, 133, 141, 148, 153, 156, 158, 159,
-158, 155, 151, 146, 140, 135, 130, 126, 124, 123, 122, 123, 125, 128, 131, 135, 139, 143, 146, 147,
-148, 148, 146, 144, 142, 139, 135, 131, 127, 123, 121, 119, 119, 119, 119, 120, 121, 123, 125, 128,
-130, 132, 133, 133, 134, 134, 134, 134, 133, 132, 131, 129, 128, 127, 125, 123, 119, 115, 111, 106,
-102,  97,  93,  90,  89,  89,  91,  93,  97, 102, 109, 116, 124, 131, 138, 145, 149, 153, 155, 156,
-155, 153, 150, 146, 141, 136, 132, 129, 126, 124, 124, 124, 125, 128, 131, 134, 138, 141, 144, 146,
-148, 148, 148, 146, 144, 141, 138, 134, 130, 127, 123, 121, 119, 118, 118, 118, 118, 120, 121, 124,
-126, 128, 130, 132, 133, 134, 134, 135, 135, 135, 134, 133, 132, 130, 128, 126, 123, 119, 115, 111,
-106, 101,  96,  93,  90,  89,  90,  92,  96, 100, 105, 111, 118, 125, 133, 139, 144, 148, 151, 152,
-152, 151, 149, 146, 142, 138, 134, 131, 128, 127, 126, 126, 127, 129, 131, 134, 137, 141, 144, 146,
-148, 148, 148, 147, 145, 143, 140, 137, 133, 129, 126, 123, 121, 120, 119, 118, 118, 119, 121, 122,
-124, 126, 128, 130, 131, 132, 132, 133, 133, 133, 133, 132, 131, 130, 128, 127, 125, 122, 118, 114,
-110, 105, 101,  97,  94,  92,  92,  93,  95,  98, 103, 107, 113, 120, 127, 133, 139, 144, 147, 149,
-151, 151, 149, 147, 144, 140, 136, 133, 130, 128, 126, 126, 127, 128, 130, 133, 136, 140, 143, 146,
-148, 149, 149, 149, 148, 146, 143, 139, 136, 132, 128, 125, 122, 120, 118, 117, 117, 117, 118, 120,
-122, 124, 126, 128, 129, 130, 131, 132, 132, 133, 132, 132, 131, 130, 130, 129, 127, 125, 122, 119,
-115, 111, 107, 103,  99,  96,  94,  93,  94,  96,  99, 103, 108, 114, 120, 127, 133, 139, 143, 146,
-148, 149, 148, 147, 145, 142, 139, 135, 132, 129, 127, 126, 126, 127, 128, 131, 133, 137, 140, 143,
-146, 148, 149, 150, 149, 148, 146, 143, 140, 136, 133, 129, 125, 122, 120, 119, 118, 117, 118, 118,
-119, 121, 123, 125, 127, 129, 130, 131, 132, 132, 132, 132, 132, 131, 130, 129, 127, 126, 123, 121,
-117, 114, 110, 105, 101,  98,  96,  95,  95,  96,  98, 101, 105, 110, 116, 122, 128, 134, 139, 143,
-146, 148, 149, 149, 148, 145, 142, 138, 135, 132, 129, 128, 127, 127, 127, 128, 130, 133, 136, 140,
-143, 146, 148, 149, 149, 149, 148, 146, 143, 140, 136, 132, 128, 125, 122, 120, 118, 117, 117, 117,
-117, 119, 120, 122, 124, 126, 128, 129, 130, 131, 132, 132, 133, 132, 132, 131, 131, 129, 128, 126,
-123, 120, 116, 112, 108, 104, 100,  97,  95,  95,  96,  98, 100, 104, 108, 114, 120, 126, 132, 137,
-141, 144, 146, 147, 147, 146, 145, 142, 139, 135, 132, 129, 128, 127, 127, 128, 129, 130, 133, 136,
-139, 143, 146, 148, 149, 150, 150, 149, 147, 145, 142, 138, 134, 131, 127, 124, 121, 120, 119, 118,
-118, 119, 119, 120, 122, 123, 125, 126, 127, 127, 128, 128, 129, 129, 130, 130, 130, 129, 129, 129,
-127, 125, 123, 119, 115, 111, 106, 102,  98,  96,  94,  94,  95,  98, 102, 107, 113, 119, 126, 133,
-140, 145, 149, 152, 153, 152, 151, 148, 144, 139, 134, 129, 125, 121, 119, 118, 119, 120, 123, 127,
-131, 135, 140, 144, 148, 150, 151, 152, 151, 149, 147, 144, 140, 136, 133, 129, 127, 125, 124, 123,
-123, 123, 123, 124, 125, 125, 126, 126, 126, 125, 125, 124, 124, 124, 124, 125, 125, 126, 127, 127,
-128, 128, 127, 125, 123, 119, 114, 109, 104,  99,  95,  91,  90,  90,  92,  97, 102, 109, 117, 125,
-134, 142, 150, 156, 160, 162, 161, 158, 154, 149, 143, 136, 129, 122, 117, 113, 111, 111, 113, 116,
-120, 125, 130, 136, 141, 146, 149, 151, 152, 151, 149, 147, 144, 141, 138, 135, 132, 130, 128, 128,
-128, 128, 129, 129, 129, 129, 129, 129, 128, 126, 125, 123, 121, 120, 120, 120, 121, 122, 123, 124,
-126, 128, 129, 129, 128, 125, 121, 116, 110, 104,  97,  92,  87,  85,  85,  88,  93, 100, 108, 117,
-127, 138, 148, 157, 164, 167, 168, 167, 163, 158, 151, 143, 134, 125, 117, 111, 107, 105, 105, 107,
-111, 116, 121, 128, 134, 140, 145, 148, 150, 151, 150, 149, 147, 144, 141, 138, 135, 133, 131, 131,
-131, 131, 132, 133, 133, 133, 133, 132, 131, 130, 128, 126, 124, 122, 120, 120, 120, 121, 122, 123,
-124, 126, 127, 128, 128, 127, 124, 120, 115, 109, 102,  95,  88,  82,  79,  80,  83,  89,  97, 105,
-115, 127, 139, 151, 162, 171, 175, 176, 174, 169, 163, 156, 147, 137, 127, 117, 109, 103, 100, 100,
-103, 107, 113, 118, 124, 130, 137, 142, 147, 149, 150, 149, 147, 144, 142, 139, 137, 135, 133, 132,
-131, 132, 134, 136, 138, 138, 138, 138, 137, 136, 134, 132, 128, 125, 121, 119, 118, 118, 118, 119,
-120, 122, 124, 126, 128, 129, 128, 125, 120, 114, 108, 100,  92,  84,  78,  75,  76,  80,  87,  95,
-104, 115, 127, 140, 154, 165, 173, 178, 178, 177, 173, 167, 160, 150, 140, 129, 119, 111, 105, 102,
-101, 102, 105, 110, 115, 121, 127, 133, 139, 143, 146, 147, 146, 145, 144, 142, 140, 137, 135, 133,
-132, 132, 133, 135, 137, 138, 139, 139, 139, 140, 139, 138, 135, 130, 126, 122, 120, 119, 118, 118,
-118, 118, 120, 122, 125, 127, 128, 128, 126, 122, 117, 111, 104,  96,  89,  82,  77,  76,  78,  82,
- 90,  99, 109, 120, 132, 146, 158, 169, 175, 178, 178, 175, 171, 164, 156, 145, 135, 125, 116, 110,
-106, 104, 104, 107, 110, 115, 121, 126, 132, 137, 142, 145, 146, 145, 144, 142, 140, 138, 135, 133,
-131, 130, 130, 130, 132, 134, 136, 137, 138, 139, 140, 140, 138, 136, 133, 129, 126, 123, 121, 120,
-119, 119, 120, 121, 123, 125, 128, 129, 129, 127, 124, 120, 114, 107,  99,  91,  84,  79,  76,  76,
- 80,  85,  93, 102, 113, 125, 138, 150, 160, 169, 174, 176, 175, 173, 168, 160, 152, 142, 132, 124,
-117, 111, 108, 106, 107, 110, 114, 119, 124, 130, 136, 140, 144, 146, 147, 146, 144, 142, 139, 136,
-133, 130, 128, 127, 127, 127, 129, 130, 132, 134, 135, 137, 138, 138, 137, 136, 134, 132, 129, 127,
-126, 124, 124, 123, 123, 124, 125, 126, 127, 127, 126, 124, 120, 115, 108, 100,  93,  86,  82,  79,
- 78,  80,  84,  89,  97, 107, 118, 130, 142, 152, 161, 166, 170, 172, 171, 169, 163, 156, 148, 139,
-131, 124, 118, 114, 113, 112, 113, 116, 120, 124, 129, 134, 138, 142, 144, 146, 146, 144, 142, 140,
-137, 134, 131, 128, 125, 124, 124, 125, 126, 128, 129, 131, 133, 135, 136, 137, 136, 135, 134, 132,
-130, 129, 128, 127, 126, 125, 125, 126, 127, 128, 128, 126, 123, 119, 115, 109, 103,  95,  88,  83,
- 80,  79,  80,  83,  88,  95, 104, 114, 126, 137, 148, 157, 163, 167, 170, 170, 168, 164, 158, 150,
-142, 134, 127, 121, 117, 115, 114, 115, 117, 120, 124, 129, 134, 139, 143, 145, 147, 147, 146, 144,
-142, 139, 135, 131, 127, 124, 122, 121, 122, 122, 123, 124, 126, 128, 130, 133, 134, 135, 135, 135,
-134, 133, 132, 132, 131, 130, 129, 128, 128, 128, 128, 128, 126, 124, 120, 115, 110, 104,  98,  92,
- 86,  82,  80,  81,  84,  88,  94, 102, 111, 121, 131, 141, 150, 156, 161, 164, 165, 164, 161, 156,
-151, 144, 138, 132, 127, 123, 120, 119, 120, 122, 124, 127, 131, 135, 139, 142, 144, 145, 145, 145,
-143, 141, 138, 135, 131, 128, 124, 122, 121, 121, 121, 122, 123, 124, 126, 128, 130, 132, 134, 134,
-134, 134, 133, 133, 133, 132, 131, 130, 129, 129, 128, 128, 127, 125, 122, 118, 114, 109, 104,  98,
- 92,  87,  84,  84,  85,  88,  91,  97, 104, 112, 122, 131, 140, 147, 153, 158, 160, 161, 160, 157,
-152, 147, 142, 136, 131, 126, 123, 121, 121, 122, 123, 126, 129, 134, 138, 142, 145, 147, 148, 148,
-147, 145, 143, 140, 135, 131, 127, 124, 121, 120, 119, 119, 119, 120, 122, 124, 126, 129, 131, 133,
-134, 134, 134, 134, 134, 133, 132, 131, 130, 129, 127, 127, 126, 126, 125, 122, 119, 116, 112, 108,
-104,  99,  94,  90,  88,  88,  90,  93,  97, 102, 108, 115, 124, 133, 141, 148, 153, 156, 158, 159,
-158, 155, 151, 146, 140, 135, 130, 126, 124, 123, 122, 123, 125, 128, 131, 135, 139, 143, 146, 147,
-148, 148, 146, 144, 142, 139, 135, 131, 127, 123, 121, 119, 119, 119, 119, 120, 121, 123, 125, 128,
-130, 132, 133, 133, 134, 134, 134, 134, 133, 132, 131, 129, 128, 127, 125, 123, 119, 115, 111, 106,
-102,  97,  93,  90,  89,  89,  91,  93,  97, 102, 109, 116, 124, 131, 138, 145, 149, 153, 155, 156,
-155, 153, 150, 146, 141, 136, 132, 129, 126, 124, 124, 124, 125, 128, 131, 134, 138, 141, 144, 146,
-148, 148, 148, 146, 144, 141, 138, 134, 130, 127, 123, 121, 119, 118, 118, 118, 118, 120, 121, 124,
-126, 128, 130, 132, 133, 134, 134, 135, 135, 135, 134, 133, 132, 130, 128, 126, 123, 119, 115, 111,
-106, 101,  96,  93,  90,  89,  90,  92,  96, 100, 105, 111, 118, 125, 133, 139, 144, 148, 151, 152,
-152, 151, 149, 146, 142, 138, 134, 131, 128, 127, 126, 126, 127, 129, 131, 134, 137, 141, 144, 146,
-148, 148, 148, 147, 145, 143, 140, 137, 133, 129, 126, 123, 121, 120, 119, 118, 118, 119, 121, 122,
-124, 126, 128, 130, 131, 132, 132, 133, 133, 133, 133, 132, 131, 130, 128, 127, 125, 122, 118, 114,
-110, 105, 101,  97,  94,  92,  92,  93,  95,  98, 103, 107, 113, 120, 127, 133, 139, 144, 147, 149,
-150, 151, 149, 147, 144, 140, 136, 133, 130, 128, 126, 126, 127, 128, 130, 133, 136, 140, 143, 146,
-148, 149, 149, 149, 148, 146, 143, 139, 136, 132, 128, 125, 122, 120, 118, 117, 117, 117, 118, 120,
-122, 124, 126, 128, 129, 130, 131, 132, 132, 133, 132, 132, 131, 130, 130, 129, 127, 125, 122, 119,
-115, 111, 107, 103,  99,  96,  94,  93,  94,  96,  99, 103, 108, 114, 120, 127, 133, 139, 143, 146,
-148, 149, 148, 147, 145, 142, 139, 135, 132, 129, 127, 126, 126, 127, 128, 131, 133, 137, 140, 143,
-146, 148, 149, 150, 149, 148, 146, 143, 140, 136, 133, 129, 125, 122, 120, 119, 118, 117, 118, 118,
-120, 121, 123, 125, 127, 129, 130, 131, 132, 132, 132, 132, 132, 131, 130, 129, 127, 126, 123, 121,
-117, 114, 110, 105, 101,  98,  96,  95,  95,  96,  98, 101, 105, 110, 116, 122, 129, 134, 139, 143,
-146, 148, 149, 149, 148, 145, 142, 138, 135, 132, 129, 128, 127, 127, 127, 128, 130, 133, 136, 140,
-143, 146, 148, 149, 149, 149, 148, 146, 143, 140, 136, 132, 128, 125, 122, 120, 118, 117, 117, 117,
-117, 119, 120, 122, 124, 126, 128, 129, 130, 131, 132, 132, 133, 132, 132, 131, 131, 129, 128, 126,
-123, 120, 116, 112, 108, 104, 100,  97,  95,  95,  96,  98, 101, 104, 108, 114, 120, 126, 132, 137,
-141, 144, 146, 147, 147, 146, 145, 142, 139, 136, 132, 129, 128, 127, 127, 128, 129, 131, 133, 136,
-139, 143, 146, 148, 149, 150, 150, 149, 147, 145, 142, 139, 135, 131, 127, 123, 121, 119, 117, 117,
-116, 116, 117, 118, 120, 122, 124, 126, 128, 129, 130, 131, 132, 132, 132, 132, 131, 130, 129, 128,
-126, 124, 121, 117, 113, 109, 106, 102,  99,  98,  97,  98,  99, 102, 105, 109, 113, 119, 124, 129,
-134, 138, 141, 144, 145, 146, 146, 144, 142, 139, 136, 133, 131, 129, 127, 127, 127, 128, 129, 131,
-134, 137, 141, 144, 147, 149, 150, 150, 150, 149, 147, 144, 141, 137, 133, 129, 125, 122, 120, 118,
-117, 116, 116, 116, 118, 119, 121, 123, 125, 126, 128, 129, 130, 131, 132, 132, 131, 131, 130, 129,
-128, 126, 124, 121, 118, 115, 111, 108, 104, 102, 100,  99,  99, 100, 102, 105, 108, 112, 117, 122,
-127, 132, 136, 140, 142, 144, 145, 145, 144, 142, 140, 137, 134, 132, 129, 128, 127, 127, 127, 129,
-130, 133, 136, 140, 143, 146, 149, 150, 151, 151, 150, 149, 146, 143, 139, 135, 131, 127, 123, 120,
-118, 116, 115, 114, 114, 115, 117, 119, 122, 124, 126, 127, 129, 130, 131, 132, 132, 132, 131, 130,
-129, 128, 126, 124, 122, 119, 116, 113, 109, 106, 104, 102, 101, 101, 102, 103, 105, 108, 112, 116,
-121, 125, 130, 134, 137, 140, 142, 143, 144, 143, 142, 140, 138, 135, 133, 130, 128, 127, 126, 126,
-127, 129, 131, 134, 137, 141, 144, 147, 149, 150, 151, 150, 149, 148, 145, 141, 138, 134, 130, 126,
-122, 120, 117, 116, 115, 114, 115, 116, 117, 119, 121, 124, 126, 128, 129, 131, 132, 132, 133, 133,
-132, 131, 129, 128, 125, 123, 120, 116, 113, 109, 106, 104, 102, 101, 101, 102, 104, 106, 109, 113,
-118, 122, 127, 131, 135, 138, 140, 142, 142, 142, 141, 140, 137, 135, 132, 130, 128, 127, 126, 126,
-126, 128, 130, 133, 136, 139, 143, 146, 148, 150, 151, 151, 150, 149, 147, 144, 140, 137, 132, 128,
-125, 122, 120, 118, 117, 116, 116, 116, 117, 119, 121, 123, 124, 126, 127, 129, 130, 131, 131, 131,
-130, 130, 129, 128, 127, 125, 122, 119, 116, 113, 110, 107, 105, 103, 102, 102, 103, 105, 107, 110,
-114, 118, 122, 127, 131, 135, 138, 140, 142, 143, 143, 143, 141, 139, 136, 134, 131, 129, 127, 126,
-125, 125, 126, 128, 131, 134, 137, 141, 144, 147, 149, 150, 151, 151, 150, 148, 145, 142, 138, 134,
-130, 126, 122, 119, 117, 115, 114, 114, 114, 115, 116, 118, 120, 122, 124, 126, 128, 130, 131, 132,
-133, 133, 132, 131, 130, 129, 127, 124, 121, 117, 113, 110, 107, 104, 102, 102, 102, 102, 104, 107,
-110, 114, 119, 123, 128, 132, 135, 138, 141, 142, 143, 143, 142, 140, 138, 135, 133, 130, 128, 126,
-125, 124, 125, 126, 128, 130, 133, 137, 140, 144, 147, 149, 151, 152, 151, 150, 148, 146, 143, 139,
-134, 130, 126, 122, 119, 117, 115, 114, 114, 114, 115, 117, 119, 121, 123, 125, 127, 129, 130, 131,
-132, 132, 131, 130, 129, 127, 125, 123, 120, 116, 113, 110, 107, 105, 103, 102, 102, 103, 105, 108,
-111, 115, 119, 123, 127, 132, 135, 138, 141, 142, 143, 143, 142, 141, 138, 136, 133, 131, 129, 127,
-125, 125, 125, 126, 128, 131, 133, 137, 140, 143, 146, 148, 150, 151, 151, 150, 148, 145, 142, 138,
-134, 130, 126, 122, 119, 117, 115, 113, 113, 113, 114, 115, 118, 120, 122, 124, 126, 128, 130, 131,
-132, 133, 133, 132, 131, 129, 127, 125, 122, 119, 116, 112, 110, 107, 105, 104, 104, 105, 106, 108,
-111, 115, 119, 123, 127, 131, 135, 138, 140, 141, 142, 141, 140, 139, 137, 135, 132, 130, 128, 126,
-125, 125, 126, 127, 129, 131, 134, 137, 140, 143, 146, 148, 149, 150, 150, 149, 147, 144, 141, 137,
-134, 130, 126, 123, 120, 118, 116, 116, 115, 116, 117, 118, 120, 122, 124, 125, 127, 128, 129, 130,
-130, 129, 128, 127, 125, 123, 121, 118, 115, 112, 110, 107, 106, 105, 105, 106, 107, 109, 112, 115,
-119, 123, 127, 131, 134, 137, 140, 141, 142, 143, 142, 141, 139, 137, 134, 132, 130, 128, 127, 127,
-127, 127, 129, 131, 133, 136, 139, 142, 144, 146, 148, 149, 148, 148, 146, 144, 141, 137, 134, 130,
-126, 123, 120, 118, 116, 115, 114, 114, 115, 117, 118, 120, 122, 124, 126, 128, 129, 130, 131, 130,
-129, 128, 125, 123, 120, 117, 114, 110, 108, 105, 104, 104, 104, 106, 108, 111, 114, 118, 123, 127,
-132, 135, 139, 141, 143, 144, 144, 143, 141, 139, 137, 134, 131, 129, 127, 126, 125, 125, 127, 128,
-131, 133, 137, 140, 143, 145, 148, 149, 149, 149, 148, 146, 143, 140, 136, 132, 128, 124, 121, 118,
-116, 115, 114, 114, 115, 116, 118, 120, 122, 124, 126, 127, 129, 130, 130, 130, 128, 127, 124, 122,
-119, 116, 113, 110, 107, 106, 105, 105, 105, 107, 109, 112, 115, 119, 124, 128, 132, 136, 139, 141,
-143, 144, 144, 143, 141, 139, 137, 134, 132, 130, 128, 127, 126, 126, 127, 129, 131, 133, 136, 139,
-142, 144, 146, 147, 147, 147, 146, 144, 142, 138, 135, 131, 128, 124, 121, 119, 117, 115, 114, 114,
-115, 116, 118, 120, 122, 124, 126, 128, 130, 131, 131, 131, 130, 128, 126, 124, 121, 118, 114, 111,
-108, 106, 104, 104, 104, 105, 107, 110, 114, 118, 122, 127, 131, 135, 138, 141, 143, 144, 144, 143,
-142, 139, 137, 134, 132, 129, 127, 126, 125, 125, 126, 128, 130, 132, 135, 139, 142, 144, 146, 148,
-148, 148, 147, 145, 143, 140, 136, 133, 129, 125, 122, 119, 117, 115, 114, 114, 115, 116, 118, 120,
-122, 124, 126, 128, 129, 131, 132, 131, 130, 129, 127, 124, 121, 118, 115, 112, 109, 106, 105, 104,
-104, 105, 107, 109, 112, 116, 120, 124, 129, 133, 136, 139, 141, 142, 143, 143, 142, 140, 138, 136,
-133, 131, 128, 127, 126, 125, 125, 126, 128, 130, 133, 136, 139, 141, 144, 146, 147, 147, 147, 146,
-144, 142, 139, 136, 132, 129, 125, 122, 120, 118, 116, 115, 115, 116, 117, 119, 121, 123, 125, 126,
-128, 130, 131, 131, 131, 131, 129, 127, 125, 123, 120, 117, 115, 112, 109, 107, 106, 106, 106, 107,
-109, 111, 114, 118, 121, 125, 129, 132, 135, 137, 139, 140, 141, 140, 139, 137, 135, 133, 131, 129,
-128, 127, 126, 126, 127, 128, 131, 133, 136, 139, 141, 144, 146, 147, 147, 147, 146, 145, 143, 140,
-137, 134, 131, 128, 125, 122, 120, 119, 118, 117, 117, 118, 119, 121, 122, 124, 125, 127, 128, 129,
-130, 129, 129, 128, 126, 124, 122, 119, 116, 113, 111, 109, 107, 106, 106, 106, 107, 109, 112, 115,
-118, 122, 126, 130, 133, 136, 138, 140, 141, 141, 140, 139, 137, 135, 133, 131, 129, 128, 127, 127,
-127, 128, 129, 131, 134, 136, 139, 142, 144, 146, 147, 147, 147, 146, 145, 142, 140, 137, 133, 130,
-127, 124, 121, 119, 118, 117, 117, 117, 118, 119, 120, 122, 124, 126, 127, 129, 130, 131, 131, 131,
-130, 128, 126, 124, 121, 118, 115, 112, 109, 107, 105, 105, 105, 106, 108, 110, 113, 116, 120, 124,
-128, 131, 134, 137, 139, 140, 140, 140, 139, 138, 136, 134, 132, 130, 128, 127, 127, 127, 127, 128,
-130, 132, 134, 137, 139, 142, 144, 145, 146, 146, 146, 145, 143, 141, 139, 136, 132, 129, 127, 124,
-122, 120, 119, 118, 118, 118, 119, 120, 121, 123, 125, 126, 128, 129, 130, 130, 131, 131, 130, 129,
-128, 127, 125, 123, 121, 119, 116, 114, 112, 110, 108, 107, 107, 108, 109, 110, 112, 115, 118, 121,
-125, 128, 132, 134, 137, 138, 139, 140, 139, 138, 137, 135, 133, 130, 128, 126, 125, 125, 125, 126,
-127, 129, 132, 135, 138, 141, 144, 146, 148, 148, 148, 148, 146, 144, 141, 138, 135, 131, 128, 125,
-122, 120, 119, 118, 117, 118, 118, 119, 121, 123, 124, 126, 127, 129, 130, 130, 131, 131, 130, 130,
-129, 128, 127, 126, 125, 124, 122, 120, 119, 117, 115, 113, 110, 108, 107, 107, 107, 108, 109, 111,
-113, 116, 119, 123, 127, 130, 133, 136, 138, 139, 140, 140, 140, 138, 136, 134, 132, 129, 127, 126,
-125, 125, 126, 127, 129, 131, 134, 137, 140, 143, 145, 147, 148, 148, 148, 147, 145, 143, 140, 137,
-133, 130, 127, 124, 122, 120, 119, 118, 118, 119, 120, 121, 123, 124, 126, 127, 128, 128, 129, 129,
-129, 129, 128, 128, 127, 127, 126, 126, 126, 126, 125, 125, 124, 122, 121, 119, 117, 114, 112, 109,
-107, 106, 106, 106, 107, 109, 111, 114, 118, 122, 126, 130, 134, 137, 139, 141, 142, 142, 141, 140,
-137, 134, 132, 129, 127, 125, 124, 124, 124, 126, 128, 130, 134, 137, 141, 144, 147, 149, 150, 150,
-150, 148, 146, 143, 140, 136, 132, 128, 125, 121, 119, 117, 116, 116, 115, 116, 117, 119, 121, 123,
-125, 126, 128, 129, 130, 131, 131, 131, 131, 130, 130, 129, 128, 126, 125, 123, 121, 119, 116, 114,
-112, 110, 108, 107, 107, 107, 107, 109, 111, 113, 117, 120, 124, 128, 131, 134, 136, 139, 140, 141,
-140, 140, 138, 136, 134, 132, 130, 128, 126, 126, 126, 126, 128, 130, 133, 136, 139, 142, 145, 147,
-149, 150, 150, 149, 147, 145, 142, 138, 134, 130, 126, 123, 120, 117, 115, 114, 114, 115, 116, 118,
-120, 122, 124, 126, 128, 130, 131, 132, 132, 132, 131, 130, 128, 126, 124, 121, 118, 115, 111, 108,
-106, 104, 103, 102, 103, 104, 106, 109, 113, 117, 121, 126, 130, 134, 137, 140, 142, 143, 143, 142,
-141, 139, 137, 134, 132, 129, 127, 126, 125, 125, 126, 127, 130, 132, 135, 139, 142, 145, 147, 149,
-151, 151, 150, 149, 146, 143, 140, 136, 132, 127, 124, 120, 117, 115, 114, 113, 113, 113, 115, 117,
-119, 121, 123, 125, 127, 129, 131, 132, 133, 133, 132, 131, 130, 128, 126, 123, 120, 117, 114, 111,
-108, 106, 105, 104, 104, 105, 107, 110, 113, 117, 121, 125, 130, 133, 136, 139, 141, 141, 142, 141,
-140, 138, 136, 133, 131, 128, 127, 126, 125, 125, 126, 128, 130, 133, 136, 139, 142, 145, 147, 149,
-150, 150, 149, 147, 145, 142, 139, 135, 131, 128, 124, 121, 119, 117, 116, 115, 115, 116, 118, 119,
-121, 123, 125, 126, 127, 129, 129, 130, 129, 128, 127, 126, 124, 122, 119, 116, 113, 111, 108, 106,
-105, 105, 105, 107, 108, 111, 114, 117, 121, 125, 129, 133, 136, 139, 141, 142, 143, 142, 141, 140,
-138, 135, 133, 131, 129, 128, 127, 126, 127, 128, 130, 132, 135, 138, 141, 143, 146, 147, 148, 149,
-148, 147, 145, 142, 139, 135, 131, 128, 124, 121, 119, 117, 115, 114, 114, 115, 116, 118, 120, 122,
-124, 125, 127, 129, 130, 131, 131, 130, 128, 126, 124, 121, 118, 115, 112, 109, 106, 105, 104, 104,
-105, 107, 109, 113, 117, 121, 126, 130, 134, 137, 140, 142, 144, 144, 143, 142, 140, 138, 135, 132,
-130, 128, 126, 125, 125, 126, 127, 130, 132, 135, 138, 142, 144, 147, 148, 149, 149, 148, 147, 144,
-141, 137, 133, 129, 126, 122, 119, 117, 115, 114, 114, 114, 116, 117, 119, 121, 123, 125, 127, 128,
-130, 130, 130, 129, 127, 125, 123, 120, 117, 114, 111, 108, 106, 105, 105, 105, 106, 108, 111, 114,
-118, 122, 126, 130, 134, 137, 140, 142, 143, 144, 143, 142, 140, 138, 135, 133, 131, 129, 127, 126,
-126, 127, 128, 130, 132, 135, 138, 141, 143, 145, 146, 147, 147, 146, 145, 143, 140, 136, 133, 129,
-126, 123, 120, 117, 116, 114, 114, 115, 116, 117, 119, 121, 123, 125, 127, 129, 130, 131, 131, 131,
-129, 127, 125, 122, 119, 116, 112, 109, 107, 105, 104, 104, 105, 106, 109, 112, 116, 120, 125, 129,
-133, 137, 140, 142, 143, 144, 144, 142, 140, 138, 135, 133, 130, 128, 126, 125, 125, 125, 127, 129,
-131, 134, 137, 140, 143, 146, 147, 148, 148, 148, 146, 144, 141, 138, 134, 130, 127, 123, 120, 118,
-116, 115, 114, 114, 115, 117, 119, 121, 123, 125, 127, 129, 130, 131, 132, 131, 130, 128, 125, 122,
-120, 116, 113, 110, 107, 105, 104, 104, 105, 106, 108, 111, 114, 118, 123, 127, 131, 135, 138, 140,
-142, 143, 143, 142, 141, 139, 137, 134, 132, 129, 127, 126, 125, 125, 126, 127, 129, 132, 134, 137,
-140, 143, 145, 146, 147, 147, 146, 145, 143, 140, 137, 134, 130, 127, 123, 121, 119, 117, 116, 115,
-115, 116, 118, 120, 122, 124, 126, 128, 129, 130, 131, 131, 131, 130, 128, 126, 124, 121, 119, 116,
-113, 110, 108, 107, 106, 106, 107, 108, 110, 113, 116, 120, 123, 127, 131, 134, 137, 139, 140, 141,
-140, 140, 138, 136, 134, 132, 130, 128, 127, 126, 126, 127, 128, 130, 132, 135, 137, 140, 143, 145,
-146, 147, 147, 147, 146, 144, 141, 138, 135, 132, 129, 126, 123, 121, 119, 118, 117, 117, 118, 119,
-120, 122, 123, 125, 126, 128, 129, 129, 130, 129, 128, 127, 125, 123, 120, 117, 114, 112, 109, 108,
-106, 106, 106, 107, 108, 111, 114, 117, 121, 124, 128, 132, 135, 137, 139, 140, 141, 140, 139, 138,
-136, 134, 132, 130, 128, 127, 127, 127, 127, 129, 130, 133, 135, 138, 141, 143, 145, 147, 147, 147,
-147, 145, 143, 141, 138, 135, 131, 128, 125, 122, 120, 118, 117, 117, 117, 117, 118, 120, 121, 123,
-125, 127, 128, 129, 130, 131, 131, 130, 129, 127, 125, 122, 119, 116, 113, 110, 108, 106, 105, 105,
-106, 107, 109, 112, 115, 118, 122, 126, 130, 133, 136, 138, 140, 140, 140, 140, 139, 137, 135, 133,
-131, 129, 128, 127, 126, 127, 128, 129, 131, 133, 136, 138, 141, 143, 145, 146, 146, 146, 145, 144,
-142, 140, 137, 134, 131, 128, 125, 123, 121, 119, 118, 118, 118, 118, 119, 121, 122, 124, 126, 127,
-128, 129, 130, 131, 131, 130, 130, 129, 127, 126, 124, 122, 120, 117, 115, 113, 111, 109, 108, 107,
-107, 108, 110, 111, 114, 116, 120, 123, 127, 130, 133, 136, 138, 139, 140, 140, 139, 137, 136, 134,
-131, 129, 127, 126, 125, 125, 125, 127, 128, 131, 134, 137, 140, 143, 145, 147, 148, 149, 148, 147,
-145, 142, 140, 136, 133, 129, 126, 123, 121, 119, 118, 118, 117, 118, 119, 120, 122, 124, 125, 127,
-128, 129, 130, 131, 131, 130, 130, 129, 128, 127, 126, 125, 124, 123, 121, 119, 117, 115, 113, 111,
-109, 107, 106, 106, 107, 109, 110, 113, 116, 119, 123, 127, 131, 135, 137, 139, 141, 141, 141, 141,
-139, 137, 134, 131, 128, 126, 124, 123, 123, 124, 125, 128, 131, 134, 138, 141, 144, 147, 149, 150,
-150, 149, 147, 145, 142, 138, 135, 130, 126, 122, 119, 117, 116, 115, 115, 116, 118, 119, 122, 124,
-127, 129, 130, 131, 132, 132, 132, 131, 130, 129, 128, 126, 125, 124, 124, 124, 124, 124, 123, 123,
-122, 122, 121, 119, 117, 115, 112, 110, 109, 109, 109, 109, 110, 112, 114, 118, 121, 125, 129, 133,
-136, 138, 140, 141, 142, 141, 139, 136, 133, 130, 127, 125, 123, 122, 122, 123, 124, 127, 130, 133,
-137, 141, 145, 148, 150, 151, 151, 149, 147, 145, 142, 138, 134, 130, 126, 122, 119, 117, 116, 116,
-117, 117, 119, 121, 122, 125, 127, 129, 130, 131, 131, 131, 131, 130, 129, 128, 127, 126, 125, 124,
-124, 124, 125, 125, 126, 126, 126, 125, 124, 123, 121, 118, 115, 112, 109, 106, 105, 105, 106, 107,
-109, 112, 115, 120, 124, 129, 134, 138, 141, 142, 143, 143, 143, 141, 139, 135, 131, 128, 125, 122,
-121, 121, 121, 123, 125, 128, 132, 136, 140, 144, 147, 150, 151, 151, 150, 148, 145, 141, 137, 133,
-129, 125, 121, 118, 116, 115, 115, 115, 117, 119, 121, 123, 126, 129, 131, 133, 134, 134, 134, 133,
-131, 130, 128, 127, 126, 125, 123, 123, 123, 123, 124, 125, 127, 128, 128, 128, 127, 127, 125, 123,
-120, 116, 112, 108, 105, 104, 103, 103, 105, 106, 109, 112, 117, 122, 128, 133, 138, 141, 144, 145,
-146, 145, 144, 142, 138, 134, 130, 127, 124, 122, 121, 121, 122, 124, 127, 130, 134, 138, 142, 145,
-148, 150, 151, 150, 148, 145, 142, 139, 135, 131, 126, 122, 119, 116, 114, 114, 114, 116, 118, 120,
-122, 124, 127, 130, 132, 134, 135, 135, 134, 133, 132, 130, 129, 128, 127, 125, 124, 124, 124, 124,
-125, 127, 128, 128, 129, 128, 128, 127, 125, 123, 120, 116, 112, 107, 104, 102, 101, 102, 103, 105,
-107, 110, 114, 120, 126, 132, 137, 141, 144, 145, 146, 145, 145, 143, 140, 137, 133, 129, 125, 123,
-122, 122, 124, 126, 128, 131, 134, 138, 141, 145, 148, 150, 150, 149, 147, 144, 141, 137, 133, 130,
-126, 122, 119, 116, 114, 114, 115, 117, 119, 121, 124, 126, 128, 130, 133, 134, 136, 136, 135, 133,
-132, 130, 128, 127, 126, 125, 124, 124, 124, 124, 125, 127, 129, 130, 131, 131, 130, 129, 128, 126,
-123, 119, 114, 109, 104, 100,  98,  98,  99, 100, 102, 105, 109, 114, 121, 127, 134, 139, 143, 146,
-148, 148, 148, 147, 144, 141, 137, 133, 128, 125, 123, 121, 121, 123, 125, 127, 130, 134, 138, 141,
-145, 148, 150, 151, 150, 148, 145, 141, 138, 134, 130, 126, 122, 118, 115, 113, 113, 113, 115, 117,
-119, 122, 124, 127, 130, 132, 135, 137, 137, 137, 136, 135, 133, 131, 130, 129, 127, 125, 124, 124,
-124, 125, 126, 127, 128, 129, 130, 130, 130, 128, 127, 124, 121, 117, 112, 107, 102,  98,  96,  96,
- 97,  99, 102, 105, 109, 115, 121, 129, 135, 141, 144, 147, 148, 149, 149, 147, 145, 141, 137, 133,
-129, 126, 124, 123, 123, 124, 126, 129, 132, 135, 139, 142, 146, 148, 150, 150, 149, 146, 143, 140,
-136, 133, 128, 124, 119, 116, 113, 112, 112, 112, 114, 116, 119, 122, 125, 129, 132, 134, 136, 138,
-138, 138, 137, 135, 133, 131, 129, 128, 126, 125, 124, 124, 124, 125, 126, 128, 130, 131, 132, 132,
-131, 130, 127, 125, 121, 117, 111, 106, 101,  97,  95,  95,  96,  97,  99, 102, 107, 112, 119, 126,
-132, 138, 143, 146, 148, 149, 149, 148, 146, 143, 139, 135, 131, 127, 124, 123, 123, 124, 125, 128,
-130, 133, 137, 141, 144, 147, 149, 150, 149, 147, 145, 142, 138, 135, 131, 126, 122, 118, 116, 114,
-113, 113, 114, 116, 118, 121, 123, 126, 129, 131, 133, 135, 136, 137, 136, 135, 134, 132, 131, 130,
-129, 128, 127, 126, 126, 126, 127, 128, 130, 131, 132, 132, 131, 130, 128, 126, 123, 119, 115, 110,
-104,  98,  94,  92,  92,  94,  96,  99, 102, 106, 111, 118, 125, 132, 138, 143, 145, 147, 147, 148,
-148, 147, 144, 141, 137, 133, 130, 128, 127, 126, 127, 128, 130, 132, 135, 138, 141, 144, 147, 148,
-149, 149, 147, 144, 141, 138, 134, 130, 126, 122, 118, 115, 113, 112, 112, 113, 114, 117, 120, 123,
-126, 129, 132, 134, 136, 138, 139, 138, 137, 136, 134, 132, 131, 129, 128, 127, 126, 125, 125, 126,
-127, 129, 130, 131, 131, 131, 130, 129, 127, 124, 121, 117, 112, 106, 100,  95,  93,  92,  93,  94,
- 96,  98, 102, 107, 113, 121, 129, 135, 141, 144, 146, 148, 149, 149, 149, 147, 144, 140, 135, 131,
-128, 127, 126, 127, 128, 129, 131, 133, 136, 139, 143, 146, 149, 150, 150, 149, 146, 144, 141, 138,
-134, 130, 126, 121, 117, 115, 113, 112, 112, 113, 115, 117, 119, 122, 125, 128, 131, 133, 136, 137,
-138, 137, 137, 135, 134, 133, 132, 131, 129, 128, 127, 127, 127, 128, 129, 130, 131, 132, 132, 131,
-130, 128, 126, 123, 119, 114, 109, 103,  97,  93,  91,  91,  92,  94,  96,  99, 102, 108, 115, 122,
-130, 136, 140, 144, 146, 147, 148, 148, 147, 145, 142, 138, 134, 131, 128, 127, 127, 128, 130, 131,
-134, 136, 139, 143, 146, 149, 152, 152, 152, 150, 147, 143, 140, 136, 132, 127, 123, 118, 115, 112,
-111, 111, 112, 114, 116, 119, 122, 125, 128, 131, 133, 135, 137, 137, 137, 136, 134, 133, 131, 130,
-128, 127, 126, 125, 125, 126, 127, 128, 130, 131, 133, 134, 135, 135, 135, 133, 130, 127, 122, 118,
-112, 106, 100,  94,  90,  87,  88,  89,  92,  95,  99, 103, 109, 117, 124, 131, 137, 142, 145, 146,
-148, 148, 147, 146, 143, 140, 137, 134, 131, 129, 128, 128, 129, 130, 132, 135, 138, 141, 144, 147,
-150, 152, 152, 151, 149, 147, 144, 140, 136, 132, 127, 123, 119, 115, 113, 112, 111, 112, 113, 115,
-117, 120, 123, 126, 129, 132, 134, 135, 136, 136, 135, 134, 133, 132, 131, 130, 129, 128, 127, 127,
-128, 128, 130, 131, 132, 133, 134, 135, 134, 133, 131, 128, 124, 120, 115, 110, 104,  98,  93,  89,
- 88,  89,  90,  93,  96,  99, 104, 110, 118, 125, 132, 137, 140, 143, 144, 145, 146, 146, 144, 142,
-139, 135, 133, 131, 130, 130, 130, 132, 133, 136, 138, 141, 144, 147, 150, 152, 153, 153, 151, 149,
-146, 142, 139, 135, 130, 126, 121, 117, 114, 113, 112, 112, 112, 113, 115, 118, 121, 123, 126, 128,
-131, 133, 134, 135, 135, 134, 133, 132, 132, 131, 130, 130, 129, 128, 128, 129, 130, 131, 132, 133,
-134, 134, 134, 134, 133, 131, 128, 124, 121, 117, 112, 107, 101,  96,  92,  91,  91,  93,  95,  97,
- 99, 103, 108, 114, 121, 127, 132, 136, 138, 140, 141, 142, 143, 142, 140, 138, 135, 132, 130, 129,
-129, 129, 130, 132, 133, 135, 137, 140, 144, 147, 149, 150, 151, 150, 148, 146, 144, 141, 138, 134,
-129, 125, 121, 118, 116, 115, 114, 115, 116, 117, 119, 122, 125, 127, 130, 132, 134, 136, 136, 136,
-136, 135, 133, 132, 131, 129, 128, 127, 126, 126, 126, 127, 128, 129, 130, 132, 133, 134, 134, 134,
-133, 131, 129, 127, 124, 120, 116, 112, 108, 104, 101,  99,  99, 100, 101, 103, 104, 107, 110, 113,
-118, 121, 124, 127, 128, 129, 130, 131, 132, 133, 133, 133, 132, 132, 132, 133, 134, 135, 137, 138,
-139, 140, 141, 141, 142, 142, 143, 143, 142, 141, 139, 138, 137, 136, 135, 134, 133, 132, 131, 130,
-130, 130, 129, 128, 128, 127, 127, 126, 126, 125, 125, 124, 124, 124, 124, 125, 125, 125, 125, 126,
-126, 127, 128, 129, 130, 130, 130, 131, 131, 132, 132, 132, 131, 131, 131, 130, 129, 129, 127, 126,
-124, 122, 120, 117, 114, 111, 108, 105, 103, 101, 100, 100, 101, 102, 104, 108, 112, 116, 121, 125,
-130, 133, 137, 140, 142, 143, 143, 142, 141, 139, 137, 134, 132, 130, 128, 127, 127, 128, 129, 131,
-134, 137, 140, 143, 146, 148, 150, 150, 150, 149, 147, 144, 141, 137, 132, 128, 124, 121, 118, 116,
-114, 113, 114, 115, 117, 119, 121, 124, 126, 129, 131, 132, 133, 133, 133, 132, 131, 130, 129, 128,
-126, 125, 125, 124, 125, 126, 127, 128, 129, 130, 130, 130, 130, 129, 127, 124, 121, 117, 113, 108,
-105, 103, 101, 101, 101, 103, 105, 108, 112, 118, 123, 129, 134, 138, 141, 143, 144, 144, 143, 142,
-139, 136, 132, 129, 126, 123, 123, 123, 124, 126, 128, 131, 134, 138, 142, 145, 148, 151, 151, 151,
-149, 146, 143, 140, 136, 132, 128, 124, 120, 117, 115, 114, 114, 116, 117, 119, 121, 124, 126, 129,
-131, 133, 134, 135, 134, 133, 132, 130, 129, 128, 127, 125, 124, 124, 124, 124, 125, 127, 128, 128,
-129, 128, 128, 127, 125, 123, 120, 116, 112, 107, 104, 102, 101, 102, 103, 105, 107, 110, 114, 120,
-126, 132, 137, 141, 144, 145, 146, 145, 145, 143, 140, 137, 133, 129, 125, 123, 122, 122, 124, 126,
-128, 131, 134, 138, 141, 145, 148, 150, 150, 149, 147, 144, 141, 137, 133, 130, 126, 122, 119, 116,
-114, 114, 115, 117, 119, 121, 124, 126, 128, 130, 133, 134, 136, 136, 135, 134, 132, 130, 128, 127,
-126, 125, 124, 124, 124, 124, 125, 127, 129, 130, 131, 131, 130, 129, 128, 126, 123, 119, 114, 109,
-104, 100,  98,  98,  99, 100, 102, 105, 109, 114, 121, 127, 134, 139, 143, 146, 148, 148, 148, 147,
-145, 141, 137, 133, 128, 125, 123, 121, 121, 123, 125, 127, 130, 134, 138, 141, 145, 148, 150, 151,
-150, 148, 145, 141, 138, 134, 130, 126, 122, 118, 115, 113, 113, 113, 115, 117, 119, 122, 124, 127,
-130, 132, 135, 137, 137, 137, 136, 135, 133, 131, 130, 129, 127, 125, 124, 124, 124, 125, 126, 127,
-128, 129, 130, 130, 130, 128, 127, 124, 121, 117, 112, 107, 102,  98,  96,  96,  97,  99, 102, 105,
-109, 115, 121, 129, 135, 141, 144, 147, 148, 149, 149, 147, 145, 141, 137, 133, 129, 126, 124, 123,
-123, 124, 126, 129, 132, 135, 139, 142, 146, 148, 150, 150, 149, 146, 143, 140, 137, 133, 128, 124,
-119, 116, 113, 112, 112, 112, 114, 116, 119, 122, 125, 129, 132, 134, 136, 138, 138, 138, 137, 135,
-133, 131, 129, 128, 126, 125, 124, 124, 124, 125, 126, 128, 130, 131, 132, 132, 131, 130, 127, 125,
-121, 117, 111, 106, 101,  97,  95,  95,  96,  97,  99, 102, 107, 112, 119, 126, 132, 138, 143, 146,
-148, 149, 149, 148, 146, 143, 139, 135, 131, 127, 124, 123, 123, 124, 125, 128, 130, 133, 137, 141,
-144, 147, 149, 150, 149, 147, 145, 142, 138, 135, 131, 126, 122, 118, 116, 114, 113, 113, 114, 116,
-118, 121, 123, 126, 129, 131, 133, 135, 136, 137, 136, 135, 134, 133, 131, 130, 129, 128, 127, 126,
-126, 126, 127, 128, 130, 131, 132, 132, 131, 130, 128, 126, 123, 119, 115, 110, 104,  98,  94,  92,
- 92,  94,  96,  99, 102, 106, 111, 118, 125, 132, 138, 143, 145, 147, 147, 148, 148, 147, 144, 141,
-137, 133, 130, 128, 126, 126, 127, 128, 130, 132, 135, 138, 141, 144, 147, 148, 149, 149, 147, 144,
-141, 138, 134, 130, 126, 122, 118, 115, 113, 112, 112, 113, 114, 117, 120, 123, 126, 129, 132, 134,
-136, 138, 139, 138, 137, 136, 134, 132, 131, 129, 128, 127, 126, 125, 125, 126, 127, 129, 130, 131,
-131, 131, 130, 129, 127, 124, 121, 117, 112, 106, 100,  95,  93,  92,  93,  94,  96,  98, 102, 107,
-113, 121, 129, 135, 141, 144, 146, 148, 149, 149, 149, 147, 144, 140, 135, 131, 128, 127, 126, 127,
-128, 129, 131, 133, 136, 139, 143, 146, 149, 150, 150, 149, 146, 144, 141, 138, 134, 130, 126, 121,
-117, 115, 113, 112, 112, 113, 115, 117, 119, 122, 125, 128, 131, 133, 136, 137, 138, 137, 136, 135,
-134, 133, 132, 131, 129, 128, 127, 127, 127, 128, 129, 130, 131, 132, 132, 131, 130, 128, 126, 123,
-119, 114, 109, 103,  97,  93,  91,  91,  92,  94,  96,  99, 102, 108, 115, 122, 130, 136, 140, 144,
-146, 147, 148, 148, 147, 145, 142, 138, 134, 131, 128, 127, 127, 128, 130, 131, 134, 136, 139, 143,
-146, 149, 152, 152, 152, 150, 147, 143, 140, 136, 132, 127, 123, 118, 115, 112, 111, 111, 112, 114,
-116, 119, 122, 125, 128, 131, 133, 135, 137, 137, 137, 136, 134, 133, 131, 130, 128, 127, 126, 125,
-125, 126, 127, 128, 130, 131, 133, 134, 135, 135, 135, 133, 130, 127, 122, 118, 112, 106, 100,  94,
- 90,  87,  88,  89,  92,  95,  99, 103, 109, 117, 124, 131, 137, 142, 145, 146, 148, 148, 147, 146,
-144, 140, 137, 134, 131, 129, 128, 128, 129, 130, 132, 135, 138, 141, 144, 147, 150, 152, 152, 151,
-149, 147, 144, 140, 136, 132, 127, 123, 119, 115, 113, 112, 111, 112, 113, 115, 117, 120, 123, 126,
-129, 132, 134, 135, 136, 136, 135, 134, 133, 132, 131, 130, 129, 128, 127, 127, 128, 128, 130, 131,
-132, 133, 134, 135, 134, 133, 131, 128, 124, 120, 115, 110, 104,  98,  93,  89,  88,  89,  90,  93,
- 96,  99, 104, 110, 118, 125, 132, 137, 140, 143, 144, 145, 146, 146, 144, 142, 139, 135, 133, 131,
-130, 130, 130, 132, 133, 136, 138, 141, 144, 147, 150, 152, 153, 153, 151, 149, 146, 142, 139, 135,
-130, 126, 121, 117, 114, 113, 112, 112, 112, 113, 115, 118, 121, 123, 126, 129, 131, 133, 134, 135,
-135, 134, 133, 132, 132, 131, 130, 130, 129, 128, 128, 129, 130, 131, 132, 133, 134, 134, 134, 134,
-133, 131, 128, 125, 121, 117, 112, 106, 100,  94,  90,  89,  89,  90,  92,  94,  97, 100, 106, 113,
-120, 127, 133, 137, 139, 142, 143, 145, 146, 145, 144, 141, 138, 135, 133, 132, 132, 132, 133, 135,
-136, 138, 140, 143, 146, 149, 151, 153, 153, 152, 150, 147, 145, 142, 138, 134, 130, 125, 121, 117,
-114, 113, 112, 111, 112, 113, 115, 117, 119, 122, 125, 127, 130, 132, 133, 134, 134, 134, 133, 132,
-132, 132, 131, 130, 130, 129, 130, 131, 132, 133, 134, 134, 135, 135, 136, 135, 134, 131, 128, 125,
-121, 116, 112, 106, 100,  95,  90,  88,  88,  89,  91,  93,  96,  99, 104, 111, 118, 125, 131, 135,
-138, 140, 142, 144, 144, 144, 143, 141, 139, 136, 134, 133, 133, 133, 135, 136, 138, 140, 142, 145,
-148, 151, 153, 155, 155, 154, 151, 149, 146, 143, 139, 135, 130, 125, 121, 117, 114, 113, 112, 112,
-112, 113, 115, 117, 119, 122, 124, 127, 129, 131, 132, 132, 132, 132, 131, 131, 130, 130, 130, 129,
-129, 129, 129, 131, 132, 133, 135, 135, 136, 137, 137, 137, 136, 134, 130, 126, 122, 118, 113, 107,
-101,  95,  90,  87,  87,  88,  90,  92,  94,  98, 102, 109, 116, 123, 129, 134, 137, 139, 141, 143,
-144, 144, 143, 141, 138, 136, 134, 133, 133, 133, 135, 136, 138, 140, 143, 146, 149, 152, 155, 156,
-157, 156, 154, 151, 148, 145, 141, 137, 132, 127, 122, 117, 115, 113, 111, 111, 110, 111, 112, 115,
-117, 120, 122, 125, 127, 129, 130, 131, 132, 132, 131, 130, 130, 130, 129, 129, 129, 128, 129, 130,
-132, 133, 135, 136, 137, 138, 139, 139, 139, 137, 134, 130, 126, 121, 116, 110, 104,  98,  93,  88,
- 86,  86,  87,  89,  91,  94,  98, 104, 111, 118, 124, 129, 133, 137, 139, 141, 143, 143, 143, 141,
-139, 136, 135, 134, 134, 134, 135, 136, 138, 140, 143, 146, 150, 153, 155, 157, 158, 158, 157, 155,
-152, 148, 144, 140, 135, 130, 124, 120, 116, 113, 111, 110, 109, 109, 110, 112, 114, 117, 119, 122,
-124, 126, 128, 129, 130, 130, 130, 129, 129, 128, 128, 128, 128, 128, 129, 130, 131, 133, 135, 136,
-138, 139, 140, 140, 140, 140, 138, 135, 131, 127, 122, 117, 111, 106, 100,  95,  90,  87,  86,  86,
- 88,  91,  94,  97, 102, 108, 115, 122, 127, 132, 135, 137, 139, 141, 142, 142, 141, 139, 137, 135,
-134, 134, 134, 135, 137, 138, 141, 143, 147, 150, 153, 156, 158, 159, 159, 159, 157, 154, 150, 146,
-142, 136, 131, 126, 121, 116, 113, 111, 109, 108, 108, 109, 110, 112, 115, 118, 120, 122, 124, 126,
-127, 128, 128, 128, 128, 127, 127, 127, 127, 127, 128, 128, 129, 131, 133, 135, 137, 139, 141, 142,
-143, 143, 143, 142, 140, 136, 132, 126, 121, 115, 110, 104,  98,  93,  88,  86,  85,  87,  89,  92,
- 95,  99, 104, 109, 116, 122, 127, 131, 134, 136, 137, 139, 140, 140, 140, 138, 136, 135, 134, 135,
-136, 137, 138, 140, 142, 145, 148, 151, 154, 157, 158, 159, 159, 158, 156, 154, 150, 146, 141, 136,
-131, 126, 121, 116, 113, 110, 109, 108, 107, 107, 108, 110, 113, 116, 118, 120, 122, 124, 126, 127,
-128, 129, 129, 129, 129, 129, 129, 130, 130, 130, 131, 132, 133, 135, 137, 138, 139, 140, 140, 141,
-140, 140, 138, 135, 131, 126, 122, 117, 112, 106, 101,  96,  92,  89,  88,  89,  91,  93,  95,  98,
-102, 106, 112, 118, 123, 128, 131, 133, 135, 137, 138, 140, 140, 140, 139, 137, 137, 137, 138, 139,
-140, 141, 143, 145, 147, 150, 152, 155, 156, 157, 158, 157, 156, 154, 151, 147, 143, 139, 134, 129,
-124, 119, 115, 112, 109, 108, 107, 106, 107, 108, 110, 113, 115, 118, 120, 123, 125, 127, 128, 129,
-129, 129, 129, 129, 129, 130, 130, 130, 131, 132, 133, 135, 137, 138, 139, 140, 140, 141, 140, 140,
-138, 136, 133, 129, 125, 120, 116, 111, 107, 102,  98,  94,  91,  90,  91,  92,  94,  96,  98, 101,
-106, 111, 117, 122, 126, 129, 132, 134, 136, 138, 140, 141, 141, 140, 139, 138, 138, 139, 140, 141,
-142, 143, 145, 147, 149, 151, 154, 155, 156, 157, 156, 155, 154, 151, 148, 145, 140, 136, 131, 126,
-122, 118, 115, 112, 110, 108, 107, 107, 108, 109, 111, 114, 116, 118, 120, 122, 123, 125, 126, 127,
-128, 129, 129, 129, 130, 131, 131, 132, 133, 133, 134, 135, 137, 138, 139, 139, 139, 138, 138, 137,
-136, 133, 130, 127, 122, 118, 114, 110, 105, 101,  97,  94,  92,  92,  93,  94,  96,  98, 101, 105,
-109, 115, 120, 124, 128, 131, 133, 135, 137, 139, 140, 140, 140, 139, 139, 138, 139, 140, 141, 142,
-143, 144, 146, 148, 150, 153, 154, 155, 156, 156, 155, 153, 151, 149, 145, 141, 137, 132, 128, 123,
-119, 115, 112, 110, 108, 107, 107, 107, 109, 110, 112, 115, 117, 119, 121, 123, 125, 127, 128, 128,
-129, 129, 129, 130, 130, 131, 131, 132, 132, 133, 134, 135, 136, 137, 138, 138, 138, 138, 138, 137,
-135, 133, 130, 126, 122, 119, 115, 110, 106, 102,  98,  95,  94,  94,  94,  95,  97,  98, 101, 105,
-109, 114, 119, 124, 127, 130, 132, 135, 137, 139, 140, 140, 140, 139, 138, 138, 138, 139, 139, 140,
-141, 142, 144, 146, 149, 151, 153, 154, 155, 156, 156, 155, 153, 151, 148, 144, 140, 136, 131, 126,
-122, 118, 115, 112, 110, 108, 108, 107, 108, 109, 111, 113, 116, 118, 120, 122, 124, 126, 128, 129,
-130, 130, 131, 131, 131, 131, 131, 132, 132, 132, 132, 133, 134, 134, 135, 135, 136, 136, 135, 135,
-134, 132, 130, 127, 123, 120, 116, 112, 108, 104, 100,  97,  96,  95,  96,  97,  98, 100, 102, 105,
-110, 115, 120, 124, 128, 130, 133, 135, 137, 138, 139, 139, 139, 138, 137, 136, 136, 137, 138, 139,
-140, 141, 143, 145, 147, 150, 152, 154, 155, 156, 156, 155, 153, 151, 149, 146, 142, 137, 133, 128,
-123, 119, 116, 113, 111, 109, 108, 107, 108, 109, 111, 114, 116, 118, 121, 123, 125, 127, 128, 130,
-130, 131, 131, 130, 130, 130, 130, 130, 130, 130, 130, 131, 131, 132, 133, 134, 134, 134, 135, 134,
-134, 133, 131, 129, 126, 123, 120, 116, 112, 109, 105, 101,  98,  97,  96,  96,  97,  99, 100, 103,
-106, 111, 115, 120, 125, 129, 131, 134, 136, 138, 139, 140, 140, 139, 138, 137, 136, 136, 136, 136,
-137, 138, 139, 141, 143, 145, 147, 150, 152, 153, 154, 155, 154, 153, 151, 149, 146, 143, 139, 134,
-130, 125, 121, 118, 115, 113, 111, 109, 109, 109, 110, 112, 114, 116, 119, 121, 123, 125, 127, 128,
-130, 131, 131, 131, 131, 130, 130, 130, 130, 130, 130, 130, 130, 130, 130, 131, 131, 132, 132, 132,
-132, 131, 130, 129, 127, 125, 123, 120, 117, 114, 111, 108, 105, 103, 102, 101, 101, 102, 102, 104,
-106, 108, 112, 116, 120, 123, 126, 129, 131, 133, 135, 137, 138, 138, 138, 137, 136, 136, 135, 135,
-136, 136, 136, 137, 139, 140, 142, 144, 147, 148, 150, 151, 152, 152, 151, 150, 149, 147, 144, 140,
-137, 133, 129, 125, 122, 119, 116, 114, 113, 112, 112, 112, 113, 115, 116, 118, 120, 122, 124, 126,
-127, 128, 129, 130, 130, 131, 130, 130, 130, 130, 130, 129, 129, 129, 129, 129, 130, 130, 130, 130,
-131, 131, 131, 131, 130, 129, 127, 126, 124, 122, 119, 117, 114, 111, 108, 106, 105, 104, 103, 103,
-104, 105, 106, 108, 111, 114, 117, 120, 124, 127, 129, 131, 133, 135, 136, 136, 136, 136, 136, 135,
-134, 134, 133, 134, 134, 135, 136, 137, 139, 141, 143, 145, 147, 149, 150, 151, 151, 151, 150, 148,
-146, 143, 140, 136, 132, 128, 125, 122, 119, 117, 115, 114, 113, 113, 114, 115, 117, 119, 121, 123,
-125, 126, 128, 129, 130, 131, 131, 131, 130, 130, 130, 130, 129, 129, 129, 129, 130, 130, 131, 132,
-132, 133, 133, 133, 133, 133, 132, 130, 128, 125, 122, 119, 116, 112, 109, 105, 101,  99,  98,  98,
- 99, 100, 102, 104, 106, 110, 115, 120, 124, 128, 130, 132, 134, 135, 137, 137, 137, 136, 135, 134,
-133, 132, 133, 133, 134, 135, 137, 139, 141, 144, 147, 149, 151, 153, 153, 153, 153, 151, 149, 146,
-143, 139, 135, 131, 126, 123, 119, 117, 115, 113, 113, 113, 113, 114, 116, 118, 120, 122, 123, 125,
-126, 127, 128, 128, 128, 128, 128, 128, 128, 128, 129, 129, 130, 131, 132, 134, 136, 137, 138, 139,
-140, 141, 140, 140, 138, 135, 132, 127, 122, 117, 112, 107, 102,  97,  92,  89,  88,  89,  91,  93,
- 96,  99, 103, 108, 114, 120, 126, 130, 133, 135, 136, 138, 139, 140, 139, 138, 137, 135, 134, 135,
-135, 137, 138, 140, 142, 144, 147, 150, 154, 156, 158, 159, 159, 159, 157, 154, 151, 147, 143, 138,
-132, 127, 122, 117, 114, 111, 109, 108, 107, 107, 108, 110, 112, 115, 118, 120, 122, 124, 125, 127,
-128, 129, 129, 129, 129, 129, 129, 129, 130, 130, 131, 132, 133, 135, 136, 138, 139, 140, 140, 141,
-141, 140, 138, 136, 132, 128, 123, 118, 113, 108, 103,  97,  93,  90,  88,  88,  90,  92,  95,  98,
-101, 105, 111, 116, 122, 127, 130, 133, 135, 136, 138, 139, 140, 140, 139, 138, 137, 137, 137, 138,
-140, 141, 143, 144, 146, 149, 152, 154, 156, 157, 158, 157, 156, 154, 152, 148, 144, 140, 135, 130,
-125, 120, 116, 113, 110, 108, 107, 106, 107, 108, 110, 112, 115, 117, 120, 122, 124, 126, 128, 129,
-129, 129, 129, 129, 129, 130, 130, 130, 131, 132, 133, 135, 136, 138, 139, 140, 140, 140, 140, 140,
-139, 137, 134, 130, 126, 121, 117, 112, 108, 103,  99,  95,  92,  90,  90,  92,  93,  95,  98, 101,
-104, 110, 115, 121, 125, 129, 131, 133, 135, 138, 140, 141, 141, 140, 139, 138, 138, 139, 139, 140,
-141, 143, 144, 146, 148, 151, 153, 155, 156, 157, 157, 156, 154, 152, 149, 146, 142, 137, 132, 127,
-123, 119, 115, 113, 110, 109, 108, 107, 108, 109, 111, 113, 115, 117, 119, 121, 123, 125, 126, 127,
-128, 128, 129, 129, 130, 130, 131, 132, 132, 133, 134, 135, 136, 138, 138, 139, 139, 139, 138, 137,
-136, 134, 131, 127, 123, 119, 115, 111, 106, 102,  98,  95,  92,  92,  92,  94,  96,  98, 101, 104,
-108, 113, 118, 123, 127, 130, 133, 135, 137, 139, 140, 140, 140, 139, 139, 138, 139, 140, 141, 142,
-143, 144, 146, 148, 150, 152, 154, 155, 156, 156, 155, 154, 152, 149, 146, 142, 138, 133, 129, 124,
-120, 116, 113, 111, 109, 108, 107, 107, 108, 110, 112, 114, 116, 118, 121, 123, 125, 126, 128, 128,
-129, 129, 129, 130, 130, 131, 131, 131, 132, 133, 134, 135, 136, 137, 138, 138, 138, 138, 138, 137,
-136, 134, 131, 127, 123, 120, 116, 112, 107, 103,  99,  96,  94,  93,  94,  95,  96,  98, 100, 104,
-108, 113, 118, 123, 126, 129, 132, 134, 137, 139, 140, 140, 140, 139, 138, 138, 138, 138, 139, 140,
-141, 142, 143, 146, 148, 150, 152, 154, 155, 156, 156, 155, 154, 151, 149, 145, 141, 137, 132, 127,
-123, 119, 116, 113, 111, 109, 108, 107, 108, 109, 111, 113, 115, 117, 119, 121, 123, 125, 127, 129,
-130, 130, 130, 131, 131, 131, 131, 132, 132, 132, 132, 133, 134, 134, 135, 135, 136, 136, 135, 135,
-134, 132, 130, 127, 124, 121, 117, 113, 109, 105, 101,  98,  96,  95,  96,  97,  98,  99, 101, 105,
-109, 114, 119, 123, 127, 130, 132, 134, 136, 138, 139, 139, 139, 138, 137, 136, 136, 137, 138, 138,
-139, 140, 142, 144, 147, 149, 151, 153, 155, 156, 156, 155, 154, 152, 150, 146, 143, 138, 134, 129,
-124, 120, 116, 114, 111, 109, 108, 107, 108, 109, 111, 113, 115, 118, 120, 122, 124, 126, 128, 129,
-130, 131, 131, 130, 130, 130, 130, 130, 130, 130, 130, 131, 131, 132, 133, 134, 134, 134, 135, 134,
-134, 133, 132, 130, 127, 124, 121, 117, 113, 109, 106, 102,  99,  97,  96,  96,  97,  98, 100, 102,
-105, 109, 114, 119, 124, 128, 131, 133, 136, 138, 139, 140, 140, 140, 139, 137, 136, 136, 136, 136,
-137, 137, 139, 140, 142, 144, 147, 149, 151, 153, 154, 155, 154, 153, 152, 150, 147, 144, 140, 135,
-131, 126, 122, 119, 116, 113, 111, 110, 109, 109, 110, 111, 113, 116, 118, 120, 122, 124, 126, 128,
-129, 130, 131, 131, 131, 131, 130, 130, 130, 130, 130, 130, 130, 130, 130, 131, 131, 131, 132, 132,
-132, 131, 131, 129, 128, 126, 123, 121, 118, 115, 112, 109, 106, 103, 102, 101, 101, 102, 102, 103,
-105, 108, 111, 115, 119, 122, 125, 128, 130, 133, 135, 136, 137, 138, 138, 137, 136, 136, 135, 135,
-136, 136, 136, 137, 138, 140, 142, 144, 146, 148, 150, 151, 152, 152, 152, 151, 149, 147, 144, 141,
-138, 134, 130, 126, 123, 120, 117, 115, 113, 112, 112, 112, 113, 114, 116, 118, 120, 122, 124, 125,
-127, 128, 129, 130, 131, 131, 130, 130, 130, 130, 129, 129, 129, 129, 129, 129, 130, 130, 130, 130,
-131, 131, 131, 130, 129, 128, 126, 124, 122, 120, 118, 115, 113, 110, 108, 106, 105, 105, 105, 106,
-107, 108, 110, 112, 115, 118, 121, 124, 127, 129, 130, 132, 133, 134, 135, 135, 135, 134, 134, 133,
-133, 133, 133, 133, 134, 135, 136, 137, 139, 141, 143, 145, 146, 148, 148, 149, 148, 148, 147, 145,
-143, 141, 138, 135, 131, 128, 125, 123, 121, 119, 117, 116, 115, 115, 116, 117, 119, 120, 122, 123,
-125, 127, 128, 129, 130, 131, 132, 132, 132, 131, 131, 131, 130, 130, 129, 129, 129, 128, 128, 128,
-128, 128, 127, 127, 127, 127, 126, 125, 124, 123, 122, 121, 120, 118, 116, 115, 113, 112, 111, 111,
-111, 112, 112, 113, 113, 115, 116, 119, 121, 123, 124, 126, 127, 128, 129, 130, 131, 131, 131, 131,
-131, 130, 130, 130, 131, 131, 132, 132, 133, 134, 135, 137, 138, 140, 141, 142, 143, 144, 144, 144,
-143, 143, 142, 140, 138, 136, 134, 132, 130, 128, 126, 124, 123, 122, 121, 121, 121, 121, 122, 123,
-124, 125, 127, 128, 129, 130, 131, 132, 132, 133, 133, 133, 133, 132, 132, 131, 131, 130, 129, 129,
-128, 127, 127, 126, 126, 125, 125, 124, 124, 123, 123, 122, 121, 120, 120, 119, 118, 117, 116, 115,
-114, 114, 114, 114, 114, 115, 115, 116, 116, 118, 119, 120, 122, 123, 124, 125, 126, 126, 127, 128,
-128, 129, 129, 129, 129, 129, 130, 130, 131, 131, 132, 133, 134, 134, 135, 136, 138, 139, 140, 140,
-141, 141, 141, 141, 141, 140, 139, 138, 136, 135, 133, 131, 130, 128, 127, 125, 124, 123, 123, 122,
-123, 123, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 133, 134, 134, 134, 134, 134, 133,
-133, 132, 132, 131, 130, 130, 129, 128, 127, 126, 125, 124, 124, 123, 122, 121, 120, 119, 118, 118,
-117, 116, 115, 115, 114, 114, 115, 115, 115, 116, 116, 117, 118, 118, 119, 120, 121, 122, 123, 124,
-124, 125, 126, 126, 127, 127, 128, 128, 128, 129, 129, 130, 131, 132, 132, 133, 134, 135, 135, 136,
-137, 138, 139, 139, 139, 140, 139, 139, 139, 138, 137, 136, 135, 133, 132, 130, 128, 127, 126, 125,
-124, 123, 123, 123, 123, 123, 124, 125, 126, 127, 128, 129, 130, 132, 133, 133, 134, 135, 135, 135,
-135, 135, 135, 135, 134, 133, 133, 132, 131, 130, 129, 128, 127, 126, 125, 124, 124, 123, 122, 121,
-120, 119, 119, 118, 118, 117, 117, 117, 116, 116, 117, 117, 117, 117, 118, 118, 118, 119, 120, 120,
-121, 121, 122, 122, 122, 123, 124, 124, 125, 125, 126, 126, 127, 127, 128, 129, 129, 130, 131, 131,
-132, 133, 133, 134, 135, 135, 136, 136, 136, 136, 136, 136, 136, 136, 135, 134, 134, 133, 132, 131,
-130, 129, 128, 128, 127, 127, 126, 126, 126, 126, 127, 127, 128, 128, 129, 130, 131, 132, 133, 133,
-134, 135, 135, 136, 136, 136, 136, 136, 135, 135, 134, 133, 132, 131, 130, 129, 128, 127, 126, 125,
-124, 123, 122, 121, 121, 120, 119, 119, 119, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 119,
-119, 119, 120, 120, 120, 120, 120, 121, 121, 122, 122, 123, 123, 124, 124, 125, 125, 126, 126, 127,
-128, 128, 129, 130, 130, 131, 132, 132, 133, 133, 133, 134, 134, 134, 134, 134, 134, 134, 134, 133,
-133, 132, 132, 131, 131, 130, 130, 130, 129, 129, 129, 129, 129, 129, 129, 130, 130, 131, 131, 132,
-132, 133, 134, 135, 135, 136, 136, 136, 136, 136, 136, 136, 136, 135, 134, 134, 133, 132, 131, 130,
-129, 128, 127, 126, 125, 124, 122, 121, 121, 120, 119, 119, 118, 118, 117, 117, 117, 117, 117, 118,
-118, 118, 118, 118, 119, 119, 119, 120, 120, 120, 121, 121, 121, 122, 122, 123, 123, 124, 124, 124,
-125, 126, 126, 127, 127, 128, 129, 129, 130, 130, 131, 131, 131, 132, 132, 132, 132, 132, 133, 133,
-132, 132, 132, 132, 131, 131, 131, 130, 130, 130, 130, 130, 129, 129, 129, 129, 129, 130, 130, 131,
-131, 131, 132, 132, 133, 134, 134, 135, 135, 136, 136, 136, 136, 136, 136, 136, 136, 135, 135, 134,
-133, 133, 132, 131, 130, 129, 128, 127, 126, 125, 124, 123, 122, 121, 121, 120, 119, 119, 118, 118,
-117, 117, 117, 117, 118, 118, 118, 118, 118, 118, 119, 119, 119, 120, 120, 120, 121, 121, 122, 122,
-123, 123, 124, 124, 125, 126, 126, 127, 128, 128, 129, 129, 130, 130, 131, 131, 131, 131, 131, 132,
-132, 131, 131, 131, 131, 131, 131, 130, 130, 130, 129, 129, 129, 129, 128, 128, 128, 128, 128, 128,
-129, 129, 130, 130, 131, 131, 132, 132, 133, 134, 134, 135, 136, 136, 137, 137, 137, 137, 137, 137,
-137, 136, 136, 135, 135, 134, 133, 132, 131, 130, 129, 128, 127, 126, 125, 124, 124, 123, 122, 121,
-121, 120, 119, 119, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 118, 119, 119, 119, 119,
-120, 120, 121, 121, 122, 122, 123, 124, 124, 125, 126, 126, 127, 128, 128, 129, 129, 129, 130, 130,
-130, 130, 131, 131, 130, 130, 130, 130, 130, 130, 130, 130, 130, 129, 129, 129, 129, 129, 129, 129,
-129, 129, 129, 129, 130, 130, 130, 131, 131, 131, 132, 132, 133, 133, 134, 134, 135, 135, 136, 136,
-136, 136, 136, 136, 136, 136, 136, 135, 135, 134, 134, 133, 132, 131, 131, 130, 129, 128, 127, 126,
-125, 124, 124, 123, 122, 121, 121, 120, 120, 119, 119, 119, 119, 118, 118, 118, 118, 118, 119, 119,
-119, 119, 119, 119, 120, 120, 120, 121, 121, 121, 122, 122, 123, 123, 124, 125, 125, 126, 126, 127,
-128, 128, 128, 129, 129, 129, 130, 130, 130, 130, 130, 130, 130, 130, 130, 129, 129, 129, 129, 129,
-129, 129, 129, 129, 129, 129, 129, 129, 130, 130, 130, 131, 131, 132, 132, 133, 133, 134, 134, 135,
-135, 135, 136, 136, 136, 136, 136, 136, 136, 136, 136, 135, 135, 134, 134, 133, 133, 132, 131, 130,
-129, 129, 128, 127, 126, 125, 124, 124, 123, 122, 122, 121, 121, 120, 120, 120, 120, 120, 120, 120,
-120, 120, 120, 120, 120, 120, 120, 120, 120, 121, 121, 121, 121, 122, 122, 122, 123, 123, 124, 124,
-125, 125, 126, 126, 126, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129, 129, 129, 128, 128, 128,
-128, 128, 128, 128, 128, 128, 128, 128, 128, 129, 129, 129, 129, 130, 130, 131, 131, 132, 132, 133,
-133, 133, 134, 134, 135, 135, 135, 136, 136, 136, 136, 136, 136, 136, 135, 135, 135, 134, 134, 133,
-133, 132, 131, 131, 130, 129, 129, 128, 127, 126, 126, 125, 124, 124, 123, 123, 122, 122, 122, 122,
-121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 122, 122, 122,
-123, 123, 123, 124, 124, 125, 125, 125, 126, 126, 127, 127, 127, 127, 127, 127, 128, 128, 128, 128,
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 129, 129, 129, 130, 130, 130,
-131, 131, 132, 132, 132, 133, 133, 134, 134, 134, 135, 135, 135, 135, 135, 135, 135, 135, 135, 135,
-135, 134, 134, 134, 133, 133, 132, 131, 131, 130, 129, 129, 128, 128, 127, 126, 126, 125, 124, 124,
-124, 123, 123, 122, 122, 122, 122, 121, 121, 121, 121, 121, 121, 120, 120, 120, 120, 120, 121, 121,
-121, 121, 122, 122, 122, 123, 123, 124, 124, 124, 125, 125, 126, 126, 127, 127, 127, 127, 127, 128,
-128, 128, 128, 128, 128, 128, 128, 128, 128, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 128,
-129, 129, 129, 130, 130, 131, 131, 131, 132, 132, 133, 133, 133, 134, 134, 134, 135, 135, 135, 135,
-135, 135, 135, 134, 134, 134, 134, 133, 133, 133, 132, 132, 131, 131, 130, 130, 129, 129, 128, 127,
-127, 126, 126, 125, 125, 124, 124, 123, 123, 123, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122,
-122, 122, 122, 122, 122, 122, 122, 122, 122, 123, 123, 123, 123, 124, 124, 124, 125, 125, 125, 126,
-126, 126, 126, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 128,
-128, 128, 128, 128, 129, 129, 129, 129, 130, 130, 131, 131, 131, 132, 132, 132, 133, 133, 134, 134,
-134, 134, 134, 135, 135, 135, 134, 134, 134, 134, 134, 133, 133, 133, 132, 132, 131, 131, 130, 130,
-129, 129, 128, 127, 127, 126, 126, 125, 125, 124, 124, 124, 123, 123, 123, 123, 123, 123, 123, 123,
-122, 123, 122, 122, 122, 122, 122, 122, 122, 122, 123, 123, 123, 123, 123, 123, 124, 124, 124, 124,
-125, 125, 125, 125, 125, 126, 126, 126, 126, 126, 126, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 128, 128, 128, 128, 128, 128, 129, 129, 129, 130, 130, 130, 131, 131, 132, 132, 132, 132,
-133, 133, 133, 134, 134, 134, 134, 134, 134, 134, 134, 134, 134, 133, 133, 133, 133, 132, 132, 131,
-131, 131, 130, 129, 129, 128, 128, 127, 127, 126, 126, 125, 125, 124, 124, 124, 123, 123, 123, 123,
-123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 124, 124, 124, 124,
-124, 124, 124, 125, 125, 125, 125, 125, 126, 126, 126, 126, 126, 126, 126, 126, 127, 127, 127, 127,
-127, 127, 127, 128, 128, 128, 128, 128, 128, 129, 129, 129, 129, 129, 130, 130, 130, 131, 131, 131,
-131, 132, 132, 132, 133, 133, 133, 133, 134, 134, 134, 135, 135, 135, 135, 135, 135, 135, 135, 135,
-134, 134, 133, 132, 132, 131, 130, 129, 128, 127, 126, 125, 124, 123, 123, 122, 122, 121, 121, 122,
-122, 122, 122, 122, 123, 123, 123, 124, 124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125,
-126, 126, 126, 127, 127, 127, 127, 127, 127, 127, 127, 126, 126, 125, 124, 123, 123, 122, 121, 120,
-120, 120, 120, 120, 120, 121, 121, 122, 123, 125, 126, 127, 129, 129, 130, 131, 132, 132, 133, 133,
-133, 133, 133, 133, 133, 133, 134, 134, 135, 136, 136, 137, 138, 139, 140, 140, 141, 141, 141, 141,
-140, 139, 138, 137, 135, 133, 131, 129, 127, 125, 123, 122, 121, 119, 118, 118, 118, 118, 118, 119,
-119, 120, 121, 122, 123, 124, 124, 125, 126, 126, 126, 126, 126, 126, 126, 126, 126, 127, 127, 127,
-127, 128, 128, 128, 129, 129, 129, 129, 129, 129, 128, 127, 126, 125, 123, 122, 120, 118, 116, 114,
-113, 112, 112, 112, 112, 113, 114, 115, 117, 119, 122, 124, 127, 129, 131, 132, 133, 134, 135, 136,
-136, 136, 135, 135, 134, 134, 134, 134, 135, 135, 136, 137, 138, 140, 141, 143, 144, 145, 146, 146,
-146, 146, 144, 143, 141, 139, 136, 133, 130, 127, 124, 121, 119, 117, 116, 115, 114, 114, 114, 115,
-116, 117, 119, 120, 122, 123, 124, 126, 127, 127, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128,
-128, 129, 129, 129, 130, 130, 130, 130, 130, 130, 129, 128, 127, 126, 124, 122, 120, 118, 115, 113,
-111, 109, 108, 107, 107, 108, 108, 109, 111, 113, 115, 118, 121, 124, 127, 129, 131, 133, 134, 136,
-136, 137, 137, 136, 136, 135, 135, 135, 135, 135, 136, 136, 137, 139, 140, 142, 144, 146, 147, 148,
-149, 149, 149, 148, 147, 145, 143, 140, 137, 133, 130, 126, 123, 120, 118, 115, 114, 113, 112, 113,
-113, 115, 116, 118, 120, 121, 123, 125, 126, 128, 129, 130, 130, 130, 130, 130, 130, 130, 129, 129,
-129, 129, 129, 129, 130, 130, 130, 130, 131, 131, 131, 130, 129, 128, 126, 124, 122, 120, 118, 115,
-113, 110, 108, 106, 105, 105, 105, 106, 107, 108, 110, 112, 115, 118, 121, 124, 127, 129, 130, 132,
-133, 134, 135, 135, 135, 134, 134, 133, 133, 133, 133, 133, 134, 135, 136, 137, 139, 141, 143, 145,
-146, 148, 148, 149, 148, 148, 147, 145, 143, 141, 138, 135, 131, 128, 125, 123, 121, 119, 117, 116,
-115, 115, 116, 117, 119, 120, 122, 123, 125, 127, 128, 129, 130, 131, 132, 132, 132, 131, 131, 131,
-130, 130, 129, 129, 129, 128, 128, 128, 128, 128, 127, 127, 127, 127, 126, 125, 124, 123, 122, 121,
-120, 118, 116, 115, 113, 112, 111, 111, 111, 112, 112, 113, 113, 115, 116, 119, 121, 123, 124, 126,
-127, 128, 129, 130, 131, 131, 131, 131, 131, 130, 130, 130, 131, 131, 132, 132, 133, 134, 135, 137,
-138, 140, 141, 142, 143, 144, 144, 144, 143, 143, 142, 140, 138, 136, 134, 132, 130, 128, 126, 124,
-123, 122, 121, 121, 121, 121, 122, 123, 124, 125, 127, 128, 129, 130, 131, 132, 132, 133, 133, 133,
-133, 132, 132, 131, 131, 130, 129, 129, 128, 127, 127, 126, 126, 125, 125, 124, 124, 123, 123, 122,
-121, 120, 120, 119, 118, 117, 116, 115, 114, 114, 114, 114, 114, 115, 115, 116, 116, 118, 119, 120,
-121, 123, 124, 125, 126, 126, 127, 128, 128, 129, 129, 129, 129, 129, 130, 130, 131, 131, 132, 133,
-134, 134, 135, 136, 138, 139, 140, 140, 141, 141, 141, 141, 141, 140, 139, 138, 136, 135, 133, 131,
-130, 128, 127, 125, 124, 123, 123, 122, 123, 123, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132,
-133, 133, 134, 134, 134, 134, 134, 133, 133, 132, 132, 131, 130, 130, 129, 128, 127, 126, 125, 124,
-124, 123, 122, 121, 120, 119, 118, 118, 117, 116, 115, 115, 114, 114, 115, 115, 115, 116, 116, 117,
-118, 118, 119, 120, 121, 122, 123, 124, 124, 125, 126, 126, 127, 127, 128, 128, 128, 129, 129, 130,
-131, 132, 132, 133, 134, 135, 135, 136, 137, 138, 139, 139, 139, 140, 139, 139, 139, 138, 137, 136,
-135, 133, 132, 130, 128, 127, 126, 125, 124, 123, 123, 123, 123, 123, 124, 125, 126, 127, 128, 129,
-130, 132, 133, 133, 134, 135, 135, 135, 135, 135, 135, 135, 134, 133, 133, 132, 131, 130, 129, 128,
-127, 126, 125, 124, 124, 123, 122, 121, 120, 119, 119, 118, 118, 117, 117, 117, 116, 116, 117, 117,
-117, 118, 118, 118, 118, 119, 120, 120, 121, 121, 122, 122, 122, 123, 124, 124, 125, 125, 126, 126,
-127, 127, 128, 129, 129, 130, 131, 131, 132, 133, 133, 134, 135, 135, 136, 136, 136, 136, 136, 136,
-136, 136, 135, 134, 134, 133, 132, 131, 130, 129, 128, 128, 127, 127, 126, 126, 126, 126, 127, 127,
-128, 128, 129, 130, 131, 132, 133, 133, 134, 135, 135, 136, 136, 136, 136, 136, 135, 135, 134, 133,
-132, 131, 130, 129, 128, 127, 126, 125, 124, 123, 122, 121, 121, 120, 120, 119, 119, 118, 118, 118,
-118, 118, 118, 118, 118, 118, 118, 119, 119, 119, 120, 120, 120, 120, 120, 121, 121, 122, 122, 123,
-123, 124, 124, 125, 125, 126, 126, 127, 128, 128, 129, 130, 130, 131, 132, 132, 133, 133, 133, 134,
-134, 134, 134, 134, 134, 134, 134, 133, 133, 132, 132, 131, 131, 130, 130, 130, 129, 129, 129, 129,
-129, 129, 129, 130, 130, 131, 131, 132, 132, 133, 134, 135, 135, 136, 136, 136, 136, 136, 136, 136,
-136, 135, 134, 134, 133, 132, 131, 130, 129, 128, 127, 126, 125, 124, 122, 121, 121, 120, 119, 119,
-118, 118, 117, 117, 117, 117, 117, 118, 118, 118, 118, 118, 119, 119, 119, 120, 120, 120, 121, 121,
-121, 122, 122, 123, 123, 124, 124, 124, 125, 126, 126, 127, 127, 128, 129, 129, 130, 130, 131, 131,
-131, 132, 132, 132, 132, 132, 133, 133, 132, 132, 132, 132, 131, 131, 131, 130, 130, 130, 130, 130,
-129, 129, 129, 129, 129, 130, 130, 131, 131, 131, 132, 132, 133, 134, 134, 135, 135, 136, 136, 136,
-136, 136, 136, 136, 136, 135, 135, 134, 133, 133, 132, 131, 130, 129, 128, 127, 126, 125, 124, 123,
-122, 121, 121, 120, 119, 119, 118, 118, 117, 117, 117, 117, 118, 118, 118, 118, 118, 118, 119, 119,
-119, 120, 120, 120, 121, 121, 122, 122, 123, 123, 124, 124, 125, 126, 126, 127, 128, 128, 129, 129,
-130, 130, 131, 131, 131, 131, 131, 132, 132, 131, 131, 131, 131, 131, 130, 130, 130, 130, 129, 129,
-129, 129, 128, 128, 128, 128, 128, 128, 129, 129, 130, 130, 131, 131, 132, 132, 133, 134, 134, 135,
-136, 136, 137, 137, 137, 137, 137, 137, 137, 136, 136, 135, 135, 134, 133, 132, 131, 130, 129, 128,
-127, 126, 125, 124, 124, 123, 122, 121, 121, 120, 119, 119, 118, 118, 118, 118, 118, 118, 118, 118,
-118, 118, 118, 118, 119, 119, 119, 119, 120, 120, 121, 121, 122, 122, 123, 124, 124, 125, 126, 126,
-127, 128, 128, 129, 129, 129, 130, 130, 130, 130, 131, 131, 131, 130, 130, 130, 130, 130, 130, 130,
-130, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 130, 130, 130, 131, 131, 131, 132, 132,
-133, 133, 134, 134, 135, 135, 136, 136, 136, 136, 136, 136, 136, 136, 136, 135, 135, 134, 134, 133,
-132, 131, 131, 130, 129, 128, 127, 126, 125, 124, 124, 123, 122, 121, 121, 120, 120, 119, 119, 119,
-119, 118, 118, 118, 118, 118, 118, 119, 119, 119, 119, 119, 120, 120, 120, 121, 121, 121, 122, 122,
-123, 123, 124, 125, 125, 126, 127, 127, 128, 128, 128, 129, 129, 129, 130, 130, 130, 130, 130, 130,
-130, 130, 130, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 129, 130, 130, 130, 131,
-131, 132, 132, 133, 133, 134, 134, 135, 135, 135, 136, 136, 136, 136, 136, 136, 136, 136, 136, 135,
-135, 134, 134, 133, 133, 132, 131, 130, 129, 129, 128, 127, 126, 125, 124, 124, 123, 122, 122, 121,
-121, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 120, 121, 121, 121,
-121, 122, 122, 122, 123, 123, 124, 124, 124, 125, 126, 126, 126, 127, 127, 128, 128, 128, 128, 128,
-129, 129, 129, 129, 129, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 129, 129, 129,
-129, 130, 130, 131, 131, 132, 132, 133, 133, 133, 134, 134, 135, 135, 135, 136, 136, 136, 136, 136,
-136, 136, 135, 135, 135, 134, 134, 133, 133, 132, 131, 131, 130, 129, 129, 128, 127, 126, 126, 125,
-124, 124, 123, 123, 122, 122, 122, 122, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121, 121,
-121, 121, 121, 121, 121, 122, 122, 122, 123, 123, 123, 124, 124, 125, 125, 125, 126, 126, 127, 127,
-127, 127, 127, 127, 128, 128, 128, 128, 128, 128, 128, 128, 127, 128, 128, 128, 128, 128, 128, 128,
-128, 128, 129, 129, 129, 130, 130, 130, 131, 131, 132, 132, 132, 133, 133, 134, 134, 134, 135, 135,
-135, 135, 135, 135, 135, 135, 135, 135, 135, 134, 134, 134, 133, 133, 132, 131, 131, 130, 129, 129,
-128, 127, 127, 126, 126, 125, 124, 124, 124, 123, 123, 122, 122, 122, 122, 121, 121, 121, 121, 121,
-121, 120, 120, 120, 120, 120, 121, 121, 121, 121, 122, 122, 122, 123, 123, 124, 124, 124, 125, 125,
-126, 126, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 127, 127, 127,
-127, 127, 128, 128, 128, 128, 128, 128, 129, 129, 129, 130, 130, 131, 131, 131, 132, 132, 133, 133,
-133, 134, 134, 134, 135, 135, 135, 135, 135, 135, 135, 134, 134, 134, 134, 133, 133, 133, 132, 132,
-131, 131, 130, 130, 129, 129, 128, 127, 127, 126, 126, 125, 125, 124, 124, 123, 123, 123, 122, 122,
-122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 123, 123, 123,
-123, 124, 124, 124, 125, 125, 125, 126, 126, 126, 126, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 128, 129, 129, 129, 130, 130, 131, 131,
-131, 132, 132, 132, 133, 133, 134, 134, 134, 134, 134, 135, 135, 135, 135, 134, 134, 134, 134, 133,
-133, 133, 132, 132, 131, 131, 130, 130, 129, 129, 128, 127, 127, 126, 126, 125, 125, 124, 124, 124,
-123, 123, 123, 123, 123, 123, 123, 123, 123, 122, 122, 122, 122, 122, 122, 122, 122, 122, 123, 123,
-123, 123, 123, 123, 124, 124, 124, 124, 125, 125, 125, 125, 125, 126, 126, 126, 126, 126, 126, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129, 130,
-130, 130, 131, 131, 132, 132, 132, 132, 133, 133, 133, 134, 134, 134, 134, 134, 134, 134, 134, 134,
-134, 133, 133, 133, 133, 132, 132, 131, 131, 131, 130, 129, 129, 128, 128, 127, 127, 126, 126, 125,
-125, 124, 124, 124, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123, 123,
-123, 123, 123, 123, 124, 124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 126, 126, 126, 126,
-126, 126, 126, 126, 127, 127, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 128, 129, 129, 129,
-129, 129, 130, 130, 130, 130, 131, 131, 131, 132, 132, 132, 132, 133, 133, 133, 133, 133, 134, 134,
-134, 134, 134, 134, 133, 133, 133, 133, 132, 132, 131, 131, 131, 130, 129, 129, 128, 128, 127, 126,
-126, 125, 125, 124, 124, 123, 123, 123, 123, 123, 122, 122, 122, 122, 122, 123, 123, 123, 123, 123,
-123, 123, 123, 123, 123, 123, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125, 126, 126, 126,
-126, 126, 126, 126, 127, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 128, 129, 129, 129, 129,
-129, 129, 129, 130, 130, 130, 130, 130, 131, 131, 131, 132, 132, 132, 132, 133, 133, 133, 133, 134,
-134, 134, 134, 134, 134, 134, 134, 133, 133, 133, 132, 132, 131, 131, 130, 130, 129, 128, 128, 127,
-126, 126, 125, 124, 124, 123, 123, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 122, 123,
-123, 123, 123, 123, 123, 124, 124, 124, 124, 124, 124, 124, 124, 124, 125, 125, 125, 125, 125, 125,
-126, 126, 126, 126, 126, 126, 127, 127, 127, 128, 128, 128, 128, 129, 129, 129, 129, 130, 130, 130,
-130, 130, 130, 130, 130, 131, 131, 131, 131, 131, 132, 132, 132, 132, 132, 132, 132, 133, 133, 133,
-133, 133, 134, 134, 134, 134, 134, 134, 133, 133, 133, 132, 132, 131, 130, 130, 129, 128, 127, 127,
-126, 125, 124, 124, 123, 122, 122, 121, 121, 120, 120, 120, 120, 120, 121, 121, 121, 121, 122, 122,
-122, 123, 123, 124, 124, 124, 124, 125, 125, 125, 125, 126, 126, 126, 126, 126, 126, 126, 126, 126,
-126, 125, 125, 126, 126, 126, 126, 127, 127, 127, 128, 128, 129, 129, 130, 130, 131, 131, 131, 132,
-132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132,
-132, 132, 132, 133, 133, 133, 133, 133, 133, 133, 132, 132, 132, 131, 131, 130, 129, 128, 127, 126,
-125, 124, 123, 122, 121, 120, 119, 119, 118, 118, 118, 118, 118, 118, 119, 119, 120, 120, 121, 122,
-122, 123, 123, 124, 125, 125, 126, 126, 126, 127, 127, 127, 127, 127, 127, 126, 126, 126, 126, 126,
-126, 126, 126, 126, 126, 126, 127, 127, 128, 128, 129, 130, 130, 131, 131, 132, 133, 133, 133, 134,
-134, 134, 133, 133, 133, 133, 133, 132, 132, 131, 131, 131, 131, 131, 130, 130, 130, 131, 131, 131,
-132, 132, 132, 133, 133, 133, 133, 134, 134, 133, 133, 133, 132, 131, 131, 130, 129, 127, 126, 125,
-124, 123, 121, 120, 119, 118, 117, 117, 116, 116, 116, 115, 116, 116, 116, 117, 118, 119, 119, 120,
-121, 122, 123, 125, 126, 126, 127, 128, 128, 129, 129, 129, 129, 129, 129, 128, 128, 128, 127, 127,
-127, 127, 127, 126, 127, 127, 127, 128, 129, 129, 130, 131, 132, 132, 133, 134, 135, 135, 135, 135,
-135, 135, 135, 134, 134, 133, 133, 132, 131, 130, 129, 129, 129, 128, 128, 128, 128, 129, 129, 130,
-130, 131, 132, 133, 134, 134, 134, 135, 135, 134, 134, 134, 133, 132, 131, 130, 128, 127, 125, 124,
-122, 121, 119, 118, 116, 115, 114, 114, 113, 113, 113, 113, 113, 114, 114, 115, 116, 117, 118, 120,
-121, 122, 124, 125, 127, 128, 129, 129, 130, 131, 131, 132, 132, 132, 131, 131, 131, 130, 130, 130,
-129, 129, 129, 129, 129, 130, 130, 131, 131, 132, 133, 133, 134, 134, 135, 135, 135, 135, 135, 134,
-134, 133, 133, 132, 131, 130, 129, 128, 128, 127, 127, 127, 127, 127, 127, 127, 128, 129, 130, 130,
-131, 132, 133, 133, 134, 134, 134, 134, 134, 134, 133, 132, 131, 130, 129, 128, 127, 125, 123, 122,
-120, 119, 117, 116, 115, 113, 112, 111, 111, 111, 111, 112, 112, 113, 113, 114, 116, 118, 119, 121,
-123, 124, 125, 127, 129, 130, 131, 132, 133, 133, 133, 133, 133, 134, 133, 133, 132, 132, 131, 131,
-131, 132, 132, 132, 132, 133, 133, 134, 134, 135, 136, 136, 136, 136, 136, 135, 135, 134, 133, 132,
-131, 130, 129, 128, 127, 126, 125, 125, 125, 125, 125, 125, 126, 126, 127, 128, 130, 131, 132, 133,
-134, 135, 136, 137, 137, 137, 137, 136, 135, 134, 133, 131, 129, 127, 125, 122, 120, 118, 116, 113,
-111, 110, 108, 106, 105, 105, 105, 105, 106, 107, 108, 110, 111, 114, 116, 119, 121, 124, 126, 128,
-131, 133, 134, 136, 137, 138, 139, 139, 139, 138, 138, 137, 137, 136, 135, 135, 134, 134, 133, 133,
-133, 134, 134, 135, 135, 135, 136, 136, 137, 137, 137, 137, 136, 135, 134, 133, 132, 130, 129, 127,
-126, 124, 123, 123, 122, 122, 121, 122, 123, 124, 125, 127, 128, 130, 131, 132, 134, 136, 137, 138,
-138, 137, 137, 136, 135, 134, 132, 130, 128, 125, 123, 120, 117, 114, 112, 110, 107, 105, 103, 101,
- 99,  99,  99, 100, 102, 103, 105, 107, 110, 114, 118, 122, 126, 130, 133, 136, 139, 141, 143, 145,
-146, 147, 146, 145, 144, 143, 141, 140, 139, 137, 136, 134, 133, 133, 132, 133, 134, 134, 135, 136,
-136, 137, 137, 137, 137, 137, 136, 135, 133, 131, 129, 127, 125, 124, 122, 121, 120, 119, 119, 119,
-120, 121, 123, 125, 127, 129, 131, 133, 134, 136, 138, 139, 140, 140, 139, 139, 138, 136, 135, 133,
-131, 129, 127, 124, 121, 119, 116, 113, 111, 109, 106, 104, 102, 100,  98,  97,  97,  98,  99, 101,
-103, 106, 108, 112, 116, 121, 126, 130, 134, 137, 140, 143, 145, 147, 148, 149, 149, 147, 146, 143,
-141, 140, 138, 137, 135, 134, 132, 131, 131, 131, 132, 133, 134, 135, 135, 135, 135, 135, 136, 136,
-135, 134, 132, 130, 128, 126, 125, 124, 123, 123, 122, 122, 122, 123, 125, 126, 128, 130, 132, 133,
-135, 136, 136, 137, 138, 138, 137, 137, 135, 134, 132, 130, 129, 127, 126, 124, 122, 120, 118, 116,
-114, 112, 111, 110, 108, 106, 105, 103, 103, 103, 105, 107, 109, 111, 113, 115, 118, 122, 126, 130,
-133, 136, 138, 139, 140, 141, 142, 142, 142, 141, 139, 137, 135, 133, 132, 131, 130, 129, 128, 128,
-127, 128, 128, 129, 130, 131, 132, 132, 132, 132, 132, 132, 132, 132, 131, 130, 129, 128, 127, 127,
-127, 127, 128, 128, 128, 129, 130, 131, 133, 134, 135, 136, 136, 137, 137, 137, 137, 137, 136, 135,
-134, 133, 131, 130, 129, 128, 127, 125, 124, 122, 121, 119, 118, 118, 117, 116, 115, 114, 113, 113,
-113, 113, 114, 115, 117, 118, 119, 120, 121, 123, 125, 127, 128, 129, 130, 130, 130, 131, 131, 131,
-130, 130, 129, 128, 127, 127, 126, 126, 126, 125, 125, 125, 125, 125, 126, 126, 127, 128, 128, 128,
-129, 129, 130, 130, 131, 131, 131, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132,
-132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 132, 133, 133, 133, 133, 133, 133, 133, 132, 132,
-132, 132, 131, 130, 130, 129, 128, 126, 125, 125, 124, 123, 122, 121, 120, 119, 119, 118, 118, 118,
-118, 118, 119, 119, 119, 120, 121, 121, 122, 123, 123, 124, 125, 125, 126, 126, 126, 127, 127, 127,
-127, 127, 127, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 127, 128, 128, 129, 130,
-130, 131, 131, 132, 133, 133, 133, 134, 134, 134, 133, 133, 133, 133, 133, 132, 132, 132, 131, 131,
-131, 131, 130, 130, 130, 130, 131, 131, 131, 132, 132, 133, 133, 133, 133, 134, 134, 133, 133, 133,
-132, 132, 131, 130, 129, 128, 127, 125, 124, 123, 122, 121, 120, 119, 118, 117, 116, 116, 116, 116,
-116, 116, 116, 117, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 128, 128, 129, 129,
-129, 129, 129, 128, 128, 128, 127, 127, 127, 127, 127, 126, 127, 127, 127, 128, 128, 129, 130, 131,
-131, 132, 133, 134, 134, 135, 135, 135, 135, 135, 135, 134, 134, 134, 133, 132, 131, 130, 130, 129,
-129, 128, 128, 128, 128, 128, 129, 129, 130, 131, 132, 133, 133, 134, 134, 134, 135, 135, 134, 134,
-133, 132, 131, 130, 129, 127, 126, 124, 123, 121, 120, 118, 117, 116, 115, 114, 113, 113, 113, 113,
-113, 113, 114, 115, 116, 117, 118, 119, 121, 122, 124, 125, 126, 127, 128, 129, 130, 131, 131, 132,
-132, 132, 131, 131, 131, 130, 130, 130, 129, 129, 129, 129, 129, 129, 130, 130, 131, 132, 132, 133,
-134, 134, 135, 135, 135, 135, 135, 135, 134, 134, 133, 132, 131, 130, 129, 129, 128, 127, 127, 127,
-127, 127, 127, 127, 128, 128, 129, 130, 131, 132, 133, 133, 134, 134, 134, 134, 134, 134, 133, 133,
-132, 131, 130, 129, 127, 126, 124, 122, 121, 119, 118, 116, 115, 114, 112, 112, 111, 111, 111, 112,
-112, 113, 113, 114, 115, 117, 119, 121, 122, 124, 125, 126, 128, 130, 131, 132, 133, 133, 133, 133,
-133, 134, 133, 133, 133, 132, 132, 131, 131, 131, 132, 132, 132, 133, 133, 134, 134, 135, 135, 136,
-136, 136, 136, 135, 135, 134, 133, 132, 132, 130, 129, 128, 127, 126, 126, 125, 125, 125, 125, 125,
-125, 126, 127, 128, 129, 130, 132, 133, 134, 135, 136, 137, 137, 137, 137, 136, 136, 135, 133, 132,
-130, 128, 126, 123, 121, 118, 116, 114, 112, 110, 108, 107, 106, 105, 105, 105, 106, 106, 108, 109,
-111, 113, 115, 118, 120, 123, 125, 128, 130, 132, 134, 135, 137, 138, 138, 139, 139, 139, 138, 138,
-137, 136, 136, 135, 134, 134, 134, 133, 133, 134, 134, 134, 135, 135, 136, 136, 136, 137, 137, 137,
-136, 135, 134, 133, 132, 131, 129, 128, 126, 125, 124, 123, 122, 122, 121, 122, 122, 123, 125, 126,
-128, 129, 130, 132, 134, 135, 137, 138, 138, 138, 137, 136, 135, 134, 133, 131, 129, 126, 123, 121,
-118, 115, 113, 110, 108, 106, 104, 101, 100,  99,  99, 100, 101, 103, 105, 107, 109, 112, 116, 121,
-125, 129, 132, 135, 138, 140, 143, 144, 146, 147, 147, 146, 145, 143, 142, 140, 139, 138, 136, 135,
-134, 133, 132, 133, 133, 134, 135, 136, 136, 137, 137, 137, 137, 137, 137, 136, 134, 132, 130, 128,
-126, 124, 123, 121, 120, 119, 119, 119, 119, 121, 122, 124, 126, 128, 130, 132, 134, 136, 137, 139,
-140, 140, 140, 139, 138, 137, 136, 134, 133, 130, 128, 125, 122, 119, 116, 113, 111, 108, 106, 103,
-100,  98,  95,  94,  93,  94,  95,  97, 100, 102, 105, 108, 113, 118, 124, 129, 134, 138, 142, 145,
-148, 150, 152, 154, 154, 153, 151, 148, 146, 143, 141, 139, 138, 136, 134, 133, 132, 132, 132, 134,
-135, 136, 137, 137, 137, 137, 137, 137, 137, 135, 133, 130, 127, 124, 122, 121, 119, 118, 117, 117,
-117, 118, 119, 122, 124, 128, 131, 133, 136, 138, 139, 141, 142, 143, 143, 143, 141, 139, 137, 135,
-132, 130, 128, 125, 122, 119, 116, 112, 109, 106, 103, 101,  98,  94,  91,  88,  86,  86,  88,  91,
- 94,  98, 101, 105, 111, 117, 125, 133, 140, 146, 150, 153, 156, 159, 161, 162, 162, 159, 156, 151,
-147, 143, 140, 137, 134, 132, 130, 128, 126, 126, 127, 129, 131, 133, 135, 136, 136, 136, 136, 136,
-135, 135, 133, 130, 126, 123, 120, 119, 119, 119, 119, 119, 120, 121, 123, 126, 130, 134, 138, 141,
-143, 144, 144, 145, 146, 146, 145, 144, 141, 137, 134, 131, 128, 126, 124, 121, 117, 113, 109, 105,
-103, 100,  99,  97,  94,  90,  85,  82,  80,  81,  85,  90,  95,  99, 103, 107, 114, 122, 133, 144,
-153, 159, 162, 164, 165, 167, 169, 169, 168, 163, 156, 148, 141, 136, 132, 129, 126, 123, 120, 118,
-118, 119, 122, 125, 129, 132, 134, 135, 135, 135, 135, 136, 136, 135, 132, 128, 124, 121, 119, 120,
-121, 122, 124, 125, 126, 128, 132, 136, 142, 146, 149, 150, 150, 149, 148, 147, 146, 145, 142, 138,
-133, 129, 126, 123, 121, 120, 117, 114, 111, 107, 104, 102, 100,  98,  95,  91,  87,  81,  77,  76,
- 77,  82,  87,  93,  98, 103, 109, 118, 129, 142, 154, 164, 170, 174, 175, 176, 176, 176, 175, 170,
-162, 152, 142, 133, 126, 121, 118, 114, 111, 109, 107, 108, 111, 116, 121, 126, 130, 132, 133, 134,
-135, 136, 137, 137, 135, 132, 129, 126, 124, 124, 125, 128, 130, 132, 134, 136, 139, 143, 148, 152,
-154, 155, 154, 152, 149, 147, 144, 141, 137, 132, 127, 122, 118, 115, 114, 113, 112, 111, 110, 108,
-107, 106, 105, 104, 102,  99,  95,  89,  84,  79,  77,  79,  83,  88,  93,  98, 104, 112, 124, 138,
-152, 164, 173, 179, 181, 183, 183, 183, 180, 174, 165, 154, 142, 130, 120, 112, 106, 102,  98,  96,
- 95,  96, 100, 106, 113, 121, 128, 134, 138, 140, 142, 143, 145, 145, 144, 142, 138, 133, 130, 128,
-128, 129, 131, 134, 136, 138, 141, 144, 148, 152, 154, 155, 153, 150, 146, 142, 138, 133, 128, 123,
-118, 113, 110, 108, 108, 110, 112, 114, 116, 118, 119, 119, 119, 119, 117, 114, 110, 103,  94,  85,
- 79,  76,  78,  81,  86,  91,  97, 104, 115, 129, 144, 159, 171, 179, 183, 184, 184, 183, 179, 174,
-164, 152, 138, 123, 111, 101,  94,  90,  87,  87,  87,  90,  96, 104, 114, 124, 135, 143, 149, 152,
-153, 153, 153, 152, 150, 146, 141, 135, 129, 126, 125, 126, 128, 132, 135, 138, 141, 145, 148, 151,
-154, 154, 152, 149, 144, 138, 132, 126, 120, 115, 110, 106, 103, 103, 105, 108, 113, 119, 124, 130,
-134, 137, 139, 139, 137, 133, 128, 119, 108,  96,  84,  74,  68,  67,  70,  75,  81,  88,  98, 110,
-126, 144, 161, 175, 184, 188, 189, 187, 183, 178, 170, 158, 144, 127, 112,  99,  90,  84,  82,  82,
- 84,  87,  93, 101, 111, 123, 135, 145, 153, 158, 159, 159, 157, 154, 151, 147, 142, 136, 130, 125,
-122, 122, 125, 129, 133, 137, 141, 145, 148, 152, 154, 155, 154, 151, 146, 140, 132, 125, 118, 112,
-107, 104, 102, 101, 103, 107, 113, 121, 128, 135, 142, 146, 149, 150, 148, 144, 137, 129, 118, 105,
- 91,  77,  65,  58,  56,  58,  65,  74,  84,  95, 109, 125, 144, 162, 178, 188, 193, 193, 190, 185,
-178, 169, 158, 144, 128, 113,  99,  90,  85,  83,  84,  87,  91,  97, 104, 113, 123, 133, 142, 148,
-152, 153, 152, 150, 147, 145, 142, 138, 134, 130, 127, 126, 127, 130, 135, 140, 144, 148, 151, 153,
-155, 155, 155, 153, 149, 143, 136, 128, 121, 114, 109, 105, 103, 102, 103, 106, 111, 117, 125, 133,
-140, 145, 149, 150, 149, 146, 141, 134, 125, 115, 103,  89,  76,  65,  58,  57,  61,  69,  79,  89,
-101, 113, 128, 145, 163, 179, 189, 193, 191, 185, 178, 170, 161, 150, 137, 123, 108,  95,  86,  82,
- 82,  86,  91,  97, 103, 110, 118, 127, 136, 144, 150, 152, 152, 150, 146, 143, 141, 139, 137, 135,
-133, 131, 131, 133, 137, 142, 147, 151, 153, 153, 153, 152, 150, 147, 143, 137, 131, 124, 117, 112,
-107, 105, 105, 106, 109, 113, 118, 124, 130, 137, 143, 148, 150, 151, 150, 146, 141, 134, 126, 117,
-108,  98,  88,  77,  68,  62,  60,  64,  72,  83,  95, 107, 118, 131, 145, 160, 175, 185, 189, 188,
-181, 172, 163, 154, 144, 134, 123, 110,  99,  91,  87,  87,  91,  97, 103, 109, 115, 121, 127, 132,
-138, 142, 144, 144, 141, 138, 135, 133, 132, 132, 134, 136, 138, 140, 142, 146, 150, 155, 158, 159,
-158, 155, 150, 144, 139, 133, 128, 122, 117, 112, 108, 105, 104, 106, 109, 114, 120, 126, 131, 135,
-140, 144, 148, 150, 150, 149, 145, 140, 134, 127, 120, 112, 104,  96,  87,  78,  69,  64,  62,  65,
- 73,  85,  97, 109, 122, 135, 150, 165, 178, 187, 191, 189, 183, 174, 163, 152, 141, 128, 116, 103,
- 93,  85,  82,  83,  88,  95, 102, 110, 117, 123, 130, 136, 141, 145, 146, 145, 143, 139, 136, 134,
-134, 136, 138, 140, 142, 144, 146, 149, 153, 156, 158, 157, 153, 147, 141, 135, 129, 124, 119, 114,
-110, 106, 104, 105, 108, 113, 119, 125, 131, 135, 140, 144, 148, 151, 152, 152, 149, 145, 140, 134,
-127, 120, 112, 104,  95,  85,  76,  67,  61,  58,  61,  70,  81,  95, 109, 122, 137, 153, 169, 184,
-195, 198, 195, 187, 176, 163, 150, 137, 123, 108,  94,  83,  77,  75,  78,  85,  94, 103, 112, 121,
-129, 137, 142, 147, 149, 148, 146, 141, 137, 133, 130, 130, 132, 135, 138, 142, 145, 149, 154, 158,
-161, 162, 160, 155, 148, 140, 132, 125, 118, 112, 106, 103, 100, 100, 102, 107, 114, 122, 130, 137,
-143, 148, 152, 154, 156, 155, 153, 149, 143, 136, 129, 122, 114, 106,  97,  89,  80,  72,  65,  61,
- 61,  66,  74,  87, 101, 116, 131, 146, 161, 176, 188, 195, 196, 192, 183, 170, 155, 141, 127, 114,
-101,  90,  82,  78,  79,  83,  90,  99, 108, 116, 124, 130, 135, 139, 141, 142, 142, 140, 138, 136,
-135, 136, 138, 142, 146, 151, 154, 157, 158, 159, 158, 156, 153, 147, 140, 132, 123, 115, 109, 104,
-102, 102, 104, 107, 111, 117, 123, 130, 137, 144, 149, 153, 155, 154, 152, 149, 146, 142, 137, 132,
-125, 118, 111, 104,  98,  92,  85,  79,  72,  67,  64,  65,  70,  81,  97, 114, 131, 147, 161, 174,
-186, 195, 200, 198, 190, 176, 160, 142, 126, 112, 100,  90,  82,  76,  75,  78,  84,  94, 105, 115,
-124, 131, 135, 138, 140, 141, 141, 141, 140, 139, 138, 137, 139, 143, 148, 153, 157, 160, 160, 159,
-156, 153, 149, 143, 136, 128, 119, 111, 105, 102, 102, 103, 107, 111, 115, 121, 127, 133, 140, 146,
-151, 153, 153, 152, 149, 145, 142, 138, 133, 127, 120, 113, 106, 100,  93,  87,  80,  74,  68,  65,
- 67,  72,  84,  99, 116, 134, 150, 164, 176, 187, 195, 198, 195, 186, 172, 155, 138, 122, 108,  97,
- 88,  81,  77,  77,  80,  87,  96, 106, 116, 125, 131, 135, 138, 140, 141, 143, 143, 143, 142, 142,
-143, 145, 148, 152, 156, 158, 158, 156, 152, 147, 142, 137, 131, 124, 117, 111, 106, 104, 104, 107,
-112, 117, 122, 127, 132, 137, 141, 145, 148, 149, 149, 147, 144, 141, 137, 133, 129, 125, 121, 116,
-111, 104,  98,  90,  83,  77,  73,  73,  76,  83,  95, 109, 125, 140, 155, 168, 179, 186, 190, 189,
-183, 173, 160, 145, 131, 117, 106,  97,  91,  88,  87,  89,  94, 100, 107, 114, 121, 126, 130, 132,
-134, 135, 136, 137, 139, 140, 142, 144, 147, 150, 153, 155, 156, 155, 152, 147, 142, 136, 130, 124,
-118, 113, 109, 106, 104, 105, 107, 111, 115, 119, 123, 126, 129, 132, 134, 136, 137, 137, 136, 135,
-133, 131, 128, 125, 122, 119, 115, 111, 106, 101,  96,  93,  92,  95, 101, 110, 121, 133, 144, 154,
-162, 168, 172, 173, 171, 166, 158, 148, 136, 125, 116, 110, 105, 103, 102, 103, 105, 109, 114, 119,
-123, 127, 129, 130, 130, 130, 131, 131, 132, 134, 135, 136, 138, 140, 143, 145, 147, 148, 146, 143,
-139, 135, 131, 128, 125, 123, 121, 120, 119, 120, 122, 125, 127, 129, 129, 129, 128, 127, 125, 123,
-121, 118, 115, 112, 110, 109, 108, 107, 107, 107, 106, 105, 104, 102, 101, 101, 103, 107, 113, 121,
-130, 140, 150, 158, 164, 168, 171, 170, 168, 163, 155, 147, 138, 129, 122, 116, 112, 111, 111, 113,
-117, 121, 125, 129, 132, 134, 136, 136, 136, 135, 133, 132, 130, 129, 129, 129, 129, 130, 131, 132,
-132, 132, 132, 131, 130, 128, 128, 128, 128, 128, 129, 130, 132, 134, 136, 138, 139, 139, 138, 137,
-136, 134, 132, 129, 127, 124, 120, 117, 114, 111, 108, 106, 104, 100,  96,  91,  87,  85,  84,  85,
- 87,  91,  96, 103, 111, 121, 131, 141, 150, 156, 160, 163, 164, 163, 162, 159, 155, 150, 145, 140,
-135, 132, 130, 129, 128, 127, 126, 126, 126, 127, 128, 130, 132, 133, 135, 135, 136, 137, 137, 138,
-138, 138, 136, 134, 131, 127, 124, 121, 120, 119, 118, 118, 118, 119, 121, 124, 128, 133, 137, 140,
-143, 144, 145, 145, 146, 146, 145, 143, 141, 137, 134, 131, 128, 126, 124, 121, 117, 114, 109, 106,
-102, 100,  98,  96,  93,  90,  85,  82,  80,  81,  85,  90,  95,  99, 103, 107, 114, 122, 133, 144,
-153, 159, 162, 164, 165, 167, 169, 169, 168, 163, 156, 148, 141, 136, 132, 129, 126, 123, 120, 118,
-118, 119, 121, 125, 129, 132, 134, 135, 135, 135, 135, 136, 136, 135, 132, 128, 124, 121, 119, 120,
-121, 122, 124, 125, 126, 128, 132, 136, 142, 146, 149, 150, 150, 149, 148, 147, 146, 145, 142, 138,
-133, 129, 126, 123, 121, 120, 117, 114, 111, 107, 104, 102, 100,  98,  95,  91,  87,  81,  77,  76,
- 77,  82,  87,  93,  98, 102, 109, 118, 129, 142, 154, 164, 170, 174, 175, 176, 176, 176, 175, 170,
-162, 152, 142, 133, 126, 121, 118, 114, 111, 109, 107, 108, 111, 116, 121, 126, 130, 132, 133, 134,
-135, 136, 137, 137, 135, 132, 129, 126, 124, 124, 125, 128, 130, 132, 134, 136, 139, 143, 148, 152,
-154, 155, 154, 152, 149, 147, 144, 141, 137, 132, 127, 122, 118, 115, 114, 113, 112, 111, 110, 108,
-107, 106, 105, 104, 102,  99,  95,  89,  84,  79,  77,  79,  83,  88,  93,  98, 104, 112, 124, 138,
-152, 164, 173, 179, 181, 183, 183, 183, 180, 174, 165, 154, 142, 130, 120, 112, 106, 102,  98,  96,
- 95,  96, 100, 106, 113, 121, 128, 134, 138, 140, 142, 143, 145, 145, 144, 142, 138, 133, 130, 128,
-128, 129, 131, 134, 136, 138, 140, 144, 148, 152, 154, 155, 153, 150, 146, 142, 138, 133, 128, 123,
-118, 113, 110, 108, 108, 110, 112, 114, 116, 118, 119, 119, 119, 119, 117, 114, 110, 103,  94,  85,
- 79,  76,  77,  81,  86,  91,  97, 104, 115, 129, 144, 159, 171, 179, 183, 184, 184, 183, 179, 174,
-164, 152, 138, 123, 111, 101,  94,  90,  87,  87,  87,  90,  96, 104, 114, 124, 135, 143, 149, 152,
-153, 153, 153, 152, 150, 146, 141, 135, 129, 126, 125, 126, 128, 132, 135, 138, 141, 145, 148, 151,
-154, 154, 152, 149, 144, 138, 132, 126, 120, 115, 110, 106, 103, 103, 105, 108, 113, 119, 124, 130,
-134, 137, 139, 139, 137, 133, 128, 119, 108,  96,  84,  74,  68,  67,  70,  75,  81,  88,  98, 110,
-126, 144, 161, 175, 184, 188, 189, 187, 183, 178, 170, 158, 144, 127, 112,  99,  90,  84,  82,  82,
- 84,  87,  93, 101, 111, 123, 135, 145, 153, 158, 159, 159, 157, 154, 151, 147, 142, 136, 130, 125,
-122, 122, 125, 129, 133, 137, 141, 145, 148, 152, 154, 155, 154, 151, 146, 140, 132, 125, 118, 112,
-107, 104, 102, 101, 103, 107, 113, 121, 128, 135, 142, 146, 149, 150, 148, 144, 137, 129, 118, 105,
- 91,  77,  65,  58,  56,  58,  65,  74,  84,  95, 109, 125, 144, 162, 178, 188, 193, 193, 190, 185,
-178, 169, 158, 144, 128, 113,  99,  90,  85,  83,  84,  87,  91,  97, 104, 113, 123, 133, 142, 148,
-152, 153, 152, 150, 147, 145, 142, 138, 134, 130, 127, 126, 127, 130, 135, 140, 144, 148, 151, 153,
-155, 155, 155, 153, 149, 143, 136, 128, 121, 114, 109, 105, 103, 102, 103, 106, 111, 117, 125, 133,
-140, 145, 149, 150, 149, 146, 141, 134, 125, 115, 103,  89,  76,  65,  58,  57,  61,  69,  79,  89,
-101, 113, 128, 145, 163, 179, 189, 193, 191, 185, 178, 170, 161, 150, 137, 123, 108,  95,  86,  82,
- 82,  86,  91,  97, 103, 110, 118, 127, 136, 144, 150, 152, 152, 150, 146, 143, 141, 139, 137, 135,
-133, 131, 131, 133, 137, 142, 147, 150, 153, 153, 153, 152, 150, 147, 143, 137, 131, 124, 117, 112,
-107, 105, 105, 106, 109, 113, 118, 124, 130, 137, 143, 148, 150, 151, 150, 146, 141, 134, 126, 117,
-108,  98,  88,  77,  68,  62,  60,  64,  72,  83,  95, 107, 118, 131, 145, 160, 175, 185, 189, 188,
-181, 172, 163, 154, 144, 134, 123, 110,  99,  91,  87,  87,  91,  97, 103, 109, 115, 121, 127, 132,
-138, 142, 144, 144, 141, 138, 135, 133, 132, 132, 134, 136, 138, 140, 142, 146, 150, 155, 158, 159,
-158, 155, 150, 144, 139, 133, 128, 122, 117, 112, 108, 105, 104, 106, 109, 114, 120, 126, 131, 135,
-140, 144, 148, 150, 150, 149, 145, 140, 134, 127, 120, 112, 104,  96,  87,  78,  69,  64,  62,  65,
- 73,  85,  97, 109, 122, 135, 150, 165, 178, 187, 191, 189, 183, 174, 163, 152, 141, 129, 116, 103,
- 93,  85,  82,  83,  88,  95, 102, 110, 117, 123, 130, 136, 141, 145, 146, 145, 143, 139, 136, 134,
-134, 136, 138, 140, 142, 144, 146, 149, 153, 156, 158, 157, 153, 147, 141, 135, 129, 124, 119, 114,
-110, 106, 104, 105, 108, 113, 119, 125, 131, 135, 140, 144, 148, 151, 152, 152, 149, 145, 140, 134,
-127, 120, 112, 104,  95,  85,  76,  67,  61,  58,  61,  69,  81,  95, 109, 122, 137, 153, 169, 184,
-195, 198, 195, 187, 176, 163, 150, 137, 123, 108,  94,  83,  77,  75,  78,  85,  94, 103, 112, 121,
-129, 136, 142, 147, 149, 148, 146, 141, 137, 133, 130, 130, 132, 135, 138, 142, 145, 149, 154, 158,
-161, 162, 160, 155, 148, 140, 132, 125, 118, 112, 106, 103, 100, 100, 102, 107, 114, 122, 130, 137,
-143, 148, 152, 154, 156, 155, 153, 149, 143, 136, 129, 122, 114, 106,  97,  89,  80,  72,  65,  61,
- 61,  66,  74,  87, 101, 116, 131, 146, 161, 176, 188, 195, 196, 192, 183, 170, 155, 141, 127, 114,
-101,  90,  82,  78,  79,  83,  90,  99, 108, 116, 124, 130, 135, 139, 141, 142, 142, 140, 138, 136,
-135, 136, 138, 142, 146, 151, 154, 157, 158, 159, 158, 156, 153, 147, 140, 132, 123, 115, 109, 104,
-102, 102, 104, 107, 111, 117, 123, 130, 137, 144, 149, 153, 155, 154, 152, 149, 146, 142, 137, 132,
-125, 118, 111, 104,  98,  92,  85,  79,  72,  67,  64,  65,  70,  81,  97, 114, 131, 147, 161, 174,
-186, 195, 200, 198, 190, 176, 160, 142, 126, 112, 100,  90,  82,  76,  75,  78,  84,  94, 105, 115,
-124, 131, 135, 138, 140, 141, 141, 141, 140, 139, 138, 137, 139, 143, 148, 153, 157, 160, 160, 159,
-156, 153, 149, 143, 136, 128, 119, 111, 105, 102, 102, 103, 107, 111, 115, 121, 127, 133, 140, 146,
-151, 153, 153, 152, 149, 145, 142, 138, 133, 127, 120, 113, 106, 100,  93,  87,  80,  74,  68,  65,
- 67,  72,  84,  99, 116, 134, 150, 164, 176, 187, 195, 198, 195, 186, 172, 155, 138, 122, 108,  97,
- 88,  81,  77,  77,  80,  87,  96, 106, 116, 125, 131, 136, 138, 140, 141, 143, 143, 143, 142, 142,
-143, 145, 148, 152, 156, 158, 158, 156, 153, 148, 143, 137, 131, 125, 118, 111, 106, 104, 104, 107,
-112, 117, 122, 127, 133, 138, 142, 146, 149, 150, 150, 148, 145, 141, 137, 133, 128, 124, 119, 114,
-108, 101,  93,  85,  77,  70,  66,  65,  68,  77,  89, 105, 123, 141, 158, 173, 185, 194, 198, 198,
-192, 180, 165, 147, 130, 115, 102,  91,  84,  80,  79,  82,  88,  95, 104, 113, 120, 126, 131, 133,
-135, 136, 138, 139, 140, 142, 143, 146, 149, 153, 157, 161, 163, 161, 158, 153, 146, 139, 132, 125,
-119, 112, 107, 104, 103, 104, 108, 114, 120, 126, 132, 137, 141, 144, 146, 148, 148, 147, 145, 142,
-137, 132, 127, 121, 115, 109, 103,  95,  87,  78,  70,  66,  66,  70,  80,  94, 112, 130, 148, 164,
-178, 188, 195, 197, 194, 185, 172, 155, 136, 119, 104,  92,  85,  80,  79,  81,  86,  94, 103, 113,
-122, 129, 134, 136, 138, 138, 140, 141, 142, 143, 145, 146, 147, 150, 153, 156, 158, 157, 153, 147,
-139, 131, 124, 118, 114, 110, 107, 106, 107, 111, 117, 125, 132, 138, 142, 145, 146, 146, 146, 144,
-142, 139, 136, 133, 129, 126, 122, 119, 115, 112, 108, 101,  93,  83,  74,  66,  63,  67,  76,  90,
-108, 127, 146, 163, 178, 190, 198, 202, 199, 190, 176, 158, 138, 120, 104,  91,  83,  78,  78,  81,
- 87,  95, 105, 114, 123, 129, 133, 135, 135, 134, 134, 135, 136, 139, 142, 145, 149, 153, 157, 161,
-163, 162, 157, 150, 140, 130, 122, 115, 110, 106, 104, 104, 107, 112, 119, 127, 134, 139, 142, 143,
-144, 143, 141, 140, 138, 135, 133, 131, 128, 126, 124, 123, 121, 118, 112, 103,  92,  81,  71,  65,
- 63,  68,  78,  94, 113, 133, 154, 171, 185, 195, 201, 201, 195, 183, 167, 148, 128, 110,  95,  84,
- 78,  77,  79,  85,  93, 102, 110, 118, 125, 131, 134, 135, 134, 133, 133, 135, 139, 143, 148, 153,
-157, 161, 164, 166, 165, 160, 152, 140, 128, 116, 108, 102, 100,  99, 100, 104, 110, 119, 128, 137,
-144, 148, 150, 150, 148, 146, 142, 138, 133, 129, 126, 125, 124, 124, 124, 123, 122, 119, 115, 107,
- 98,  86,  76,  68,  64,  65,  71,  84, 101, 121, 142, 162, 180, 193, 202, 204, 200, 191, 177, 160,
-142, 125, 108,  95,  85,  80,  79,  82,  88,  95, 102, 110, 117, 122, 127, 129, 130, 130, 130, 131,
-134, 140, 146, 152, 157, 162, 165, 168, 168, 165, 159, 149, 136, 123, 111, 103,  98,  97,  99, 102,
-108, 115, 123, 132, 140, 146, 149, 150, 148, 145, 141, 137, 133, 130, 128, 127, 127, 127, 127, 126,
-125, 123, 119, 112, 101,  89,  75,  65,  59,  60,  68,  82, 102, 124, 146, 166, 182, 195, 201, 202,
-198, 187, 171, 154, 135, 118, 103,  92,  85,  82,  84,  89,  95, 102, 108, 113, 117, 120, 122, 123,
-123, 123, 125, 128, 134, 141, 150, 158, 164, 169, 172, 172, 170, 164, 155, 143, 130, 117, 106,  99,
- 95,  96,  99, 104, 111, 119, 127, 135, 142, 147, 149, 149, 146, 142, 138, 134, 131, 128, 128, 128,
-129, 131, 132, 133, 133, 132, 129, 124, 115, 103,  89,  75,  63,  56,  55,  60,  72,  89, 111, 135,
-159, 179, 194, 203, 206, 203, 195, 181, 164, 145, 126, 109,  96,  88,  85,  86,  90,  96, 102, 108,
-113, 116, 117, 117, 117, 117, 118, 118, 120, 125, 132, 142, 154, 164, 172, 176, 177, 174, 168, 160,
-150, 137, 124, 111, 101,  95,  94,  96, 101, 108, 116, 124, 132, 139, 144, 147, 148, 147, 144, 140,
-136, 132, 129, 128, 128, 130, 133, 135, 136, 136, 136, 134, 132, 127, 121, 112, 101,  89,  76,  66,
- 59,  56,  60,  70,  86, 108, 132, 156, 176, 191, 199, 202, 199, 192, 181, 167, 150, 131, 114,  99,
- 90,  86,  88,  92,  98, 103, 106, 109, 110, 111, 112, 113, 114, 116, 118, 122, 127, 135, 144, 155,
-165, 172, 176, 176, 173, 167, 159, 149, 139, 128, 117, 107, 101,  98,  98, 102, 108, 115, 121, 127,
-132, 137, 140, 142, 143, 142, 140, 138, 136, 134, 133, 134, 135, 136, 137, 137, 136, 134, 132, 130,
-127, 123, 119, 114, 108, 103,  97,  90,  82,  75,  69,  66,  68,  77,  92, 112, 136, 159, 178, 191,
-197, 198, 194, 188, 179, 165, 149, 131, 113,  98,  89,  85,  87,  92,  98, 103, 107, 110, 111, 112,
-112, 113, 115, 117, 120, 124, 129, 137, 147, 157, 167, 174, 177, 176, 170, 162, 153, 143, 133, 123,
-115, 108, 103, 102, 103, 108, 114, 120, 126, 130, 133, 134, 135, 135, 135, 135, 135, 134, 134, 135,
-136, 137, 139, 141, 142, 141, 139, 135, 130, 126, 122, 118, 116, 114, 114, 113, 110, 106, 100,  92,
- 83,  75,  70,  69,  73,  83,  98, 119, 143, 165, 182, 193, 198, 199, 194, 185, 173, 158, 141, 123,
-108,  96,  89,  87,  89,  93,  99, 104, 106, 107, 107, 107, 108, 111, 115, 119, 125, 132, 140, 150,
-161, 171, 178, 181, 179, 173, 164, 153, 142, 131, 121, 114, 108, 104, 102, 102, 106, 112, 120, 126,
-131, 132, 132, 131, 131, 132, 133, 134, 135, 136, 136, 137, 139, 140, 142, 143, 143, 140, 136, 130,
-124, 120, 118, 116, 116, 116, 115, 113, 111, 108, 104,  98,  91,  83,  75,  69,  68,  74,  88, 109,
-135, 160, 181, 194, 199, 198, 192, 184, 173, 160, 144, 127, 110,  96,  89,  87,  91,  97, 104, 109,
-111, 110, 109, 107, 107, 109, 111, 116, 121, 128, 136, 146, 157, 167, 176, 180, 179, 174, 164, 153,
-142, 132, 124, 118, 113, 110, 108, 109, 111, 115, 121, 125, 128, 129, 129, 128, 127, 127, 127, 129,
-132, 135, 137, 140, 142, 144, 145, 145, 144, 142, 137, 131, 124, 119, 114, 112, 112, 112, 114, 117,
-119, 119, 116, 110, 101,  90,  79,  70,  66,  67,  76,  91, 112, 137, 162, 182, 194, 200, 198, 192,
-182, 170, 155, 139, 123, 110, 100,  94,  93,  96, 101, 106, 110, 111, 110, 107, 104, 102, 102, 105,
-111, 120, 129, 141, 153, 165, 175, 182, 184, 181, 174, 162, 150, 137, 126, 118, 112, 110, 109, 109,
-111, 114, 117, 122, 125, 127, 127, 125, 124, 123, 125, 127, 131, 135, 138, 141, 144, 146, 148, 148,
-147, 144, 139, 133, 126, 119, 114, 112, 112, 114, 116, 119, 120, 120, 119, 117, 113, 107,  98,  88,
- 78,  70,  66,  68,  78,  94, 118, 145, 169, 187, 197, 198, 193, 185, 175, 165, 152, 137, 121, 107,
- 97,  94,  95,  99, 105, 110, 112, 111, 110, 107, 105, 104, 105, 109, 115, 122, 131, 141, 152, 163,
-173, 180, 182, 179, 171, 160, 148, 137, 127, 119, 114, 110, 109, 108, 110, 112, 116, 121, 125, 127,
-128, 126, 124, 123, 124, 127, 132, 136, 140, 143, 145, 145, 146, 146, 145, 143, 139, 133, 126, 119,
-113, 111, 111, 114, 117, 121, 123, 123, 122, 118, 113, 105,  97,  88,  78,  71,  66,  67,  76,  93,
-118, 145, 171, 189, 198, 199, 194, 186, 176, 164, 151, 136, 121, 107,  98,  94,  96, 101, 107, 111,
-113, 111, 108, 103,  99,  98, 101, 106, 114, 124, 134, 145, 157, 168, 178, 184, 185, 180, 171, 158,
-145, 133, 124, 117, 113, 112, 111, 111, 112, 115, 118, 121, 123, 124, 123, 121, 120, 121, 124, 128,
-133, 137, 141, 145, 147, 148, 149, 148, 145, 141, 136, 129, 124, 119, 115, 112, 111, 112, 113, 115,
-117, 119, 120, 119, 115, 108,  99,  90,  82,  76,  73,  75,  84,  99, 120, 144, 168, 186, 195, 196,
-190, 179, 168, 155, 142, 129, 118, 109, 103, 101, 103, 107, 113, 117, 119, 117, 111, 104,  98,  95,
- 96, 102, 112, 123, 136, 148, 161, 171, 179, 182, 180, 174, 164, 152, 140, 129, 121, 117, 115, 116,
-118, 119, 119, 119, 119, 120, 120, 119, 117, 116, 116, 118, 123, 130, 136, 142, 146, 149, 150, 149,
-147, 145, 141, 137, 131, 126, 121, 117, 115, 116, 118, 120, 123, 125, 126, 125, 125, 123, 119, 113,
-105,  95,  86,  79,  76,  77,  83,  96, 114, 134, 154, 171, 182, 185, 182, 176, 168, 159, 149, 138,
-128, 119, 114, 111, 111, 112, 112, 112, 111, 108, 104,  99,  93,  89,  89,  91,  98, 108, 120, 133,
-145, 157, 168, 176, 181, 181, 176, 169, 159, 149, 140, 132, 126, 120, 115, 111, 106, 104, 102, 103,
-105, 108, 111, 114, 117, 121, 126, 132, 137, 142, 146, 148, 148, 145, 142, 139, 136, 134, 133, 132,
-130, 129, 129, 130, 132, 135, 138, 139, 138, 136, 132, 127, 121, 115, 109, 102,  97,  92,  89,  89,
- 92,  99, 111, 125, 141, 155, 165, 170, 171, 169, 164, 159, 152, 144, 135, 126, 119, 113, 109, 105,
-101,  97,  93,  87,  82,  79,  78,  80,  85,  95, 106, 119, 133, 147, 161, 174, 184, 190, 191, 186,
-176, 164, 150, 137, 124, 113, 104,  97,  92,  90,  91,  94, 100, 106, 113, 119, 124, 128, 132, 134,
-137, 138, 139, 139, 139, 138, 138, 139, 141, 143, 146, 148, 150, 151, 151, 151, 150, 148, 144, 139,
-133, 127, 120, 114, 109, 106, 104, 104, 105, 107, 110, 114, 119, 124, 131, 137, 143, 149, 152, 154,
-155, 153, 150, 146, 140, 134, 126, 119, 111, 104,  98,  92,  85,  79,  73,  69,  67,  69,  75,  87,
-102, 118, 135, 150, 164, 177, 188, 196, 199, 196, 186, 171, 154, 137, 122, 108,  97,  87,  80,  76,
- 75,  79,  87,  97, 108, 118, 126, 132, 136, 139, 140, 141, 141, 141, 140, 138, 137, 138, 140, 144,
-149, 155, 159, 160, 160, 158, 155, 151, 147, 141, 134, 125, 116, 109, 104, 102, 102, 104, 108, 112,
-117, 122, 129, 136, 142, 148, 152, 154, 153, 151, 148, 144, 140, 136, 131, 125, 118, 111, 104,  98,
- 91,  85,  78,  72,  67,  65,  68,  75,  88, 105, 122, 139, 155, 168, 180, 190, 197, 198, 193, 182,
-167, 150, 133, 117, 104,  94,  85,  79,  76,  77,  82,  89,  99, 109, 119, 127, 133, 137, 139, 140,
-142, 143, 143, 143, 142, 142, 143, 145, 149, 153, 157, 159, 158, 155, 151, 146, 141, 136, 129, 123,
-116, 109, 105, 104, 105, 108, 113, 118, 124, 129, 134, 139, 143, 147, 150, 150, 150, 147, 144, 140,
-136, 131, 127, 122, 118, 112, 106,  99,  91,  82,  74,  68,  65,  66,  71,  80,  94, 111, 129, 147,
-163, 177, 188, 196, 199, 197, 189, 175, 159, 142, 125, 111,  98,  89,  82,  79,  80,  84,  90,  98,
-107, 115, 122, 128, 131, 134, 135, 137, 138, 139, 141, 142, 144, 147, 150, 154, 158, 162, 162, 161,
-156, 151, 144, 137, 130, 123, 116, 111, 106, 103, 103, 105, 110, 116, 122, 128, 133, 138, 142, 145,
-147, 148, 148, 147, 144, 140, 135, 130, 125, 119, 113, 107, 101,  93,  84,  76,  69,  65,  67,  72,
- 84,  99, 117, 136, 153, 169, 181, 191, 196, 196, 192, 182, 167, 149, 131, 114, 100,  89,  83,  80,
- 80,  83,  89,  96, 106, 115, 124, 131, 135, 137, 138, 139, 140, 141, 142, 144, 145, 146, 148, 151,
-154, 157, 158, 157, 152, 144, 136, 128, 122, 117, 113, 109, 107, 106, 107, 112, 119, 127, 134, 139,
-143, 145, 146, 146, 145, 144, 141, 139, 135, 132, 128, 124, 121, 118, 114, 111, 106,  99,  90,  80,
- 71,  65,  64,  69,  80,  95, 114, 133, 151, 168, 182, 193, 200, 202, 197, 186, 170, 152, 132, 114,
- 99,  88,  81,  78,  78,  82,  89,  98, 108, 117, 125, 131, 134, 135, 135, 134, 134, 135, 137, 140,
-143, 146, 150, 154, 158, 162, 163, 161, 155, 147, 137, 127, 119, 113, 109, 106, 104, 105, 108, 114,
-122, 129, 136, 140, 143, 144, 143, 142, 141, 139, 137, 135, 132, 130, 128, 126, 124, 123, 120, 116,
-110, 100,  89,  78,  68,  64,  64,  70,  83, 100, 119, 140, 159, 175, 189, 198, 201, 199, 192, 178,
-161, 142, 123, 105,  91,  82,  77,  77,  81,  88,  96, 104, 113, 121, 127, 132, 134, 135, 134, 133,
-133, 136, 140, 145, 150, 154, 158, 162, 165, 166, 164, 158, 148, 136, 124, 114, 106, 101,  99,  99,
-101, 105, 112, 121, 131, 139, 145, 149, 150, 150, 148, 145, 141, 136, 132, 128, 126, 125, 124, 124,
-124, 123, 121, 118, 113, 105,  94,  83,  73,  66,  63,  66,  75,  89, 107, 127, 149, 168, 184, 196,
-203, 203, 198, 187, 172, 155, 137, 119, 104,  92,  83,  79,  79,  83,  90,  97, 105, 112, 119, 124,
-128, 129, 130, 129, 130, 132, 136, 141, 148, 154, 159, 163, 166, 168, 168, 164, 156, 145, 132, 119,
-108, 101,  97,  97, 100, 104, 110, 117, 126, 135, 142, 147, 150, 150, 148, 144, 140, 136, 132, 129,
-128, 127, 127, 127, 126, 126, 125, 122, 117, 109,  98,  84,  72,  62,  58,  62,  72,  88, 108, 131,
-152, 171, 187, 197, 202, 202, 195, 182, 166, 148, 130, 113,  99,  89,  83,  82,  85,  91,  97, 104,
-109, 114, 118, 121, 122, 123, 123, 124, 126, 130, 136, 144, 152, 160, 166, 171, 173, 172, 168, 162,
-152, 139, 126, 114, 104,  97,  95,  96, 100, 106, 113, 121, 129, 137, 144, 148, 149, 148, 145, 141,
-137, 133, 130, 128, 128, 128, 130, 132, 133, 133, 133, 131, 127, 121, 112,  99,  85,  71,  60,  55,
- 56,  63,  76,  95, 118, 143, 166, 184, 198, 204, 205, 201, 191, 176, 158, 139, 120, 104,  93,  87,
- 85,  87,  91,  98, 104, 110, 114, 116, 117, 117, 117, 117, 118, 119, 122, 127, 135, 146, 157, 167,
-173, 177, 176, 172, 166, 157, 146, 133, 120, 108,  99,  94,  94,  97, 103, 110, 118, 127, 134, 141,
-145, 148, 148, 146, 143, 139, 134, 131, 128, 128, 129, 131, 133, 135, 136, 136, 135, 134, 131, 126,
-118, 109,  98,  85,  73,  63,  57,  57,  63,  75,  93, 115, 140, 163, 182, 194, 201, 202, 198, 189,
-177, 161, 144, 125, 109,  96,  88,  86,  89,  94,  99, 104, 107, 109, 110, 111, 112, 114, 115, 116,
-119, 123, 129, 138, 148, 158, 167, 174, 176, 175, 171, 165, 156, 146, 135, 124, 114, 105,  99,  98,
- 99, 104, 110, 117, 123, 129, 134, 138, 141, 142, 143, 142, 140, 137, 135, 134, 134, 134, 136, 137,
-137, 136, 135, 133, 131, 129, 126, 122, 117, 112, 107, 101,  95,  88,  80,  73,  67,  66,  70,  81,
- 98, 119, 143, 165, 182, 193, 197, 197, 193, 186, 175, 160, 143, 125, 108,  95,  87,  85,  88,  94,
-100, 105, 109, 111, 112, 112, 113, 114, 115, 118, 121, 125, 131, 140, 150, 160, 170, 175, 177, 174,
-168, 160, 150, 140, 130, 120, 112, 106, 103, 102, 104, 109, 116, 122, 127, 131, 133, 134, 134, 135,
-135, 135, 135, 134, 134, 135, 136, 138, 140, 141, 142, 140, 138, 133, 129, 125, 120, 117, 115, 114,
-113, 112, 109, 104,  97,  89,  80,  73,  69,  69,  75,  87, 104, 126, 150, 171, 186, 195, 199, 198,
-192, 182, 169, 153, 135, 118, 103,  93,  88,  87,  90,  95, 100, 105, 107, 107, 107, 107, 109, 112,
-116, 121, 127, 134, 143, 153, 164, 173, 179, 181, 178, 171, 161, 150, 138, 128, 119, 112, 107, 103,
-101, 103, 108, 115, 122, 128, 131, 132, 132, 131, 131, 132, 133, 134, 135, 136, 137, 138, 139, 141,
-143, 144, 142, 139, 134, 128, 123, 119, 117, 116, 116, 116, 114, 112, 110, 106, 102,  96,  88,  80,
- 73,  69,  69,  78,  94, 117, 143, 168, 186, 197, 200, 197, 190, 181, 170, 156, 139, 121, 105,  93,
- 87,  88,  93,  99, 106, 110, 111, 110, 108, 107, 108, 109, 112, 117, 123, 130, 139, 149, 160, 170,
-178, 180, 178, 171, 161, 150, 139, 129, 122, 116, 112, 109, 108, 109, 112, 117, 122, 126, 129, 129,
-128, 127, 127, 127, 128, 130, 133, 136, 138, 140, 142, 144, 145, 145, 144, 140, 135, 129, 123, 117,
-114, 112, 112, 113, 115, 118, 119, 118, 114, 107,  97,  86,  76,  68,  66,  69,  79,  97, 119, 145,
-168, 186, 197, 200, 197, 189, 179, 165, 150, 134, 119, 106,  97,  93,  94,  97, 102, 107, 110, 111,
-109, 106, 103, 101, 103, 107, 114, 122, 133, 145, 157, 169, 178, 184, 184, 179, 170, 159, 146, 134,
-123, 116, 111, 109, 109, 109, 112, 115, 119, 123, 126, 127, 126, 125, 124, 124, 125, 128, 132, 136,
-139, 142, 145, 147, 148, 148, 147, 143, 138, 131, 124, 118, 113, 112, 112, 115, 117, 119, 120, 120,
-119, 116, 111, 104,  95,  85,  75,  68,  66,  70,  82, 101, 126, 153, 175, 191, 198, 197, 191, 182,
-172, 161, 147, 132, 116, 103,  96,  94,  96, 101, 106, 111, 112, 111, 109, 107, 105, 105, 106, 110,
-117, 125, 134, 145, 155, 166, 176, 181, 181, 177, 168, 156, 144, 133, 124, 117, 112, 110, 108, 109,
-110, 113, 118, 122, 126, 128, 127, 126, 124, 123, 125, 129, 133, 138, 141, 144, 145, 145, 146, 146,
-144, 142, 137, 131, 123, 117, 112, 111, 112, 115, 118, 121, 123, 123, 121, 117, 111, 103,  94,  85,
- 75,  69,  66,  69,  80, 100, 126, 154, 178, 193, 199, 198, 192, 183, 172, 160, 146, 131, 116, 104,
- 96,  94,  97, 102, 108, 112, 113, 110, 106, 101,  98,  98, 102, 108, 117, 127, 138, 149, 161, 172,
-180, 185, 184, 177, 167, 154, 141, 130, 121, 115, 112, 111, 111, 111, 113, 115, 119, 122, 124, 124,
-122, 121, 120, 122, 125, 129, 134, 139, 143, 145, 148, 149, 149, 147, 144, 139, 134, 128, 122, 117,
-114, 112, 111, 112, 114, 116, 118, 120, 120, 118, 113, 105,  96,  88,  80,  75,  73,  77,  88, 105,
-127, 152, 174, 190, 196, 195, 187, 176, 164, 151, 137, 125, 114, 107, 102, 101, 104, 109, 114, 118,
-119, 115, 109, 103,  97,  95,  98, 105, 115, 127, 140, 152, 164, 174, 180, 182, 179, 171, 160, 148,
-136, 126, 119, 116, 116, 117, 118, 119, 119, 119, 119, 120, 120, 118, 117, 115, 116, 120, 125, 132,
-139, 144, 148, 150, 150, 149, 147, 144, 140, 135, 129, 123, 118, 115, 113, 114, 116, 119, 121, 122,
-122, 121, 120, 118, 113, 106,  97,  87,  78,  71,  69,  73,  83, 100, 123, 147, 170, 187, 196, 196,
-191, 181, 170, 158, 145, 131, 118, 109, 104, 102, 104, 107, 110, 111, 111, 109, 106, 102,  99,  97,
- 99, 105, 113, 124, 137, 149, 162, 172, 180, 184, 182, 175, 165, 153, 141, 131, 124, 118, 116, 114,
-114, 114, 115, 116, 116, 118, 119, 119, 119, 119, 119, 121, 124, 129, 135, 141, 146, 149, 150, 148,
-146, 143, 139, 136, 132, 127, 122, 118, 115, 114, 114, 116, 118, 120, 121, 121, 119, 116, 112, 107,
-100,  93,  86,  81,  78,  78,  82,  93, 111, 134, 157, 177, 190, 194, 191, 182, 171, 159, 148, 136,
-124, 114, 107, 105, 106, 108, 111, 114, 114, 112, 108, 104, 100,  97,  97, 102, 110, 121, 133, 145,
-156, 166, 175, 181, 181, 177, 168, 156, 144, 133, 125, 119, 116, 115, 115, 115, 116, 116, 117, 117,
-118, 119, 120, 120, 120, 122, 125, 129, 134, 139, 143, 146, 148, 147, 146, 143, 139, 135, 132, 129,
-126, 123, 121, 118, 117, 116, 117, 118, 119, 120, 119, 117, 113, 109, 104,  99,  93,  87,  81,  79,
- 80,  88, 102, 123, 146, 168, 184, 192, 192, 186, 175, 163, 150, 138, 128, 120, 114, 110, 109, 109,
-111, 113, 114, 113, 109, 103,  97,  93,  93,  97, 106, 118, 131, 145, 157, 168, 174, 177, 177, 172,
-165, 156, 146, 137, 130, 125, 122, 122, 123, 123, 121, 118, 115, 113, 111, 110, 111, 113, 115, 119,
-124, 129, 135, 141, 146, 149, 150, 150, 147, 143, 139, 134, 130, 128, 126, 124, 123, 122, 120, 118,
-117, 116, 115, 115, 115, 115, 114, 112, 108, 102,  96,  91,  88,  86,  86,  90,  99, 113, 132, 154,
-175, 188, 192, 187, 176, 163, 150, 139, 130, 123, 118, 115, 112, 112, 113, 115, 116, 116, 113, 108,
-101,  96,  93,  95, 101, 112, 126, 139, 151, 161, 169, 173, 174, 171, 165, 156, 147, 139, 132, 127,
-126, 126, 126, 126, 125, 121, 116, 112, 110, 109, 110, 112, 114, 117, 122, 129, 136, 141, 146, 148,
-148, 147, 144, 140, 136, 133, 130, 128, 128, 127, 127, 126, 124, 122, 120, 118, 117, 116, 115, 115,
-115, 115, 113, 108, 101,  93,  86,  81,  79,  82,  91, 106, 126, 149, 169, 183, 189, 186, 179, 168,
-158, 148, 139, 130, 123, 118, 116, 115, 115, 115, 114, 112, 108, 103,  98,  94,  93,  95, 101, 109,
-121, 133, 145, 155, 164, 170, 174, 173, 168, 161, 152, 144, 138, 133, 131, 130, 129, 127, 123, 119,
-114, 111, 109, 110, 111, 113, 115, 117, 120, 124, 129, 135, 140, 144, 146, 146, 144, 141, 137, 134,
-133, 133, 133, 133, 131, 129, 126, 122, 120, 117, 116, 114, 112, 111, 111, 111, 111, 110, 108, 103,
- 98,  93,  89,  88,  90,  98, 112, 131, 153, 171, 183, 186, 181, 171, 159, 149, 141, 135, 129, 124,
-119, 117, 116, 116, 116, 115, 112, 108, 103,  98,  95,  95,  98, 105, 115, 127, 138, 148, 155, 161,
-165, 167, 166, 162, 157, 149, 143, 137, 133, 131, 130, 130, 129, 126, 121, 116, 111, 107, 107, 109,
-113, 118, 121, 125, 128, 132, 136, 139, 141, 142, 142, 139, 137, 134, 133, 133, 134, 136, 137, 136,
-132, 128, 123, 119, 118, 117, 116, 116, 114, 112, 108, 105, 102,  99,  95,  91,  87,  85,  85,  92,
-105, 123, 145, 166, 181, 188, 187, 180, 169, 159, 149, 140, 131, 125, 119, 115, 112, 111, 111, 112,
-110, 108, 104,  99,  95,  94,  96, 102, 111, 123, 134, 145, 154, 161, 166, 169, 169, 167, 162, 155,
-148, 141, 135, 131, 129, 127, 126, 123, 119, 115, 112, 110, 110, 112, 114, 117, 121, 124, 127, 130,
-134, 137, 139, 141, 142, 141, 140, 139, 137, 137, 136, 136, 136, 134, 131, 127, 121, 117, 113, 112,
-112, 113, 115, 115, 112, 107, 100,  93,  87,  82,  81,  83,  89, 100, 116, 136, 156, 175, 187, 191,
-188, 179, 168, 155, 143, 133, 124, 117, 113, 110, 109, 109, 110, 111, 110, 109, 106, 102,  98,  96,
- 98, 104, 113, 123, 135, 146, 156, 165, 171, 174, 173, 169, 162, 154, 145, 137, 131, 126, 123, 121,
-119, 118, 116, 115, 115, 116, 117, 119, 120, 120, 121, 123, 125, 129, 133, 137, 140, 142, 143, 143,
-143, 142, 141, 140, 137, 134, 130, 125, 122, 119, 117, 117, 117, 118, 118, 118, 116, 114, 111, 106,
- 98,  90,  82,  76,  73,  76,  85, 101, 123, 147, 169, 185, 193, 193, 186, 177, 167, 156, 145, 133,
-121, 111, 105, 103, 103, 106, 109, 111, 111, 108, 105, 103, 101, 101, 104, 110, 118, 126, 136, 145,
-155, 164, 172, 176, 176, 172, 164, 154, 144, 135, 127, 122, 118, 116, 114, 113, 112, 113, 116, 119,
-122, 124, 125, 124, 123, 123, 125, 128, 133, 137, 141, 143, 144, 145, 145, 144, 143, 141, 137, 132,
-126, 120, 115, 113, 113, 115, 118, 120, 122, 122, 120, 116, 110, 103,  95,  86,  77,  72,  69,  72,
- 82, 101, 126, 153, 176, 192, 198, 196, 190, 181, 170, 159, 146, 131, 117, 106,  98,  96,  98, 103,
-108, 112, 112, 110, 106, 101,  98,  98, 102, 109, 117, 127, 138, 149, 161, 171, 180, 184, 183, 177,
-167, 154, 141, 130, 121, 115, 112, 111, 111, 111, 113, 115, 119, 122, 124, 124, 122, 121, 120, 122,
-125, 129, 134, 139, 143, 145, 148, 149, 149, 147, 144, 139, 134, 128, 122, 117, 114, 112, 111, 112,
-114, 116, 118, 120, 120, 118, 113, 105,  96,  88,  80,  75,  73,  77,  88, 105, 127, 152, 174, 190,
-196, 195, 187, 176, 164, 151, 137, 125, 114, 107, 102, 101, 104, 109, 114, 118, 119, 115, 109, 103,
- 97,  95,  98, 105, 115, 127, 140, 152, 164, 174, 180, 182, 179, 171, 160, 148, 136, 126, 119, 116,
-116, 117, 118, 119, 119, 119, 119, 120, 120, 118, 117, 115, 116, 120, 125, 132, 139, 144, 148, 150,
-150, 149, 147, 144, 140, 135, 129, 123, 118, 115, 113, 114, 116, 119, 121, 122, 122, 121, 120, 118,
-113, 106,  97,  87,  78,  71,  69,  73,  83, 100, 123, 147, 170, 187, 196, 196, 191, 182, 170, 158,
-145, 131, 118, 109, 104, 102, 104, 107, 110, 111, 111, 109, 106, 102,  99,  97,  99, 105, 113, 124,
-137, 149, 162, 172, 180, 184, 182, 175, 165, 153, 141, 131, 124, 118, 115, 114, 114, 114, 115, 116,
-116, 118, 119, 119, 119, 119, 119, 121, 124, 129, 135, 141, 146, 149, 150, 148, 146, 143, 139, 136,
-132, 127, 122, 118, 115, 114, 114, 116, 118, 120, 121, 121, 119, 116, 112, 107, 100,  93,  86,  81,
- 78,  78,  82,  93, 111, 134, 157, 177, 190, 194, 191, 182, 171, 159, 148, 136, 124, 114, 107, 105,
-106, 108, 111, 114, 114, 112, 108, 104, 100,  97,  97, 102, 110, 121, 133, 145, 156, 166, 175, 180,
-181, 177, 168, 156, 144, 133, 125, 119, 116, 115, 115, 115, 116, 116, 117, 117, 118, 119, 120, 120,
-120, 122, 125, 129, 134, 139, 143, 146, 148, 147, 145, 143, 139, 135, 132, 129, 126, 123, 121, 118,
-117, 116, 117, 118, 119, 120, 119, 117, 113, 109, 104,  99,  93,  87,  81,  79,  80,  88, 102, 123,
-146, 168, 184, 192, 192, 186, 175, 163, 150, 138, 128, 120, 114, 110, 109, 109, 111, 113, 114, 113,
-109, 103,  97,  93,  93,  97, 106, 118, 131, 145, 157, 168, 174, 177, 177, 172, 165, 156, 146, 137,
-130, 125, 122, 122, 123, 123, 121, 118, 115, 113, 111, 110, 111, 113, 115, 119, 124, 129, 135, 141,
-146, 149, 150, 150, 147, 143, 139, 134, 130, 128, 126, 124, 123, 122, 120, 118, 117, 116, 115, 115,
-115, 115, 114, 112, 108, 102,  96,  91,  88,  86,  86,  90,  99, 113, 132, 154, 175, 188, 192, 187,
-176, 163, 150, 139, 130, 123, 118, 115, 112, 112, 113, 115, 116, 116, 113, 108, 101,  96,  93,  95,
-101, 112, 126, 139, 151, 161, 169, 173, 174, 171, 165, 156, 147, 139, 132, 127, 126, 126, 126, 126,
-125, 121, 116, 112, 110, 109, 110, 112, 114, 117, 122, 129, 136, 141, 146, 148, 148, 147, 144, 140,
-136, 133, 130, 128, 128, 127, 127, 126, 124, 122, 120, 118, 117, 116, 115, 115, 115, 115, 113, 108,
-101,  93,  86,  81,  79,  82,  91, 106, 126, 149, 169, 183, 189, 186, 179, 168, 158, 148, 139, 130,
-123, 118, 116, 115, 115, 115, 114, 112, 108, 103,  98,  94,  93,  95, 101, 109, 121, 133, 145, 155,
-164, 170, 174, 173, 168, 161, 152, 144, 138, 133, 131, 130, 129, 127, 123, 119, 114, 111, 109, 110,
-111, 113, 115, 117, 120, 124, 129, 135, 140, 144, 146, 146, 144, 141, 137, 134, 133, 133, 133, 133,
-132, 129, 126, 122, 120, 117, 116, 114, 112, 111, 111, 111, 111, 110, 108, 103,  98,  92,  89,  88,
- 90,  98, 112, 131, 153, 171, 183, 186, 181, 171, 159, 149, 141, 135, 129, 124, 119, 117, 116, 116,
-116, 115, 112, 108, 103,  98,  95,  95,  98, 105, 115, 127, 138, 148, 155, 161, 165, 167, 166, 162,
-156, 149, 142, 136, 132, 130, 130, 130, 129, 127, 122, 116, 111, 108, 107, 109, 113, 117, 121, 124,
-128, 132, 136, 140, 142, 143, 142, 140, 137, 134, 133, 132, 134, 135, 136, 135, 132, 127, 123, 119,
-118, 117, 117, 116, 114, 111, 108, 105, 102,  99,  96,  93,  89,  87,  88,  94, 107, 125, 146, 166,
-180, 186, 184, 176, 165, 154, 144, 136, 130, 126, 123, 120, 119, 117, 116, 115, 112, 107, 102,  96,
- 92,  90,  92, 100, 111, 124, 138, 149, 159, 165, 168, 168, 166, 162, 156, 149, 143, 138, 134, 132,
-132, 132, 131, 129, 124, 118, 111, 107, 105, 105, 108, 112, 117, 122, 127, 132, 136, 140, 143, 144,
-144, 142, 139, 136, 134, 132, 133, 134, 136, 137, 135, 132, 126, 119, 114, 111, 110, 111, 112, 112,
-111, 107, 102,  97,  93,  91,  91,  92,  95, 102, 114, 129, 148, 166, 180, 185, 182, 172, 160, 148,
-139, 132, 128, 126, 125, 124, 122, 119, 116, 113, 110, 107, 102,  98,  94,  92,  95, 101, 112, 124,
-137, 147, 156, 161, 164, 165, 162, 159, 154, 148, 144, 140, 138, 137, 136, 134, 131, 127, 121, 115,
-110, 107, 107, 109, 112, 115, 118, 122, 126, 131, 135, 139, 141, 141, 140, 138, 136, 135, 134, 136,
-137, 139, 139, 137, 133, 129, 124, 120, 117, 115, 114, 113, 112, 111, 110, 107, 104,  99,  93,  88,
- 85,  84,  89, 100, 117, 137, 158, 174, 183, 184, 177, 167, 156, 147, 141, 136, 132, 128, 125, 122,
-120, 118, 115, 112, 107, 102,  96,  92,  91,  93,  99, 108, 119, 130, 140, 148, 154, 158, 161, 163,
-161, 158, 153, 147, 142, 139, 138, 138, 137, 135, 131, 126, 119, 113, 109, 107, 108, 111, 115, 118,
-121, 123, 125, 127, 131, 135, 139, 141, 142, 141, 139, 137, 136, 137, 138, 139, 139, 136, 131, 125,
-119, 115, 114, 114, 116, 116, 114, 111, 106, 101,  96,  93,  92,  91,  92,  94, 100, 111, 128, 147,
-165, 176, 180, 176, 166, 155, 147, 141, 138, 136, 134, 132, 128, 125, 121, 118, 115, 112, 107, 101,
- 95,  91,  90,  93, 101, 112, 124, 134, 143, 150, 154, 157, 158, 157, 156, 153, 150, 146, 143, 141,
-140, 140, 139, 136, 132, 126, 118, 112, 108, 107, 108, 111, 115, 118, 123, 127, 130, 132, 134, 134,
-134, 135, 135, 135, 136, 137, 138, 139, 139, 140, 139, 137, 133, 128, 123, 118, 115, 113, 112, 112,
-111, 109, 105,  99,  94,  89,  86,  86,  90,  98, 111, 128, 146, 162, 174, 178, 176, 168, 159, 149,
-143, 138, 136, 133, 131, 129, 127, 123, 120, 115, 110, 105,  99,  94,  91,  92,  96, 103, 113, 123,
-132, 139, 145, 150, 154, 157, 158, 157, 154, 151, 148, 146, 145, 145, 144, 142, 137, 130, 122, 114,
-108, 106, 107, 110, 113, 116, 118, 119, 121, 124, 127, 131, 135, 137, 137, 137, 137, 138, 139, 142,
-144, 146, 144, 140, 133, 127, 121, 118, 117, 118, 118, 117, 114, 109, 104,  99,  94,  91,  90,  89,
- 89,  93, 100, 112, 128, 147, 163, 175, 178, 173, 165, 155, 146, 140, 137, 137, 137, 136, 134, 131,
-126, 122, 117, 111, 106,  99,  94,  90,  89,  93, 101, 112, 123, 133, 140, 145, 148, 150, 151, 151,
-150, 149, 147, 147, 147, 147, 148, 148, 147, 143, 137, 129, 120, 112, 106, 104, 105, 109, 113, 118,
-122, 125, 126, 127, 128, 129, 130, 132, 134, 137, 139, 141, 142, 143, 144, 143, 141, 138, 133, 127,
-122, 118, 115, 114, 115, 115, 113, 108, 102,  94,  88,  84,  83,  86,  92, 102, 116, 133, 151, 167,
-176, 177, 172, 162, 153, 145, 141, 139, 138, 139, 138, 137, 133, 127, 120, 113, 105,  98,  93,  89,
- 87,  89,  95, 104, 114, 124, 133, 139, 143, 147, 149, 150, 151, 151, 150, 151, 152, 154, 155, 155,
-152, 147, 138, 128, 118, 110, 105, 104, 107, 110, 114, 116, 117, 118, 119, 121, 123, 127, 130, 133,
-135, 137, 139, 141, 144, 147, 149, 149, 147, 141, 134, 128, 123, 121, 120, 120, 119, 117, 113, 108,
-104,  99,  96,  93,  91,  89,  89,  91,  97, 107, 121, 138, 155, 169, 175, 175, 169, 160, 152, 145,
-141, 139, 138, 137, 136, 134, 131, 126, 120, 114, 106,  98,  92,  88,  87,  90,  98, 107, 117, 127,
-134, 139, 143, 145, 146, 146, 146, 146, 147, 149, 151, 153, 155, 156, 155, 151, 143, 133, 122, 113,
-106, 102, 103, 108, 113, 119, 122, 123, 122, 122, 121, 123, 125, 128, 132, 135, 138, 140, 142, 143,
-144, 145, 145, 143, 139, 133, 127, 123, 121, 122, 124, 125, 123, 118, 112, 105,  99,  95,  92,  90,
- 88,  88,  89,  94, 105, 119, 136, 153, 165, 171, 172, 167, 159, 152, 146, 143, 142, 142, 142, 140,
-137, 132, 126, 120, 113, 107, 100,  94,  89,  88,  91,  97, 106, 115, 124, 131, 137, 140, 143, 145,
-146, 147, 148, 148, 149, 150, 152, 153, 153, 151, 147, 141, 133, 125, 117, 111, 108, 108, 110, 114,
-117, 120, 122, 123, 123, 122, 123, 124, 126, 130, 134, 138, 141, 142, 143, 143, 142, 141, 140, 138,
-134, 130, 125, 122, 121, 121, 123, 124, 122, 119, 113, 106, 100,  95,  92,  92,  93,  94,  97, 101,
-109, 121, 137, 152, 163, 168, 166, 158, 149, 142, 139, 140, 142, 144, 144, 142, 138, 132, 126, 121,
-115, 110, 105, 100,  96,  95,  97, 103, 110, 118, 125, 130, 133, 135, 137, 140, 142, 143, 144, 146,
-147, 148, 149, 149, 149, 148, 145, 140, 134, 128, 122, 118, 116, 116, 116, 117, 118, 120, 121, 123,
-123, 123, 122, 123, 124, 128, 132, 136, 138, 139, 139, 138, 137, 136, 136, 136, 135, 132, 130, 127,
-125, 125, 126, 127, 126, 124, 119, 112, 106, 101,  99,  99,  99,  99,  99,  98, 100, 105, 116, 130,
-144, 156, 162, 161, 157, 151, 146, 143, 142, 142, 141, 140, 138, 135, 132, 129, 125, 120, 115, 109,
-103,  98,  97,  99, 104, 111, 118, 125, 129, 132, 133, 135, 137, 140, 142, 144, 145, 145, 146, 146,
-147, 147, 145, 143, 139, 134, 128, 124, 121, 120, 120, 120, 121, 121, 121, 121, 121, 121, 121, 121,
-122, 124, 127, 130, 133, 135, 136, 137, 136, 136, 135, 134, 134, 134, 134, 133, 132, 131, 130, 129,
-128, 127, 125, 122, 119, 115, 111, 107, 104, 102,  99,  97,  97,  97,  99, 104, 112, 124, 138, 150,
-158, 160, 157, 150, 144, 140, 138, 139, 141, 142, 142, 142, 139, 135, 130, 125, 119, 112, 107, 102,
- 99, 100, 103, 109, 116, 122, 126, 128, 129, 130, 131, 133, 136, 138, 140, 142, 144, 146, 147, 147,
-146, 144, 141, 136, 130, 126, 123, 123, 124, 127, 128, 127, 125, 122, 119, 118, 118, 120, 122, 124,
-125, 126, 128, 130, 132, 134, 135, 135, 134, 133, 132, 132, 132, 133, 134, 135, 134, 133, 131, 130,
-129, 128, 127, 125, 122, 117, 113, 108, 105, 103, 102, 102, 102, 101, 101, 101, 105, 113, 124, 137,
-149, 156, 157, 153, 147, 142, 139, 139, 141, 142, 143, 142, 140, 136, 133, 128, 124, 119, 114, 108,
-104, 101, 103, 107, 113, 120, 125, 127, 128, 127, 128, 129, 132, 134, 137, 140, 142, 143, 144, 144,
-144, 144, 142, 139, 135, 131, 127, 125, 125, 126, 128, 128, 128, 126, 124, 122, 121, 120, 120, 121,
-123, 124, 126, 127, 129, 131, 133, 134, 134, 134, 133, 133, 132, 132, 133, 134, 135, 135, 133, 131,
-129, 127, 126, 125, 125, 124, 122, 118, 114, 109, 105, 102, 101, 101, 101, 102, 103, 105, 110, 118,
-130, 141, 150, 152, 149, 143, 137, 134, 136, 140, 144, 147, 147, 145, 141, 137, 133, 128, 124, 120,
-116, 112, 109, 108, 110, 113, 117, 120, 121, 121, 119, 118, 119, 121, 125, 130, 134, 137, 140, 141,
-143, 143, 144, 143, 141, 139, 137, 135, 134, 135, 136, 136, 136, 134, 130, 125, 120, 117, 116, 117,
-119, 121, 122, 123, 124, 125, 127, 128, 128, 129, 130, 131, 132, 133, 135, 136, 137, 138, 138, 138,
-137, 135, 133, 130, 128, 126, 125, 124, 124, 124, 123, 120, 116, 111, 106, 102,  99,  98,  98,  98,
- 99, 101, 106, 113, 125, 138, 150, 158, 159, 155, 148, 143, 140, 140, 142, 144, 145, 144, 141, 137,
-133, 128, 123, 118, 113, 108, 103, 100, 100, 103, 109, 115, 121, 125, 127, 128, 129, 131, 134, 136,
-139, 141, 143, 144, 145, 146, 147, 146, 145, 142, 138, 134, 129, 125, 123, 122, 122, 122, 122, 121,
-122, 122, 122, 122, 122, 122, 122, 124, 126, 130, 133, 135, 136, 136, 136, 136, 135, 135, 135, 134,
-133, 131, 129, 128, 128, 128, 128, 128, 125, 120, 115, 110, 106, 104, 103, 103, 103, 102, 101, 102,
-106, 115, 127, 138, 147, 152, 151, 148, 145, 143, 142, 143, 143, 142, 141, 138, 135, 132, 130, 126,
-122, 118, 112, 106, 102, 101, 102, 107, 113, 119, 124, 128, 130, 132, 134, 137, 139, 141, 143, 144,
-145, 145, 146, 146, 146, 145, 142, 138, 133, 128, 123, 121, 119, 120, 120, 121, 121, 121, 121, 121,
-121, 121, 121, 122, 124, 127, 130, 133, 135, 136, 137, 136, 135, 135, 134, 134, 134, 134, 133, 132,
-131, 130, 129, 128, 127, 125, 122, 118, 114, 110, 107, 104, 101,  99,  97,  97,  97, 100, 105, 114,
-126, 139, 151, 158, 160, 156, 149, 143, 139, 138, 139, 141, 142, 142, 141, 139, 135, 130, 124, 118,
-112, 106, 101,  99, 100, 104, 110, 117, 122, 126, 129, 129, 130, 131, 134, 136, 138, 141, 143, 144,
-146, 147, 147, 146, 144, 140, 135, 130, 125, 123, 123, 125, 127, 128, 127, 125, 122, 119, 118, 118,
-120, 122, 124, 125, 127, 128, 130, 132, 134, 135, 135, 134, 133, 132, 132, 132, 133, 134, 135, 134,
-133, 131, 129, 128, 128, 127, 125, 121, 117, 112, 108, 105, 103, 102, 102, 101, 101, 101, 102, 106,
-114, 126, 139, 150, 156, 156, 152, 146, 141, 139, 139, 141, 143, 143, 141, 139, 136, 132, 128, 123,
-118, 113, 108, 103, 101, 103, 108, 114, 121, 125, 127, 128, 127, 128, 129, 132, 135, 138, 140, 142,
-143, 144, 144, 144, 143, 142, 138, 134, 130, 127, 125, 125, 127, 128, 128, 127, 126, 124, 122, 121,
-120, 120, 121, 123, 124, 126, 128, 129, 131, 133, 134, 134, 134, 133, 132, 132, 132, 133, 134, 135,
-135, 133, 131, 128, 127, 126, 125, 125, 124, 122, 117, 113, 108, 104, 102, 100, 100, 101, 101, 103,
-105, 111, 121, 134, 146, 154, 156, 153, 146, 139, 137, 138, 141, 143, 144, 144, 141, 138, 134, 130,
-126, 121, 116, 111, 107, 104, 104, 107, 112, 118, 122, 125, 125, 125, 125, 126, 128, 132, 135, 139,
-141, 142, 143, 143, 143, 143, 142, 139, 136, 133, 130, 129, 129, 130, 131, 131, 129, 126, 122, 119,
-117, 118, 121, 123, 125, 125, 126, 126, 127, 128, 130, 131, 132, 132, 132, 133, 133, 133, 134, 134,
-135, 136, 135, 134, 132, 130, 128, 127, 127, 127, 126, 126, 124, 122, 118, 114, 110, 106, 104, 103,
-102, 102, 103, 103, 104, 109, 117, 128, 139, 148, 152, 150, 145, 140, 138, 139, 141, 144, 146, 145,
-143, 141, 137, 133, 130, 126, 122, 117, 111, 107, 105, 106, 110, 115, 120, 123, 124, 123, 122, 122,
-123, 126, 129, 132, 136, 139, 141, 142, 143, 142, 142, 141, 139, 137, 134, 132, 131, 132, 133, 133,
-133, 131, 128, 125, 122, 121, 120, 120, 120, 120, 121, 123, 125, 127, 129, 130, 131, 132, 132, 132,
-132, 132, 133, 134, 136, 137, 138, 137, 135, 133, 132, 131, 129, 128, 126, 124, 122, 120, 119, 116,
-114, 111, 109, 106, 105, 103, 101, 101, 102, 104, 109, 116, 126, 137, 146, 151, 151, 147, 141, 138,
-138, 141, 145, 147, 147, 146, 143, 140, 136, 132, 127, 122, 116, 111, 107, 105, 106, 109, 114, 118,
-121, 122, 121, 120, 119, 121, 124, 128, 131, 134, 136, 138, 139, 140, 142, 143, 143, 141, 139, 135,
-132, 131, 131, 132, 135, 136, 136, 133, 129, 124, 120, 118, 117, 118, 120, 122, 123, 125, 127, 129,
-130, 130, 129, 128, 128, 129, 131, 133, 136, 138, 139, 139, 138, 136, 134, 132, 130, 129, 129, 128,
-127, 126, 125, 125, 124, 122, 120, 116, 112, 109, 106, 104, 103, 103, 103, 103, 104, 105, 111, 119,
-131, 141, 148, 149, 145, 140, 136, 136, 140, 144, 147, 149, 147, 144, 140, 136, 132, 130, 127, 124,
-119, 114, 110, 108, 108, 111, 116, 120, 121, 121, 120, 119, 119, 121, 124, 127, 131, 133, 135, 137,
-138, 138, 139, 140, 140, 140, 139, 138, 136, 136, 135, 135, 135, 134, 132, 129, 127, 125, 124, 123,
-122, 121, 121, 122, 122, 123, 125, 126, 127, 128, 129, 130, 130, 131, 131, 132, 134, 135, 136, 137,
-137, 136, 135, 133, 132, 130, 129, 127, 126, 125, 125, 124, 124, 123, 122, 119, 116, 112, 109, 106,
-104, 104, 105, 106, 107, 107, 108, 111, 118, 128, 139, 147, 150, 147, 141, 136, 135, 137, 141, 145,
-146, 145, 142, 139, 135, 132, 130, 128, 125, 122, 117, 113, 111, 111, 114, 118, 122, 124, 124, 122,
-119, 119, 120, 122, 126, 129, 131, 133, 134, 135, 136, 137, 138, 138, 138, 137, 136, 135, 134, 135,
-136, 137, 137, 134, 131, 128, 125, 124, 124, 124, 124, 123, 123, 123, 123, 124, 124, 125, 127, 128,
-128, 128, 128, 129, 131, 132, 134, 135, 135, 134, 134, 133, 133, 132, 132, 131, 130, 129, 127, 126,
-126, 126, 126, 126, 125, 124, 121, 118, 114, 111, 110, 109, 109, 109, 109, 108, 106, 106, 108, 112,
-120, 131, 140, 147, 147, 142, 136, 132, 133, 137, 143, 147, 147, 145, 142, 139, 136, 134, 131, 129,
-126, 122, 118, 115, 113, 114, 116, 120, 123, 124, 122, 120, 118, 117, 118, 122, 126, 129, 131, 132,
-132, 132, 133, 134, 135, 136, 136, 136, 135, 134, 134, 135, 137, 138, 138, 137, 134, 131, 127, 124,
-122, 123, 124, 127, 128, 127, 126, 124, 123, 124, 125, 126, 126, 127, 127, 128, 129, 130, 131, 132,
-133, 133, 133, 133, 132, 132, 132, 132, 131, 131, 130, 130, 129, 129, 128, 127, 126, 125, 123, 122,
-120, 118, 116, 113, 110, 107, 105, 104, 105, 107, 109, 112, 115, 120, 127, 134, 140, 142, 139, 134,
-131, 131, 136, 142, 147, 149, 149, 147, 143, 138, 134, 131, 129, 128, 126, 124, 121, 118, 117, 118,
-121, 123, 123, 122, 119, 116, 115, 116, 118, 122, 125, 127, 128, 129, 130, 131, 132, 132, 131, 131,
-132, 133, 134, 137, 139, 142, 142, 141, 138, 133, 129, 127, 126, 128, 131, 133, 132, 130, 127, 124,
-122, 122, 122, 122, 123, 123, 124, 125, 126, 127, 128, 129, 130, 130, 130, 130, 130, 130, 131, 133,
-134, 134, 133, 132, 132, 131, 130, 129, 129, 129, 128, 127, 126, 124, 120, 117, 115, 114, 113, 112,
-110, 109, 107, 106, 106, 108, 112, 119, 127, 135, 139, 139, 135, 130, 127, 129, 134, 141, 146, 149,
-148, 145, 142, 139, 136, 134, 132, 130, 128, 126, 125, 123, 123, 123, 124, 124, 124, 122, 120, 117,
-115, 115, 117, 120, 123, 125, 126, 126, 125, 125, 126, 127, 128, 130, 131, 132, 133, 134, 135, 137,
-139, 139, 140, 139, 137, 134, 132, 131, 130, 131, 132, 133, 132, 130, 127, 124, 122, 121, 121, 122,
-123, 124, 124, 124, 124, 123, 123, 123, 125, 127, 128, 129, 130, 131, 131, 132, 133, 133, 133, 133,
-133, 132, 132, 132, 132, 132, 132, 131, 129, 128, 125, 123, 121, 119, 117, 116, 115, 113, 112, 110,
-109, 109, 110, 111, 114, 118, 123, 129, 133, 136, 135, 132, 128, 127, 129, 134, 139, 144, 146, 145,
-142, 139, 136, 133, 132, 132, 132, 132, 131, 129, 128, 127, 126, 126, 126, 125, 123, 121, 119, 118,
-118, 119, 121, 122, 123, 123, 123, 122, 121, 122, 123, 124, 126, 128, 130, 132, 134, 135, 136, 137,
-137, 136, 135, 135, 134, 134, 135, 135, 136, 135, 134, 132, 129, 126, 124, 124, 125, 127, 128, 128,
-126, 124, 122, 121, 122, 123, 124, 125, 125, 126, 126, 126, 127, 127, 128, 129, 130, 130, 130, 131,
-131, 132, 132, 132, 132, 131, 130, 130, 129, 129, 129, 129, 128, 126, 123, 119, 116, 114, 114, 115,
-116, 117, 117, 116, 114, 114, 116, 120, 125, 129, 132, 132, 130, 128, 127, 128, 132, 136, 139, 141,
-140, 138, 136, 135, 133, 133, 133, 134, 133, 133, 132, 131, 130, 129, 128, 128, 127, 126, 124, 123,
-122, 121, 121, 122, 123, 123, 123, 122, 121, 120, 120, 121, 123, 125, 127, 128, 129, 129, 130, 130,
-131, 132, 133, 134, 135, 135, 135, 134, 134, 133, 133, 133, 133, 132, 131, 129, 128, 128, 128, 129,
-129, 129, 128, 126, 124, 123, 123, 123, 124, 125, 126, 126, 126, 125, 125, 126, 127, 128, 129, 129,
-129, 129, 129, 130, 130, 131, 132, 132, 132, 131, 129, 128, 127, 126, 125, 124, 124, 123, 121, 119,
-116, 115, 114, 115, 117, 119, 120, 121, 122, 123, 124, 125, 125, 125, 124, 124, 126, 129, 133, 136,
-138, 138, 136, 134, 133, 132, 132, 134, 135, 136, 137, 136, 135, 133, 131, 130, 129, 128, 128, 127,
-127, 126, 125, 124, 122, 122, 122, 122, 122, 122, 121, 120, 120, 120, 121, 123, 125, 126, 127, 128,
-128, 128, 129, 129, 130, 131, 132, 133, 134, 135, 135, 135, 134, 134, 133, 133, 133, 133, 132, 131,
-130, 130, 131, 131, 130, 128, 127, 125, 124, 125, 125, 126, 127, 127, 126, 125, 125, 125, 125, 126,
-127, 127, 128, 128, 128, 128, 128, 129, 129, 129, 130, 130, 130, 129, 128, 127, 127, 126, 126, 126,
-125, 123, 120, 117, 115, 114, 115, 116, 117, 118, 119, 119, 120, 122, 123, 125, 125, 124, 123, 124,
-126, 129, 133, 136, 138, 137, 136, 134, 133, 133, 133, 134, 136, 137, 138, 137, 135, 133, 132, 131,
-131, 131, 130, 129, 128, 126, 125, 124, 123, 124, 124, 123, 122, 121, 120, 119, 119, 120, 121, 123,
-124, 125, 126, 126, 127, 127, 127, 128, 129, 130, 132, 133, 133, 134, 134, 135, 135, 135, 135, 134,
-133, 133, 132, 132, 132, 133, 133, 132, 131, 129, 128, 127, 126, 126, 126, 126, 126, 126, 126, 125,
-125, 125, 125, 125, 125, 125, 126, 126, 126, 126, 126, 127, 127, 128, 128, 128, 127, 126, 125, 124,
-124, 123, 123, 122, 122, 121, 119, 117, 116, 115, 116, 118, 120, 123, 125, 127, 128, 127, 125, 122,
-121, 123, 126, 131, 135, 138, 138, 136, 134, 132, 131, 131, 132, 134, 136, 137, 137, 137, 136, 134,
-132, 131, 131, 130, 130, 129, 129, 128, 127, 127, 126, 125, 124, 123, 122, 121, 120, 121, 122, 122,
-123, 124, 124, 124, 124, 124, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 133, 133, 133, 133,
-133, 134, 134, 134, 134, 134, 134, 134, 133, 132, 130, 129, 128, 129, 129, 130, 130, 129, 127, 126,
-125, 125, 125, 126, 126, 126, 125, 125, 125, 125, 125, 125, 124, 125, 125, 125, 125, 125, 125, 124,
-124, 123, 121, 120, 119, 118, 119, 120, 121, 121, 120, 119, 119, 120, 122, 125, 128, 129, 128, 125,
-124, 124, 127, 131, 134, 136, 136, 134, 132, 130, 130, 130, 132, 134, 136, 137, 136, 134, 133, 132,
-132, 132, 132, 132, 132, 131, 130, 129, 128, 127, 128, 128, 127, 126, 124, 122, 121, 122, 123, 124,
-124, 124, 124, 124, 123, 124, 124, 125, 126, 127, 128, 129, 129, 130, 131, 131, 130, 130, 131, 132,
-133, 133, 133, 132, 131, 131, 132, 132, 132, 131, 130, 130, 129, 129, 129, 130, 129, 129, 128, 126,
-125, 125, 126, 127, 127, 127, 126, 125, 124, 124, 124, 124, 124, 125, 126, 126, 126, 125, 124, 122,
-122, 121, 122, 122, 123, 123, 123, 121, 119, 118, 117, 119, 122, 126, 129, 130, 129, 126, 122, 121,
-122, 126, 130, 134, 136, 135, 132, 130, 128, 128, 129, 130, 132, 134, 134, 134, 133, 132, 131, 131,
-131, 131, 132, 132, 131, 131, 131, 131, 131, 130, 129, 128, 126, 125, 125, 126, 127, 128, 128, 127,
-126, 125, 124, 124, 125, 126, 126, 127, 127, 128, 128, 128, 127, 126, 126, 127, 129, 130, 131, 131,
-130, 129, 128, 128, 129, 130, 131, 131, 130, 130, 130, 130, 130, 129, 128, 128, 127, 127, 128, 129,
-129, 129, 129, 128, 127, 126, 125, 125, 126, 127, 128, 129, 129, 128, 126, 125, 123, 123, 123, 123,
-124, 124, 123, 122, 120, 119, 118, 118, 119, 120, 121, 124, 127, 128, 127, 125, 122, 120, 121, 124,
-128, 132, 134, 133, 132, 129, 127, 126, 127, 130, 132, 134, 135, 135, 134, 133, 132, 132, 132, 132,
-133, 134, 134, 134, 133, 132, 131, 131, 130, 129, 128, 127, 127, 127, 127, 127, 127, 126, 125, 124,
-123, 123, 124, 125, 125, 125, 125, 125, 124, 125, 125, 126, 127, 127, 128, 128, 128, 128, 128, 128,
-129, 130, 132, 132, 132, 131, 130, 129, 130, 131, 132, 132, 133, 132, 131, 130, 129, 129, 129, 129,
-129, 129, 129, 129, 129, 128, 127, 126, 125, 125, 125, 125, 125, 124, 124, 123, 123, 122, 121, 120,
-119, 118, 118, 119, 119, 119, 119, 119, 119, 120, 122, 124, 126, 126, 125, 123, 123, 123, 126, 129,
-132, 133, 133, 132, 130, 129, 128, 129, 131, 133, 135, 136, 136, 135, 134, 133, 133, 133, 133, 134,
-134, 134, 134, 133, 133, 132, 132, 131, 130, 128, 127, 126, 126, 127, 127, 127, 126, 125, 124, 123,
-123, 123, 123, 124, 124, 125, 125, 125, 125, 125, 125, 124, 124, 124, 126, 127, 129, 130, 130, 130,
-129, 129, 129, 129, 129, 130, 132, 132, 133, 133, 132, 131, 130, 130, 129, 129, 130, 131, 132, 132,
-131, 130, 129, 127, 127, 126, 127, 127, 128, 128, 127, 126, 124, 124, 123, 123, 123, 122, 121, 120,
-120, 120, 120, 120, 119, 119, 118, 119, 121, 123, 125, 126, 126, 125, 123, 122, 123, 125, 128, 130,
-132, 131, 130, 129, 128, 128, 129, 130, 132, 134, 135, 135, 134, 133, 133, 132, 133, 133, 134, 134,
-134, 134, 133, 133, 133, 132, 131, 130, 128, 127, 127, 127, 128, 128, 128, 127, 126, 124, 124, 123,
-124, 125, 125, 126, 125, 125, 124, 124, 124, 124, 124, 125, 126, 127, 128, 128, 128, 127, 127, 127,
-128, 129, 130, 130, 130, 130, 130, 130, 130, 131, 131, 131, 131, 130, 129, 130, 130, 131, 131, 131,
-130, 129, 128, 128, 128, 128, 128, 128, 128, 127, 127, 126, 126, 125, 124, 123, 122, 122, 122, 122,
-122, 121, 120, 119, 118, 118, 120, 122, 124, 126, 126, 125, 123, 121, 120, 121, 124, 128, 131, 132,
-131, 130, 128, 126, 126, 127, 129, 132, 134, 135, 135, 134, 132, 131, 131, 132, 133, 134, 134, 134,
-134, 134, 133, 132, 131, 130, 130, 129, 128, 128, 128, 129, 129, 128, 127, 126, 124, 123, 124, 124,
-125, 126, 127, 126, 125, 124, 123, 123, 124, 124, 125, 126, 127, 128, 128, 127, 126, 125, 126, 128,
-130, 132, 132, 131, 129, 127, 127, 129, 131, 132, 132, 131, 130, 129, 128, 129, 130, 131, 131, 131,
-130, 129, 129, 129, 129, 129, 128, 128, 128, 128, 127, 127, 126, 125, 124, 124, 123, 122, 121, 121,
-121, 121, 121, 120, 120, 119, 118, 119, 121, 124, 125, 125, 123, 121, 120, 120, 123, 127, 130, 132,
-131, 129, 126, 125, 126, 128, 131, 133, 135, 135, 134, 133, 132, 132, 132, 133, 134, 135, 135, 135,
-134, 133, 132, 132, 132, 132, 131, 130, 128, 127, 127, 128, 128, 128, 127, 126, 125, 124, 124, 124,
-124, 125, 125, 125, 124, 124, 124, 124, 124, 124, 124, 125, 126, 126, 126, 126, 126, 127, 127, 128,
-129, 129, 129, 129, 129, 129, 130, 130, 130, 131, 131, 131, 131, 131, 131, 130, 130, 131, 132, 132,
-133, 132, 131, 130, 129, 128, 128, 129, 130, 130, 129, 128, 127, 126, 125, 124, 123, 122, 122, 123,
-123, 122, 121, 119, 117, 117, 118, 120, 122, 123, 122, 120, 118, 117, 118, 121, 124, 128, 130, 130,
-129, 127, 126, 126, 127, 130, 133, 135, 136, 136, 135, 134, 133, 133, 133, 133, 134, 134, 134, 133,
-132, 132, 131, 131, 130, 130, 129, 128, 127, 126, 126, 126, 127, 127, 127, 126, 125, 124, 124, 125,
-125, 126, 127, 127, 126, 125, 125, 125, 126, 127, 128, 129, 129, 129, 128, 127, 126, 126, 127, 128,
-130, 131, 130, 129, 127, 126, 125, 126, 127, 129, 130, 130, 130, 128, 128, 128, 129, 130, 131, 131,
-131, 130, 131, 131, 132, 132, 132, 131, 131, 130, 130, 130, 130, 129, 129, 128, 127, 126, 124, 123,
-122, 121, 120, 119, 118, 118, 117, 117, 117, 116, 116, 116, 116, 117, 119, 122, 126, 129, 131, 131,
-129, 126, 125, 127, 129, 133, 136, 138, 139, 138, 135, 133, 132, 132, 132, 133, 134, 134, 133, 132,
-131, 130, 129, 129, 128, 128, 127, 126, 125, 125, 124, 125, 125, 125, 125, 125, 124, 124, 124, 124,
-125, 125, 126, 127, 128, 129, 130, 131, 131, 131, 131, 130, 130, 129, 130, 130, 131, 131, 131, 131,
-130, 128, 127, 125, 125, 126, 127, 128, 128, 128, 127, 125, 125, 125, 125, 126, 127, 128, 128, 129,
-129, 129, 129, 129, 130, 130, 131, 131, 131, 132, 132, 131, 131, 131, 130, 129, 129, 128, 128, 128,
-127, 126, 125, 122, 119, 117, 116, 116, 117, 118, 118, 118, 117, 115, 115, 117, 120, 124, 128, 130,
-130, 129, 127, 126, 127, 130, 134, 137, 138, 138, 137, 135, 134, 133, 133, 133, 133, 134, 133, 133,
-132, 131, 130, 129, 129, 128, 127, 126, 125, 124, 123, 123, 124, 124, 124, 124, 123, 122, 121, 121,
-122, 123, 125, 127, 128, 128, 128, 129, 129, 130, 131, 132, 133, 134, 134, 133, 133, 132, 132, 132,
-132, 132, 132, 131, 129, 128, 128, 128, 129, 129, 129, 128, 126, 125, 124, 123, 123, 124, 125, 126,
-126, 126, 126, 126, 126, 127, 128, 129, 129, 129, 129, 129, 130, 131, 131, 132, 132, 132, 131, 129,
-128, 127, 126, 125, 124, 124, 123, 121, 119, 116, 115, 114, 115, 117, 119, 120, 121, 122, 123, 124,
-125, 125, 125, 124, 124, 126, 129, 133, 136, 138, 138, 136, 134, 133, 132, 132, 134, 135, 136, 137,
-136, 135, 133, 131, 130, 129, 128, 128, 127, 127, 126, 125, 124, 122, 122, 122, 122, 122, 122, 121,
-120, 120, 120, 121, 123, 125, 126, 127, 128, 128, 128, 129, 129, 130, 131, 132, 133, 134, 135, 135,
-135, 134, 134, 133, 133, 133, 133, 132, 131, 130, 130, 131, 131, 130, 128, 127, 125, 124, 125, 125,
-126, 127, 127, 126, 125, 125, 125, 125, 126, 127, 127, 128, 128, 128, 128, 128, 129, 129, 129, 130,
-130, 130, 129, 128, 127, 127, 126, 126, 126, 125, 123, 120, 117, 115, 114, 115, 116, 117, 118, 119,
-119, 120, 122, 124, 125, 125, 124, 123, 124, 126, 129, 133, 137, 138, 137, 136, 134, 133, 133, 133,
-134, 136, 137, 138, 137, 135, 133, 132, 131, 131, 131, 130, 129, 128, 126, 125, 124, 123, 124, 124,
-123, 122, 121, 120, 119, 119, 120, 121, 123, 124, 125, 126, 126, 127, 127, 127, 128, 129, 130, 132,
-133, 133, 134, 134, 135, 135, 135, 134, 134, 133, 133, 132, 132, 132, 133, 133, 132, 131, 129, 128,
-127, 126, 126, 126, 126, 126, 126, 126, 125, 125, 125, 125, 125, 125, 125, 126, 126, 126, 126, 126,
-127, 127, 128, 128, 128, 127, 126, 125, 125, 124, 123, 123, 122, 122, 121, 119, 117, 116, 115, 116,
-118, 120, 122, 125, 127, 128, 127, 125, 122, 121, 123, 126, 131, 135, 138, 138, 136, 134, 132, 131,
-131, 132, 134, 136, 137, 137, 137, 136, 134, 132, 131, 131, 130, 130, 129, 129, 128, 127, 127, 126,
-125, 124, 123, 122, 121, 120, 121, 121, 122, 123, 124, 124, 124, 124, 124, 124, 125, 126, 127, 128,
-129, 130, 131, 132, 133, 133, 133, 133, 133, 133, 134, 134, 134, 134, 135, 134, 134, 133, 132, 130,
-129, 128, 129, 129, 130, 130, 129, 127, 126, 125, 125, 125, 126, 126, 126, 125, 125, 125, 125, 125,
-125, 124, 125, 125, 125, 125, 125, 125, 124, 124, 122, 121, 120, 119, 118, 119, 120, 121, 121, 120,
-119, 119, 120, 122, 125, 128, 129, 128, 125, 124, 124, 127, 131, 134, 136, 136, 134, 132, 130, 130,
-130, 132, 134, 136, 137, 136, 134, 133, 132, 132, 132, 132, 132, 132, 131, 130, 129, 128, 127, 128,
-128, 127, 126, 124, 122, 121, 122, 123, 124, 124, 124, 124, 123, 123, 124, 124, 125, 126, 127, 128,
-129, 129, 130, 131, 131, 130, 130, 131, 132, 133, 133, 133, 132, 131, 131, 132, 132, 132, 131, 130,
-130, 129, 129, 129, 130, 129, 129, 128, 126, 125, 125, 126, 127, 127, 127, 126, 125, 124, 124, 124,
-124, 124, 125, 126, 126, 126, 125, 124, 122, 122, 121, 122, 122, 123, 123, 123, 121, 119, 118, 117,
-119, 122, 126, 129, 130, 129, 126, 122, 121, 122, 126, 130, 134, 136, 135, 132, 130, 128, 128, 129,
-130, 132, 134, 134, 134, 133, 132, 131, 131, 131, 131, 132, 132, 131, 131, 131, 131, 131, 130, 129,
-128, 126, 125, 125, 126, 127, 128, 128, 127, 126, 125, 124, 124, 125, 126, 126, 127, 127, 128, 128,
-128, 127, 126, 126, 127, 129, 130, 131, 131, 130, 129, 128, 128, 129, 130, 131, 131, 130, 130, 130,
-130, 130, 129, 128, 128, 127, 127, 128, 129, 129, 129, 129, 128, 127, 126, 125, 125, 126, 127, 128,
-129, 129, 128, 126, 125, 123, 123, 123, 123, 124, 124, 123, 122, 120, 119, 118, 118, 119, 120, 121,
-124, 127, 128, 127, 125, 122, 120, 121, 124, 128, 132, 134, 133, 132, 129, 127, 126, 127, 130, 132,
-134, 135, 135, 134, 133, 132, 132, 132, 132, 133, 134, 134, 134, 133, 132, 131, 131, 130, 129, 128,
-127, 127, 127, 127, 127, 127, 126, 125, 124, 123, 123, 124, 125, 125, 125, 125, 125, 124, 125, 125,
-126, 127, 127, 128, 128, 128, 128, 128, 128, 129, 131, 132, 132, 132, 131, 130, 130, 130, 131, 132,
-132, 133, 132, 131, 130, 129, 129, 129, 129, 129, 129, 129, 129, 129, 128, 127, 126, 125, 125, 125,
-125, 125, 124, 124, 123, 123, 122, 121, 120, 119, 118, 119, 119, 119, 119, 119, 119, 119, 120, 122,
-124, 126, 126, 125, 123, 123, 123, 126, 129, 132, 133, 133, 132, 130, 129, 129, 129, 131, 133, 135,
-136, 136, 135, 134, 133, 133, 133, 133, 133, 134, 134, 134, 133, 133, 132, 132, 131, 130, 128, 127,
-126, 126, 127, 127, 127, 126, 125, 124, 123, 123, 123, 123, 124, 124, 125, 125, 125, 125, 125, 125,
-124, 124, 124, 126, 127, 129, 130, 130, 130, 129, 129, 129, 129, 129, 130, 132, 132, 133, 133, 132,
-131, 130, 130, 129, 129, 130, 131, 132, 132, 131, 130, 129, 127, 127, 126, 127, 128, 128, 128, 127,
-126, 124, 124, 123, 123, 123, 122, 121, 120, 120, 120, 120, 120, 119, 119, 118, 119, 121, 123, 125,
-126, 126, 125, 123, 122, 123, 125, 128, 130, 132, 131, 130, 129, 128, 128, 129, 130, 132, 134, 135,
-135, 134, 133, 133, 132, 133, 133, 134, 134, 134, 134, 133, 133, 133, 132, 131, 130, 128, 127, 127,
-127, 128, 128, 128, 127, 126, 124, 124, 123, 124, 125, 125, 126, 125, 125, 124, 124, 124, 124, 124,
-125, 126, 127, 128, 128, 128, 127, 127, 127, 128, 129, 130, 130, 130, 130, 130, 130, 130, 131, 131,
-131, 131, 130, 129, 130, 130, 131, 131, 131, 130, 129, 128, 128, 128, 128, 128, 128, 128, 127, 127,
-126, 126, 125, 124, 123, 122, 122, 122, 122, 122, 121, 120, 119, 118, 118, 120, 122, 124, 126, 126,
-125, 123, 121, 120, 121, 124, 128, 131, 132, 131, 130, 127, 126, 126, 127, 129, 132, 134, 135, 135,
-134, 132, 131, 131, 132, 133, 134, 134, 134, 134, 134, 133, 132, 131, 130, 130, 129, 128, 128, 128,
-129, 129, 128, 127, 126, 124, 123, 124, 124, 125, 126, 127, 126, 125, 124, 123, 123, 124, 124, 125,
-126, 127, 128, 128, 127, 126, 125, 126, 128, 130, 132, 132, 131, 129, 127, 127, 129, 131, 132, 132,
-131, 130, 129, 128, 129, 130, 131, 131, 131, 130, 129, 129, 129, 129, 129, 128, 128, 128, 128, 127,
-127, 126, 125, 124, 124, 123, 122, 121, 121, 121, 121, 121, 120, 120, 119, 118, 119, 121, 124, 125,
-125, 123, 121, 120, 120, 123, 127, 130, 132, 131, 129, 126, 125, 126, 128, 131, 133, 135, 135, 134,
-133, 132, 132, 132, 133, 134, 135, 135, 135, 134, 133, 132, 132, 132, 132, 131, 130, 128, 127, 127,
-128, 128, 128, 127, 126, 125, 124, 124, 124, 124, 125, 125, 125, 124, 124, 124, 124, 124, 124, 124,
-125, 126, 126, 126, 126, 126, 127, 127, 128, 129, 129, 129, 129, 129, 129, 130, 130, 130, 131, 131,
-131, 131, 131, 131, 131, 130, 131, 132, 132, 133, 132, 131, 130, 129, 128, 128, 129, 130, 130, 129,
-128, 127, 126, 124, 123, 122, 122, 122, 122, 122, 122, 120, 119, 117, 117, 119, 121, 123, 124, 124,
-122, 120, 119, 119, 122, 125, 128, 130, 129, 128, 126, 125, 126, 127, 129, 131, 133, 134, 134, 134,
-133, 132, 132, 133, 134, 134, 135, 135, 135, 134, 133, 133, 132, 132, 131, 131, 130, 129, 129, 129,
-129, 129, 129, 128, 126, 125, 124, 124, 124, 125, 125, 126, 125, 124, 123, 122, 122, 122, 123, 124,
-125, 126, 126, 126, 125, 124, 124, 125, 127, 129, 130, 131, 130, 129, 127, 127, 128, 129, 131, 133,
-133, 132, 130, 130, 130, 131, 132, 133, 132, 131, 131, 131, 131, 132, 132, 131, 130, 130, 129, 129,
-128, 128, 128, 127, 126, 125, 124, 123, 122, 121, 120, 120, 120, 120, 120, 120, 120, 121, 121, 121,
-120, 119, 119, 120, 122, 124, 126, 128, 127, 126, 125, 124, 124, 126, 128, 131, 133, 134, 134, 133,
-131, 131, 131, 132, 134, 135, 136, 137, 136, 135, 133, 132, 132, 132, 133, 133, 133, 132, 131, 130,
-129, 128, 127, 127, 127, 127, 127, 127, 126, 125, 124, 124, 123, 123, 123, 124, 124, 124, 124, 123,
-123, 123, 123, 124, 124, 124, 125, 125, 126, 127, 127, 127, 127, 127, 127, 128, 129, 130, 130, 131,
-131, 130, 130, 130, 131, 131, 132, 133, 134, 133, 133, 132, 131, 131, 131, 132, 132, 133, 132, 131,
-130, 129, 128, 128, 127, 127, 126, 126, 125, 124, 123, 122, 120, 119, 119, 119, 121, 122, 122, 122,
-120, 119, 118, 118, 119, 121, 124, 125, 126, 126, 125, 124, 123, 124, 125, 127, 129, 131, 132, 132,
-131, 131, 130, 130, 131, 132, 134, 135, 135, 135, 135, 134, 133, 133, 132, 132, 132, 132, 132, 132,
-132, 132, 131, 129, 128, 128, 127, 127, 127, 127, 127, 127, 126, 125, 124, 123, 122, 122, 122, 123,
-124, 124, 125, 124, 124, 123, 122, 122, 123, 125, 126, 128, 128, 127, 126, 126, 126, 127, 128, 129,
-130, 130, 131, 131, 131, 131, 132, 132, 132, 132, 132, 133, 133, 134, 134, 134, 133, 132, 131, 131,
-131, 131, 131, 131, 130, 129, 128, 127, 125, 124, 124, 124, 123, 122, 121, 121, 120, 120, 121, 121,
-121, 120, 119, 118, 118, 119, 120, 123, 124, 125, 125, 124, 123, 122, 122, 124, 126, 128, 130, 131,
-131, 131, 130, 129, 129, 130, 132, 134, 135, 136, 135, 134, 133, 133, 133, 133, 133, 134, 134, 133,
-133, 132, 131, 130, 129, 129, 129, 129, 129, 129, 128, 127, 126, 125, 125, 124, 124, 124, 124, 124,
-124, 124, 123, 123, 122, 122, 122, 122, 123, 123, 124, 124, 124, 124, 125, 125, 125, 126, 126, 127,
-128, 128, 129, 129, 130, 130, 131, 132, 132, 133, 132, 132, 132, 132, 133, 134, 134, 134, 134, 133,
-133, 132, 132, 132, 132, 131, 131, 131, 130, 129, 128, 127, 126, 125, 124, 123, 123, 123, 122, 122,
-121, 121, 121, 121, 121, 120, 119, 118, 119, 120, 122, 123, 124, 124, 123, 122, 121, 121, 123, 125,
-127, 129, 130, 130, 129, 129, 128, 129, 130, 131, 133, 134, 134, 134, 133, 133, 133, 133, 133, 133,
-134, 134, 134, 133, 133, 132, 131, 131, 130, 130, 130, 130, 130, 129, 128, 127, 126, 125, 125, 125,
-125, 124, 124, 124, 124, 123, 123, 122, 122, 122, 122, 122, 123, 124, 124, 124, 124, 124, 124, 124,
-125, 126, 127, 128, 129, 129, 129, 129, 129, 130, 131, 131, 132, 133, 133, 133, 133, 133, 133, 133,
-133, 134, 134, 134, 133, 133, 132, 132, 131, 131, 131, 131, 130, 129, 128, 127, 126, 125, 125, 124,
-123, 122, 122, 121, 121, 122, 122, 121, 121, 120, 119, 119, 119, 119, 121, 122, 123, 123, 123, 122,
-122, 122, 123, 124, 125, 127, 128, 129, 129, 129, 128, 128, 129, 130, 132, 133, 134, 134, 134, 134,
-133, 133, 133, 134, 134, 134, 134, 133, 133, 133, 132, 132, 131, 131, 131, 130, 129, 129, 128, 128,
-127, 127, 126, 126, 125, 124, 124, 123, 123, 123, 123, 123, 123, 123, 123, 122, 122, 122, 122, 123,
-123, 124, 124, 125, 125, 126, 126, 126, 126, 127, 127, 128, 130, 131, 131, 131, 131, 131, 131, 132,
-132, 133, 134, 134, 132, 130, 128, 127, 127, 127, 128, 128, 128, 128, 128, 127, 127, 127, 128, 128,
-128, 128, 128, 127, 127, 127, 127, 127, 128, 127, 128, 127, 127, 127, 127, 127, 127, 128, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 128, 127, 128, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 128, 127, 128, 127,
-128, 127, 127, 128, 127, 128, 127, 128, 127, 128, 127, 128, 128, 128, 128, 128, 128, 128, 127, 128,
-128, 128, 128, 128, 127, 128, 127, 128, 127, 128, 128, 127, 128, 127, 128 };
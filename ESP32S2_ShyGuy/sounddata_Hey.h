@@ -1,1382 +0,0 @@
-// Wav2c recriado em Javascript por Guilherme Rodrigues: https://github.com/guilhermerodrigues680/wav2c-online
-// Baseado no wav2c em C de Olle Jonsson: https://github.com/olleolleolle/wav2c
-
-//const int sounddata_sampleRate = 48000; 
-const int sounddata_length_Hey = 12822; 
-
-unsigned char PROGMEM sounddata_data_Hey[] = { 128,
-128, 128, 128, 128, 127, 128, 128, 128, 128, 128, 127, 127, 127, 127, 127, 127, 128, 128, 128, 128,
-128, 128, 128, 127, 127, 127, 127, 127, 127, 128, 128, 128, 128, 128, 128, 127, 127, 127, 127, 127,
-127, 127, 128, 128, 128, 128, 128, 128, 127, 127, 127, 128, 128, 128, 128, 127, 127, 127, 128, 128,
-128, 128, 127, 127, 127, 127, 128, 128, 128, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 128,
-128, 128, 128, 128, 128, 128, 128, 128, 128, 128, 127, 127, 126, 127, 127, 128, 128, 128, 128, 128,
-128, 128, 129, 128, 128, 127, 126, 126, 127, 127, 128, 128, 128, 128, 127, 127, 126, 127, 127, 128,
-129, 129, 129, 128, 128, 128, 128, 128, 127, 127, 127, 126, 126, 126, 127, 127, 128, 128, 128, 128,
-127, 127, 127, 127, 128, 128, 128, 128, 127, 127, 127, 128, 129, 130, 129, 128, 126, 125, 125, 126,
-128, 129, 129, 129, 128, 127, 126, 126, 127, 127, 127, 126, 126, 127, 127, 129, 130, 131, 131, 130,
-129, 127, 126, 125, 126, 127, 127, 128, 128, 128, 127, 127, 127, 127, 127, 128, 128, 127, 127, 127,
-127, 128, 129, 129, 129, 128, 128, 127, 127, 127, 127, 127, 127, 128, 128, 128, 127, 126, 125, 125,
-125, 126, 128, 129, 129, 129, 128, 127, 127, 127, 128, 130, 131, 131, 130, 128, 127, 125, 125, 125,
-126, 127, 128, 128, 127, 127, 127, 127, 128, 129, 130, 130, 130, 129, 128, 127, 127, 126, 126, 126,
-126, 126, 127, 127, 128, 129, 130, 131, 131, 128, 125, 122, 121, 123, 127, 131, 134, 136, 135, 132,
-129, 127, 126, 125, 125, 124, 124, 125, 125, 126, 127, 127, 127, 126, 125, 125, 125, 126, 127, 129,
-130, 132, 133, 132, 131, 129, 126, 124, 123, 124, 125, 126, 127, 128, 128, 129, 129, 130, 129, 128,
-125, 123, 122, 123, 125, 128, 131, 132, 132, 131, 129, 126, 125, 124, 124, 125, 127, 129, 131, 132,
-132, 131, 129, 127, 125, 124, 123, 123, 124, 124, 126, 128, 130, 131, 131, 130, 128, 127, 126, 127,
-128, 128, 129, 129, 129, 130, 129, 129, 127, 126, 124, 124, 125, 127, 128, 129, 129, 128, 128, 128,
-129, 131, 132, 132, 130, 127, 123, 120, 121, 123, 127, 130, 130, 129, 128, 127, 127, 128, 129, 129,
-128, 126, 124, 124, 127, 131, 134, 134, 129, 123, 118, 118, 125, 134, 142, 143, 138, 128, 118, 112,
-113, 119, 127, 132, 132, 128, 124, 123, 125, 129, 133, 135, 132, 127, 123, 121, 124, 129, 133, 135,
-134, 130, 126, 121, 120, 120, 121, 124, 127, 129, 131, 132, 132, 132, 133, 132, 131, 128, 124, 121,
-121, 122, 124, 128, 131, 132, 132, 129, 126, 124, 124, 126, 128, 131, 132, 131, 129, 126, 124, 124,
-126, 128, 129, 130, 131, 130, 129, 127, 124, 122, 121, 122, 124, 126, 128, 130, 131, 132, 132, 133,
-132, 130, 126, 123, 121, 121, 124, 129, 132, 133, 130, 125, 120, 118, 118, 122, 127, 130, 132, 132,
-131, 130, 129, 128, 129, 130, 132, 132, 129, 127, 125, 126, 128, 130, 130, 128, 125, 124, 124, 125,
-127, 128, 128, 127, 126, 126, 126, 127, 127, 128, 129, 132, 134, 135, 135, 135, 134, 132, 130, 127,
-122, 118, 116, 117, 120, 124, 126, 127, 127, 126, 127, 129, 132, 133, 133, 130, 128, 127, 128, 130,
-132, 133, 132, 130, 128, 125, 122, 120, 121, 122, 124, 125, 125, 125, 126, 128, 131, 134, 135, 133,
-130, 127, 126, 129, 132, 134, 132, 128, 123, 122, 124, 127, 130, 130, 128, 125, 122, 120, 122, 125,
-128, 131, 132, 133, 133, 133, 131, 128, 125, 124, 124, 125, 126, 127, 126, 127, 129, 130, 130, 128,
-124, 121, 121, 122, 126, 130, 133, 134, 133, 130, 128, 126, 125, 125, 127, 129, 129, 128, 125, 124,
-123, 123, 125, 126, 127, 127, 128, 130, 132, 133, 133, 131, 129, 128, 128, 127, 127, 126, 126, 127,
-128, 128, 127, 125, 123, 121, 120, 121, 124, 127, 131, 134, 135, 132, 126, 122, 120, 124, 130, 136,
-140, 139, 135, 131, 127, 124, 123, 124, 124, 123, 120, 118, 117, 118, 123, 129, 134, 137, 137, 133,
-129, 126, 126, 127, 130, 132, 133, 132, 130, 126, 124, 123, 124, 126, 128, 129, 128, 126, 123, 122,
-123, 125, 129, 131, 130, 130, 129, 129, 131, 133, 134, 134, 132, 129, 125, 121, 120, 120, 121, 123,
-127, 131, 134, 135, 133, 129, 125, 124, 125, 127, 129, 131, 132, 131, 130, 129, 127, 125, 124, 125,
-126, 128, 129, 128, 126, 125, 124, 125, 126, 127, 128, 129, 129, 127, 125, 124, 126, 128, 131, 133,
-133, 131, 129, 128, 127, 124, 121, 121, 123, 126, 130, 131, 129, 125, 124, 124, 127, 130, 132, 131,
-129, 128, 127, 127, 129, 130, 130, 129, 126, 123, 119, 117, 118, 122, 127, 133, 136, 136, 134, 132,
-130, 129, 129, 129, 129, 129, 128, 127, 126, 126, 127, 130, 130, 128, 122, 117, 115, 117, 123, 131,
-137, 139, 137, 133, 128, 125, 124, 125, 125, 126, 126, 127, 127, 127, 126, 126, 126, 125, 124, 124,
-125, 127, 130, 132, 131, 130, 128, 128, 130, 133, 136, 136, 135, 132, 127, 123, 120, 119, 120, 121,
-123, 125, 125, 124, 123, 123, 125, 129, 133, 134, 132, 129, 127, 128, 131, 135, 139, 139, 136, 130,
-122, 114, 108, 108, 115, 125, 135, 140, 139, 132, 126, 123, 124, 128, 134, 136, 133, 128, 125, 124,
-127, 130, 131, 130, 126, 121, 118, 117, 119, 123, 128, 134, 136, 136, 132, 128, 127, 126, 126, 126,
-126, 126, 127, 128, 130, 133, 136, 136, 132, 127, 121, 118, 117, 118, 121, 124, 126, 127, 127, 129,
-132, 136, 138, 136, 132, 127, 121, 118, 119, 123, 130, 136, 139, 137, 131, 126, 122, 121, 121, 123,
-125, 128, 128, 127, 125, 124, 124, 126, 129, 132, 133, 132, 129, 128, 128, 130, 132, 135, 135, 132,
-128, 124, 122, 120, 120, 120, 120, 122, 125, 128, 130, 132, 134, 135, 134, 130, 125, 121, 122, 127,
-132, 136, 138, 136, 131, 128, 128, 130, 133, 135, 133, 126, 117, 110, 107, 111, 121, 131, 139, 141,
-139, 134, 128, 124, 123, 124, 126, 127, 128, 129, 130, 132, 135, 136, 134, 130, 124, 118, 113, 112,
-115, 121, 128, 135, 138, 136, 132, 127, 124, 124, 127, 129, 128, 125, 124, 124, 126, 130, 132, 134,
-134, 133, 130, 126, 121, 117, 115, 117, 121, 126, 130, 132, 131, 131, 131, 132, 133, 133, 132, 130,
-128, 126, 125, 125, 126, 128, 128, 126, 123, 121, 121, 124, 128, 130, 130, 129, 128, 128, 130, 133,
-135, 136, 135, 133, 129, 124, 119, 116, 116, 119, 126, 133, 138, 140, 138, 133, 127, 121, 117, 115,
-118, 122, 127, 131, 134, 134, 133, 131, 130, 128, 126, 124, 123, 122, 124, 128, 132, 133, 132, 127,
-121, 118, 118, 121, 126, 130, 132, 131, 128, 127, 128, 129, 129, 129, 129, 128, 127, 127, 128, 130,
-134, 137, 138, 135, 127, 119, 114, 113, 116, 121, 126, 130, 132, 131, 129, 128, 129, 132, 134, 134,
-130, 125, 122, 122, 126, 132, 135, 136, 135, 131, 129, 129, 131, 131, 130, 125, 120, 116, 116, 119,
-125, 130, 134, 136, 135, 132, 129, 125, 123, 124, 126, 128, 128, 128, 129, 130, 130, 130, 129, 127,
-124, 121, 121, 124, 129, 135, 139, 140, 138, 133, 127, 121, 117, 116, 118, 120, 122, 125, 127, 129,
-131, 130, 127, 125, 125, 125, 126, 127, 128, 127, 128, 129, 130, 131, 129, 126, 125, 126, 128, 127,
-125, 122, 121, 123, 127, 131, 133, 131, 128, 126, 124, 124, 125, 127, 128, 130, 132, 132, 132, 130,
-129, 130, 133, 137, 138, 135, 128, 120, 115, 114, 116, 120, 124, 128, 132, 135, 137, 136, 132, 128,
-124, 123, 125, 128, 133, 137, 140, 140, 136, 130, 124, 122, 124, 129, 133, 134, 130, 123, 116, 112,
-113, 117, 122, 128, 132, 134, 132, 131, 130, 131, 132, 133, 133, 131, 129, 127, 124, 121, 120, 119,
-119, 118, 118, 118, 120, 124, 128, 131, 133, 133, 130, 126, 125, 125, 126, 128, 129, 127, 124, 123,
-125, 129, 132, 133, 132, 130, 127, 123, 118, 116, 119, 126, 135, 141, 141, 134, 125, 120, 121, 127,
-134, 136, 134, 130, 128, 130, 133, 136, 136, 135, 134, 132, 129, 126, 124, 122, 124, 125, 125, 124,
-122, 120, 122, 128, 136, 142, 143, 138, 129, 122, 119, 120, 123, 127, 132, 136, 137, 134, 130, 125,
-122, 122, 122, 121, 119, 118, 118, 121, 124, 127, 127, 126, 124, 122, 120, 121, 123, 124, 124, 123,
-124, 126, 130, 132, 131, 128, 126, 125, 127, 129, 131, 133, 132, 129, 127, 127, 128, 130, 131, 131,
-129, 128, 128, 127, 124, 123, 123, 126, 130, 133, 135, 134, 133, 132, 132, 133, 135, 136, 137, 135,
-132, 130, 130, 132, 133, 134, 132, 130, 127, 125, 125, 126, 127, 128, 130, 131, 132, 132, 131, 129,
-126, 124, 124, 126, 126, 124, 121, 118, 120, 125, 131, 136, 136, 131, 124, 118, 115, 115, 116, 116,
-116, 118, 123, 129, 132, 131, 127, 123, 120, 118, 116, 114, 113, 113, 118, 126, 134, 141, 143, 141,
-135, 130, 125, 120, 117, 117, 120, 125, 133, 140, 142, 142, 140, 139, 137, 133, 127, 120, 116, 116,
-121, 129, 137, 144, 148, 147, 142, 134, 126, 120, 119, 122, 128, 135, 141, 144, 143, 140, 136, 132,
-129, 128, 126, 123, 119, 115, 114, 117, 124, 132, 136, 136, 133, 127, 122, 117, 115, 114, 116, 119,
-122, 125, 127, 127, 126, 123, 121, 120, 119, 117, 115, 112, 111, 112, 116, 121, 126, 129, 133, 137,
-138, 138, 136, 133, 131, 129, 129, 129, 128, 127, 127, 127, 127, 128, 129, 129, 127, 124, 121, 121,
-124, 129, 136, 141, 145, 146, 143, 140, 137, 136, 136, 136, 134, 132, 129, 127, 127, 127, 126, 127,
-128, 131, 133, 132, 130, 128, 128, 129, 133, 134, 134, 131, 127, 124, 122, 122, 121, 121, 120, 117,
-113, 110, 108, 111, 118, 127, 135, 139, 136, 129, 119, 113, 111, 114, 119, 122, 121, 119, 116, 116,
-118, 120, 121, 124, 126, 129, 131, 133, 136, 141, 147, 151, 149, 142, 133, 125, 119, 116, 117, 121,
-126, 130, 134, 135, 134, 132, 133, 134, 135, 135, 133, 130, 127, 128, 132, 136, 140, 144, 144, 143,
-139, 136, 132, 128, 127, 128, 129, 131, 131, 128, 124, 121, 121, 123, 125, 126, 124, 121, 118, 117,
-117, 118, 121, 125, 127, 129, 128, 126, 125, 124, 123, 121, 119, 115, 113, 111, 111, 112, 114, 115,
-116, 117, 119, 123, 126, 128, 130, 131, 135, 140, 144, 147, 146, 144, 141, 137, 133, 127, 121, 116,
-114, 114, 116, 118, 121, 125, 131, 136, 140, 140, 136, 133, 132, 135, 139, 143, 145, 144, 142, 139,
-138, 136, 134, 133, 132, 131, 129, 126, 122, 120, 120, 124, 130, 135, 138, 138, 136, 132, 127, 123,
-119, 115, 113, 112, 114, 116, 118, 120, 120, 121, 123, 124, 123, 121, 117, 114, 113, 114, 116, 119,
-121, 122, 123, 124, 125, 124, 122, 120, 120, 122, 125, 129, 132, 134, 137, 140, 142, 142, 141, 137,
-132, 127, 124, 122, 121, 123, 125, 128, 130, 132, 133, 132, 131, 131, 132, 134, 136, 138, 139, 139,
-140, 141, 143, 144, 143, 141, 138, 133, 129, 125, 123, 122, 124, 126, 129, 130, 129, 128, 127, 127,
-127, 126, 125, 123, 121, 120, 120, 120, 121, 122, 123, 125, 126, 125, 121, 117, 112, 109, 108, 108,
-108, 108, 109, 110, 113, 117, 120, 123, 126, 132, 137, 142, 146, 146, 145, 143, 140, 137, 133, 129,
-125, 122, 122, 122, 122, 121, 120, 120, 120, 123, 127, 131, 135, 139, 142, 144, 143, 142, 139, 136,
-134, 134, 134, 134, 135, 135, 135, 135, 135, 136, 136, 136, 135, 133, 132, 132, 133, 134, 134, 134,
-133, 130, 126, 121, 116, 113, 112, 113, 115, 117, 118, 118, 119, 119, 120, 121, 121, 121, 119, 118,
-117, 115, 113, 110, 108, 108, 109, 113, 117, 123, 128, 133, 137, 140, 141, 141, 138, 136, 134, 133,
-134, 134, 132, 129, 126, 124, 122, 120, 119, 119, 121, 123, 125, 126, 127, 128, 131, 135, 139, 142,
-144, 145, 145, 144, 143, 142, 140, 138, 137, 136, 135, 133, 130, 129, 128, 128, 130, 131, 131, 132,
-132, 132, 131, 129, 126, 123, 121, 120, 120, 122, 125, 127, 128, 128, 126, 123, 119, 115, 111, 108,
-106, 107, 109, 113, 116, 118, 119, 118, 118, 116, 114, 112, 110, 111, 114, 119, 126, 133, 141, 147,
-153, 155, 155, 150, 143, 134, 126, 119, 115, 114, 115, 118, 122, 126, 128, 129, 129, 128, 127, 127,
-128, 131, 134, 137, 141, 145, 148, 151, 153, 153, 150, 145, 138, 131, 125, 121, 121, 123, 127, 132,
-135, 135, 133, 130, 128, 128, 127, 127, 126, 125, 125, 126, 127, 128, 128, 128, 127, 124, 121, 116,
-111, 106, 104, 105, 107, 108, 109, 109, 109, 110, 111, 112, 112, 113, 115, 119, 126, 134, 142, 147,
-150, 152, 151, 147, 140, 131, 123, 118, 118, 120, 123, 124, 124, 124, 125, 127, 127, 127, 126, 126,
-128, 130, 134, 137, 141, 144, 146, 146, 143, 140, 136, 134, 133, 134, 135, 135, 134, 134, 134, 136,
-137, 138, 137, 134, 132, 132, 132, 133, 134, 134, 134, 132, 129, 125, 120, 117, 115, 115, 115, 116,
-116, 116, 116, 116, 117, 116, 115, 114, 114, 114, 113, 111, 107, 105, 104, 106, 110, 115, 120, 125,
-130, 136, 141, 144, 146, 147, 147, 145, 143, 138, 133, 127, 123, 121, 121, 121, 121, 120, 119, 118,
-118, 120, 123, 127, 133, 139, 143, 145, 144, 141, 138, 137, 138, 139, 140, 139, 138, 137, 136, 135,
-134, 136, 137, 138, 136, 133, 129, 127, 126, 127, 129, 131, 132, 131, 130, 128, 126, 125, 124, 124,
-122, 120, 117, 113, 111, 110, 113, 117, 121, 123, 122, 119, 115, 110, 105, 101,  98,  98, 101, 106,
-114, 122, 131, 139, 146, 152, 153, 150, 143, 134, 127, 126, 129, 133, 135, 134, 131, 126, 121, 117,
-115, 114, 115, 118, 121, 123, 126, 129, 135, 142, 150, 155, 156, 153, 148, 144, 141, 140, 138, 136,
-134, 132, 131, 131, 130, 130, 130, 130, 130, 130, 129, 128, 128, 130, 133, 135, 137, 136, 135, 134,
-133, 131, 128, 124, 120, 116, 114, 112, 111, 110, 109, 108, 107, 106, 105, 104, 103, 103, 103, 103,
-104, 104, 106, 109, 117, 130, 145, 159, 168, 171, 168, 159, 149, 138, 128, 121, 117, 115, 115, 114,
-114, 114, 116, 119, 122, 125, 125, 124, 121, 121, 123, 127, 133, 140, 147, 154, 158, 159, 159, 156,
-153, 149, 142, 134, 125, 119, 116, 118, 122, 127, 131, 132, 133, 132, 132, 131, 132, 132, 133, 134,
-134, 134, 133, 132, 132, 131, 128, 124, 119, 114, 111, 110, 111, 111, 110, 109, 108, 108, 108, 107,
-106, 104, 102, 100,  98,  96,  96,  99, 109, 125, 146, 166, 180, 185, 182, 172, 158, 142, 128, 118,
-112, 110, 111, 112, 113, 113, 115, 117, 119, 120, 120, 119, 118, 119, 123, 130, 139, 147, 155, 161,
-165, 167, 164, 159, 152, 143, 134, 127, 121, 117, 117, 120, 123, 127, 128, 128, 127, 125, 125, 126,
-129, 131, 134, 137, 139, 141, 142, 140, 136, 131, 125, 119, 114, 111, 110, 109, 109, 109, 110, 110,
-109, 108, 106, 105, 103, 101,  97,  93,  91,  93, 100, 113, 129, 146, 162, 173, 179, 177, 170, 158,
-145, 133, 125, 120, 117, 115, 113, 112, 111, 112, 113, 114, 115, 116, 117, 119, 122, 126, 132, 139,
-146, 153, 159, 162, 162, 162, 159, 154, 149, 141, 133, 127, 122, 120, 119, 120, 121, 123, 125, 126,
-128, 129, 130, 131, 132, 134, 136, 137, 136, 135, 133, 130, 127, 125, 123, 121, 119, 117, 114, 112,
-111, 112, 112, 111, 109, 106, 103, 101, 100, 100,  98,  97,  98, 103, 113, 127, 143, 158, 167, 170,
-167, 158, 147, 136, 129, 126, 127, 128, 127, 123, 120, 117, 116, 117, 118, 119, 118, 116, 115, 115,
-118, 125, 134, 144, 152, 159, 163, 164, 161, 157, 151, 145, 139, 134, 130, 127, 126, 126, 127, 128,
-127, 125, 122, 121, 122, 125, 128, 131, 134, 136, 138, 139, 139, 137, 134, 130, 126, 122, 118, 115,
-115, 116, 117, 118, 116, 111, 106, 102, 101, 102, 103, 102,  99,  94,  90,  89,  93, 103, 119, 139,
-160, 176, 185, 184, 174, 161, 148, 137, 129, 124, 120, 117, 114, 113, 112, 111, 112, 113, 114, 114,
-112, 111, 112, 116, 124, 135, 145, 153, 158, 161, 162, 162, 162, 160, 156, 150, 141, 133, 126, 123,
-122, 124, 125, 125, 123, 120, 116, 115, 116, 120, 126, 133, 139, 143, 144, 143, 140, 135, 131, 127,
-123, 120, 118, 117, 117, 118, 118, 116, 113, 109, 106, 104, 101,  98,  93,  88,  83,  80,  82,  90,
-104, 124, 147, 168, 184, 190, 186, 175, 160, 145, 134, 126, 122, 120, 121, 121, 120, 119, 117, 115,
-112, 110, 106, 104, 103, 106, 114, 125, 138, 150, 160, 166, 167, 166, 163, 159, 155, 150, 144, 138,
-132, 128, 126, 125, 125, 124, 123, 121, 118, 116, 114, 115, 120, 127, 135, 142, 146, 147, 144, 140,
-134, 129, 125, 121, 119, 119, 119, 119, 118, 115, 113, 111, 109, 108, 106, 102,  97,  93,  90,  88,
- 87,  89,  96, 108, 125, 144, 161, 174, 180, 179, 172, 161, 148, 137, 128, 123, 120, 120, 120, 120,
-119, 118, 117, 115, 113, 111, 109, 109, 112, 118, 127, 137, 147, 154, 159, 160, 160, 158, 155, 151,
-146, 142, 137, 133, 131, 129, 127, 127, 126, 126, 125, 123, 122, 122, 124, 127, 130, 133, 134, 134,
-133, 132, 131, 130, 128, 126, 124, 123, 121, 119, 117, 114, 113, 112, 111, 111, 111, 109, 106, 103,
-100,  97,  95,  94,  94,  98, 107, 121, 137, 153, 165, 171, 172, 168, 160, 151, 141, 132, 125, 120,
-118, 116, 116, 117, 118, 120, 121, 121, 119, 116, 115, 117, 122, 129, 136, 143, 148, 152, 154, 156,
-156, 156, 153, 149, 143, 136, 129, 124, 121, 122, 126, 129, 130, 129, 127, 125, 124, 125, 127, 129,
-130, 131, 131, 131, 131, 130, 129, 128, 126, 125, 122, 118, 114, 110, 108, 108, 108, 109, 109, 108,
-107, 106, 105, 105, 104, 103, 105, 110, 118, 128, 139, 148, 156, 160, 160, 156, 148, 139, 129, 123,
-120, 121, 122, 123, 123, 123, 123, 124, 124, 124, 123, 122, 123, 126, 129, 134, 139, 143, 147, 148,
-147, 144, 141, 138, 137, 136, 136, 136, 135, 134, 133, 134, 135, 136, 136, 134, 132, 130, 130, 131,
-133, 134, 134, 133, 131, 127, 123, 119, 116, 115, 116, 116, 116, 116, 116, 117, 117, 116, 115, 114,
-114, 114, 114, 112, 108, 105, 104, 105, 108, 113, 118, 123, 128, 134, 139, 143, 145, 147, 147, 146,
-144, 140, 134, 129, 124, 121, 121, 121, 121, 121, 119, 117, 117, 119, 121, 126, 131, 137, 142, 145,
-145, 142, 139, 138, 138, 139, 140, 139, 139, 138, 136, 135, 134, 135, 137, 138, 137, 134, 130, 127,
-126, 126, 128, 130, 132, 131, 130, 128, 126, 125, 124, 124, 123, 121, 118, 114, 111, 110, 112, 116,
-120, 123, 123, 121, 116, 111, 106, 102,  99,  98, 100, 104, 111, 120, 128, 137, 144, 150, 153, 151,
-145, 137, 129, 126, 127, 131, 135, 135, 132, 127, 123, 118, 115, 114, 114, 117, 120, 123, 125, 128,
-133, 140, 148, 154, 156, 154, 150, 145, 142, 140, 139, 137, 134, 133, 131, 131, 130, 130, 130, 130,
-130, 130, 129, 128, 128, 129, 132, 134, 136, 137, 136, 134, 133, 131, 129, 125, 121, 117, 114, 113,
-111, 110, 109, 108, 108, 107, 106, 104, 103, 103, 103, 103, 104, 104, 105, 108, 114, 126, 140, 155,
-166, 171, 169, 162, 152, 141, 131, 123, 118, 116, 115, 114, 114, 114, 115, 118, 121, 124, 125, 124,
-122, 121, 122, 126, 131, 138, 145, 152, 157, 159, 159, 157, 154, 150, 144, 137, 128, 120, 116, 117,
-121, 126, 130, 132, 133, 132, 132, 131, 132, 132, 133, 134, 134, 134, 134, 133, 132, 131, 129, 126,
-121, 115, 112, 110, 110, 111, 110, 109, 108, 107, 108, 108, 107, 105, 102, 100,  98,  97,  96,  98,
-105, 120, 140, 160, 177, 185, 184, 175, 162, 147, 132, 120, 113, 110, 110, 112, 113, 113, 114, 116,
-118, 120, 120, 119, 118, 118, 122, 128, 136, 145, 153, 159, 164, 166, 165, 161, 154, 146, 137, 129,
-122, 118, 117, 119, 122, 126, 128, 128, 127, 126, 125, 126, 128, 131, 134, 136, 139, 141, 142, 141,
-138, 133, 126, 120, 115, 112, 110, 109, 109, 109, 110, 110, 109, 108, 106, 105, 103, 101,  98,  94,
- 91,  92,  98, 109, 124, 141, 157, 170, 178, 179, 173, 162, 149, 136, 127, 121, 118, 115, 113, 112,
-111, 111, 113, 114, 115, 116, 117, 118, 121, 125, 130, 136, 144, 151, 157, 161, 163, 162, 160, 156,
-151, 144, 136, 129, 123, 120, 119, 119, 121, 123, 124, 126, 128, 129, 130, 131, 132, 134, 136, 137,
-137, 136, 134, 131, 128, 126, 124, 122, 120, 117, 115, 112, 111, 111, 112, 111, 109, 107, 104, 102,
-101, 100,  99,  97,  97, 101, 109, 123, 139, 154, 165, 170, 169, 162, 150, 139, 130, 126, 126, 128,
-127, 125, 121, 118, 116, 117, 118, 119, 119, 117, 115, 115, 117, 122, 131, 140, 150, 157, 162, 164,
-162, 158, 153, 147, 141, 135, 131, 128, 126, 126, 127, 128, 127, 126, 123, 121, 121, 124, 127, 130,
-133, 135, 137, 139, 139, 138, 135, 132, 127, 123, 119, 116, 115, 115, 117, 118, 117, 113, 108, 103,
-101, 102, 103, 103, 100,  95,  91,  89,  91, 100, 114, 133, 154, 172, 183, 185, 178, 165, 151, 140,
-131, 125, 121, 117, 115, 113, 112, 111, 112, 113, 114, 114, 113, 111, 111, 114, 121, 132, 142, 151,
-157, 160, 162, 162, 162, 161, 158, 152, 144, 135, 128, 123, 122, 123, 125, 125, 124, 121, 117, 115,
-116, 119, 124, 131, 137, 142, 144, 143, 141, 137, 132, 128, 124, 121, 118, 117, 117, 118, 118, 117,
-114, 110, 107, 105, 102,  99,  95,  89,  84,  80,  80,  86,  99, 117, 139, 162, 180, 189, 188, 179,
-165, 150, 137, 128, 123, 121, 121, 121, 120, 119, 117, 115, 113, 110, 107, 104, 103, 105, 111, 121,
-134, 147, 157, 164, 167, 166, 164, 160, 156, 152, 146, 140, 134, 129, 126, 125, 125, 124, 124, 122,
-119, 117, 115, 115, 118, 124, 132, 140, 145, 147, 145, 141, 136, 131, 126, 122, 120, 119, 119, 119,
-118, 116, 113, 111, 109, 108, 106, 103,  98,  93,  89,  86,  85,  85,  90, 101, 118, 138, 158, 174,
-184, 185, 180, 169, 154, 141, 130, 122, 119, 119, 119, 120, 119, 118, 116, 114, 112, 109, 106, 105,
-107, 112, 121, 132, 144, 154, 161, 164, 164, 163, 160, 156, 151, 145, 139, 134, 131, 129, 127, 126,
-126, 125, 123, 120, 118, 118, 119, 124, 129, 135, 139, 140, 140, 138, 135, 132, 129, 126, 124, 122,
-121, 121, 119, 118, 116, 115, 113, 112, 110, 106, 100,  95,  90,  87,  84,  82,  82,  87,  99, 117,
-140, 163, 180, 189, 189, 181, 168, 154, 140, 130, 123, 120, 119, 118, 118, 117, 116, 116, 116, 114,
-110, 106, 103, 105, 112, 123, 136, 148, 156, 160, 162, 162, 161, 159, 156, 152, 148, 142, 135, 128,
-124, 122, 124, 126, 126, 123, 119, 116, 117, 121, 126, 131, 135, 139, 141, 141, 139, 136, 132, 128,
-126, 124, 123, 121, 119, 117, 116, 114, 113, 111, 109, 107, 104, 100,  95,  90,  85,  82,  82,  87,
- 97, 112, 130, 150, 168, 180, 185, 180, 169, 156, 144, 135, 129, 126, 123, 121, 120, 119, 117, 115,
-113, 111, 109, 107, 107, 108, 112, 120, 130, 142, 151, 157, 159, 160, 159, 158, 156, 153, 148, 143,
-137, 133, 129, 127, 126, 125, 124, 123, 121, 119, 118, 120, 124, 129, 134, 138, 139, 138, 136, 134,
-131, 128, 125, 123, 123, 123, 123, 122, 120, 117, 114, 112, 110, 107, 103,  99,  95,  92,  89,  87,
- 85,  87,  93, 105, 121, 139, 157, 171, 180, 181, 173, 159, 144, 131, 124, 124, 127, 131, 132, 130,
-126, 121, 118, 115, 113, 111, 109, 108, 110, 115, 122, 131, 141, 149, 154, 157, 156, 155, 153, 152,
-150, 147, 143, 139, 135, 134, 133, 133, 131, 128, 123, 119, 115, 115, 117, 122, 129, 135, 139, 140,
-139, 136, 132, 128, 126, 124, 124, 124, 124, 124, 122, 120, 117, 114, 110, 106, 102,  97,  92,  87,
- 83,  79,  79,  83,  93, 109, 129, 151, 170, 181, 184, 177, 165, 151, 139, 131, 128, 129, 131, 132,
-132, 129, 124, 120, 116, 112, 107, 103, 100, 101, 106, 116, 129, 140, 149, 155, 156, 156, 155, 153,
-152, 151, 149, 147, 143, 139, 135, 132, 131, 131, 130, 126, 122, 117, 115, 116, 121, 127, 133, 138,
-140, 140, 138, 134, 131, 127, 125, 123, 123, 124, 124, 125, 124, 122, 119, 114, 109, 104,  99,  96,
- 93,  90,  86,  82,  80,  83,  92, 108, 128, 149, 167, 178, 181, 175, 162, 147, 135, 129, 127, 130,
-133, 134, 134, 132, 128, 124, 119, 114, 109, 105, 102, 102, 107, 115, 127, 139, 148, 153, 154, 152,
-150, 148, 147, 147, 146, 145, 144, 142, 140, 139, 137, 135, 131, 126, 121, 117, 116, 118, 123, 128,
-134, 138, 140, 138, 135, 132, 129, 127, 126, 125, 125, 125, 125, 125, 123, 121, 117, 112, 107, 102,
- 98,  94,  90,  85,  80,  77,  78,  85,  99, 119, 143, 163, 176, 180, 176, 166, 154, 144, 137, 134,
-133, 133, 133, 131, 128, 125, 122, 119, 115, 111, 106, 102, 102, 106, 114, 124, 135, 143, 148, 150,
-150, 150, 151, 152, 152, 151, 149, 146, 142, 140, 138, 136, 134, 130, 124, 118, 115, 114, 118, 125,
-132, 137, 139, 139, 138, 135, 132, 129, 127, 125, 125, 125, 126, 127, 127, 125, 122, 117, 111, 105,
-100,  96,  94,  92,  90,  88,  85,  83,  85,  91, 106, 126, 148, 167, 178, 180, 173, 162, 149, 138,
-130, 127, 128, 130, 132, 132, 131, 128, 125, 122, 118, 113, 107, 103, 104, 109, 117, 127, 136, 143,
-148, 151, 151, 151, 149, 147, 146, 146, 146, 145, 143, 141, 139, 137, 134, 129, 123, 118, 116, 118,
-123, 130, 135, 138, 137, 135, 132, 129, 128, 128, 129, 130, 131, 130, 128, 126, 123, 120, 118, 114,
-109, 103,  97,  93,  89,  86,  83,  81,  81,  86,  95, 110, 129, 148, 164, 174, 175, 170, 161, 150,
-140, 132, 128, 128, 131, 134, 135, 134, 130, 125, 118, 111, 106, 103, 103, 106, 113, 121, 129, 136,
-141, 145, 148, 149, 149, 148, 147, 146, 145, 145, 146, 145, 144, 143, 139, 135, 130, 125, 122, 121,
-122, 126, 130, 134, 137, 137, 134, 131, 127, 124, 122, 122, 124, 126, 129, 130, 129, 127, 123, 118,
-114, 110, 106, 102,  97,  91,  86,  81,  79,  81,  86,  96, 110, 128, 146, 161, 169, 170, 165, 157,
-149, 141, 136, 133, 132, 133, 135, 136, 135, 131, 125, 117, 110, 105, 103, 104, 108, 116, 125, 133,
-139, 142, 142, 142, 142, 144, 146, 149, 150, 150, 149, 147, 145, 142, 138, 134, 131, 127, 124, 123,
-124, 126, 130, 134, 137, 138, 136, 132, 128, 125, 123, 122, 123, 124, 127, 129, 130, 130, 127, 122,
-117, 111, 107, 103, 100,  94,  88,  83,  80,  80,  83,  91, 104, 121, 139, 155, 163, 164, 160, 152,
-145, 141, 139, 138, 138, 138, 138, 137, 136, 133, 128, 122, 115, 109, 104, 102, 105, 111, 119, 127,
-134, 138, 141, 141, 142, 143, 145, 148, 150, 151, 151, 150, 147, 144, 141, 137, 132, 128, 124, 123,
-125, 127, 130, 132, 134, 134, 135, 134, 132, 130, 128, 126, 125, 125, 125, 126, 126, 127, 127, 126,
-122, 117, 110, 105, 101,  98,  96,  93,  89,  86,  84,  85,  90,  99, 113, 132, 150, 164, 170, 166,
-156, 145, 136, 132, 132, 134, 135, 135, 136, 137, 137, 134, 129, 122, 114, 107, 104, 104, 107, 114,
-123, 132, 139, 142, 143, 143, 143, 143, 145, 146, 147, 146, 146, 147, 147, 147, 145, 140, 132, 126,
-122, 121, 123, 125, 128, 130, 133, 135, 136, 134, 132, 129, 127, 125, 125, 125, 126, 128, 129, 129,
-126, 121, 115, 109, 104, 100,  96,  92,  88,  84,  81,  82,  87,  97, 111, 127, 143, 156, 163, 163,
-158, 149, 141, 136, 133, 134, 136, 137, 138, 138, 136, 133, 128, 122, 116, 111, 108, 108, 109, 112,
-118, 125, 131, 136, 140, 142, 143, 145, 145, 146, 146, 146, 146, 147, 148, 148, 147, 143, 138, 131,
-125, 121, 121, 123, 127, 130, 133, 135, 136, 135, 133, 129, 127, 125, 125, 126, 127, 127, 127, 126,
-126, 124, 121, 115, 109, 103,  98,  93,  90,  87,  85,  84,  86,  91,  99, 111, 125, 141, 154, 162,
-163, 157, 148, 140, 135, 135, 137, 141, 144, 144, 141, 136, 131, 126, 120, 115, 111, 108, 107, 109,
-113, 118, 124, 130, 135, 138, 139, 141, 143, 145, 148, 149, 148, 147, 147, 146, 146, 144, 142, 138,
-133, 128, 125, 124, 124, 126, 129, 131, 133, 133, 132, 131, 129, 127, 126, 124, 124, 124, 126, 129,
-131, 131, 128, 121, 114, 106, 101,  97,  94,  90,  85,  81,  81,  86,  95, 108, 122, 136, 148, 154,
-154, 150, 144, 139, 138, 138, 139, 140, 141, 142, 143, 143, 139, 132, 123, 115, 108, 105, 105, 108,
-113, 119, 125, 129, 131, 132, 133, 134, 137, 141, 145, 148, 150, 151, 151, 150, 148, 145, 140, 136,
-133, 131, 129, 128, 128, 129, 130, 133, 135, 135, 134, 131, 127, 125, 123, 123, 123, 125, 127, 129,
-129, 129, 127, 124, 121, 117, 112, 105,  99,  94,  92,  92,  93,  94,  94,  96, 102, 112, 126, 139,
-147, 149, 147, 143, 139, 136, 135, 135, 137, 140, 143, 144, 143, 140, 136, 132, 126, 119, 112, 108,
-107, 112, 119, 126, 130, 131, 131, 132, 133, 136, 139, 142, 145, 147, 148, 148, 146, 144, 143, 141,
-139, 137, 133, 130, 127, 127, 129, 133, 135, 136, 134, 130, 127, 125, 126, 127, 127, 128, 127, 127,
-126, 126, 126, 126, 125, 121, 115, 109, 103,  99,  97,  96,  95,  92,  90,  89,  92,  99, 110, 124,
-138, 149, 155, 155, 152, 148, 144, 140, 137, 135, 134, 135, 135, 135, 134, 131, 127, 122, 118, 114,
-112, 112, 113, 115, 120, 125, 129, 133, 136, 139, 143, 146, 149, 151, 150, 148, 146, 143, 141, 139,
-137, 136, 134, 132, 129, 127, 126, 126, 128, 130, 132, 134, 135, 135, 133, 130, 128, 127, 127, 127,
-127, 128, 127, 125, 123, 120, 118, 116, 113, 110, 107, 103,  99,  96,  94,  92,  91,  92,  94, 100,
-109, 122, 136, 149, 158, 161, 158, 152, 145, 140, 138, 137, 136, 135, 133, 131, 130, 127, 124, 121,
-118, 115, 112, 110, 109, 111, 117, 123, 131, 138, 144, 148, 151, 152, 152, 151, 149, 147, 145, 142,
-140, 138, 135, 133, 132, 130, 128, 127, 125, 124, 123, 124, 126, 129, 133, 135, 136, 135, 134, 133,
-131, 129, 127, 125, 123, 122, 121, 120, 118, 115, 112, 109, 107, 104, 102,  99,  96,  93,  92,  92,
- 93,  97, 104, 114, 126, 139, 151, 160, 165, 166, 164, 159, 151, 143, 135, 130, 127, 125, 124, 122,
-120, 118, 116, 115, 113, 111, 110, 110, 112, 116, 123, 131, 140, 148, 154, 157, 158, 158, 156, 153,
-150, 145, 141, 137, 134, 132, 130, 128, 127, 126, 125, 123, 122, 122, 123, 126, 129, 132, 135, 135,
-135, 134, 133, 131, 129, 127, 125, 123, 122, 120, 118, 116, 115, 113, 111, 109, 106, 102,  98,  95,
- 92,  91,  90,  89,  91,  96, 105, 120, 139, 157, 172, 180, 180, 175, 165, 153, 141, 131, 125, 122,
-120, 119, 118, 117, 116, 116, 117, 115, 112, 108, 106, 107, 114, 124, 136, 146, 154, 158, 160, 160,
-160, 158, 155, 152, 147, 142, 135, 129, 124, 123, 125, 127, 127, 124, 120, 118, 118, 121, 126, 130,
-135, 138, 140, 140, 138, 135, 132, 128, 126, 124, 123, 121, 119, 117, 115, 114, 113, 111, 109, 107,
-104, 100,  95,  90,  85,  82,  82,  87,  97, 112, 130, 150, 168, 180, 185, 180, 169, 156, 144, 135,
-129, 126, 123, 121, 120, 119, 117, 115, 113, 111, 109, 107, 107, 108, 112, 120, 130, 142, 151, 157,
-159, 160, 159, 158, 156, 153, 148, 143, 137, 133, 129, 127, 126, 125, 124, 123, 121, 119, 118, 120,
-124, 129, 134, 138, 139, 138, 136, 134, 131, 128, 125, 123, 123, 123, 123, 122, 120, 117, 114, 112,
-110, 107, 103,  99,  95,  92,  89,  87,  85,  87,  93, 105, 121, 139, 157, 171, 180, 181, 173, 159,
-144, 131, 124, 124, 127, 131, 132, 130, 126, 121, 118, 115, 113, 111, 109, 108, 110, 115, 122, 131,
-141, 149, 154, 157, 157, 155, 153, 152, 150, 147, 143, 139, 135, 134, 133, 133, 131, 128, 123, 119,
-115, 115, 117, 122, 129, 135, 139, 140, 139, 136, 132, 128, 126, 124, 124, 124, 124, 124, 122, 120,
-117, 114, 110, 106, 102,  97,  92,  87,  83,  79,  79,  83,  93, 109, 129, 151, 170, 181, 184, 177,
-165, 151, 139, 131, 128, 129, 131, 132, 132, 129, 124, 120, 116, 112, 107, 103, 100, 101, 106, 116,
-129, 140, 149, 155, 156, 156, 155, 153, 152, 151, 149, 147, 143, 139, 135, 132, 131, 131, 130, 126,
-122, 117, 115, 116, 121, 127, 133, 138, 140, 140, 138, 134, 131, 127, 125, 123, 123, 124, 124, 125,
-124, 122, 119, 114, 109, 104,  99,  96,  93,  90,  86,  82,  80,  83,  92, 108, 128, 149, 167, 178,
-181, 175, 162, 147, 135, 129, 127, 129, 133, 134, 134, 132, 128, 124, 119, 114, 109, 105, 102, 102,
-107, 115, 127, 139, 148, 153, 154, 152, 150, 148, 147, 147, 146, 145, 144, 142, 140, 139, 137, 135,
-131, 126, 121, 117, 116, 118, 123, 128, 134, 138, 140, 138, 135, 132, 129, 127, 126, 125, 125, 125,
-125, 125, 123, 121, 117, 112, 107, 102,  98,  94,  90,  85,  80,  77,  78,  85,  99, 119, 143, 163,
-176, 180, 176, 166, 154, 144, 137, 134, 133, 133, 133, 131, 128, 125, 122, 119, 115, 111, 106, 102,
-102, 106, 114, 124, 135, 143, 148, 150, 150, 150, 151, 152, 152, 151, 149, 146, 142, 140, 138, 136,
-134, 130, 124, 118, 115, 114, 118, 125, 132, 137, 139, 139, 138, 135, 132, 129, 127, 125, 125, 125,
-126, 127, 127, 125, 122, 117, 111, 105, 100,  96,  94,  92,  90,  88,  85,  83,  85,  91, 106, 126,
-148, 167, 178, 180, 173, 162, 149, 138, 130, 127, 128, 130, 132, 132, 131, 128, 125, 122, 118, 112,
-107, 103, 104, 109, 117, 127, 136, 143, 148, 151, 151, 151, 149, 147, 146, 146, 146, 145, 143, 141,
-139, 137, 134, 129, 123, 118, 116, 118, 123, 130, 135, 138, 137, 135, 132, 129, 128, 128, 129, 130,
-131, 130, 128, 126, 123, 120, 118, 114, 109, 103,  97,  93,  89,  86,  83,  81,  81,  86,  95, 110,
-129, 148, 164, 174, 175, 170, 161, 150, 140, 132, 128, 128, 131, 134, 135, 134, 130, 125, 118, 111,
-106, 103, 103, 106, 113, 121, 129, 136, 141, 145, 148, 149, 149, 148, 147, 145, 145, 145, 146, 145,
-144, 143, 139, 135, 130, 125, 122, 121, 122, 126, 130, 134, 137, 137, 134, 131, 127, 124, 122, 122,
-124, 126, 129, 130, 129, 127, 123, 118, 114, 110, 106, 102,  97,  91,  86,  81,  79,  81,  86,  96,
-110, 128, 146, 161, 169, 170, 165, 157, 149, 141, 136, 133, 132, 133, 135, 136, 135, 131, 125, 117,
-110, 105, 103, 104, 108, 116, 125, 133, 139, 142, 142, 142, 142, 144, 146, 149, 150, 150, 149, 147,
-145, 142, 138, 134, 131, 127, 124, 123, 124, 126, 130, 134, 137, 138, 136, 132, 128, 125, 123, 122,
-123, 124, 127, 129, 130, 130, 127, 122, 117, 111, 107, 103, 100,  94,  88,  83,  80,  80,  83,  91,
-104, 121, 139, 155, 163, 164, 160, 152, 145, 141, 139, 138, 138, 138, 138, 137, 136, 133, 128, 122,
-115, 109, 104, 102, 105, 111, 119, 127, 134, 138, 141, 141, 142, 143, 145, 148, 150, 151, 151, 150,
-147, 144, 141, 137, 132, 128, 124, 123, 124, 127, 130, 132, 134, 134, 135, 134, 132, 130, 128, 126,
-125, 125, 125, 126, 126, 127, 127, 126, 122, 117, 110, 105, 101,  98,  96,  93,  89,  86,  84,  85,
- 90,  99, 113, 132, 150, 164, 170, 166, 156, 145, 136, 132, 132, 134, 135, 135, 136, 137, 137, 134,
-129, 122, 114, 107, 104, 104, 107, 114, 123, 132, 139, 142, 143, 143, 143, 143, 145, 146, 147, 146,
-146, 147, 147, 147, 145, 140, 132, 126, 122, 121, 123, 125, 128, 130, 133, 135, 136, 134, 132, 129,
-127, 125, 125, 125, 126, 128, 129, 129, 126, 121, 115, 109, 104, 100,  96,  92,  88,  84,  81,  82,
- 87,  97, 111, 127, 143, 156, 163, 163, 158, 149, 141, 136, 133, 134, 136, 137, 138, 138, 136, 133,
-128, 122, 116, 111, 108, 108, 109, 112, 118, 125, 131, 136, 140, 142, 143, 145, 145, 146, 146, 146,
-146, 147, 148, 148, 147, 143, 138, 131, 125, 121, 121, 123, 127, 130, 133, 135, 136, 135, 133, 129,
-127, 125, 125, 126, 127, 127, 127, 126, 126, 124, 121, 115, 109, 103,  98,  93,  90,  87,  85,  84,
- 86,  91,  99, 111, 125, 141, 154, 162, 163, 157, 148, 140, 135, 135, 137, 141, 144, 144, 141, 136,
-131, 126, 120, 115, 111, 108, 107, 109, 113, 118, 124, 130, 135, 138, 139, 141, 143, 145, 148, 149,
-148, 147, 147, 146, 146, 144, 142, 138, 133, 128, 125, 124, 124, 126, 129, 131, 133, 133, 132, 131,
-129, 127, 126, 124, 124, 124, 126, 129, 131, 131, 128, 121, 114, 106, 101,  97,  94,  90,  85,  81,
- 81,  86,  95, 108, 122, 136, 148, 154, 154, 150, 144, 139, 138, 138, 139, 140, 141, 142, 143, 143,
-139, 132, 123, 115, 108, 105, 105, 108, 113, 119, 125, 129, 131, 132, 133, 134, 137, 141, 145, 148,
-150, 151, 151, 150, 148, 145, 140, 136, 133, 131, 129, 128, 128, 129, 130, 133, 135, 135, 134, 131,
-127, 125, 123, 123, 123, 125, 127, 128, 129, 129, 127, 124, 121, 117, 112, 105,  99,  94,  92,  92,
- 93,  94,  94,  96, 102, 112, 126, 139, 147, 149, 147, 143, 139, 136, 135, 135, 137, 140, 143, 144,
-143, 140, 136, 132, 126, 119, 112, 107, 107, 112, 119, 125, 130, 131, 130, 131, 132, 135, 138, 142,
-145, 148, 149, 149, 148, 145, 144, 142, 140, 137, 134, 131, 128, 127, 130, 133, 135, 136, 133, 129,
-125, 124, 125, 126, 127, 128, 128, 128, 128, 128, 128, 127, 126, 122, 117, 110, 103,  99,  96,  95,
- 94,  92,  90,  89,  92,  99, 110, 123, 135, 145, 149, 149, 147, 145, 142, 140, 138, 137, 137, 139,
-140, 141, 140, 136, 131, 125, 119, 114, 112, 112, 113, 116, 119, 122, 125, 128, 130, 133, 136, 141,
-145, 147, 147, 147, 146, 146, 145, 145, 143, 141, 138, 134, 132, 130, 130, 131, 132, 134, 135, 135,
-134, 131, 128, 124, 122, 122, 124, 127, 129, 131, 131, 129, 125, 121, 118, 115, 113, 110, 107, 102,
- 97,  94,  93,  93,  95,  98, 102, 108, 115, 125, 134, 141, 144, 143, 138, 134, 132, 134, 138, 143,
-145, 144, 142, 139, 136, 133, 129, 126, 122, 119, 116, 115, 115, 117, 121, 125, 129, 131, 132, 134,
-137, 139, 141, 142, 143, 143, 144, 145, 146, 145, 144, 142, 138, 135, 132, 131, 131, 131, 133, 134,
-135, 135, 133, 129, 126, 123, 122, 123, 125, 127, 128, 127, 126, 125, 124, 121, 118, 115, 111, 107,
-103, 100,  96,  94,  93,  93,  95,  99, 105, 114, 123, 132, 139, 141, 141, 138, 137, 137, 140, 143,
-146, 146, 144, 142, 139, 136, 132, 127, 122, 118, 116, 116, 116, 116, 117, 119, 122, 125, 127, 130,
-132, 136, 139, 143, 145, 146, 146, 147, 147, 146, 146, 144, 142, 139, 136, 133, 131, 129, 129, 131,
-132, 134, 134, 132, 129, 126, 124, 122, 122, 124, 127, 129, 131, 131, 129, 127, 123, 119, 115, 111,
-109, 106, 103,  98,  94,  91,  92,  95, 100, 107, 114, 120, 126, 131, 134, 135, 134, 134, 136, 139,
-142, 145, 147, 146, 145, 142, 137, 132, 127, 123, 120, 118, 118, 120, 123, 124, 125, 124, 124, 124,
-126, 128, 131, 134, 138, 142, 145, 146, 145, 144, 143, 143, 142, 141, 139, 137, 135, 134, 135, 135,
-136, 137, 138, 137, 135, 131, 127, 124, 121, 121, 122, 124, 126, 127, 129, 129, 128, 125, 120, 115,
-110, 107, 107, 107, 105, 102,  98,  95,  93,  95, 100, 107, 116, 125, 132, 136, 137, 136, 135, 135,
-137, 140, 142, 143, 143, 142, 142, 141, 138, 133, 127, 122, 118, 117, 118, 120, 122, 123, 123, 122,
-122, 124, 127, 130, 134, 138, 141, 144, 145, 146, 147, 147, 146, 145, 143, 139, 136, 134, 133, 133,
-134, 135, 135, 134, 133, 132, 130, 129, 127, 125, 123, 122, 123, 125, 128, 129, 130, 129, 126, 122,
-118, 115, 112, 110, 110, 109, 107, 104, 100,  95,  92,  93,  96, 103, 112, 121, 129, 135, 138, 137,
-135, 133, 132, 134, 136, 139, 141, 143, 144, 144, 144, 141, 137, 130, 124, 119, 116, 117, 118, 121,
-124, 126, 128, 129, 129, 128, 129, 130, 134, 138, 141, 144, 145, 145, 145, 144, 142, 139, 137, 135,
-135, 136, 137, 137, 136, 135, 134, 133, 132, 130, 128, 126, 124, 123, 122, 122, 123, 125, 127, 129,
-129, 127, 121, 115, 111, 108, 106, 106, 105, 104, 102, 100,  99,  99, 103, 108, 115, 121, 125, 128,
-131, 132, 133, 133, 134, 136, 138, 141, 143, 144, 145, 144, 141, 138, 132, 127, 122, 119, 118, 119,
-122, 124, 126, 126, 125, 124, 125, 126, 129, 133, 137, 140, 142, 144, 145, 145, 145, 143, 142, 140,
-139, 138, 137, 136, 136, 136, 136, 135, 134, 133, 131, 129, 127, 125, 124, 123, 124, 124, 124, 124,
-125, 125, 125, 124, 123, 120, 117, 113, 110, 107, 106, 106, 106, 104, 102, 100,  99, 103, 110, 119,
-127, 131, 131, 129, 127, 127, 129, 132, 135, 139, 142, 145, 146, 145, 142, 139, 134, 130, 126, 124,
-122, 123, 124, 125, 126, 126, 125, 124, 124, 126, 129, 132, 135, 136, 137, 139, 141, 142, 144, 143,
-142, 140, 137, 136, 135, 135, 136, 137, 138, 138, 137, 134, 130, 127, 126, 126, 126, 126, 125, 125,
-125, 126, 127, 128, 128, 127, 125, 121, 118, 114, 111, 110, 109, 109, 108, 105, 101,  96,  95,  98,
-104, 112, 119, 123, 125, 127, 128, 129, 130, 133, 136, 139, 142, 143, 143, 142, 142, 142, 141, 138,
-135, 131, 127, 124, 122, 121, 122, 122, 123, 123, 124, 126, 128, 130, 132, 133, 135, 136, 137, 139,
-141, 143, 144, 145, 144, 141, 138, 135, 134, 135, 137, 138, 137, 136, 134, 131, 130, 128, 127, 126,
-125, 125, 124, 124, 124, 124, 125, 125, 125, 125, 123, 121, 119, 116, 113, 110, 107, 105, 104, 102,
-100,  99,  99, 102, 108, 116, 123, 128, 129, 128, 126, 126, 127, 131, 135, 139, 143, 146, 147, 146,
-144, 140, 137, 135, 132, 129, 125, 122, 121, 122, 125, 127, 127, 126, 125, 125, 126, 127, 129, 132,
-135, 139, 142, 143, 143, 142, 141, 141, 140, 139, 138, 135, 134, 135, 136, 137, 137, 136, 134, 131,
-129, 127, 125, 123, 123, 123, 124, 126, 128, 129, 128, 127, 124, 121, 118, 115, 113, 112, 111, 111,
-111, 109, 105, 100,  97,  97, 101, 108, 115, 120, 123, 124, 125, 126, 128, 130, 132, 134, 137, 139,
-141, 141, 141, 141, 142, 141, 139, 135, 131, 128, 126, 126, 125, 125, 125, 125, 125, 126, 127, 127,
-128, 129, 132, 135, 137, 139, 139, 140, 140, 140, 140, 140, 139, 139, 138, 137, 135, 134, 133, 134,
-135, 136, 136, 135, 132, 129, 126, 124, 124, 125, 126, 128, 128, 128, 126, 122, 119, 116, 115, 117,
-118, 118, 116, 112, 107, 105, 105, 106, 109, 110, 111, 110, 109, 110, 114, 120, 125, 129, 130, 128,
-127, 127, 130, 135, 138, 139, 139, 139, 138, 139, 139, 139, 138, 136, 133, 130, 128, 127, 128, 130,
-131, 130, 128, 127, 128, 130, 131, 132, 132, 132, 133, 135, 136, 138, 138, 139, 138, 137, 136, 136,
-137, 138, 138, 137, 136, 135, 134, 133, 132, 130, 129, 129, 129, 128, 127, 125, 123, 122, 122, 123,
-123, 123, 122, 121, 117, 113, 109, 107, 106, 108, 109, 109, 106, 102,  99, 100, 105, 113, 121, 127,
-128, 128, 127, 126, 128, 131, 134, 137, 140, 143, 144, 143, 142, 140, 138, 136, 133, 130, 126, 124,
-125, 127, 130, 131, 129, 126, 122, 121, 123, 127, 132, 135, 138, 138, 137, 137, 137, 138, 139, 140,
-140, 138, 137, 135, 135, 136, 137, 137, 136, 134, 132, 130, 129, 129, 129, 129, 128, 128, 128, 127,
-126, 125, 124, 124, 123, 123, 122, 120, 118, 116, 115, 114, 114, 113, 110, 106, 101,  97,  98, 102,
-108, 116, 122, 125, 125, 124, 121, 120, 121, 124, 130, 135, 139, 142, 142, 142, 141, 140, 139, 137,
-135, 133, 132, 131, 132, 132, 132, 131, 129, 127, 124, 123, 124, 126, 130, 134, 136, 136, 134, 132,
-130, 131, 132, 135, 137, 139, 140, 139, 137, 136, 136, 136, 136, 136, 135, 134, 133, 132, 131, 131,
-131, 131, 129, 128, 127, 126, 126, 126, 125, 124, 122, 121, 120, 119, 119, 117, 115, 112, 108, 105,
-103, 102, 102, 104, 108, 113, 116, 118, 119, 119, 119, 121, 123, 125, 128, 131, 134, 137, 139, 140,
-139, 138, 137, 137, 137, 137, 136, 135, 134, 133, 131, 129, 128, 128, 128, 129, 129, 129, 129, 129,
-129, 130, 131, 132, 133, 134, 135, 136, 136, 135, 135, 135, 136, 136, 136, 136, 136, 136, 136, 135,
-134, 132, 132, 132, 132, 132, 132, 131, 130, 129, 127, 126, 125, 124, 124, 125, 125, 123, 121, 118,
-116, 115, 114, 114, 113, 110, 107, 104, 101, 100, 102, 106, 113, 120, 125, 126, 123, 117, 113, 114,
-120, 129, 137, 142, 142, 141, 138, 137, 137, 136, 136, 136, 136, 135, 135, 135, 135, 135, 135, 133,
-130, 126, 123, 122, 124, 129, 135, 138, 138, 135, 131, 126, 124, 126, 130, 135, 139, 141, 141, 138,
-134, 132, 131, 133, 135, 136, 136, 136, 135, 134, 133, 133, 131, 130, 129, 128, 128, 128, 128, 128,
-127, 126, 124, 122, 121, 119, 119, 118, 116, 113, 110, 107, 106, 105, 105, 106, 106, 108, 111, 113,
-116, 117, 117, 118, 118, 120, 122, 125, 129, 131, 134, 135, 136, 136, 136, 136, 137, 138, 139, 139,
-138, 136, 134, 133, 133, 133, 132, 132, 131, 131, 131, 131, 130, 129, 127, 126, 126, 128, 130, 132,
-133, 134, 134, 133, 133, 133, 134, 135, 136, 137, 138, 137, 137, 136, 136, 135, 134, 133, 132, 131,
-131, 131, 131, 130, 130, 130, 129, 128, 126, 124, 122, 122, 122, 123, 123, 122, 120, 117, 115, 113,
-111, 110, 108, 108, 107, 107, 106, 106, 106, 106, 108, 110, 113, 117, 122, 128, 134, 138, 139, 138,
-136, 135, 136, 138, 141, 142, 143, 142, 140, 138, 134, 131, 128, 126, 125, 125, 125, 125, 125, 125,
-126, 128, 129, 129, 130, 131, 134, 137, 139, 141, 141, 140, 139, 139, 139, 138, 138, 138, 136, 135,
-132, 131, 130, 131, 132, 134, 134, 132, 130, 128, 125, 124, 125, 126, 128, 129, 130, 129, 127, 125,
-122, 119, 117, 114, 112, 109, 106, 102,  98,  96,  95,  98, 102, 108, 114, 119, 124, 127, 129, 129,
-129, 130, 132, 136, 140, 143, 145, 144, 142, 140, 136, 133, 130, 127, 124, 123, 123, 124, 126, 126,
-126, 126, 125, 125, 127, 129, 131, 134, 137, 141, 143, 144, 143, 141, 140, 140, 141, 140, 139, 137,
-135, 134, 134, 134, 135, 137, 137, 137, 135, 131, 128, 124, 122, 122, 123, 124, 126, 127, 129, 129,
-128, 125, 121, 115, 111, 108, 107, 107, 106, 103,  99,  95,  93,  95,  99, 106, 115, 124, 131, 136,
-137, 136, 135, 135, 137, 140, 142, 143, 143, 143, 142, 141, 138, 133, 127, 122, 118, 117, 118, 120,
-122, 123, 123, 123, 122, 123, 126, 130, 134, 138, 141, 144, 145, 146, 147, 147, 146, 145, 143, 139,
-136, 134, 133, 133, 134, 135, 135, 134, 133, 132, 130, 129, 127, 125, 123, 122, 123, 125, 127, 129,
-130, 129, 126, 123, 119, 115, 112, 111, 110, 109, 107, 104, 100,  95,  93,  93,  96, 103, 112, 121,
-129, 135, 138, 137, 135, 133, 132, 134, 136, 139, 141, 143, 144, 144, 144, 142, 137, 130, 124, 119,
-116, 116, 118, 121, 123, 126, 128, 129, 129, 129, 129, 130, 134, 137, 141, 144, 145, 145, 145, 144,
-142, 139, 137, 135, 135, 135, 137, 137, 136, 135, 134, 133, 132, 130, 128, 126, 124, 123, 122, 122,
-123, 125, 127, 129, 130, 127, 122, 116, 111, 108, 106, 106, 105, 104, 102, 100,  99,  99, 102, 108,
-114, 120, 125, 128, 131, 132, 133, 133, 134, 136, 138, 140, 142, 144, 145, 144, 142, 138, 133, 127,
-122, 119, 118, 119, 122, 124, 126, 126, 125, 124, 125, 126, 129, 133, 136, 140, 142, 143, 145, 145,
-145, 143, 142, 140, 139, 138, 137, 136, 136, 136, 136, 135, 134, 133, 131, 129, 127, 125, 124, 123,
-124, 124, 124, 124, 125, 125, 125, 124, 123, 120, 117, 113, 110, 108, 106, 106, 106, 105, 102, 100,
- 99, 102, 110, 119, 127, 131, 131, 129, 128, 127, 129, 132, 135, 139, 142, 145, 146, 145, 143, 139,
-134, 130, 126, 124, 123, 123, 124, 125, 126, 126, 125, 124, 124, 126, 129, 132, 135, 136, 137, 138,
-140, 142, 144, 143, 142, 140, 138, 136, 135, 135, 136, 137, 138, 138, 137, 134, 130, 127, 126, 126,
-126, 126, 125, 125, 125, 126, 127, 128, 128, 127, 125, 121, 118, 114, 111, 110, 109, 109, 108, 105,
-101,  97,  95,  98, 104, 112, 118, 123, 125, 127, 128, 129, 130, 132, 136, 139, 142, 143, 143, 142,
-142, 142, 141, 139, 135, 131, 127, 124, 122, 121, 122, 122, 123, 123, 124, 126, 128, 130, 132, 133,
-135, 136, 137, 139, 141, 143, 144, 145, 144, 141, 138, 135, 134, 135, 137, 138, 137, 136, 134, 132,
-130, 128, 127, 126, 125, 125, 124, 124, 124, 124, 125, 125, 125, 125, 123, 122, 119, 116, 113, 110,
-108, 106, 104, 102, 100,  99,  99, 102, 108, 116, 123, 128, 129, 128, 126, 126, 127, 131, 135, 139,
-143, 146, 147, 146, 144, 140, 137, 135, 132, 129, 125, 122, 121, 122, 125, 127, 127, 126, 125, 125,
-126, 127, 129, 132, 135, 139, 142, 143, 143, 142, 141, 141, 140, 140, 138, 135, 134, 135, 136, 137,
-137, 136, 134, 131, 129, 127, 125, 123, 123, 123, 124, 126, 128, 129, 128, 127, 124, 121, 118, 115,
-113, 112, 111, 111, 111, 109, 105, 101,  97,  97, 101, 108, 115, 120, 123, 124, 125, 126, 128, 130,
-132, 134, 137, 139, 141, 141, 141, 141, 142, 141, 139, 135, 131, 128, 126, 126, 125, 125, 125, 125,
-125, 126, 126, 127, 128, 129, 132, 135, 137, 139, 139, 140, 140, 140, 140, 140, 139, 139, 138, 137,
-135, 134, 133, 134, 135, 136, 136, 135, 132, 129, 126, 124, 124, 125, 126, 128, 128, 128, 126, 123,
-119, 116, 115, 117, 118, 118, 116, 112, 108, 105, 105, 106, 108, 110, 111, 110, 109, 110, 114, 119,
-125, 129, 130, 128, 127, 127, 130, 134, 138, 139, 139, 139, 138, 139, 139, 139, 138, 136, 133, 130,
-128, 127, 128, 130, 131, 130, 128, 127, 128, 130, 131, 132, 132, 132, 133, 135, 136, 138, 138, 139,
-138, 137, 136, 136, 137, 138, 138, 137, 136, 135, 134, 133, 132, 130, 129, 129, 129, 128, 127, 125,
-123, 122, 122, 123, 123, 123, 122, 121, 118, 113, 109, 107, 106, 108, 109, 109, 106, 102,  99, 100,
-105, 113, 121, 126, 128, 128, 127, 126, 128, 131, 134, 137, 140, 143, 144, 143, 142, 140, 138, 136,
-133, 130, 126, 124, 125, 127, 130, 131, 130, 126, 122, 121, 123, 127, 131, 135, 138, 138, 137, 137,
-136, 137, 139, 140, 140, 139, 137, 136, 135, 136, 137, 137, 136, 134, 132, 130, 129, 129, 129, 129,
-128, 128, 128, 127, 126, 125, 124, 124, 123, 123, 122, 120, 118, 116, 115, 114, 114, 113, 110, 106,
-101,  97,  97, 101, 108, 116, 121, 125, 125, 124, 121, 120, 121, 124, 129, 135, 139, 142, 142, 142,
-141, 140, 139, 137, 135, 133, 132, 131, 132, 132, 132, 131, 129, 127, 124, 123, 124, 126, 130, 134,
-136, 136, 134, 132, 130, 131, 132, 135, 137, 139, 140, 139, 137, 136, 136, 136, 136, 136, 135, 134,
-133, 132, 131, 132, 131, 131, 130, 128, 127, 126, 126, 126, 125, 124, 122, 121, 120, 119, 119, 117,
-115, 112, 108, 105, 103, 102, 102, 104, 108, 113, 116, 118, 119, 119, 119, 121, 123, 125, 128, 131,
-134, 137, 139, 140, 139, 138, 137, 137, 137, 137, 136, 135, 134, 133, 131, 129, 128, 128, 128, 129,
-129, 129, 129, 129, 129, 130, 131, 132, 133, 134, 135, 136, 136, 135, 135, 135, 136, 136, 136, 136,
-136, 136, 136, 135, 134, 132, 132, 132, 132, 132, 132, 131, 130, 129, 127, 126, 125, 124, 124, 125,
-125, 123, 121, 118, 116, 115, 114, 114, 113, 110, 108, 104, 101, 100, 101, 105, 112, 120, 125, 126,
-123, 117, 113, 113, 119, 128, 137, 141, 142, 141, 139, 137, 137, 136, 136, 136, 136, 135, 135, 135,
-135, 135, 135, 133, 130, 126, 123, 122, 124, 129, 134, 138, 138, 135, 131, 126, 124, 126, 129, 134,
-139, 141, 141, 138, 134, 132, 131, 133, 135, 136, 136, 136, 135, 134, 133, 133, 131, 130, 129, 128,
-128, 128, 128, 128, 127, 126, 124, 122, 121, 120, 119, 118, 116, 113, 110, 107, 106, 105, 105, 105,
-106, 108, 110, 113, 116, 117, 118, 119, 120, 121, 124, 128, 131, 134, 136, 137, 138, 137, 136, 136,
-136, 137, 139, 139, 138, 136, 134, 132, 131, 131, 131, 130, 130, 130, 131, 132, 132, 131, 129, 129,
-129, 130, 132, 133, 134, 134, 134, 133, 132, 132, 132, 133, 134, 136, 136, 135, 134, 133, 133, 133,
-133, 133, 132, 132, 131, 131, 130, 129, 128, 128, 128, 127, 126, 124, 122, 121, 121, 121, 121, 119,
-116, 113, 111, 109, 107, 107, 107, 108, 109, 111, 112, 113, 114, 115, 116, 117, 118, 119, 122, 126,
-131, 135, 138, 138, 136, 134, 133, 134, 137, 139, 141, 141, 140, 139, 136, 134, 132, 132, 133, 134,
-134, 133, 132, 131, 131, 131, 130, 129, 127, 126, 127, 130, 133, 134, 134, 133, 131, 130, 130, 131,
-133, 135, 136, 136, 135, 133, 132, 132, 133, 133, 133, 133, 131, 130, 128, 128, 128, 129, 130, 130,
-129, 127, 124, 121, 120, 119, 120, 120, 119, 116, 113, 109, 106, 104, 104, 104, 107, 110, 114, 117,
-117, 117, 115, 114, 115, 117, 122, 128, 134, 138, 139, 137, 135, 133, 133, 134, 137, 139, 140, 139,
-138, 137, 136, 135, 134, 133, 131, 130, 130, 130, 131, 133, 135, 136, 134, 132, 128, 126, 126, 128,
-131, 135, 136, 135, 132, 129, 128, 129, 131, 133, 133, 133, 132, 131, 132, 132, 133, 133, 132, 130,
-129, 128, 129, 131, 133, 134, 134, 131, 127, 124, 122, 122, 124, 125, 124, 123, 121, 118, 115, 113,
-110, 107, 106, 106, 107, 109, 111, 113, 115, 116, 116, 115, 114, 114, 117, 121, 127, 131, 134, 135,
-134, 133, 131, 132, 134, 137, 141, 142, 141, 139, 136, 135, 134, 135, 136, 136, 136, 136, 135, 134,
-133, 132, 132, 131, 131, 130, 129, 129, 130, 130, 131, 131, 130, 128, 127, 127, 128, 130, 132, 133,
-132, 130, 129, 127, 128, 129, 131, 133, 135, 135, 133, 130, 128, 127, 129, 132, 134, 134, 132, 130,
-127, 125, 123, 122, 122, 121, 120, 119, 116, 114, 111, 108, 107, 106, 108, 111, 114, 117, 117, 116,
-115, 113, 112, 114, 118, 123, 128, 132, 132, 131, 129, 128, 130, 132, 135, 137, 139, 139, 138, 137,
-136, 136, 136, 136, 136, 136, 134, 134, 135, 136, 138, 138, 136, 133, 128, 126, 126, 129, 133, 137,
-138, 136, 132, 127, 125, 125, 127, 131, 133, 135, 134, 131, 128, 127, 126, 128, 130, 131, 132, 132,
-131, 130, 128, 128, 129, 130, 131, 131, 130, 129, 127, 125, 123, 121, 120, 119, 119, 118, 116, 114,
-110, 108, 106, 107, 109, 113, 117, 120, 121, 118, 113, 109, 109, 113, 120, 128, 133, 135, 133, 130,
-127, 126, 127, 130, 134, 138, 141, 141, 139, 137, 135, 133, 134, 134, 135, 136, 136, 136, 138, 139,
-139, 137, 134, 129, 126, 125, 127, 131, 136, 138, 138, 135, 131, 127, 124, 124, 126, 129, 132, 134,
-135, 133, 131, 128, 126, 126, 127, 129, 131, 132, 132, 132, 132, 131, 130, 129, 129, 129, 129, 128,
-127, 126, 124, 122, 120, 118, 117, 116, 115, 113, 110, 108, 108, 111, 115, 118, 120, 118, 115, 111,
-110, 111, 116, 122, 127, 130, 129, 127, 125, 124, 126, 129, 132, 134, 136, 136, 135, 135, 135, 136,
-137, 137, 137, 136, 135, 136, 137, 138, 139, 139, 137, 135, 133, 132, 132, 133, 133, 134, 134, 133,
-132, 131, 129, 129, 129, 130, 130, 130, 130, 130, 130, 129, 128, 128, 128, 128, 128, 129, 130, 130,
-130, 130, 129, 129, 129, 129, 129, 129, 129, 128, 127, 125, 123, 121, 120, 120, 120, 119, 117, 114,
-111, 109, 109, 112, 116, 119, 121, 119, 115, 111, 109, 110, 115, 122, 127, 130, 130, 127, 124, 121,
-121, 123, 128, 134, 137, 138, 136, 133, 132, 132, 134, 137, 138, 138, 138, 138, 138, 139, 140, 139,
-139, 137, 135, 133, 133, 133, 135, 137, 137, 136, 133, 130, 128, 128, 129, 130, 131, 131, 130, 129,
-127, 126, 126, 126, 127, 127, 127, 127, 128, 129, 129, 130, 129, 129, 128, 128, 128, 128, 128, 128,
-127, 126, 125, 124, 122, 120, 118, 117, 116, 115, 115, 115, 114, 115, 116, 117, 119, 120, 118, 115,
-112, 112, 115, 120, 124, 127, 126, 124, 122, 120, 120, 123, 127, 130, 133, 133, 131, 130, 130, 131,
-133, 135, 136, 137, 137, 138, 139, 139, 140, 140, 140, 138, 137, 136, 136, 137, 137, 138, 137, 136,
-134, 133, 132, 132, 132, 132, 131, 131, 129, 128, 128, 128, 128, 127, 127, 127, 127, 127, 127, 128,
-128, 128, 129, 129, 128, 128, 127, 127, 127, 127, 127, 126, 125, 124, 123, 122, 121, 119, 118, 116,
-116, 115, 116, 117, 118, 119, 120, 120, 118, 114, 112, 111, 114, 118, 123, 126, 127, 125, 121, 117,
-115, 117, 123, 129, 133, 134, 132, 129, 128, 128, 130, 132, 135, 137, 138, 139, 140, 140, 140, 140,
-139, 138, 137, 136, 137, 139, 141, 141, 140, 137, 134, 132, 132, 132, 134, 136, 136, 134, 131, 129,
-127, 126, 127, 128, 129, 129, 129, 128, 127, 126, 126, 126, 127, 127, 126, 126, 125, 125, 126, 127,
-127, 127, 125, 124, 122, 120, 119, 119, 120, 120, 119, 118, 116, 115, 115, 117, 119, 120, 119, 117,
-114, 113, 115, 118, 122, 124, 123, 121, 119, 118, 119, 121, 123, 125, 128, 129, 130, 130, 129, 129,
-130, 132, 134, 135, 136, 136, 137, 139, 140, 140, 140, 139, 139, 139, 140, 140, 141, 141, 140, 139,
-138, 136, 136, 135, 135, 134, 134, 134, 133, 132, 130, 129, 128, 127, 127, 127, 127, 127, 127, 127,
-126, 125, 125, 125, 125, 126, 126, 126, 126, 125, 125, 125, 125, 124, 123, 121, 120, 120, 120, 120,
-120, 119, 117, 115, 114, 114, 116, 118, 120, 119, 117, 115, 113, 114, 117, 120, 122, 123, 122, 121,
-120, 120, 121, 124, 126, 129, 130, 130, 129, 129, 130, 132, 134, 135, 135, 135, 136, 137, 139, 140,
-141, 140, 139, 138, 138, 138, 139, 140, 141, 140, 139, 137, 135, 134, 133, 133, 134, 134, 133, 133,
-132, 130, 129, 128, 127, 126, 127, 127, 128, 129, 129, 129, 127, 126, 125, 125, 126, 128, 129, 129,
-128, 127, 126, 125, 124, 124, 124, 124, 123, 123, 121, 120, 119, 118, 117, 116, 116, 117, 119, 121,
-121, 120, 117, 114, 112, 112, 114, 117, 120, 122, 122, 121, 120, 119, 120, 121, 124, 127, 129, 131,
-131, 131, 131, 132, 134, 135, 136, 136, 137, 138, 139, 140, 140, 139, 138, 136, 135, 134, 135, 136,
-138, 138, 137, 134, 132, 131, 131, 132, 134, 135, 135, 134, 133, 131, 129, 129, 129, 130, 131, 131,
-131, 130, 130, 129, 129, 128, 128, 128, 128, 128, 128, 128, 128, 127, 126, 126, 125, 124, 124, 123,
-122, 122, 121, 121, 120, 118, 116, 115, 115, 115, 116, 116, 115, 113, 110, 108, 108, 112, 117, 122,
-125, 125, 123, 119, 116, 117, 121, 127, 132, 136, 136, 135, 134, 133, 133, 134, 135, 135, 136, 136,
-136, 137, 137, 138, 137, 136, 134, 132, 130, 130, 132, 135, 138, 139, 138, 135, 132, 129, 128, 130,
-132, 135, 137, 137, 136, 133, 130, 129, 130, 131, 132, 133, 132, 131, 130, 130, 130, 130, 129, 129,
-128, 127, 127, 127, 127, 127, 127, 126, 125, 123, 121, 121, 120, 119, 118, 116, 113, 111, 109, 108,
-108, 109, 110, 112, 114, 116, 117, 117, 117, 117, 118, 121, 124, 127, 129, 131, 131, 132, 132, 132,
-132, 133, 134, 135, 136, 137, 136, 134, 133, 132, 132, 132, 132, 132, 132, 133, 134, 134, 134, 133,
-131, 131, 131, 132, 134, 135, 135, 135, 135, 134, 133, 132, 133, 134, 135, 135, 135, 134, 133, 132,
-132, 132, 132, 132, 131, 131, 131, 130, 129, 128, 128, 127, 127, 127, 126, 124, 123, 122, 122, 122,
-121, 120, 117, 115, 112, 111, 109, 108, 108, 109, 110, 112, 113, 113, 114, 115, 117, 118, 118, 119,
-121, 125, 130, 134, 137, 137, 135, 133, 132, 133, 135, 138, 140, 141, 140, 138, 136, 134, 132, 132,
-132, 133, 134, 133, 132, 131, 131, 131, 130, 129, 127, 126, 127, 130, 133, 134, 134, 132, 131, 130,
-130, 131, 133, 135, 136, 136, 135, 133, 132, 132, 133, 133, 133, 133, 131, 130, 128, 128, 128, 129,
-130, 130, 129, 127, 124, 121, 120, 119, 120, 120, 119, 116, 113, 109, 106, 104, 104, 104, 107, 110,
-114, 117, 117, 117, 115, 114, 115, 117, 122, 128, 134, 138, 139, 137, 135, 133, 133, 134, 137, 139,
-140, 139, 138, 137, 136, 135, 134, 133, 131, 130, 130, 130, 131, 133, 135, 136, 134, 132, 128, 126,
-126, 128, 131, 135, 136, 135, 132, 129, 128, 129, 131, 133, 133, 133, 132, 131, 132, 132, 133, 133,
-132, 130, 129, 128, 129, 131, 133, 134, 134, 131, 127, 124, 122, 122, 124, 125, 124, 123, 121, 118,
-115, 113, 110, 107, 106, 106, 107, 109, 111, 113, 115, 116, 116, 115, 114, 114, 117, 121, 127, 131,
-134, 135, 134, 133, 131, 132, 134, 137, 141, 142, 141, 139, 136, 135, 134, 135, 136, 136, 136, 136,
-135, 134, 133, 132, 132, 131, 131, 130, 129, 129, 130, 130, 131, 131, 130, 128, 127, 127, 128, 130,
-132, 133, 132, 130, 129, 127, 128, 129, 131, 133, 135, 135, 133, 130, 128, 127, 129, 132, 134, 134,
-132, 130, 127, 125, 123, 122, 122, 121, 120, 119, 116, 114, 111, 108, 107, 106, 108, 111, 114, 117,
-117, 116, 115, 113, 112, 114, 118, 123, 128, 132, 132, 131, 129, 128, 130, 132, 135, 137, 139, 139,
-138, 137, 136, 136, 136, 136, 136, 136, 134, 134, 135, 136, 138, 138, 136, 133, 128, 126, 126, 129,
-133, 137, 138, 136, 132, 127, 125, 125, 127, 131, 133, 135, 134, 131, 128, 127, 126, 128, 130, 131,
-132, 132, 131, 130, 128, 128, 129, 130, 131, 131, 130, 129, 127, 125, 123, 121, 120, 119, 119, 118,
-116, 114, 110, 108, 106, 107, 109, 113, 117, 120, 121, 118, 113, 109, 109, 113, 120, 128, 133, 135,
-133, 130, 127, 126, 127, 130, 134, 138, 141, 141, 139, 137, 135, 133, 134, 134, 135, 136, 136, 136,
-138, 139, 139, 137, 134, 129, 126, 125, 127, 131, 136, 138, 138, 135, 131, 127, 124, 124, 126, 129,
-132, 134, 135, 133, 131, 128, 126, 126, 127, 129, 131, 132, 132, 132, 132, 131, 130, 129, 129, 129,
-129, 128, 127, 126, 124, 122, 120, 118, 117, 116, 115, 113, 110, 108, 108, 111, 115, 118, 120, 118,
-115, 111, 110, 111, 116, 122, 127, 130, 129, 127, 125, 124, 126, 129, 132, 134, 135, 136, 135, 135,
-135, 136, 137, 137, 137, 136, 135, 136, 137, 138, 139, 139, 137, 135, 133, 132, 132, 133, 133, 134,
-134, 133, 132, 131, 129, 129, 129, 130, 130, 130, 130, 130, 130, 129, 128, 128, 128, 128, 128, 129,
-130, 130, 130, 130, 129, 129, 129, 129, 129, 129, 129, 128, 127, 125, 123, 121, 120, 120, 120, 119,
-117, 114, 111, 109, 109, 112, 116, 119, 121, 119, 115, 111, 109, 110, 115, 122, 127, 130, 130, 127,
-124, 121, 121, 123, 128, 134, 137, 138, 136, 133, 132, 132, 134, 137, 138, 138, 138, 138, 138, 139,
-140, 139, 139, 137, 135, 133, 133, 133, 135, 137, 137, 136, 133, 130, 128, 128, 129, 130, 131, 131,
-130, 129, 127, 126, 126, 126, 127, 127, 127, 127, 128, 129, 129, 130, 129, 129, 128, 128, 128, 128,
-128, 128, 127, 126, 125, 124, 122, 120, 118, 117, 116, 115, 115, 115, 114, 115, 116, 117, 119, 120,
-118, 115, 112, 112, 115, 120, 124, 127, 126, 124, 122, 120, 120, 123, 127, 130, 133, 133, 131, 130,
-130, 131, 133, 135, 136, 137, 137, 138, 139, 139, 140, 140, 140, 138, 137, 136, 136, 137, 137, 138,
-137, 136, 134, 133, 132, 132, 132, 132, 131, 131, 129, 128, 128, 128, 128, 127, 127, 127, 127, 127,
-127, 128, 128, 128, 129, 129, 128, 128, 127, 127, 127, 127, 127, 126, 125, 124, 123, 122, 121, 119,
-118, 116, 116, 115, 116, 117, 118, 119, 120, 120, 118, 114, 112, 111, 114, 118, 123, 126, 127, 125,
-121, 117, 115, 117, 123, 129, 133, 134, 132, 129, 128, 128, 130, 132, 135, 137, 138, 139, 140, 140,
-140, 140, 139, 138, 137, 136, 137, 139, 141, 141, 140, 137, 134, 132, 132, 132, 134, 136, 136, 134,
-131, 129, 127, 126, 127, 128, 129, 129, 129, 128, 127, 126, 126, 126, 127, 127, 126, 126, 125, 125,
-126, 127, 127, 127, 125, 124, 122, 120, 119, 119, 120, 120, 119, 118, 116, 115, 115, 117, 119, 120,
-119, 117, 114, 113, 115, 118, 122, 124, 123, 121, 119, 118, 119, 121, 123, 125, 128, 129, 130, 130,
-129, 129, 130, 132, 134, 135, 136, 136, 137, 139, 140, 140, 140, 139, 139, 139, 140, 140, 141, 141,
-140, 139, 138, 136, 136, 135, 135, 134, 134, 134, 133, 132, 130, 129, 128, 127, 127, 127, 127, 127,
-127, 127, 126, 125, 125, 125, 125, 126, 126, 126, 126, 125, 125, 125, 125, 124, 123, 121, 120, 120,
-120, 120, 120, 119, 117, 115, 114, 114, 116, 118, 120, 119, 117, 115, 113, 114, 117, 120, 122, 123,
-122, 121, 120, 120, 121, 124, 126, 129, 130, 129, 129, 129, 130, 132, 134, 135, 135, 135, 136, 138,
-139, 140, 141, 140, 139, 138, 138, 138, 139, 140, 141, 141, 139, 137, 135, 134, 133, 134, 134, 134,
-134, 133, 132, 130, 128, 127, 126, 126, 126, 127, 127, 128, 128, 127, 126, 124, 124, 124, 125, 126,
-127, 128, 127, 126, 125, 123, 123, 122, 122, 122, 122, 122, 121, 119, 118, 116, 115, 114, 115, 117,
-119, 121, 122, 121, 118, 115, 113, 114, 117, 121, 125, 126, 126, 123, 121, 120, 120, 122, 125, 129,
-131, 132, 132, 131, 130, 131, 132, 134, 135, 136, 137, 138, 140, 141, 141, 140, 139, 137, 136, 136,
-138, 140, 141, 141, 139, 137, 134, 132, 132, 133, 135, 136, 136, 134, 131, 128, 126, 125, 126, 127,
-129, 129, 128, 127, 126, 125, 125, 124, 125, 125, 126, 127, 127, 126, 125, 125, 124, 124, 124, 123,
-123, 122, 121, 120, 119, 119, 118, 118, 116, 115, 115, 116, 118, 120, 120, 119, 116, 114, 114, 116,
-120, 123, 125, 124, 122, 120, 119, 120, 122, 126, 129, 131, 131, 130, 129, 129, 130, 131, 133, 135,
-136, 137, 138, 138, 139, 140, 140, 139, 139, 138, 138, 139, 140, 141, 141, 140, 138, 135, 134, 133,
-133, 134, 135, 136, 135, 132, 129, 127, 126, 126, 127, 128, 129, 128, 127, 126, 125, 124, 125, 125,
-126, 126, 126, 126, 125, 125, 125, 125, 126, 126, 125, 124, 123, 122, 122, 122, 122, 121, 120, 118,
-116, 115, 115, 116, 118, 121, 123, 123, 121, 117, 114, 113, 115, 119, 123, 125, 125, 123, 121, 119,
-120, 121, 123, 126, 128, 129, 130, 129, 129, 130, 131, 132, 133, 134, 135, 136, 138, 140, 141, 141,
-140, 139, 138, 137, 138, 139, 140, 141, 141, 139, 137, 135, 134, 133, 134, 135, 135, 135, 134, 132,
-129, 127, 126, 126, 126, 128, 128, 129, 128, 127, 125, 124, 123, 124, 125, 126, 127, 126, 126, 125,
-125, 124, 124, 123, 123, 122, 123, 122, 122, 120, 119, 118, 117, 117, 117, 118, 119, 121, 122, 121,
-118, 115, 113, 114, 117, 121, 124, 125, 125, 122, 119, 117, 117, 119, 124, 129, 131, 131, 129, 127,
-126, 127, 129, 131, 134, 136, 137, 138, 138, 138, 138, 138, 138, 138, 138, 138, 140, 141, 141, 140,
-139, 138, 136, 135, 135, 135, 136, 137, 137, 135, 133, 130, 128, 127, 127, 128, 129, 129, 129, 128,
-126, 125, 124, 124, 125, 125, 126, 125, 125, 125, 125, 125, 125, 124, 124, 124, 123, 123, 123, 123,
-123, 123, 121, 120, 118, 117, 116, 116, 117, 118, 121, 123, 123, 121, 118, 116, 115, 116, 119, 122,
-124, 124, 123, 121, 119, 119, 121, 123, 125, 126, 126, 127, 127, 129, 130, 130, 131, 131, 132, 133,
-134, 136, 138, 140, 140, 140, 139, 137, 137, 137, 138, 140, 141, 141, 141, 139, 137, 135, 134, 135,
-136, 136, 137, 136, 134, 132, 129, 127, 126, 126, 128, 129, 129, 129, 127, 126, 124, 124, 124, 124,
-125, 126, 126, 126, 125, 124, 123, 122, 123, 123, 124, 124, 123, 122, 121, 119, 119, 118, 118, 118,
-117, 117, 117, 118, 120, 121, 120, 118, 117, 116, 117, 119, 121, 122, 123, 122, 121, 121, 121, 122,
-123, 125, 127, 128, 129, 129, 128, 128, 129, 131, 132, 134, 135, 135, 136, 137, 138, 139, 139, 139,
-138, 138, 138, 139, 139, 140, 139, 139, 138, 137, 136, 135, 134, 134, 135, 135, 135, 133, 131, 129,
-128, 127, 128, 128, 128, 128, 127, 127, 126, 126, 125, 125, 125, 125, 125, 126, 126, 126, 125, 124,
-124, 123, 123, 123, 124, 124, 123, 123, 121, 120, 119, 119, 119, 118, 118, 118, 119, 120, 122, 122,
-122, 120, 117, 116, 116, 119, 123, 125, 125, 124, 122, 120, 119, 120, 122, 125, 127, 129, 129, 129,
-128, 128, 128, 130, 132, 133, 135, 136, 136, 137, 137, 138, 138, 138, 137, 137, 137, 138, 139, 140,
-140, 139, 137, 135, 134, 134, 134, 135, 136, 135, 134, 132, 130, 128, 127, 128, 129, 129, 130, 129,
-128, 126, 125, 125, 125, 126, 126, 126, 126, 125, 124, 124, 124, 123, 124, 124, 124, 124, 123, 123,
-122, 121, 121, 121, 121, 120, 120, 118, 117, 117, 118, 120, 123, 123, 122, 119, 117, 116, 117, 120,
-123, 125, 125, 124, 122, 121, 120, 121, 123, 125, 127, 129, 129, 129, 128, 128, 129, 130, 132, 134,
-135, 135, 136, 136, 137, 138, 138, 138, 137, 137, 137, 137, 138, 139, 139, 138, 137, 136, 135, 134,
-134, 134, 135, 135, 135, 133, 131, 129, 127, 126, 127, 128, 129, 129, 128, 127, 125, 124, 124, 124,
-125, 126, 127, 126, 125, 124, 123, 123, 123, 124, 124, 125, 124, 123, 122, 121, 121, 120, 121, 121,
-121, 120, 119, 118, 118, 119, 121, 123, 123, 122, 119, 118, 117, 119, 121, 124, 125, 124, 123, 122,
-121, 121, 122, 124, 126, 128, 129, 128, 128, 127, 128, 129, 131, 133, 134, 134, 135, 135, 136, 137,
-137, 137, 137, 137, 136, 137, 137, 138, 138, 138, 138, 137, 135, 134, 134, 134, 135, 135, 135, 134,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127,
-127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127
-};
@@ -0,0 +1,419 @@
+/**
+ * Host simulator of the DAC audio engine
+ *
+ * @author    Florian Staeblein
+ * @date      2026/10/18
+ * @copyright © 2026 Florian Staeblein
+ *
+ * ==============================================================
+ *
+ * Runs XT_DAC_Audio.cpp against a simulated 50 kHz timer and DAC.
+ * A schedule interleaves "loop" calls (FillBuffer) with ISR calls,
+ * the DAC output of every ISR tick is written to a WAV file.
+ *
+ * Usage: AudioSimulator [options] clip [clip ...]
+ *   -o file     Output WAV file (default: AudioSimulator.wav)
+ *   -s list     Loop intervals in ISR ticks, comma separated and
+ *               repeated (default: 1000, i.e. every 20 ms)
+ *   -m          Mix all clips at once on separate voices instead
+ *               of queueing them one after another
+ *   -g ms       Gap between queued clips (default: 0)
+ *   -c file     Compare the output with a reference WAV file,
+ *               exits with 1 if it is not bit-exact
+ *   -x hash     Compare the hash of the output with a reference
+ *               hash (hex), exits with 1 if it differs. The
+ *               references of "make check" are in the Makefile
+ *   -r dir      SPIFFS root directory for clips starting with "/"
+ *
+ * Clips are sound bank names (e.g. "Hey", "GoAway"), synthesizer
+ * scripts ("Creak", "Giggle", "Chirp") or SPIFFS paths (e.g.
+ * "/Voice0.wav").
+ *
+ * ==============================================================
+ */
+
+
+//===============================================================
+// Includes
+//===============================================================
+#include <vector>
+#include "Arduino.h"
+#include "esp32-hal-timer.h"
+#include "SPIFFS.h"
+#include "XT_DAC_Audio.h"
+#include "SoundBank.h"
+#include "SynthScripts.h"
+
+
+//===============================================================
+// Defines
+//===============================================================
+#define PIN_DAC                 17
+#define TICK_MICROS             20        // 50 kHz
+#define MAX_TICKS               (50000 * 60)
+
+
+//===============================================================
+// Global definitions
+//===============================================================
+typedef enum : int
+{
+  eFadeIn,
+  ePlaying,
+  eFadeOut,
+  eDone
+} SimState;
+
+
+//===============================================================
+// Writes 8 bit mono samples as WAV file
+//===============================================================
+bool WriteWav(const char *path, const std::vector<uint8_t> &samples, uint32_t rate)
+{
+  FILE *file = fopen(path, "wb");
+  if (file == NULL)
+  {
+    return false;
+  }
+
+  uint32_t dataSize = samples.size();
+  uint8_t header[44];
+  memcpy(header, "RIFF", 4);
+  uint32_t riffSize = 36 + dataSize;
+  memcpy(header + 4, &riffSize, 4);
+  memcpy(header + 8, "WAVEfmt ", 8);
+  uint32_t fmtSize = 16;
+  uint16_t audioFormat = 1;
+  uint16_t channels = 1;
+  uint32_t byteRate = rate;
+  uint16_t blockAlign = 1;
+  uint16_t bitsPerSample = 8;
+  memcpy(header + 16, &fmtSize, 4);
+  memcpy(header + 20, &audioFormat, 2);
+  memcpy(header + 22, &channels, 2);
+  memcpy(header + 24, &rate, 4);
+  memcpy(header + 28, &byteRate, 4);
+  memcpy(header + 32, &blockAlign, 2);
+  memcpy(header + 34, &bitsPerSample, 2);
+  memcpy(header + 36, "data", 4);
+  memcpy(header + 40, &dataSize, 4);
+
+  fwrite(header, 1, sizeof(header), file);
+  fwrite(samples.data(), 1, samples.size(), file);
+  fclose(file);
+  return true;
+}
+
+//===============================================================
+// Reads the samples of an 8 bit mono WAV file (44 byte header)
+//===============================================================
+bool ReadWav(const char *path, std::vector<uint8_t> &samples)
+{
+  FILE *file = fopen(path, "rb");
+  if (file == NULL)
+  {
+    return false;
+  }
+  fseek(file, 0, SEEK_END);
+  long size = ftell(file);
+  fseek(file, 44, SEEK_SET);
+  samples.resize(size > 44 ? size - 44 : 0);
+  size_t read = fread(samples.data(), 1, samples.size(), file);
+  fclose(file);
+  return read == samples.size();
+}
+
+//===============================================================
+// Returns the FNV-1a hash of the samples
+//===============================================================
+uint32_t Hash(const std::vector<uint8_t> &samples)
+{
+  uint32_t hash = 2166136261u;
+  for (uint8_t sample : samples)
+  {
+    hash = (hash ^ sample) * 16777619u;
+  }
+  return hash;
+}
+
+//===============================================================
+// Synthesizer scripts by name
+//===============================================================
+struct NamedScript
+{
+  const char *Name;
+  const SynthScript *Script;
+};
+
+const NamedScript SynthScripts[] =
+{
+  { "Creak", &SynthCreak },
+  { "Giggle", &SynthGiggle },
+  { "Chirp", &SynthChirp },
+};
+
+std::vector<XT_Synth_Class *> synths;
+
+//===============================================================
+// Creates a clip from a sound bank name, a synthesizer script or
+// a SPIFFS path
+//===============================================================
+XT_Wav_Class *CreateClip(const char *name)
+{
+  if (name[0] == '/')
+  {
+    XT_SpiffsWav_Class *clip = new XT_SpiffsWav_Class(name);
+    if (!clip->IsOpen())
+    {
+      delete clip;
+      return NULL;
+    }
+    return clip;
+  }
+
+  for (uint8_t index = 0; index < SOUNDCLIPS_COUNT; index++)
+  {
+    if (strcmp(name, SoundClipNames[index]) == 0)
+    {
+      return new XT_Wav_Class(SoundBankData, SoundBankClips[index]);
+    }
+  }
+
+  for (const NamedScript &script : SynthScripts)
+  {
+    if (strcmp(name, script.Name) == 0)
+    {
+      synths.push_back(new XT_Synth_Class(*script.Script));
+      return synths.back();
+    }
+  }
+  return NULL;
+}
+
+//===============================================================
+// Main
+//===============================================================
+int main(int argc, char **argv)
+{
+  const char *outputPath = "AudioSimulator.wav";
+  const char *comparePath = NULL;
+  const char *expectedHash = NULL;
+  std::vector<uint32_t> schedule;
+  std::vector<XT_Wav_Class *> clips;
+  bool mix = false;
+  uint16_t gapMs = 0;
+
+  // Parse arguments
+  for (int index = 1; index < argc; index++)
+  {
+    if (strcmp(argv[index], "-o") == 0 && index + 1 < argc)
+    {
+      outputPath = argv[++index];
+    }
+    else if (strcmp(argv[index], "-c") == 0 && index + 1 < argc)
+    {
+      comparePath = argv[++index];
+    }
+    else if (strcmp(argv[index], "-x") == 0 && index + 1 < argc)
+    {
+      expectedHash = argv[++index];
+    }
+    else if (strcmp(argv[index], "-r") == 0 && index + 1 < argc)
+    {
+      SPIFFS.Root = argv[++index];
+    }
+    else if (strcmp(argv[index], "-s") == 0 && index + 1 < argc)
+    {
+      for (char *token = strtok(argv[++index], ","); token != NULL; token = strtok(NULL, ","))
+      {
+        schedule.push_back(max(1, atoi(token)));
+      }
+    }
+    else if (strcmp(argv[index], "-g") == 0 && index + 1 < argc)
+    {
+      gapMs = atoi(argv[++index]);
+    }
+    else if (strcmp(argv[index], "-m") == 0)
+    {
+      mix = true;
+    }
+    else
+    {
+      XT_Wav_Class *clip = CreateClip(argv[index]);
+      if (clip == NULL)
+      {
+        fprintf(stderr, "Unknown clip: %s\n", argv[index]);
+        return 2;
+      }
+      clips.push_back(clip);
+    }
+  }
+  if (clips.empty())
+  {
+    fprintf(stderr, "Usage: %s [-o out.wav] [-s ticks,...] [-m] [-g ms] [-c ref.wav] [-x hash] [-r spiffsdir] clip [clip ...]\n", argv[0]);
+    return 2;
+  }
+  if (mix && clips.size() > MIXER_VOICES)
+  {
+    fprintf(stderr, "At most %d clips can be mixed\n", MIXER_VOICES);
+    return 2;
+  }
+  if (!mix && clips.size() > CUE_QUEUE_SIZE)
+  {
+    fprintf(stderr, "At most %d clips can be queued\n", CUE_QUEUE_SIZE);
+    return 2;
+  }
+  if (schedule.empty())
+  {
+    schedule.push_back(1000);
+  }
+
+  // Start the engine like the sketch does
+  XT_DAC_Audio_Class dacAudio(PIN_DAC);
+  dacAudio.Begin();
+  dacAudio.ResetTelemetry();
+  dacAudio.Enable(true);
+  if (!mix)
+  {
+    // Queued clips start by themselves once the fade in is done
+    for (size_t index = 0; index < clips.size(); index++)
+    {
+      dacAudio.Enqueue(clips[index], index == 0 ? 0 : gapMs);
+    }
+  }
+  hw_timer_t *timer = HostGetTimer();
+
+  std::vector<uint8_t> output;
+  SimState state = mix ? eFadeIn : ePlaying;
+  size_t scheduleIndex = 0;
+  uint32_t nextLoopTick = 0;
+  uint64_t fillCycles = 0;
+  uint32_t loops = 0;
+  uint32_t tick = 0;
+
+  for (tick = 0; tick < MAX_TICKS && state != eDone; tick++)
+  {
+    // Loop call, the same sequence as the sketch
+    if (tick == nextLoopTick)
+    {
+      switch (state)
+      {
+        case eFadeIn:
+          if (dacAudio.IsRampDone())
+          {
+            for (size_t voice = 0; voice < clips.size(); voice++)
+            {
+              dacAudio.Play(clips[voice], voice);
+            }
+            state = ePlaying;
+          }
+          break;
+        case ePlaying:
+          {
+            bool completed = dacAudio.IsQueueIdle();
+            for (size_t index = 0; mix && index < clips.size(); index++)
+            {
+              completed &= clips[index]->Completed;
+            }
+            if (completed)
+            {
+              dacAudio.Stop();
+              dacAudio.Enable(false);
+              state = eFadeOut;
+            }
+          }
+          break;
+        case eFadeOut:
+          if (dacAudio.IsRampDone())
+          {
+            state = eDone;
+          }
+          break;
+        default:
+          break;
+      }
+
+      uint32_t startCycles = ESP.getCycleCount();
+      dacAudio.FillBuffer();
+      fillCycles += (uint32_t)(ESP.getCycleCount() - startCycles);
+      loops++;
+
+      nextLoopTick = tick + schedule[scheduleIndex];
+      scheduleIndex = (scheduleIndex + 1) % schedule.size();
+    }
+
+    // ISR call and DAC output of this tick
+    if (timer->Running && timer->Isr != NULL)
+    {
+      timer->Isr();
+    }
+    output.push_back(HostGetDacValue(PIN_DAC));
+    HostAdvanceMicros(TICK_MICROS);
+  }
+
+  // Report
+  AudioTelemetry telemetry = dacAudio.GetTelemetry();
+  printf("Output:            %s (%u samples, %.3f s)\n", outputPath, (unsigned)output.size(), output.size() / 50000.0);
+  printf("Hash:              %08x\n", Hash(output));
+  printf("Loops:             %u\n", loops);
+  printf("Underruns:         %u\n", telemetry.Underruns);
+  printf("Samples dropped:   %u\n", telemetry.SamplesDropped);
+  printf("Buffer min/avg/max:%u/%u/%u\n", telemetry.OccupancyMin, telemetry.OccupancyAvg, telemetry.OccupancyMax);
+  printf("Fill cost:         %.1f host cycles per output sample\n", (double)fillCycles / max(1u, tick));
+  printf("Mix cost:          %u host cycles per mixed sample (smoothed)\n", telemetry.MixCyclesPerSample);
+  for (XT_Synth_Class *synth : synths)
+  {
+    printf("Synth cost:        %u host cycles per sample (budget %u cycles on the ESP32-S2)\n", synth->CyclesPerSample, SYNTH_CYCLE_BUDGET);
+  }
+  printf("ISR max:           %u host cycles\n", telemetry.IsrCyclesMax);
+  printf("ISR histogram:    ");
+  for (uint8_t bin = 0; bin < ISR_HISTOGRAM_BINS; bin++)
+  {
+    printf(" %u", telemetry.IsrHistogram[bin]);
+  }
+  printf("\n");
+
+  if (state != eDone)
+  {
+    fprintf(stderr, "Simulation did not finish within %u ticks\n", MAX_TICKS);
+    return 1;
+  }
+  if (!WriteWav(outputPath, output, 50000))
+  {
+    fprintf(stderr, "Could not write %s\n", outputPath);
+    return 1;
+  }
+
+  // Bit-exact regression check
+  if (comparePath != NULL)
+  {
+    std::vector<uint8_t> reference;
+    if (!ReadWav(comparePath, reference))
+    {
+      fprintf(stderr, "Could not read %s\n", comparePath);
+      return 1;
+    }
+    size_t mismatch = 0;
+    while (mismatch < min(reference.size(), output.size()) && reference[mismatch] == output[mismatch])
+    {
+      mismatch++;
+    }
+    if (reference.size() != output.size() || mismatch != output.size())
+    {
+      printf("Compare:           MISMATCH with %s at sample %u\n", comparePath, (unsigned)mismatch);
+      return 1;
+    }
+    printf("Compare:           bit-exact with %s\n", comparePath);
+  }
+  if (expectedHash != NULL)
+  {
+    if (Hash(output) != (uint32_t)strtoul(expectedHash, NULL, 16))
+    {
+      printf("Compare:           MISMATCH, hash %08x instead of %s\n", Hash(output), expectedHash);
+      return 1;
+    }
+    printf("Compare:           hash matches the reference\n");
+  }
+
+  return 0;
+}
@@ -0,0 +1,507 @@
+/**
+ * Host benchmark of the knock detector
+ *
+ * @author    Florian Staeblein
+ * @date      2026/10/18
+ * @copyright © 2026 Florian Staeblein
+ *
+ * ==============================================================
+ *
+ * Feeds accelerometer traces through KnockDetector.cpp in FIFO
+ * sized batches and compares the detections with the labels of
+ * the trace.
+ *
+ * Usage: KnockBenchmark [options] trace.csv [trace.csv ...]
+ *   -s value    Sensitivity 0 ... 100 (default: 80)
+ *   -b count    Samples per FIFO batch (default: 16)
+ *   -t ratio    Lowest accepted hit rate (default: 0.9)
+ *   -r          Replays the knocks through the rhythm recognizer
+ *               of the sketch and lists the recognized rhythms.
+ *               Fails on a wrong or missed rhythm if the trace
+ *               labels them
+ *   -g file     Writes a synthetic trace with the rhythms of the
+ *               sketch, loose knocks, slams and noise to the file
+ *               and exits
+ *   -c          Checks the rhythm recognizer with fixed knock
+ *               sequences (tempos, jitter, ambiguous timing, stray
+ *               knocks) and exits
+ *
+ * Trace format (CSV): first line "rate,<Hz>", then one line per
+ * sample "x,y,z[,label[,flags]]" in raw LSB (4 mg). Label 1 marks
+ * the onset of a knock, label 2 the onset of a slam that has to be
+ * rejected. Labels from 3 on mark the last knock of a rhythm, 3 +
+ * the index in RhythmTemplates. Traces recorded on the device by TraceRecorder.py also
+ * carry the activity flags of the ADXL345, they are ignored here.
+ *
+ * Exits with 1 if the hit rate is below the limit, a slam or
+ * noise is detected as knock, a labeled rhythm is missed or
+ * another one recognized (-r), or the detector needs more than
+ * KNOCK_CPU_BUDGET of a 240 MHz CPU (host cycles as estimate).
+ *
+ * ==============================================================
+ */
+
+
+//===============================================================
+// Includes
+//===============================================================
+#include <vector>
+#include "Arduino.h"
+#include "KnockDetector.h"
+#include "KnockRhythm.h"
+
+
+//===============================================================
+// Defines
+//===============================================================
+#define MATCH_MS                30        // Detection to label distance
+#define CPU_HZ                  240000000
+#define KNOCK_CPU_BUDGET        0.02      // 2 % of the CPU
+#define LABEL_KNOCK             1
+#define LABEL_SLAM              2
+#define LABEL_RHYTHM            3         // Last knock of a rhythm, plus the template index
+#define RHYTHM_TEMPLATE_COUNT   3
+#define RHYTHM_LOOP_MS          20        // Loop period of the sketch, one FIFO drain (16 samples at 800 Hz)
+
+
+//===============================================================
+// Global definitions
+//===============================================================
+struct Trace
+{
+  uint16_t Rate = 800;
+  std::vector<RawSample> Samples;
+  std::vector<uint8_t> Labels;
+};
+
+// Same templates as the sketch, the reaction is the template index
+const RhythmTemplate* RhythmTemplates[RHYTHM_TEMPLATE_COUNT] = { &Rhythm3x, &RhythmShaveAndHaircut, &Rhythm2Plus2 };
+
+
+//===============================================================
+// Returns true if the label marks a knock
+//===============================================================
+bool IsKnock(uint8_t label)
+{
+  return label == LABEL_KNOCK ||
+    label >= LABEL_RHYTHM;
+}
+
+//===============================================================
+// Reads a CSV trace
+//===============================================================
+bool ReadTrace(const char *path, Trace &trace)
+{
+  FILE *file = fopen(path, "r");
+  if (file == NULL)
+  {
+    return false;
+  }
+
+  char line[128];
+  while (fgets(line, sizeof(line), file) != NULL)
+  {
+    int x, y, z, label = 0;
+    unsigned rate;
+    if (sscanf(line, "rate,%u", &rate) == 1)
+    {
+      trace.Rate = rate;
+    }
+    else if (sscanf(line, "%d,%d,%d,%d", &x, &y, &z, &label) >= 3)
+    {
+      trace.Samples.push_back({ (int16_t)x, (int16_t)y, (int16_t)z });
+      trace.Labels.push_back(label);
+    }
+  }
+  fclose(file);
+  return !trace.Samples.empty();
+}
+
+//===============================================================
+// Adds a damped sine burst to one axis
+//===============================================================
+void AddBurst(Trace &trace, size_t start, int axis, float amplitude, float frequency, float decayMs)
+{
+  size_t length = (size_t)(decayMs * 5 * trace.Rate / 1000);
+  for (size_t index = 0; index < length && start + index < trace.Samples.size(); index++)
+  {
+    float time = (float)index / trace.Rate;
+    float value = amplitude * expf(-time * 1000 / decayMs) * sinf(2 * PI * frequency * time);
+    int16_t *sample = axis == 0 ? &trace.Samples[start + index].XAxis :
+      axis == 1 ? &trace.Samples[start + index].YAxis : &trace.Samples[start + index].ZAxis;
+    *sample = constrain(*sample + (int)value, -4096, 4095);
+  }
+}
+
+//===============================================================
+// Adds a knock of random strength and tone
+//===============================================================
+void AddKnock(Trace &trace, size_t position, uint8_t label)
+{
+  // Light to firm knocks (0.2 ... 0.6 g), mostly on Z
+  float amplitude = 50 + rand() % 100;
+  AddBurst(trace, position, 2, amplitude, 150 + rand() % 150, 4 + rand() % 8);
+  AddBurst(trace, position, 0, amplitude / 4, 200, 5);
+  trace.Labels[position] = label;
+}
+
+//===============================================================
+// Writes a synthetic trace: the rhythms of the sketch at random
+// tempos, loose knocks, slams, slow door motion and sensor noise.
+// All knocks are above the threshold of the default sensitivity,
+// the detector has to find every one of them
+//===============================================================
+bool GenerateTrace(const char *path)
+{
+  Trace trace;
+  trace.Rate = 800;
+  size_t count = trace.Rate * 180;
+  trace.Samples.resize(count);
+  trace.Labels.resize(count, 0);
+  srand(42);
+
+  // Gravity on Z, noise of +-2 LSB and a slow swing of the door
+  for (size_t index = 0; index < count; index++)
+  {
+    float swing = 6 * sinf(2 * PI * 0.3f * index / trace.Rate);
+    trace.Samples[index] = { (int16_t)(rand() % 5 - 2), (int16_t)(rand() % 5 - 2 + swing), (int16_t)(250 + rand() % 5 - 2) };
+  }
+
+  // Groups separated by a pause that starts a new rhythm sequence: a slam, two loose knocks or a rhythm
+  size_t pause = trace.Rate * (RHYTHM_PAUSE_MS + 500) / 1000;
+  size_t start = trace.Rate;
+  while (start + trace.Rate * 5 < count)
+  {
+    int kind = rand() % 6;
+    if (kind == 0)
+    {
+      AddBurst(trace, start, 2, 900 + rand() % 600, 25 + rand() % 20, 120);
+      AddBurst(trace, start, 1, 400, 35, 100);
+      trace.Labels[start] = LABEL_SLAM;
+      start += trace.Rate * 2;
+      continue;
+    }
+    if (kind == 1)
+    {
+      AddKnock(trace, start, LABEL_KNOCK);
+      AddKnock(trace, start + trace.Rate * (150 + rand() % 250) / 1000, LABEL_KNOCK);
+      start += pause;
+      continue;
+    }
+
+    // Beat of 150 ... 300 ms, every interval off by up to 10 %
+    uint8_t index = rand() % RHYTHM_TEMPLATE_COUNT;
+    const RhythmTemplate &rhythm = *RhythmTemplates[index];
+    uint32_t beatMs = 150 + rand() % 150;
+    size_t position = start;
+    for (uint8_t interval = 0; interval < rhythm.IntervalCount; interval++)
+    {
+      AddKnock(trace, position, LABEL_KNOCK);
+      position += trace.Rate * rhythm.Intervals[interval] * beatMs * (90 + rand() % 21) / 100000;
+    }
+    AddKnock(trace, position, LABEL_RHYTHM + index);
+    start = position + pause;
+  }
+
+  FILE *file = fopen(path, "w");
+  if (file == NULL)
+  {
+    return false;
+  }
+  fprintf(file, "rate,%u\n", trace.Rate);
+  for (size_t index = 0; index < count; index++)
+  {
+    const RawSample &sample = trace.Samples[index];
+    fprintf(file, "%d,%d,%d,%u\n", sample.XAxis, sample.YAxis, sample.ZAxis, trace.Labels[index]);
+  }
+  fclose(file);
+  return true;
+}
+
+//===============================================================
+// Rhythm check: knock times, expected template and the longest
+// accepted decision time after the last knock. The sketch gets a
+// knock in the first loop after it, a rhythm decided at its last
+// knock takes up to RHYTHM_LOOP_MS, one that waits for a longer
+// rhythm also the wait
+//===============================================================
+struct RhythmCase
+{
+  const char *Name;
+  std::vector<uint32_t> Taps;
+  uint8_t Expected;             // Template index or RHYTHM_NONE
+  uint32_t DecisionMaxMs;
+};
+
+//===============================================================
+// Checks the rhythm recognizer, returns true if all cases pass
+//===============================================================
+bool CheckRhythms()
+{
+  const RhythmCase cases[] =
+  {
+    { "3x fast", { 0, 100, 200 }, 0, RHYTHM_LOOP_MS },
+    { "3x medium", { 0, 250, 500 }, 0, RHYTHM_LOOP_MS },
+    { "3x slow", { 0, 400, 800 }, 0, RHYTHM_LOOP_MS },
+    { "3x jitter", { 0, 200, 450 }, 0, RHYTHM_LOOP_MS },
+    { "3x 1:2 is no 3x", { 0, 150, 450 }, RHYTHM_NONE, 0 },
+    { "2+2", { 0, 150, 600, 750 }, 2, RHYTHM_LOOP_MS },
+    { "2+2 slow", { 0, 300, 1200, 1500 }, 2, RHYTHM_LOOP_MS },
+    { "Shave and a haircut", { 0, 300, 450, 600, 900, 1500, 1800 }, 1, RHYTHM_LOOP_MS },
+    { "Shave and a haircut slow", { 0, 800, 1200, 1600, 2400, 4000, 4800 }, 1, RHYTHM_LOOP_MS },
+    { "Two knocks", { 0, 200 }, RHYTHM_NONE, 0 },
+    { "Stray knock, 3x", { 0, 700, 900, 1100 }, 0, RHYTHM_LOOP_MS },
+    { "Stray knock, Shave and...", { 0, 500, 800, 950, 1100, 1400, 2000, 2300 }, 1, RHYTHM_LOOP_MS },
+    // Starts like Shave and a haircut (beat 200 ms), waits for its 2 beat interval plus tolerance: 400 + 100 + 10 ms
+    { "Shave and... start is 3x", { 0, 400, 600, 800 }, 0, 510 + RHYTHM_LOOP_MS },
+  };
+
+  KnockRhythm rhythm;
+  for (uint8_t index = 0; index < RHYTHM_TEMPLATE_COUNT; index++)
+  {
+    rhythm.AddTemplate(*RhythmTemplates[index], index);
+  }
+
+  bool passed = true;
+  for (const RhythmCase &check : cases)
+  {
+    // Knocks after a long pause, off the loop phase. The loop runs every RHYTHM_LOOP_MS like the
+    // sketch and adds a knock with its own time in the first loop after it
+    uint32_t offsetMs = 10007;
+    uint32_t lastTapMs = offsetMs + check.Taps.back();
+    uint8_t reaction = RHYTHM_NONE;
+    uint32_t decisionMs = 0;
+    size_t tap = 0;
+    rhythm.Clear();
+    for (uint32_t nowMs = 10000; nowMs < lastTapMs + 3000 && reaction == RHYTHM_NONE; nowMs += RHYTHM_LOOP_MS)
+    {
+      reaction = rhythm.Update(nowMs);
+      if (tap < check.Taps.size() &&
+        offsetMs + check.Taps[tap] <= nowMs)
+      {
+        uint8_t tapReaction = rhythm.AddTap(offsetMs + check.Taps[tap]);
+        reaction = tapReaction != RHYTHM_NONE ? tapReaction : reaction;
+        tap++;
+      }
+      decisionMs = nowMs - lastTapMs;
+    }
+
+    bool ok = reaction == check.Expected &&
+      (reaction == RHYTHM_NONE || (tap == check.Taps.size() && decisionMs <= check.DecisionMaxMs));
+    passed &= ok;
+    printf("  %-26s %-22s ", check.Name, reaction != RHYTHM_NONE ? RhythmTemplates[reaction]->Name : "-");
+    if (reaction != RHYTHM_NONE)
+    {
+      printf("%4u ms (max %4u ms) ", decisionMs, check.DecisionMaxMs);
+    }
+    else
+    {
+      printf("%23s", "");
+    }
+    printf("%s\n", ok ? "ok" : "FAILED");
+  }
+  printf("Rhythm check:      %s\n", passed ? "PASSED" : "FAILED");
+  return passed;
+}
+
+//===============================================================
+// Main
+//===============================================================
+int main(int argc, char **argv)
+{
+  uint8_t sensitivity = 80;
+  uint8_t batch = 16;
+  double minHitRate = 0.9;
+  bool rhythms = false;
+  std::vector<const char *> paths;
+
+  // Parse arguments
+  for (int index = 1; index < argc; index++)
+  {
+    if (strcmp(argv[index], "-s") == 0 && index + 1 < argc)
+    {
+      sensitivity = atoi(argv[++index]);
+    }
+    else if (strcmp(argv[index], "-b") == 0 && index + 1 < argc)
+    {
+      int value = atoi(argv[++index]);
+      batch = constrain(value, 1, ADXL345_FIFO_SIZE);
+    }
+    else if (strcmp(argv[index], "-t") == 0 && index + 1 < argc)
+    {
+      minHitRate = atof(argv[++index]);
+    }
+    else if (strcmp(argv[index], "-r") == 0)
+    {
+      rhythms = true;
+    }
+    else if (strcmp(argv[index], "-c") == 0)
+    {
+      return CheckRhythms() ? 0 : 1;
+    }
+    else if (strcmp(argv[index], "-g") == 0 && index + 1 < argc)
+    {
+      const char *path = argv[++index];
+      if (!GenerateTrace(path))
+      {
+        fprintf(stderr, "Could not write %s\n", path);
+        return 1;
+      }
+      printf("Synthetic trace written to %s\n", path);
+      return 0;
+    }
+    else
+    {
+      paths.push_back(argv[index]);
+    }
+  }
+  if (paths.empty())
+  {
+    fprintf(stderr, "Usage: %s [-s sensitivity] [-b batch] [-t hitrate] [-r] [-c] [-g out.csv] trace.csv [...]\n", argv[0]);
+    return 2;
+  }
+
+  uint32_t knocks = 0, hits = 0, falseKnocks = 0, slams = 0, slamsDetected = 0;
+  uint32_t latencyMax = 0;
+  uint64_t latencySum = 0;
+  uint64_t cycles = 0, samples = 0;
+  uint32_t rate = 0;
+  uint32_t recognized = 0, decisionMax = 0, rhythmsExpected = 0, rhythmsCorrect = 0;
+
+  for (const char *path : paths)
+  {
+    Trace trace;
+    if (!ReadTrace(path, trace))
+    {
+      fprintf(stderr, "Could not read %s\n", path);
+      return 2;
+    }
+    rate = trace.Rate;
+
+    // Label times in ms, the trace starts at 0
+    std::vector<uint32_t> labelTimes;
+    std::vector<uint8_t> labelKinds;
+    std::vector<bool> labelHit;
+    for (size_t index = 0; index < trace.Labels.size(); index++)
+    {
+      if (trace.Labels[index] != 0)
+      {
+        labelTimes.push_back(index * 1000 / trace.Rate);
+        labelKinds.push_back(trace.Labels[index]);
+        labelHit.push_back(false);
+      }
+    }
+
+    // Feed the trace in FIFO batches, the batch is available when its last sample is taken
+    KnockDetector detector(trace.Rate);
+    detector.SetSensitivity(sensitivity);
+
+    KnockRhythm rhythm;
+    for (uint8_t index = 0; index < RHYTHM_TEMPLATE_COUNT; index++)
+    {
+      rhythm.AddTemplate(*RhythmTemplates[index], index);
+    }
+    uint32_t lastTapMs = 0;
+    for (size_t start = 0; start < trace.Samples.size(); start += batch)
+    {
+      uint8_t count = min((size_t)batch, trace.Samples.size() - start);
+      uint32_t nowMs = (start + count - 1) * 1000 / trace.Rate;
+
+      uint32_t startCycles = ESP.getCycleCount();
+      uint8_t found = detector.Process(&trace.Samples[start], count, nowMs);
+      cycles += (uint32_t)(ESP.getCycleCount() - startCycles);
+      samples += count;
+
+      // Rhythm decisions, in the same order as the loop of the sketch
+      if (rhythms)
+      {
+        uint8_t reaction = rhythm.Update(nowMs);
+        if (found > 0)
+        {
+          uint8_t tapReaction = rhythm.AddTap(detector.LastKnock.TimeMs);
+          lastTapMs = detector.LastKnock.TimeMs;
+          reaction = tapReaction != RHYTHM_NONE ? tapReaction : reaction;
+        }
+        if (reaction != RHYTHM_NONE)
+        {
+          uint32_t decision = nowMs - lastTapMs;
+          decisionMax = max(decisionMax, decision);
+          recognized++;
+
+          // Correct if the last knock ends a labeled rhythm of the same template
+          bool correct = false;
+          for (size_t label = 0; label < labelTimes.size(); label++)
+          {
+            if (labelKinds[label] >= LABEL_RHYTHM &&
+              abs((int32_t)(lastTapMs - labelTimes[label])) <= MATCH_MS)
+            {
+              correct = labelKinds[label] - LABEL_RHYTHM == reaction;
+              break;
+            }
+          }
+          rhythmsCorrect += correct;
+          printf("  %8.3f s  %-22s decided %u ms after the last knock%s\n", nowMs / 1000.0, RhythmTemplates[reaction]->Name, decision,
+            correct ? "" : " (not labeled)");
+        }
+      }
+      if (found == 0)
+      {
+        continue;
+      }
+
+      // Match with the nearest label, the time from onset to available result is the latency
+      const KnockEvent &event = detector.LastKnock;
+      uint32_t latency = nowMs - event.TimeMs;
+      latencySum += latency;
+      latencyMax = max(latencyMax, latency);
+
+      bool matched = false;
+      for (size_t label = 0; label < labelTimes.size(); label++)
+      {
+        if (abs((int32_t)(event.TimeMs - labelTimes[label])) <= MATCH_MS)
+        {
+          matched = IsKnock(labelKinds[label]);
+          slamsDetected += labelKinds[label] == LABEL_SLAM;
+          labelHit[label] = true;
+          break;
+        }
+      }
+      hits += matched;
+      falseKnocks += !matched;
+    }
+
+    for (size_t label = 0; label < labelTimes.size(); label++)
+    {
+      knocks += IsKnock(labelKinds[label]);
+      slams += labelKinds[label] == LABEL_SLAM;
+      rhythmsExpected += labelKinds[label] >= LABEL_RHYTHM;
+    }
+    printf("%-30s %u samples at %u Hz, %u knocks found, %u rejected\n", path, (unsigned)trace.Samples.size(), trace.Rate, detector.Knocks, detector.Rejected);
+  }
+
+  // Report
+  double hitRate = knocks > 0 ? (double)hits / knocks : 1.0;
+  double cyclesPerSample = samples > 0 ? (double)cycles / samples : 0;
+  double cpu = cyclesPerSample * rate / CPU_HZ;
+  printf("Sensitivity:       %u, batch %u samples\n", sensitivity, batch);
+  printf("Knocks:            %u of %u found (hit rate %.1f %%)\n", hits, knocks, hitRate * 100);
+  printf("False knocks:      %u (%u of %u slams)\n", falseKnocks, slamsDetected, slams);
+  printf("Latency:           %.1f ms average, %u ms max (onset to result, including the batch)\n", hits + falseKnocks > 0 ? (double)latencySum / (hits + falseKnocks) : 0.0, latencyMax);
+  if (rhythms)
+  {
+    printf("Rhythms:           %u recognized, %u of %u labeled ones, decided at most %u ms after the last knock\n",
+      recognized, rhythmsCorrect, rhythmsExpected, decisionMax);
+  }
+  printf("Cost:              %.1f host cycles per sample, %.3f %% of a 240 MHz CPU at %u Hz\n", cyclesPerSample, cpu * 100, rate);
+
+  bool passed = hitRate >= minHitRate && falseKnocks == 0 && cpu <= KNOCK_CPU_BUDGET;
+
+  // Traces with labeled rhythms: every one recognized as its template, nothing else
+  if (rhythms &&
+    rhythmsExpected > 0)
+  {
+    passed &= rhythmsCorrect == rhythmsExpected && recognized == rhythmsCorrect;
+  }
+  printf("Result:            %s\n", passed ? "PASSED" : "FAILED");
+  return passed ? 0 : 1;
+}
@@ -0,0 +1,130 @@
+/**
+ * Minimal Arduino API for host builds of the sketch modules
+ *
+ * @author    Florian Staeblein
+ * @date      2026/10/18
+ * @copyright © 2026 Florian Staeblein
+ */
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+//===============================================================
+// Includes
+//===============================================================
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <string>
+
+
+//===============================================================
+// Defines
+//===============================================================
+#define IRAM_ATTR
+#define ARDUINO_ISR_ATTR
+#define PROGMEM
+
+#define INPUT                   0x01
+#define OUTPUT                  0x03
+#define ANALOG                  0xC0
+#define LOW                     0
+#define HIGH                    1
+
+#define PI                      3.1415926535897932384626433832795
+
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+// Single core target, critical sections are no-ops on the host
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED  0
+#define portENTER_CRITICAL(mux)       (void)(mux)
+#define portEXIT_CRITICAL(mux)        (void)(mux)
+#define portENTER_CRITICAL_ISR(mux)   (void)(mux)
+#define portEXIT_CRITICAL_ISR(mux)    (void)(mux)
+
+// FreeRTOS handles, the host builds never create tasks or queues
+typedef void* QueueHandle_t;
+
+using std::min;
+using std::max;
+
+
+//===============================================================
+// Arduino String, backed by std::string
+//===============================================================
+class String : public std::string
+{
+  public:
+    String() { }
+    String(const char *value) : std::string(value) { }
+    String(const std::string &value) : std::string(value) { }
+    String(int value) : std::string(std::to_string(value)) { }
+    String(unsigned int value) : std::string(std::to_string(value)) { }
+    String(long value) : std::string(std::to_string(value)) { }
+    String(unsigned long value) : std::string(std::to_string(value)) { }
+    String(double value, int decimals = 2)
+    {
+      char buffer[32];
+      snprintf(buffer, sizeof(buffer), "%.*f", decimals, value);
+      assign(buffer);
+    }
+
+    bool startsWith(const char *prefix) const { return rfind(prefix, 0) == 0; }
+};
+
+
+//===============================================================
+// Serial output to stderr
+//===============================================================
+class HardwareSerial
+{
+  public:
+    void begin(unsigned long) { }
+    int available() { return 0; }
+    String readString() { return String(); }
+    void print(const String &value) { fputs(value.c_str(), stderr); }
+    void print(const char *value) { fputs(value, stderr); }
+    void print(long value) { fprintf(stderr, "%ld", value); }
+    void print(double value) { fprintf(stderr, "%.2f", value); }
+    template <typename T> void println(const T &value) { print(value); println(); }
+    void println() { fputc('\n', stderr); }
+};
+extern HardwareSerial Serial;
+
+
+//===============================================================
+// CPU cycle counter (host time stamp counter)
+//===============================================================
+class EspClass
+{
+  public:
+    uint32_t getCycleCount();
+};
+extern EspClass ESP;
+
+
+//===============================================================
+// Simulated time and pins, implemented in HostArduino.cpp
+//===============================================================
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+long random(long max);
+long random(long min, long max);
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+void dacWrite(uint8_t pin, uint8_t value);
+
+// Advances the simulated clock
+void HostAdvanceMicros(uint64_t us);
+
+// Returns the last value written to a DAC pin
+uint8_t HostGetDacValue(uint8_t pin);
+
+#endif
@@ -0,0 +1,74 @@
+/**
+ * File system on top of a host directory for host builds of the sketch modules
+ *
+ * @author    Florian Staeblein
+ * @date      2026/10/18
+ * @copyright © 2026 Florian Staeblein
+ */
+
+#ifndef HOST_FS_H
+#define HOST_FS_H
+
+#include "Arduino.h"
+
+namespace fs
+{
+  //===============================================================
+  // File, backed by a stdio stream
+  //===============================================================
+  class File
+  {
+    public:
+      File(FILE *file = NULL) : _file(file) { }
+
+      operator bool() const { return _file != NULL; }
+      size_t read(uint8_t *buffer, size_t length) { return _file ? fread(buffer, 1, length, _file) : 0; }
+      size_t write(const uint8_t *buffer, size_t length) { return _file ? fwrite(buffer, 1, length, _file) : 0; }
+      bool seek(uint32_t position) { return _file && fseek(_file, position, SEEK_SET) == 0; }
+      size_t position() const { return _file ? ftell(_file) : 0; }
+      size_t size() const
+      {
+        if (!_file)
+        {
+          return 0;
+        }
+        long position = ftell(_file);
+        fseek(_file, 0, SEEK_END);
+        long size = ftell(_file);
+        fseek(_file, position, SEEK_SET);
+        return size;
+      }
+      void close()
+      {
+        if (_file)
+        {
+          fclose(_file);
+        }
+        _file = NULL;
+      }
+
+    private:
+      FILE *_file;
+  };
+
+  //===============================================================
+  // File system, paths are relative to Root
+  //===============================================================
+  class FS
+  {
+    public:
+      std::string Root = ".";
+
+      bool begin(bool formatOnFail = false) { return true; }
+      File open(const char *path, const char *mode = "r") { return File(fopen((Root + path).c_str(), mode[0] == 'r' ? "rb" : "wb")); }
+      File open(const String &path, const char *mode = "r") { return open(path.c_str(), mode); }
+      bool exists(const char *path) { File file = open(path); bool found = file; file.close(); return found; }
+      bool exists(const String &path) { return exists(path.c_str()); }
+      size_t totalBytes() { return 0; }
+      size_t usedBytes() { return 0; }
+  };
+}
+
+using fs::File;
+
+#endif
@@ -0,0 +1,2 @@
+// Serial is declared in Arduino.h for host builds
+#include "Arduino.h"
@@ -0,0 +1,152 @@
+/**
+ * Minimal Arduino API for host builds of the sketch modules
+ *
+ * @author    Florian Staeblein
+ * @date      2026/10/18
+ * @copyright © 2026 Florian Staeblein
+ */
+
+
+//===============================================================
+// Includes
+//===============================================================
+#include <time.h>
+#include "Arduino.h"
+#include "esp32-hal-timer.h"
+#include "SPIFFS.h"
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+
+//===============================================================
+// Global variables
+//===============================================================
+HardwareSerial Serial;
+EspClass ESP;
+fs::FS SPIFFS;
+
+uint64_t HostMicros = 0;          // Simulated time since start
+uint8_t DacValues[256];           // Last value per DAC pin
+hw_timer_t HostTimer;             // The one simulated timer
+
+//===============================================================
+// CPU cycle counter, host time stamp counter or nanoseconds
+//===============================================================
+uint32_t EspClass::getCycleCount()
+{
+#if defined(__x86_64__) || defined(__i386__)
+  return (uint32_t)__rdtsc();
+#else
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint32_t)(now.tv_sec * 1000000000ULL + now.tv_nsec);
+#endif
+}
+
+//===============================================================
+// Simulated time
+//===============================================================
+uint32_t millis()
+{
+  return HostMicros / 1000;
+}
+
+uint32_t micros()
+{
+  return HostMicros;
+}
+
+void delay(uint32_t ms)
+{
+  HostMicros += ms * 1000ULL;
+}
+
+void delayMicroseconds(uint32_t us)
+{
+  HostMicros += us;
+}
+
+void HostAdvanceMicros(uint64_t us)
+{
+  HostMicros += us;
+}
+
+long random(long max)
+{
+  return max > 0 ? rand() % max : 0;
+}
+
+long random(long min, long max)
+{
+  return min + random(max - min);
+}
+
+//===============================================================
+// Simulated pins
+//===============================================================
+void pinMode(uint8_t pin, uint8_t mode)
+{
+}
+
+void digitalWrite(uint8_t pin, uint8_t value)
+{
+}
+
+int digitalRead(uint8_t pin)
+{
+  return LOW;
+}
+
+void dacWrite(uint8_t pin, uint8_t value)
+{
+  DacValues[pin] = value;
+}
+
+uint8_t HostGetDacValue(uint8_t pin)
+{
+  return DacValues[pin];
+}
+
+//===============================================================
+// Simulated timer
+//===============================================================
+hw_timer_t *timerBegin(uint32_t frequency)
+{
+  HostTimer.Frequency = frequency;
+  HostTimer.AlarmValue = 0;
+  HostTimer.Running = false;
+  HostTimer.Isr = NULL;
+  return &HostTimer;
+}
+
+void timerEnd(hw_timer_t *timer)
+{
+  timer->Running = false;
+  timer->Isr = NULL;
+}
+
+void timerAttachInterrupt(hw_timer_t *timer, void (*isr)())
+{
+  timer->Isr = isr;
+}
+
+void timerStart(hw_timer_t *timer)
+{
+  timer->Running = true;
+}
+
+void timerStop(hw_timer_t *timer)
+{
+  timer->Running = false;
+}
+
+void timerAlarm(hw_timer_t *timer, uint64_t value, bool autoReload, uint64_t reloadCount)
+{
+  timer->AlarmValue = value;
+}
+
+hw_timer_t *HostGetTimer()
+{
+  return &HostTimer;
+}
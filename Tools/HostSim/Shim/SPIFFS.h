@@ -0,0 +1,4 @@
+// SPIFFS maps to a host directory for host builds
+#include "FS.h"
+
+extern fs::FS SPIFFS;
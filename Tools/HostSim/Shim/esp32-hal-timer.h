@@ -0,0 +1,35 @@
+/**
+ * Simulated hardware timer for host builds of the sketch modules
+ *
+ * @author    Florian Staeblein
+ * @date      2026/10/18
+ * @copyright © 2026 Florian Staeblein
+ */
+
+#ifndef HOST_ESP32_HAL_TIMER_H
+#define HOST_ESP32_HAL_TIMER_H
+
+#include "Arduino.h"
+
+//===============================================================
+// Simulated timer, the host driver calls the ISR
+//===============================================================
+typedef struct hw_timer_s
+{
+  uint32_t Frequency;
+  uint64_t AlarmValue;
+  bool Running;
+  void (*Isr)();
+} hw_timer_t;
+
+hw_timer_t *timerBegin(uint32_t frequency);
+void timerEnd(hw_timer_t *timer);
+void timerAttachInterrupt(hw_timer_t *timer, void (*isr)());
+void timerStart(hw_timer_t *timer);
+void timerStop(hw_timer_t *timer);
+void timerAlarm(hw_timer_t *timer, uint64_t value, bool autoReload, uint64_t reloadCount);
+
+// Returns the last timer created by timerBegin
+hw_timer_t *HostGetTimer();
+
+#endif
@@ -0,0 +1,357 @@
+#!/usr/bin/env python3
+"""
+Generates the flash resident sound bank from WAV files
+
+@author    Florian Staeblein
+@date      2026/10/18
+@copyright © 2026 Florian Staeblein
+
+Usage:
+  python3 Tools/SoundBankGenerator.py [Sounds/SoundBank.json]
+
+The manifest lists all clips of the sound bank. Every clip is read
+from its WAV file, converted to mono and prepared:
+  - "TrimThreshold": silence at both ends below this 16 bit level is
+    cut off, "TrimPadMs" of it is kept to not clip the attack
+  - "NormalizePeak": the peak is scaled to this fraction of full
+    scale (null keeps the level)
+  - "SampleRate": the clip is resampled to this rate (null keeps the
+    rate of the WAV file)
+These settings are given for the whole bank and can be overridden per
+clip. The clip is then appended to one constant data array, either as
+8 bit unsigned PCM or as 4 bit IMA-ADPCM ("Format": "ADPCM4", half
+the flash of PCM). A clip table (offset, length, sample rate, format)
+indexes the array, so the firmware never copies sound data to RAM.
+The clip lengths are derived from the encoded data, there are no
+hand maintained lengths. The generated header checks the clip table
+against the data with static_asserts, using the clip size of the
+firmware decoder (SoundClipSize in XT_DAC_Audio.h).
+
+The report shows the latency to the first audible sample of the
+WAV file and of the generated clip, measured on the samples. Trim
+only shortens it if the file starts with more silence than the pad.
+
+Run this script (or "make -C Tools/HostSim soundbank") before
+building the sketch whenever a WAV file or the manifest changes.
+"""
+
+import json
+import os
+import sys
+import wave
+
+
+#===============================================================
+# Defines
+#===============================================================
+DEFAULT_MANIFEST = os.path.join(os.path.dirname(__file__), "..", "Sounds", "SoundBank.json")
+VALUES_PER_LINE = 20
+
+# IMA-ADPCM tables, identical to the decoder in XT_DAC_Audio.cpp
+ADPCM_INDEX_TABLE = [-1, -1, -1, -1, 2, 4, 6, 8, -1, -1, -1, -1, 2, 4, 6, 8]
+ADPCM_STEP_TABLE = [
+  7, 8, 9, 10, 11, 12, 13, 14, 16, 17,
+  19, 21, 23, 25, 28, 31, 34, 37, 41, 45,
+  50, 55, 60, 66, 73, 80, 88, 97, 107, 118,
+  130, 143, 157, 173, 190, 209, 230, 253, 279, 307,
+  337, 371, 408, 449, 494, 544, 598, 658, 724, 796,
+  876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+  2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358,
+  5894, 6484, 7132, 7845, 8630, 9493, 10442, 11487, 12635, 13899,
+  15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767]
+
+FORMATS = ["PCM8", "ADPCM4"]
+DAC_RATE = 50000
+
+# Defaults of the clip preparation, overridden by the manifest
+DEFAULT_SETTINGS = {
+  "TrimThreshold": 512,
+  "TrimPadMs": 5,
+  "NormalizePeak": None,
+  "SampleRate": None,
+}
+
+
+#===============================================================
+# Reads a WAV file and returns (sample rate, 16 bit signed mono samples)
+#===============================================================
+def ReadWav(path):
+  with wave.open(path, "rb") as wav:
+    channels = wav.getnchannels()
+    width = wav.getsampwidth()
+    rate = wav.getframerate()
+    frames = wav.readframes(wav.getnframes())
+
+  if width not in (1, 2):
+    raise ValueError(f"{path}: {width * 8} bit samples are not supported")
+
+  # Convert every frame to a signed 16 bit value, mixing down all channels
+  samples = []
+  frameSize = width * channels
+  for index in range(0, len(frames), frameSize):
+    total = 0
+    for channel in range(channels):
+      position = index + channel * width
+      if width == 1:
+        total += (frames[position] - 128) << 8
+      else:
+        total += int.from_bytes(frames[position:position + 2], "little", signed=True)
+    samples.append(total // channels)
+
+  return rate, samples
+
+
+#===============================================================
+# Cuts silence below the threshold at both ends, keeps a pad
+#===============================================================
+def TrimSilence(samples, threshold, pad):
+  loud = [index for index, value in enumerate(samples) if abs(value) >= threshold]
+  if not loud:
+    return []
+  start = max(0, loud[0] - pad)
+  end = min(len(samples), loud[-1] + 1 + pad)
+  return samples[start:end]
+
+
+#===============================================================
+# Scales the samples so the peak is the given fraction of full scale
+#===============================================================
+def Normalize(samples, peak):
+  current = max((abs(value) for value in samples), default=0)
+  if current == 0:
+    return samples
+  scale = peak * 32767 / current
+  return [min(32767, max(-32768, round(value * scale))) for value in samples]
+
+
+#===============================================================
+# Resamples with linear interpolation, averages over the source
+# samples of one output sample when the rate goes down
+#===============================================================
+def Resample(samples, rate, newRate):
+  if rate == newRate or not samples:
+    return samples
+
+  ratio = rate / newRate
+  if ratio > 1:
+    # Box filter over one output period against aliasing
+    width = int(ratio)
+    total = 0
+    filtered = []
+    for index, value in enumerate(samples):
+      total += value
+      if index >= width:
+        total -= samples[index - width]
+      filtered.append(total // min(index + 1, width))
+    # Compensate the group delay of the filter
+    samples = filtered[(width - 1) // 2:] + [filtered[-1]] * ((width - 1) // 2)
+
+  length = int((len(samples) - 1) / ratio) + 1
+  result = []
+  for index in range(length):
+    position = index * ratio
+    base = int(position)
+    fraction = position - base
+    following = samples[min(base + 1, len(samples) - 1)]
+    result.append(round(samples[base] + (following - samples[base]) * fraction))
+  return result
+
+
+#===============================================================
+# Returns the encoded size in bytes of a clip
+#===============================================================
+def EncodedSize(length, format):
+  if format == "ADPCM4":
+    # Header with the first sample, then one nibble per further sample
+    return 4 + length // 2
+  return length
+
+
+#===============================================================
+# Encodes 16 bit samples as 8 bit unsigned PCM, as played by the DAC
+#===============================================================
+def EncodePcm8(samples):
+  return bytes(min(255, max(0, (value >> 8) + 128)) for value in samples)
+
+
+#===============================================================
+# Encodes 16 bit samples as IMA-ADPCM
+#
+# Header: first sample as predictor (int16), step index, reserved.
+# Every further sample is one nibble, low nibble first.
+#===============================================================
+def EncodeAdpcm4(samples):
+  predictor = samples[0] if samples else 0
+  index = 0
+  data = bytearray(predictor.to_bytes(2, "little", signed=True) + bytes([index, 0]))
+
+  codes = []
+  for value in samples[1:]:
+    step = ADPCM_STEP_TABLE[index]
+    diff = value - predictor
+    code = 0
+    if diff < 0:
+      code = 8
+      diff = -diff
+
+    # Quantize exactly the way the decoder expands
+    delta = step >> 3
+    if diff >= step:
+      code |= 4
+      diff -= step
+      delta += step
+    if diff >= step >> 1:
+      code |= 2
+      diff -= step >> 1
+      delta += step >> 1
+    if diff >= step >> 2:
+      code |= 1
+      delta += step >> 2
+
+    predictor += -delta if code & 8 else delta
+    predictor = min(32767, max(-32768, predictor))
+    index = min(88, max(0, index + ADPCM_INDEX_TABLE[code]))
+    codes.append(code)
+
+  for position in range(0, len(codes), 2):
+    high = codes[position + 1] if position + 1 < len(codes) else 0
+    data.append(codes[position] | (high << 4))
+
+  return bytes(data)
+
+
+#===============================================================
+# Formats a byte array as C initializer lines
+#===============================================================
+def FormatBytes(data):
+  lines = []
+  for index in range(0, len(data), VALUES_PER_LINE):
+    lines.append("  " + ", ".join(str(value) for value in data[index:index + VALUES_PER_LINE]) + ",")
+  return "\n".join(lines)
+
+
+#===============================================================
+# Generates the sound bank header
+#===============================================================
+def Generate(manifestPath):
+  with open(manifestPath, "r", encoding="utf-8") as file:
+    manifest = json.load(file)
+
+  baseDir = os.path.dirname(os.path.abspath(manifestPath))
+  outputPath = os.path.join(baseDir, manifest["Output"])
+
+  data = bytearray()
+  clips = []
+  sourceBytes = 0
+  for clip in manifest["Clips"]:
+    settings = dict(DEFAULT_SETTINGS)
+    settings.update({key: value for key, value in manifest.items() if key in DEFAULT_SETTINGS})
+    settings.update({key: value for key, value in clip.items() if key in DEFAULT_SETTINGS})
+
+    rate, samples = ReadWav(os.path.join(baseDir, clip["File"]))
+    sourceLength, sourceRate = len(samples), rate
+    pad = int(rate * settings["TrimPadMs"] / 1000)
+    lead = next((index for index, value in enumerate(samples) if abs(value) >= settings["TrimThreshold"]), 0)
+
+    # Prepare the clip, trim first to resample and normalize the clip only
+    samples = TrimSilence(samples, settings["TrimThreshold"], pad)
+    if settings["SampleRate"]:
+      samples = Resample(samples, rate, settings["SampleRate"])
+      rate = settings["SampleRate"]
+    if settings["NormalizePeak"]:
+      samples = Normalize(samples, settings["NormalizePeak"])
+
+    if rate > DAC_RATE:
+      raise ValueError(f"{clip['File']}: sample rate {rate} Hz is above the DAC rate of {DAC_RATE} Hz")
+    if not samples:
+      raise ValueError(f"{clip['File']}: clip is silent")
+
+    format = clip.get("Format", "PCM8")
+    if format not in FORMATS:
+      raise ValueError(f"{clip['File']}: unknown format {format}")
+    encoded = EncodeAdpcm4(samples) if format == "ADPCM4" else EncodePcm8(samples)
+
+    # Statistics: duration and latency to the first audible sample before and after, both measured
+    trimmedLead = next((index for index, value in enumerate(samples) if abs(value) >= settings["TrimThreshold"]), 0)
+    stats = (sourceLength / sourceRate, trimmedLead * 1000 / rate, lead * 1000 / sourceRate)
+    clips.append((clip["Name"], len(data), len(samples), rate, format, len(encoded), *stats))
+    sourceBytes += EncodedSize(sourceLength, format)
+    data += encoded
+
+  lines = []
+  lines.append("/**")
+  lines.append(" * Flash resident sound bank")
+  lines.append(" *")
+  lines.append(" * Generated by Tools/SoundBankGenerator.py from Sounds/" + os.path.basename(manifestPath) + ", do not edit!")
+  lines.append(" */")
+  lines.append("")
+  lines.append("#ifndef SOUNDBANK_H")
+  lines.append("#define SOUNDBANK_H")
+  lines.append("")
+  lines.append("//===============================================================")
+  lines.append("// Includes")
+  lines.append("//===============================================================")
+  lines.append("#include <Arduino.h>")
+  lines.append("#include \"XT_DAC_Audio.h\"")
+  lines.append("")
+  lines.append("")
+  lines.append("//===============================================================")
+  lines.append("// Clip indices")
+  lines.append("//===============================================================")
+  lines.append("enum eSoundClips")
+  lines.append("{")
+  for index, (name, offset, length, rate, format, size, *stats) in enumerate(clips):
+    lines.append(f"  SoundClip_{name}" + (" = 0," if index == 0 else ","))
+  lines.append("  SOUNDCLIPS_COUNT")
+  lines.append("};")
+  lines.append("")
+  lines.append("//===============================================================")
+  lines.append("// Clip names")
+  lines.append("//===============================================================")
+  lines.append("const char* const SoundClipNames[SOUNDCLIPS_COUNT] =")
+  lines.append("{")
+  for name, offset, length, rate, format, size, *stats in clips:
+    lines.append(f"  \"{name}\",")
+  lines.append("};")
+  lines.append("")
+  lines.append("//===============================================================")
+  lines.append("// Clip table (offset, length, sample rate, format)")
+  lines.append("//===============================================================")
+  lines.append("constexpr SoundClip SoundBankClips[SOUNDCLIPS_COUNT] =")
+  lines.append("{")
+  for name, offset, length, rate, format, size, *stats in clips:
+    lines.append(f"  {{ {offset}, {length}, {rate}, SoundFormat_{format} }}, // {name}")
+  lines.append("};")
+  lines.append("")
+  lines.append("//===============================================================")
+  lines.append(f"// Sample data of all clips ({len(data)} bytes)")
+  lines.append("//===============================================================")
+  lines.append(f"const uint8_t SoundBankData[{len(data)}] PROGMEM =")
+  lines.append("{")
+  lines.append(FormatBytes(data))
+  lines.append("};")
+  lines.append("")
+  lines.append("//===============================================================")
+  lines.append("// Every clip ends where the next one starts, the last one at the")
+  lines.append("// end of the data, with the clip size of the decoder")
+  lines.append("//===============================================================")
+  for index, (name, offset, length, rate, format, size, *stats) in enumerate(clips):
+    end = f"SoundBankClips[SoundClip_{clips[index + 1][0]}].Offset" if index + 1 < len(clips) else "sizeof(SoundBankData)"
+    lines.append(f"static_assert(SoundBankClips[SoundClip_{name}].Offset + SoundClipSize(SoundBankClips[SoundClip_{name}]) == {end}, \"{name}: clip table does not match the sound data\");")
+  lines.append("")
+  lines.append("#endif")
+
+  with open(outputPath, "w", encoding="utf-8", newline="\n") as file:
+    file.write("\n".join(lines) + "\n")
+
+  for name, offset, length, rate, format, size, sourceDuration, leadMs, sourceLeadMs in clips:
+    print(f"{name:16} {length:8} samples  {rate:6} Hz  {length / rate:6.3f} s (was {sourceDuration:6.3f} s)  "
+      f"first sound {leadMs:5.1f} ms (was {sourceLeadMs:5.1f} ms)  {format:6} {size:8} bytes")
+  print(f"Sound bank: {len(data)} bytes (untrimmed {sourceBytes} bytes) -> {os.path.normpath(outputPath)}")
+
+
+#===============================================================
+# Main
+#===============================================================
+if __name__ == "__main__":
+  Generate(sys.argv[1] if len(sys.argv) > 1 else DEFAULT_MANIFEST)
@@ -0,0 +1,236 @@
+#!/usr/bin/env python3
+"""
+Records accelerometer traces streamed by the sketch
+
+@author    Florian Staeblein
+@date      2026/10/18
+@copyright © 2026 Florian Staeblein
+
+Usage:
+  python3 Tools/TraceRecorder.py [options] PORT out.csv
+  python3 Tools/TraceRecorder.py [options] --raw capture.bin out.csv
+
+Options:
+  --seconds N     Stops after N seconds (default: until Ctrl+C)
+  --tap-labels    Labels the sample frames with a tap flag of the
+                  ADXL345 logic as knocks (label 1), as reference
+                  for the software detector
+  --save-raw FILE Keeps a copy of the received bytes
+
+Sends "t" to the sketch, which starts streaming the FIFO samples in
+binary frames (see ESP32S2_ShyGuy/TraceCapture.h), and "t" again on
+exit. Text output of the sketch in between is printed. The frames
+are written as CSV trace in the format of KnockBenchmark:
+  rate,<Hz>
+  x,y,z,label,flags
+Missing frames (checksum errors, drops on the device) are filled
+with the last sample and reported, so the time base stays intact.
+
+Replay the traces with Tools/HostSim/KnockBenchmark, e.g.
+  Tools/HostSim/KnockBenchmark -r traces/*.csv
+
+Serial ports need pyserial (pip install pyserial).
+"""
+
+import sys
+import time
+
+
+#===============================================================
+# Defines
+#===============================================================
+TRACE_SYNC = 0xA5
+TRACE_VERSION = 1
+TRACE_TYPE_HEADER = ord("H")
+TRACE_TYPE_SAMPLES = ord("S")
+TRACE_FLAG_TAP = 0x01
+LABEL_KNOCK = 1
+BAUD_RATE = 115200
+
+
+#===============================================================
+# Splits a byte stream into frames and text
+#===============================================================
+class FrameDecoder:
+  def __init__(self):
+    self.Buffer = bytearray()
+    self.Text = bytearray()
+    self.Errors = 0
+
+  # Adds received bytes, returns a list of (type, payload)
+  def Feed(self, data):
+    self.Buffer += data
+    frames = []
+    while self.Buffer:
+      # Text up to the next sync byte
+      if self.Buffer[0] != TRACE_SYNC:
+        end = self.Buffer.find(bytes([TRACE_SYNC]))
+        end = len(self.Buffer) if end < 0 else end
+        self.Text += self.Buffer[:end]
+        del self.Buffer[:end]
+        continue
+
+      if len(self.Buffer) < 3 or len(self.Buffer) < self.Buffer[2] + 4:
+        break
+      frameType, length = self.Buffer[1], self.Buffer[2]
+      payload = bytes(self.Buffer[3:3 + length])
+      if (frameType + length + sum(payload)) & 0xFF != self.Buffer[3 + length]:
+        # Broken frame, resync at the next sync byte
+        self.Errors += 1
+        del self.Buffer[:1]
+        continue
+
+      frames.append((frameType, payload))
+      del self.Buffer[:length + 4]
+    return frames
+
+  # Returns the complete text lines received so far
+  def Lines(self):
+    lines = []
+    while b"\n" in self.Text:
+      line, _, rest = self.Text.partition(b"\n")
+      lines.append(line.decode("ascii", "replace").rstrip("\r"))
+      self.Text = bytearray(rest)
+    return lines
+
+
+#===============================================================
+# Collects the samples of the frames into a continuous trace
+#===============================================================
+class TraceWriter:
+  def __init__(self, tapLabels):
+    self.TapLabels = tapLabels
+    self.Rate = 0
+    self.Samples = []
+    self.LastTime = None
+    self.Missing = 0
+
+  def Add(self, frameType, payload):
+    if frameType == TRACE_TYPE_HEADER and len(payload) >= 3:
+      rate = int.from_bytes(payload[0:2], "little")
+      if payload[2] != TRACE_VERSION:
+        print(f"Warning: trace version {payload[2]}, expected {TRACE_VERSION}")
+      if self.Rate and rate != self.Rate:
+        raise ValueError(f"Sample rate changed from {self.Rate} to {rate} Hz")
+      self.Rate = rate
+      return
+
+    if frameType != TRACE_TYPE_SAMPLES or len(payload) < 6 or self.Rate == 0:
+      return
+    timeMs = int.from_bytes(payload[0:4], "little")
+    flags, count = payload[4], payload[5]
+    samples = []
+    for index in range(count):
+      offset = 6 + index * 6
+      samples.append(tuple(int.from_bytes(payload[offset + axis * 2:offset + axis * 2 + 2], "little", signed=True) for axis in range(3)))
+
+    # Fill a gap (dropped frames) with the last sample, the time of a frame is the time of its last sample
+    if self.LastTime is not None and self.Samples:
+      expected = (timeMs - self.LastTime) * self.Rate // 1000
+      gap = expected - count
+      if 8 < gap < self.Rate * 10:
+        self.Missing += gap
+        last = self.Samples[-1]
+        self.Samples += [[last[0], last[1], last[2], 0, 0]] * gap
+    self.LastTime = timeMs
+
+    # The tap flag marks the sample with the strongest change of the frame
+    label = 0
+    strongest = 0
+    if flags & TRACE_FLAG_TAP and self.TapLabels:
+      label = LABEL_KNOCK
+      previous = self.Samples[-1] if self.Samples else samples[0]
+      change = 0
+      for index, sample in enumerate(samples):
+        delta = sum(abs(sample[axis] - previous[axis]) for axis in range(3))
+        if delta > change:
+          change, strongest = delta, index
+        previous = sample
+
+    for index, sample in enumerate(samples):
+      self.Samples.append([sample[0], sample[1], sample[2], label if index == strongest else 0, flags if index == count - 1 else 0])
+
+  def Write(self, path):
+    with open(path, "w") as file:
+      file.write(f"rate,{self.Rate}\n")
+      for sample in self.Samples:
+        file.write(",".join(str(value) for value in sample) + "\n")
+
+
+#===============================================================
+# Opens the serial port or the raw capture file
+#===============================================================
+def OpenSource(port, raw):
+  if raw:
+    return open(port, "rb"), None
+  try:
+    import serial
+  except ImportError:
+    sys.exit("pyserial is missing: pip install pyserial")
+  connection = serial.Serial(port, BAUD_RATE, timeout=0.1)
+  connection.write(b"t")
+  return connection, connection
+
+
+#===============================================================
+# Records until the time is up, the input ends or Ctrl+C
+#===============================================================
+def Record(port, output, raw=False, seconds=None, tapLabels=False, saveRaw=None):
+  source, connection = OpenSource(port, raw)
+  decoder = FrameDecoder()
+  writer = TraceWriter(tapLabels)
+  rawFile = open(saveRaw, "wb") if saveRaw else None
+  start = time.time()
+
+  try:
+    while seconds is None or time.time() - start < seconds:
+      data = source.read(4096)
+      if not data:
+        if raw:
+          break
+        continue
+      if rawFile:
+        rawFile.write(data)
+      for frameType, payload in decoder.Feed(data):
+        writer.Add(frameType, payload)
+      for line in decoder.Lines():
+        print(line)
+  except KeyboardInterrupt:
+    pass
+  finally:
+    if connection:
+      connection.write(b"t")
+      connection.close()
+    else:
+      source.close()
+    if rawFile:
+      rawFile.close()
+
+  if writer.Rate == 0:
+    sys.exit("No trace header received, is the sketch built with KNOCK_DETECTOR_DSP?")
+  writer.Write(output)
+  duration = len(writer.Samples) / writer.Rate
+  labels = sum(1 for sample in writer.Samples if sample[3])
+  print(f"{output}: {len(writer.Samples)} samples at {writer.Rate} Hz ({duration:.1f} s), {labels} labels")
+  print(f"Checksum errors: {decoder.Errors}, missing samples filled: {writer.Missing}")
+
+
+if __name__ == "__main__":
+  arguments = sys.argv[1:]
+  options = {}
+  positional = []
+  while arguments:
+    argument = arguments.pop(0)
+    if argument == "--seconds":
+      options["seconds"] = float(arguments.pop(0))
+    elif argument == "--tap-labels":
+      options["tapLabels"] = True
+    elif argument == "--save-raw":
+      options["saveRaw"] = arguments.pop(0)
+    elif argument == "--raw":
+      options["raw"] = True
+    else:
+      positional.append(argument)
+  if len(positional) != 2:
+    sys.exit(__doc__)
+  Record(positional[0], positional[1], **options)